@@ -0,0 +1,257 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SESSIONMANAGER_ACTORPLACEMENT_HPP
+#define SESSIONMANAGER_ACTORPLACEMENT_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <caf/actor_registry.hpp>
+#include <caf/actor_system.hpp>
+#include <caf/default_enum_inspect.hpp>
+#include <caf/io/middleman.hpp>
+
+#include "Logger/Logger.hpp"
+
+namespace session_manager
+{
+
+/**
+ * @enum PlacementMode
+ * @brief Describes on which node an actor of the session lives.
+ */
+enum class PlacementMode : uint8_t
+{
+	Local,    // Spawned in this process, only reachable from this node
+	Publish,  // Spawned in this process and published on a port through caf_io
+	Remote,   // Spawned on another node, a proxy is registered locally
+	None      // Not part of this node
+};
+
+/**
+ * @brief Converts a PlacementMode enum value to its string representation.
+ * @param mode The PlacementMode enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(PlacementMode mode)
+{
+	using namespace std::string_literals;
+
+	switch (mode)
+	{
+	case PlacementMode::Local:
+		return "local"s;
+	case PlacementMode::Publish:
+		return "publish"s;
+	case PlacementMode::Remote:
+		return "remote"s;
+	case PlacementMode::None:
+		return "none"s;
+	}
+
+	throw std::domain_error("Invalid value for PlacementMode: " +
+	                        std::to_string(std::to_underlying(mode)));
+}
+
+/**
+ * @brief Attempts to convert a string to a PlacementMode enum value.
+ * @param str The string to convert.
+ * @param mode Reference to the PlacementMode enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, PlacementMode& mode)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "local"sv)
+	{
+		mode = PlacementMode::Local;
+		status = true;
+	}
+	else if (str == "publish"sv)
+	{
+		mode = PlacementMode::Publish;
+		status = true;
+	}
+	else if (str == "remote"sv)
+	{
+		mode = PlacementMode::Remote;
+		status = true;
+	}
+	else if (str == "none"sv)
+	{
+		mode = PlacementMode::None;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a PlacementMode enum value.
+ * @param value The integer value to convert.
+ * @param mode Reference to the PlacementMode enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<PlacementMode> value,
+                                          PlacementMode& mode)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(PlacementMode::Local):
+		mode = PlacementMode::Local;
+		status = true;
+		break;
+	case std::to_underlying(PlacementMode::Publish):
+		mode = PlacementMode::Publish;
+		status = true;
+		break;
+	case std::to_underlying(PlacementMode::Remote):
+		mode = PlacementMode::Remote;
+		status = true;
+		break;
+	case std::to_underlying(PlacementMode::None):
+		mode = PlacementMode::None;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+/**
+ * @brief Inspect function needed by CAF to read the placement modes from the
+ * configuration: an unknown mode fails the parsing of the configuration.
+ */
+template <class Inspector>
+bool inspect(Inspector& f, PlacementMode& mode)
+{
+	return caf::default_enum_inspect(f, mode);
+}
+
+/**
+ * \struct ActorPlacement
+ *
+ * @brief Placement of one registered actor type, as read from the "icograph.placement"
+ * section of the CAF configuration file.
+ *
+ * - "publish": the actor is published on `port` (0 lets the OS pick one).
+ * - "remote": the actor is looked up on `host`:`port`.
+ */
+struct ActorPlacement
+{
+	PlacementMode mode = PlacementMode::Local;
+	std::string host = "localhost";
+	uint16_t port = 0;
+};
+
+// --------------------------------------------------------------------
+/**
+ * @brief Places one registered actor of the session according to its configuration:
+ * spawns it, spawns and publishes it, or connects to it on a remote node. The resulting
+ * handle (or proxy) is mapped in the registry under its custom ID so that the other
+ * actors reach it the same way wherever it lives.
+ *
+ * @tparam Handle statically typed handle of the actor
+ * @tparam Spawner callable spawning the actor locally
+ *
+ * @param system actor system of the current node
+ * @param actorId custom ID of the actor in the registry
+ * @param actorName name of the actor in the configuration file
+ * @param placement configured placement of the actor
+ * @param spawner spawns the actor when it lives on this node
+ *
+ * @return the handle, or std::nullopt if the actor is not part of this node
+ *
+ * @throws std::runtime_error if publishing or connecting fails
+ */
+template <typename Handle, typename Spawner>
+std::optional<Handle> placeActor(caf::actor_system& system,
+                                 caf::actor_id actorId,
+                                 std::string_view actorName,
+                                 const ActorPlacement& placement,
+                                 Spawner spawner)
+{
+	std::optional<Handle> handle;
+	switch (placement.mode)
+	{
+	case PlacementMode::Local:
+		handle = spawner();
+		break;
+	case PlacementMode::Publish:
+	{
+		handle = spawner();
+		auto port = system.middleman().publish(*handle, placement.port);
+		if (!port)
+		{
+			throw std::runtime_error("Cannot publish actor " + std::string(actorName) +
+			                         " on port " + std::to_string(placement.port) +
+			                         ": " + caf::to_string(port.error()));
+		}
+		MEDLOG_INFO("Actor {} published on port {}", actorName, *port);
+		break;
+	}
+	case PlacementMode::Remote:
+	{
+		auto remote =
+		    system.middleman().remote_actor<Handle>(placement.host, placement.port);
+		if (!remote)
+		{
+			throw std::runtime_error("Cannot reach actor " + std::string(actorName) +
+			                         " on " + placement.host + ":" +
+			                         std::to_string(placement.port) + ": " +
+			                         caf::to_string(remote.error()));
+		}
+		handle = std::move(*remote);
+		MEDLOG_INFO("Actor {} found on {}:{}", actorName, placement.host,
+		            placement.port);
+		break;
+	}
+	case PlacementMode::None:
+		break;
+	}
+
+	// Map actors with an ID in the actor system registry to make them system-wide
+	// available by any other actor within the same actor system.
+	if (handle)
+	{
+		system.registry().put(actorId, *handle);
+	}
+
+	return handle;
+}
+
+}  // namespace session_manager
+
+/**
+ * @brief Specialization of the std::format for PlacementMode. Needed for logging
+ */
+template <>
+struct std::formatter<session_manager::PlacementMode>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const session_manager::PlacementMode& mode, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", session_manager::to_string(mode));
+	}
+};
+
+#endif  // SESSIONMANAGER_ACTORPLACEMENT_HPP
@@ -0,0 +1,40 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SESSIONMANAGER_ADAPTIVETUNERACTOR_HPP
+#define SESSIONMANAGER_ADAPTIVETUNERACTOR_HPP
+
+#include <caf/behavior.hpp>
+#include <caf/event_based_actor.hpp>
+
+#include "Scheduler/AdaptiveTuning.hpp"
+
+namespace session_manager
+{
+
+/**
+ * @brief Behavior of the adaptive tuner. Samples periodically the run queue of the shared
+ * task pool, the run queues of the actors (the depth of their mailboxes, recorded by the
+ * frame handlers) and the handler latencies, then adjusts the active workers of the pool
+ * and the per-actor throughput quota within the configured bounds. Every change is
+ * logged. The quota is read by the acquisition session at each drain of its ring: a
+ * change applies to the running stream from its next batch.
+ *
+ * @param self The current actor
+ * @param cfg bounds and thresholds of the tuning
+ *
+ * @return An empty behavior, as all logic is handled by the sampling flow.
+ */
+caf::behavior adaptive_tuner(caf::event_based_actor* self,
+                             scheduler::AdaptiveTuningConfig cfg);
+
+}  // namespace session_manager
+
+#endif  // SESSIONMANAGER_ADAPTIVETUNERACTOR_HPP
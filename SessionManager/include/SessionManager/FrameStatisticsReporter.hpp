@@ -0,0 +1,37 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SESSIONMANAGER_FRAMESTATISTICSREPORTER_HPP
+#define SESSIONMANAGER_FRAMESTATISTICSREPORTER_HPP
+
+#include <chrono>
+
+#include <caf/behavior.hpp>
+#include <caf/event_based_actor.hpp>
+
+namespace session_manager
+{
+
+/**
+ * @brief Behavior of the frame statistics reporter. Logs periodically, for each stage of
+ * the pipeline that received frames during the period, the frame count, the latency
+ * percentiles from the production of the frames, and the frames missing or reordered.
+ *
+ * @param self The current actor
+ * @param period time between two summaries
+ *
+ * @return An empty behavior, as all logic is handled by the reporting flow.
+ */
+caf::behavior frame_statistics_reporter(caf::event_based_actor* self,
+                                        std::chrono::nanoseconds period);
+
+}  // namespace session_manager
+
+#endif  // SESSIONMANAGER_FRAMESTATISTICSREPORTER_HPP
@@ -13,6 +13,8 @@
 
 #include <caf/actor_system.hpp>
 
+#include "SessionManagerConfig.hpp"
+
 namespace session_manager
 {
 
@@ -21,12 +23,16 @@ namespace session_manager
  *
  * @brief Orchestrator and monitorer of the session, it generates and
  * coordinates all the actors of the application.
+ *
+ * Each registered actor is placed according to the "icograph.placement" section of the
+ * configuration: spawned locally, spawned and published to remote nodes, or looked up on
+ * a remote node. Several processes (possibly on localhost) can thus share one session.
  */
 class SessionManager
 {
 public:
 	// Ctor
-	explicit SessionManager(caf::actor_system& system);
+	SessionManager(caf::actor_system& system, const SessionManagerConfig& cfg);
 
 	// Dtor
 	~SessionManager() = default;
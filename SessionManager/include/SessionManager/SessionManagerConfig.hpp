@@ -0,0 +1,81 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SESSIONMANAGER_SESSIONMANAGERCONFIG_HPP
+#define SESSIONMANAGER_SESSIONMANAGERCONFIG_HPP
+
+#include <chrono>
+#include <string>
+
+#include <caf/actor_system_config.hpp>
+
+#include "AcquisitionModule/AcquisitionConfig.hpp"
+#include "AcquisitionModule/ModuleusSimulator.hpp"
+#include "DomainModel/DomainModelConfig.hpp"
+#include "ProcessingModule/ProcessingConfig.hpp"
+#include "Recorder/ReplayActor.hpp"
+#include "Scheduler/AdaptiveTuning.hpp"
+#include "Scheduler/CpuBudget.hpp"
+
+#include "ActorPlacement.hpp"
+
+namespace session_manager
+{
+
+/**
+ * \class SessionManagerConfig
+ *
+ * @brief CAF configuration of the application. Extends the default CAF options with the
+ * application specific sections of the configuration file (see
+ * configuration/caf-application.cfg).
+ */
+class SessionManagerConfig : public caf::actor_system_config
+{
+public:
+	// Ctor: declares the custom options to CAF
+	SessionManagerConfig();
+
+	// Placement of each actor type registered in common_caf::CustomActorIdentifier
+	ActorPlacement workflowManagerPlacement;
+	ActorPlacement echoViewerPlacement;
+	ActorPlacement domainModelPlacement;
+
+	// CPU budget shared by the CAF scheduler, the task pool and the logger
+	scheduler::CpuBudgetConfig cpuBudget;
+
+	// Highest instruction set of the processing kernels: "avx512", "avx2" or "scalar"
+	// (see simd::SimdLevel), the CPU permitting
+	std::string simdMaxLevel = "avx512";
+
+	// Bounds of the adaptive tuning of the task pool and throughput quota
+	scheduler::AdaptiveTuningConfig adaptiveTuning;
+
+	// Capture and replay of the messages delivered to the registered actors
+	recorder::RecordingConfig recording;
+
+	// Simulated acquisition hardware
+	acq_module::SimulatorConfig simulator;
+
+	// Sequence cache and replayed source of the acquisition session
+	acq_module::AcquisitionConfig acquisition;
+
+	// Workers processing the frames between the acquisition and the consumers
+	processing::ProcessingConfig processing;
+
+	// Cache and precision of the stored frames
+	domain_model::DomainModelConfig domainModel;
+
+	// Period of the frame latency summaries in the logs (0: disabled)
+	std::chrono::nanoseconds frameStatisticsPeriod = std::chrono::seconds(10);
+};
+
+}  // namespace session_manager
+
+#endif  // SESSIONMANAGER_SESSIONMANAGERCONFIG_HPP
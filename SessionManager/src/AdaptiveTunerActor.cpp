@@ -0,0 +1,81 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <memory>
+
+#include <caf/scheduled_actor/flow.hpp>
+
+#include "Logger/Logger.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+#include "Scheduler/TaskPool.hpp"
+
+#include "SessionManager/AdaptiveTunerActor.hpp"
+
+namespace session_manager
+{
+
+caf::behavior adaptive_tuner(caf::event_based_actor* self,
+                             scheduler::AdaptiveTuningConfig cfg)
+{
+	scheduler::TaskPool* pool = scheduler::TaskPool::shared();
+	if (pool == nullptr)
+	{
+		MEDLOG_WARN("Adaptive tuning disabled: no shared task pool");
+		return {};
+	}
+
+	if (cfg.max_workers == 0 || cfg.max_workers > pool->threadCount())
+	{
+		cfg.max_workers = pool->threadCount();
+	}
+
+	auto policy = std::make_shared<scheduler::AdaptiveTuningPolicy>(
+	    cfg, scheduler::TuningState{.workers = pool->activeWorkers(),
+	                                .quota = scheduler::throughputQuota()});
+
+	// Apply the clamped initial state
+	pool->setActiveWorkers(policy->state().workers);
+	scheduler::setThroughputQuota(policy->state().quota);
+
+	self->make_observable()
+	    .interval(cfg.period)
+	    .for_each(
+	        [pool, policy](int64_t)
+	        {
+		        const auto sample = scheduler::takeLoadSample();
+		        const std::size_t runQueue = pool->pendingJobs();
+
+		        const scheduler::TuningState previous = policy->state();
+		        const scheduler::TuningState next = policy->update(sample, runQueue);
+		        if (next == previous)
+		        {
+			        return;
+		        }
+
+		        pool->setActiveWorkers(next.workers);
+		        scheduler::setThroughputQuota(next.quota);
+
+		        MEDLOG_INFO(
+		            "Adaptive tuning: workers {} -> {}, quota {} -> {} (run queue {}, "
+		            "mailbox depth {}, {} handlers, mean latency {}us, max latency {}us)",
+		            previous.workers, next.workers, previous.quota, next.quota, runQueue,
+		            sample.max_mailbox_depth, sample.handler_count,
+		            std::chrono::duration_cast<std::chrono::microseconds>(
+		                sample.mean_latency)
+		                .count(),
+		            std::chrono::duration_cast<std::chrono::microseconds>(
+		                sample.max_latency)
+		                .count());
+	        });
+
+	return {};
+}
+
+}  // namespace session_manager
@@ -0,0 +1,79 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <array>
+#include <memory>
+#include <utility>
+
+#include <caf/scheduled_actor/flow.hpp>
+
+#include "Frame/FrameStatistics.hpp"
+#include "Logger/Logger.hpp"
+
+#include "SessionManager/FrameStatisticsReporter.hpp"
+
+namespace session_manager
+{
+
+namespace
+{
+// Nanoseconds to milliseconds, for the logs
+double toMs(uint64_t ns)
+{
+	return static_cast<double>(ns) / 1e6;
+}
+}  // namespace
+
+caf::behavior frame_statistics_reporter(caf::event_based_actor* self,
+                                        std::chrono::nanoseconds period)
+{
+	// Statistics at the previous summary, subtracted to report the last period only
+	using Snapshot = std::array<frame::StageStatistics, frame::frame_stage_count>;
+	auto previous = std::make_shared<Snapshot>();
+	for (const frame::FrameStage stage : frame::frame_stages)
+	{
+		(*previous)[std::to_underlying(stage)] = frame::stageStatistics(stage);
+	}
+
+	self->make_observable()
+	    .interval(period)
+	    .for_each(
+	        [previous](int64_t)
+	        {
+		        for (const frame::FrameStage stage : frame::frame_stages)
+		        {
+			        frame::StageStatistics& last = (*previous)[std::to_underlying(stage)];
+			        frame::StageStatistics current = frame::stageStatistics(stage);
+			        frame::StageStatistics window = current;
+			        window -= last;
+			        last = current;
+			        if (window.frames == 0)
+			        {
+				        continue;
+			        }
+
+			        const frame::LatencyHistogram& latency = window.latency;
+			        MEDLOG_INFO("Frames {}: {} received, latency p50 {:.2f}ms "
+			                    "p99 {:.2f}ms max {:.2f}ms",
+			                    stage, window.frames, toMs(latency.percentile(0.5)),
+			                    toMs(latency.percentile(0.99)),
+			                    toMs(latency.percentile(1.0)));
+			        if (window.gaps > 0 || window.reordered > 0)
+			        {
+				        MEDLOG_WARN("Frames {}: {} missing in {} gaps, {} reordered",
+				                    stage, window.missing, window.gaps, window.reordered);
+			        }
+		        }
+	        });
+
+	return {};
+}
+
+}  // namespace session_manager
@@ -8,18 +8,35 @@
  * Author: Alyson Roger <alyson.roger@iconeus.com>
  */
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 #include <caf/actor_from_state.hpp>
 #include <caf/actor_registry.hpp>
 #include <caf/event_based_actor.hpp>
+#include <caf/io/middleman.hpp>
 
 #include "CAF/CustomActorIdentifier.hpp"
 #include "DomainModel/DomainModelActor.hpp"
 #include "EchoViewModel/EchoViewerActor.hpp"
+#include "Frame/StimulusEvent.hpp"
 #include "Logger/Logger.hpp"
+#include "ProcessingModule/OrderingPolicy.hpp"
+#include "ProcessingModule/QualityLevel.hpp"
+#include "ProcessingModule/SpatialFilter.hpp"
+#include "Recorder/MessageReader.hpp"
+#include "Recorder/ReplayActor.hpp"
+#include "Simd/Dispatch.hpp"
 #include "WorkflowManager/WorkflowActor.hpp"
 
+#include "SessionManager/AdaptiveTunerActor.hpp"
+#include "SessionManager/FrameStatisticsReporter.hpp"
 #include "SessionManager/SessionManager.hpp"
 
 namespace session_manager
@@ -39,37 +56,239 @@ static void callWorkflowActor(caf::event_based_actor* self,
 }
 
 // --------------------------------------------------------------------
+/**
+ * @brief Replaces a registered actor by a stub when replaying a capture, if the actor is
+ * listed in the "icograph.recording.stubs" option.
+ *
+ * @param system actor system of the current node
+ * @param actorId custom ID of the actor in the registry
+ * @param actorName name of the actor in the configuration file
+ * @param recording capture and replay configuration
+ *
+ * @return true if a stub has been registered in place of the actor
+ */
+static bool placeStub(caf::actor_system& system,
+                      caf::actor_id actorId,
+                      std::string_view actorName,
+                      const recorder::RecordingConfig& recording)
+{
+	if (recording.replay_file.empty() ||
+	    std::ranges::find(recording.stubs, actorName) == recording.stubs.end())
+	{
+		return false;
+	}
+
+	system.registry().put(actorId,
+	                      system.spawn(recorder::replay_stub, std::string(actorName)));
+	MEDLOG_INFO("Actor {} replaced by a stub", actorName);
+	return true;
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Spawns the driver replaying the capture to the registered actors (real actors
+ * or stubs).
+ *
+ * @param system actor system of the current node
+ * @param recording capture and replay configuration
+ *
+ * @throws std::invalid_argument if the replay speed is unknown
+ * @throws std::runtime_error if the capture file cannot be read
+ */
+static void startReplay(caf::actor_system& system,
+                        const recorder::RecordingConfig& recording)
+{
+	recorder::ReplaySpeed speed{recorder::ReplaySpeed::Original};
+	if (!from_string(recording.replay_speed, speed))
+	{
+		throw std::invalid_argument("Invalid replay speed '" + recording.replay_speed +
+		                            "'");
+	}
+
+	auto reader =
+	    std::make_shared<recorder::MessageReader>(system, recording.replay_file);
 
-SessionManager::SessionManager(caf::actor_system& system)
+	// Receivers are looked up in the registry at each message: the acquisition is
+	// registered when the workflow starts it, the actors restarted are found again
+	std::vector<caf::actor_id> receivers{common_caf::custom_workflow_manager_actor_id,
+	                                     common_caf::custom_echo_viewer_actor_id,
+	                                     common_caf::custom_domain_model_actor_id,
+	                                     common_caf::custom_acquisition_actor_id};
+
+	MEDLOG_INFO("Replaying {}", recording.replay_file);
+	system.spawn(recorder::replay_driver, std::move(reader), std::move(receivers),
+	             speed);
+}
+
+// --------------------------------------------------------------------
+
+SessionManager::SessionManager(caf::actor_system& system, const SessionManagerConfig& cfg)
 {
+	// Checked here: the acquisition session and the processing farm only read them when
+	// the workflow starts
+	recorder::ReplaySpeed acquisitionSpeed{recorder::ReplaySpeed::Original};
+	if (!from_string(cfg.acquisition.replay_speed, acquisitionSpeed))
+	{
+		throw std::invalid_argument("Invalid acquisition replay speed '" +
+		                            cfg.acquisition.replay_speed + "'");
+	}
+	processing::OrderingPolicy ordering{processing::OrderingPolicy::Strict};
+	if (!from_string(cfg.processing.ordering, ordering))
+	{
+		throw std::invalid_argument("Invalid processing ordering '" +
+		                            cfg.processing.ordering + "'");
+	}
+	if (cfg.processing.worker_timeout <= std::chrono::nanoseconds{0})
+	{
+		throw std::invalid_argument("Invalid processing worker timeout: not positive");
+	}
+	processing::QualityLevel maxLevel{processing::QualityLevel::ReducedRate};
+	if (!from_string(cfg.processing.load_shedding.max_level, maxLevel))
+	{
+		throw std::invalid_argument("Invalid load shedding level '" +
+		                            cfg.processing.load_shedding.max_level + "'");
+	}
+	const processing::PowerDopplerConfig& powerDoppler = cfg.processing.power_doppler;
+	if (powerDoppler.tissue_components >= powerDoppler.ensemble)
+	{
+		throw std::invalid_argument(
+		    "Invalid power Doppler ensemble: " + std::to_string(powerDoppler.ensemble) +
+		    " frames for " + std::to_string(powerDoppler.tissue_components) +
+		    " tissue components");
+	}
+	if (cfg.processing.pixel_statistics.window == 0)
+	{
+		throw std::invalid_argument("Invalid pixel statistics window: 0 images");
+	}
+	const processing::ActivationMapConfig& activationMap = cfg.processing.activation_map;
+	frame::StimulusSource stimulusSource{frame::StimulusSource::Paradigm};
+	if (!frame::from_string(activationMap.source, stimulusSource))
+	{
+		throw std::invalid_argument("Invalid source of the stimuli '" +
+		                            activationMap.source + "'");
+	}
+	if (activationMap.stimulus_duration.count() < 0 ||
+	    activationMap.response_peak.count() < 0 || activationMap.period == 0)
+	{
+		throw std::invalid_argument("Invalid activation map: negative duration or no "
+		                            "period");
+	}
+	for (const auto& [workflowName, filter] : cfg.processing.spatial_filters)
+	{
+		try
+		{
+			// Checks the kind and the parameters, the images are not known yet
+			static_cast<void>(processing::SpatialFilter(filter, 1, 1));
+		}
+		catch (const std::invalid_argument& e)
+		{
+			throw std::invalid_argument(workflowName + ": " + e.what());
+		}
+	}
+
+	try
+	{
+		// Checks the streams and the precisions, the cache is empty
+		static_cast<void>(domain_model::DomainModel(cfg.domainModel));
+	}
+	catch (const std::invalid_argument& e)
+	{
+		throw std::invalid_argument(std::string("Domain model: ") + e.what());
+	}
+
+	// The kernels are built by the workflow, after this
+	simd::SimdLevel simdLevel{simd::SimdLevel::Avx512};
+	if (!from_string(cfg.simdMaxLevel, simdLevel))
+	{
+		throw std::invalid_argument("Invalid SIMD level '" + cfg.simdMaxLevel + "'");
+	}
+	simd::limitLevel(simdLevel);
+	MEDLOG_INFO("Processing kernels for {} (CPU: {})", simd::activeLevel(),
+	            simd::detectedLevel());
+
+	// Adjusts the task pool and the throughput quota to the load of this node
+	if (cfg.adaptiveTuning.enabled)
+	{
+		system.spawn(adaptive_tuner, cfg.adaptiveTuning);
+	}
+
+	// Logs the latencies and the lost frames of the pipeline
+	if (cfg.frameStatisticsPeriod.count() > 0)
+	{
+		system.spawn(frame_statistics_reporter, cfg.frameStatisticsPeriod);
+	}
+
 	// Spawn viewer model actor.
 	// STATEFUL to keep the state of the display.
 	// Will be created with Qt Quick context (main Qt thread handling coming afterwards)
-	auto echoViewerActorHandle =
-	    system.spawn(caf::actor_from_state<echo_view_model::echo_viewer_actor_state>);
+	if (!placeStub(system, common_caf::custom_echo_viewer_actor_id,
+	               common_caf::custom_echo_viewer_actor_name, cfg.recording))
+	{
+		placeActor<echo_view_model::echo_viewer_actor>(
+		    system, common_caf::custom_echo_viewer_actor_id,
+		    common_caf::custom_echo_viewer_actor_name, cfg.echoViewerPlacement,
+		    [&system]
+		    {
+			    return system.spawn(
+			        caf::actor_from_state<echo_view_model::echo_viewer_actor_state>);
+		    });
+	}
 
 	// Spawn domain Model actor.
 	// STATEFUL to store in-memory caching of the data and the list of the data
 	// related to the current patient.
-	auto domainModelActorHandle =
-	    system.spawn(caf::actor_from_state<domain_model::domain_model_actor_state>);
+	if (!placeStub(system, common_caf::custom_domain_model_actor_id,
+	               common_caf::custom_domain_model_actor_name, cfg.recording))
+	{
+		placeActor<domain_model::domain_model_actor>(
+		    system, common_caf::custom_domain_model_actor_id,
+		    common_caf::custom_domain_model_actor_name, cfg.domainModelPlacement,
+		    [&system, &cfg]
+		    {
+			    return system.spawn(
+			        caf::actor_from_state<domain_model::domain_model_actor_state>,
+			        cfg.domainModel);
+		    });
+	}
 
 	// Spawn workflow actor.
 	// STATEFUL to keep the current state of the acquisition workflow
 	// Contains a state machine that drives the workflow steps
-	auto workflowManagerActorHandle =
-	    system.spawn(caf::actor_from_state<workflow::workflow_actor_state>,
-	                 workflow::WorkflowType::Neonate);
-
-	// Map actors with an ID in the actor system registry to make them system-wide
-	// available by any other actor within the same actor system.
-	system.registry().put(common_caf::custom_echo_viewer_actor_id, echoViewerActorHandle);
-	system.registry().put(common_caf::custom_domain_model_actor_id,
-	                      domainModelActorHandle);
-	system.registry().put(common_caf::custom_workflow_manager_actor_id,
-	                      workflowManagerActorHandle);
-
-	system.spawn(callWorkflowActor, workflowManagerActorHandle);
+	// The workflow actor is placed last since it retrieves the other actors from the
+	// registry.
+	std::optional<workflow::workflow_actor> workflowManagerActorHandle;
+	if (!placeStub(system, common_caf::custom_workflow_manager_actor_id,
+	               common_caf::custom_workflow_manager_actor_name, cfg.recording))
+	{
+		workflowManagerActorHandle = placeActor<workflow::workflow_actor>(
+		    system, common_caf::custom_workflow_manager_actor_id,
+		    common_caf::custom_workflow_manager_actor_name, cfg.workflowManagerPlacement,
+		    [&system, &cfg]
+		    {
+			    return system.spawn(caf::actor_from_state<workflow::workflow_actor_state>,
+			                        workflow::WorkflowType::Neonate, cfg.simulator,
+			                        cfg.acquisition, cfg.processing);
+		    });
+	}
+
+	// The acquisition is spawned by the workflow: only its stub is placed here
+	placeStub(system, common_caf::custom_acquisition_actor_id,
+	          common_caf::custom_acquisition_actor_name, cfg.recording);
+
+	// A replayed session is driven by the capture
+	if (!cfg.recording.replay_file.empty())
+	{
+		startReplay(system, cfg.recording);
+		return;
+	}
+
+	// Only the node owning the workflow drives the session. Worker nodes only host the
+	// actors they publish.
+	if (workflowManagerActorHandle &&
+	    cfg.workflowManagerPlacement.mode != PlacementMode::Remote)
+	{
+		system.spawn(callWorkflowActor, *workflowManagerActorHandle);
+	}
 }
 
 }  // namespace session_manager
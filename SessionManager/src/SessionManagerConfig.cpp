@@ -0,0 +1,215 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <string>
+
+#include <caf/config_option_adder.hpp>
+
+#include "CAF/CustomActorIdentifier.hpp"
+#include "Frame/FrameStream.hpp"
+#include "WorkflowManager/WorkflowType.hpp"
+
+#include "SessionManager/SessionManagerConfig.hpp"
+
+namespace session_manager
+{
+
+/**
+ * @brief Declares the options of one actor placement under
+ * "icograph.placement.<actorName>".
+ *
+ * @param options CAF options container
+ * @param actorName name of the actor in the configuration file
+ * @param placement structure receiving the parsed values
+ */
+static void addPlacementOptions(caf::config_option_set& options,
+                                std::string_view actorName,
+                                ActorPlacement& placement)
+{
+	const std::string category = "icograph.placement." + std::string(actorName);
+
+	caf::config_option_adder{options, category}
+	    .add(placement.mode, "mode", "one of: local, publish, remote, none")
+	    .add(placement.host, "host", "host of the remote node (mode = remote)")
+	    .add(placement.port, "port", "port to publish on or to connect to");
+}
+
+/**
+ * @brief Declares the options of the denoising filter of a workflow under
+ * "icograph.processing.spatial-filter.<workflowName>".
+ *
+ * @param options CAF options container
+ * @param workflowName name of the workflow (see workflow::to_string)
+ * @param filter structure receiving the parsed values
+ */
+static void addSpatialFilterOptions(caf::config_option_set& options,
+                                    const std::string& workflowName,
+                                    processing::SpatialFilterConfig& filter)
+{
+	const std::string category = "icograph.processing.spatial-filter." + workflowName;
+
+	caf::config_option_adder{options, category}
+	    .add(filter.kind, "kind", "one of: none, gaussian, median, bilateral")
+	    .add(filter.radius, "radius", "half-width of the window in pixels")
+	    .add(filter.sigma, "sigma", "standard deviation of the weights in pixels")
+	    .add(filter.range_sigma, "range-sigma",
+	         "bilateral: standard deviation of the range weights, relative to the level");
+}
+
+// --------------------------------------------------------------------
+
+SessionManagerConfig::SessionManagerConfig()
+{
+	addPlacementOptions(custom_options_, common_caf::custom_workflow_manager_actor_name,
+	                    workflowManagerPlacement);
+	addPlacementOptions(custom_options_, common_caf::custom_echo_viewer_actor_name,
+	                    echoViewerPlacement);
+	addPlacementOptions(custom_options_, common_caf::custom_domain_model_actor_name,
+	                    domainModelPlacement);
+
+	caf::config_option_adder{custom_options_, "icograph.cpu-budget"}
+	    .add(cpuBudget.threads, "threads",
+	         "threads running simultaneously (0: all cores left after reservation)")
+	    .add(cpuBudget.reserved_cores, "reserved-cores",
+	         "cores removed from the affinity of the process")
+	    .add(cpuBudget.kernel_threads, "kernel-threads",
+	         "workers of the shared task pool (0: half of the budget)");
+
+	caf::config_option_adder{custom_options_, "icograph.simd"}
+	    .add(simdMaxLevel, "max-level",
+	         "highest instruction set of the kernels, one of: avx512, avx2, scalar");
+
+	caf::config_option_adder{custom_options_, "icograph.adaptive-tuning"}
+	    .add(adaptiveTuning.enabled, "enabled", "enable the adaptive tuning")
+	    .add(adaptiveTuning.period, "period", "sampling period of the load")
+	    .add(adaptiveTuning.min_workers, "min-workers", "minimum active pool workers")
+	    .add(adaptiveTuning.max_workers, "max-workers",
+	         "maximum active pool workers (0: all workers of the pool)")
+	    .add(adaptiveTuning.min_quota, "min-quota", "minimum items per batch")
+	    .add(adaptiveTuning.max_quota, "max-quota", "maximum items per batch")
+	    .add(adaptiveTuning.target_latency, "target-latency",
+	         "handler latency above which the load is too high")
+	    .add(adaptiveTuning.max_mailbox_depth, "max-mailbox-depth",
+	         "messages waiting for an actor above which the load is too high")
+	    .add(adaptiveTuning.idle_samples, "idle-samples",
+	         "consecutive idle samples before stepping down");
+
+	caf::config_option_adder{custom_options_, "icograph.recording"}
+	    .add(recording.capture_file, "capture-file",
+	         "records the messages of the registered actors in this file")
+	    .add(recording.replay_file, "replay-file",
+	         "replays this capture instead of driving the workflow")
+	    .add(recording.replay_speed, "replay-speed", "one of: original, max")
+	    .add(recording.stubs, "stubs", "names of the actors replaced by stubs on replay");
+
+	caf::config_option_adder{custom_options_, "icograph.acquisition"}
+	    .add(acquisition.sequence_cache, "sequence-cache",
+	         "directory of the compiled sequences (empty: kept in memory only)")
+	    .add(acquisition.replay_file, "replay-file",
+	         "capture whose frames replace the acquisition hardware")
+	    .add(acquisition.replay_speed, "replay-speed", "one of: original, max");
+
+	caf::config_option_adder{custom_options_, "icograph.processing"}
+	    .add(processing.workers, "workers",
+	         "workers processing the frames in parallel (0: no processing stage)")
+	    .add(processing.max_in_flight, "max-in-flight", "frames processed at once")
+	    .add(processing.worker_timeout, "worker-timeout",
+	         "time after which a frame sent to a worker is given up")
+	    .add(processing.ordering, "ordering", "one of: strict, latest-wins");
+
+	processing::LoadSheddingConfig& shedding = processing.load_shedding;
+	caf::config_option_adder{custom_options_, "icograph.processing.load-shedding"}
+	    .add(shedding.enabled, "enabled", "degrade the processed frames when behind")
+	    .add(shedding.period, "period", "sampling period of the backlog and latency")
+	    .add(shedding.max_level, "max-level",
+	         "one of: full, essential-maps, reduced-resolution, reduced-rate")
+	    .add(shedding.max_backlog, "max-backlog",
+	         "frames waiting in the farm or a later stage above which it is behind")
+	    .add(shedding.max_latency, "max-latency",
+	         "frame latency above which the farm is behind")
+	    .add(shedding.recovery_samples, "recovery-samples",
+	         "consecutive quiet samples before stepping back up")
+	    .add(shedding.resolution_step, "resolution-step",
+	         "decimation of the power Doppler images at reduced resolution")
+	    .add(shedding.rate_step, "rate-step",
+	         "one ensemble in rate-step processed at reduced rate");
+
+	processing::PowerDopplerConfig& powerDoppler = processing.power_doppler;
+	caf::config_option_adder{custom_options_, "icograph.processing.power-doppler"}
+	    .add(powerDoppler.enabled, "enabled", "compute the power Doppler images")
+	    .add(powerDoppler.ensemble, "ensemble", "Doppler frames of an image")
+	    .add(powerDoppler.step, "step", "frames between two images (sliding window)")
+	    .add(powerDoppler.tissue_components, "tissue-components",
+	         "largest singular components removed as tissue")
+	    .add(powerDoppler.oversampling, "oversampling",
+	         "extra vectors of the randomized subspace")
+	    .add(powerDoppler.power_iterations, "power-iterations",
+	         "power iterations of the randomized subspace");
+
+	for (const workflow::WorkflowType type :
+	     {workflow::WorkflowType::Neonate, workflow::WorkflowType::NeuroRadiology,
+	      workflow::WorkflowType::NeuroSurgery})
+	{
+		const std::string name = workflow::to_string(type);
+		addSpatialFilterOptions(custom_options_, name, processing.spatial_filters[name]);
+	}
+
+	processing::PixelStatisticsConfig& pixelStatistics = processing.pixel_statistics;
+	caf::config_option_adder{custom_options_, "icograph.processing.pixel-statistics"}
+	    .add(pixelStatistics.enabled, "enabled",
+	         "keep the statistics of the power Doppler pixels")
+	    .add(pixelStatistics.window, "window", "images of the sliding window");
+
+	processing::ActivationMapConfig& activationMap = processing.activation_map;
+	caf::config_option_adder{custom_options_, "icograph.processing.activation-map"}
+	    .add(activationMap.enabled, "enabled",
+	         "map the response of the power Doppler pixels to the stimuli")
+	    .add(activationMap.source, "source", "events of the stimuli: paradigm or trigger")
+	    .add(activationMap.stimulus_duration, "stimulus-duration",
+	         "duration of a stimulus from its event (0: until an event of code 0)")
+	    .add(activationMap.response_peak, "response-peak",
+	         "peak of the hemodynamic response (0: none)")
+	    .add(activationMap.detrend, "detrend", "fit a linear drift of the pixels")
+	    .add(activationMap.period, "period", "images between two maps published");
+
+	caf::config_option_adder{custom_options_, "icograph.domain-model"}.add(
+	    domainModel.cache_megabytes, "cache-megabytes",
+	    "samples of the most recent frames kept in memory (0: none)");
+	for (const frame::FrameStream stream : frame::frame_streams)
+	{
+		const std::string name = frame::to_string(stream);
+		caf::config_option_adder{custom_options_, "icograph.domain-model.precision"}.add(
+		    domainModel.precisions.try_emplace(name, "float32").first->second, name,
+		    "one of: float32 (default), float16, bfloat16, int16");
+	}
+
+	caf::config_option_adder{custom_options_, "icograph.frame-statistics"}
+	    .add(frameStatisticsPeriod, "period",
+	         "period of the frame latency summaries in the logs (0: disabled)");
+
+	caf::config_option_adder{custom_options_, "icograph.simulator"}
+	    .add(simulator.kind, "kind", "one of: iq (compounded IQ), rf (raw RF data)")
+	    .add(simulator.depth_samples, "depth-samples", "samples per line")
+	    .add(simulator.lateral_samples, "lateral-samples", "lines of the IQ frames")
+	    .add(simulator.channels, "channels", "channels of the RF frames")
+	    .add(simulator.frame_rate, "frame-rate", "frames per second")
+	    .add(simulator.bmode_rate, "bmode-rate",
+	         "B-mode frames per second, interleaved (0: no B-mode stream)")
+	    .add(simulator.frame_count, "frame-count", "frames per acquisition (0: endless)")
+	    .add(simulator.noise_level, "noise-level", "standard deviation of the noise")
+	    .add(simulator.tissue_amplitude, "tissue-amplitude", "amplitude of the tissue")
+	    .add(simulator.flow_amplitude, "flow-amplitude", "amplitude of the blood signal")
+	    .add(simulator.flow_velocity, "flow-velocity",
+	         "Doppler shift at the vessel center, as a fraction of frame-rate / 2")
+	    .add(simulator.buffer_count, "buffer-count", "preallocated frame buffers")
+	    .add(simulator.seed, "seed", "seed of the generated scene");
+}
+
+}  // namespace session_manager
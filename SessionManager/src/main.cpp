@@ -8,20 +8,31 @@
  * Author: Alyson Roger <alyson.roger@iconeus.com>
  */
 
+#include <cstdlib>
 #include <iostream>
+#include <optional>
 #include <string>
 
 #include <caf/actor_system.hpp>
-#include <caf/caf_main.hpp>
+#include <caf/exec_main.hpp>
+#include <caf/init_global_meta_objects.hpp>
+#include <caf/io/middleman.hpp>
 
 #include "Logger/Logger.hpp"
+#include "Recorder/MessageRecorder.hpp"
+#include "Scheduler/CpuBudget.hpp"
+#include "Scheduler/TaskPool.hpp"
 
 #include "SessionManager/SessionManager.hpp"
+#include "SessionManager/SessionManagerConfig.hpp"
 
 #include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/FrameTypeIds.hpp"
 #include "WorkflowManager/WorkflowTypeIds.hpp"
 
-int caf_main(caf::actor_system& system)
+int caf_main(caf::actor_system& system,
+             const session_manager::SessionManagerConfig& cfg,
+             const scheduler::CpuBudget& budget)
 {
 	try
 	{
@@ -34,9 +45,23 @@ int caf_main(caf::actor_system& system)
 		// Logger is valid as long as
 		medlog::Logger logger(medlog::LoggerConfig{.app_name = "SessionManager"s,
 		                                           .log_filename = L"SessionManager.log"s,
+		                                           .thread_count = budget.logger_threads,
 		                                           .level = medlog::LogLevel::Info});
 
-		session_manager::SessionManager sessionManager(system);
+		MEDLOG_INFO("CPU budget: {} threads ({} actor, {} kernel, {} logger)",
+		            budget.total, budget.caf_threads, budget.kernel_threads,
+		            budget.logger_threads);
+
+		// Records the messages delivered to the registered actors until the end of the
+		// session
+		std::optional<recorder::Capture> capture;
+		if (!cfg.recording.capture_file.empty())
+		{
+			capture.emplace(system, cfg.recording.capture_file);
+			MEDLOG_INFO("Capturing the session in {}", cfg.recording.capture_file);
+		}
+
+		session_manager::SessionManager sessionManager(system, cfg);
 
 		system.await_all_actors_done();
 
@@ -49,5 +74,57 @@ int caf_main(caf::actor_system& system)
 	}
 }
 
-// Used defined ID must be specified here
-CAF_MAIN(caf::id_block::custom_types_workflow, caf::id_block::custom_types_acq_module)
+// Explicit version of CAF_MAIN: the CPU budget has to be applied to the configuration
+// after it has been parsed and before the CAF scheduler starts its threads.
+int main(int argc, char** argv)
+{
+	// Used defined ID must be specified here, as well as the caf_io module needed to
+	// publish actors to remote nodes.
+	caf::exec_main_init_meta_objects<caf::id_block::custom_types_general,
+	                                 caf::id_block::custom_types_workflow,
+	                                 caf::id_block::custom_types_acq_module,
+	                                 caf::io::middleman>();
+	caf::core::init_global_meta_objects();
+
+	session_manager::SessionManagerConfig cfg;
+	if (auto err = cfg.parse(argc, argv))
+	{
+		std::cerr << "error while parsing CLI and file options: " << caf::to_string(err)
+		          << "\n";
+		return EXIT_FAILURE;
+	}
+
+	// Return immediately if a help text was printed.
+	if (cfg.helptext_printed)
+	{
+		return EXIT_SUCCESS;
+	}
+
+	cfg.load<caf::io::middleman>();
+
+	try
+	{
+		// Every thread started afterwards (CAF, task pool, logger) inherits the affinity
+		if (!scheduler::reserveCores(cfg.cpuBudget.reserved_cores))
+		{
+			std::cerr << "cannot reserve " << cfg.cpuBudget.reserved_cores
+			          << " cores on this platform\n";
+		}
+
+		const auto budget =
+		    scheduler::computeCpuBudget(cfg.cpuBudget, scheduler::availableCores());
+		cfg.set("caf.scheduler.policy", "stealing");
+		cfg.set("caf.scheduler.max-threads", static_cast<int64_t>(budget.caf_threads));
+
+		// Parallel kernels and background jobs. Must outlive the actors using it.
+		scheduler::SharedTaskPool taskPool(budget.kernel_threads);
+
+		caf::actor_system system{cfg};
+		return caf_main(system, cfg, budget);
+	}
+	catch (const std::exception& e)
+	{
+		std::cerr << "unhandled exception: " << e.what() << "\n";
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,182 @@
+#include <caf/test/caf_test_main.hpp>
+#include <caf/test/test.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <caf/actor_system.hpp>
+#include <caf/actor_system_config.hpp>
+#include <caf/config_option_adder.hpp>
+#include <caf/event_based_actor.hpp>
+#include <caf/io/middleman.hpp>
+#include <caf/scoped_actor.hpp>
+#include <caf/typed_actor.hpp>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "SessionManager/ActorPlacement.hpp"
+
+using namespace session_manager;
+
+namespace
+{
+struct doubler_trait
+{
+	using signatures = caf::type_list<caf::result<int32_t>(caf::get_atom, int32_t)>;
+};
+
+using doubler_actor = caf::typed_actor<doubler_trait>;
+
+constexpr caf::actor_id doubler_id = 1000;
+
+doubler_actor::behavior_type doubler()
+{
+	return {[](caf::get_atom, int32_t value) { return 2 * value; }};
+}
+
+struct node_config : caf::actor_system_config
+{
+	node_config()
+	{
+		load<caf::io::middleman>();
+		caf::config_option_adder{custom_options_, "placement"}
+		    .add(placement.mode, "mode", "one of: local, publish, remote, none")
+		    .add(placement.port, "port", "port to publish on or to connect to");
+	}
+
+	ActorPlacement placement;
+};
+
+// Port free on the loopback interface when called
+uint16_t freePort()
+{
+	const int socketFd = ::socket(AF_INET, SOCK_STREAM, 0);
+	sockaddr_in address{};
+	address.sin_family = AF_INET;
+	address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	socklen_t length = sizeof(address);
+	uint16_t port = 0;
+	if (::bind(socketFd, reinterpret_cast<sockaddr*>(&address), length) == 0 &&
+	    ::getsockname(socketFd, reinterpret_cast<sockaddr*>(&address), &length) == 0)
+	{
+		port = ntohs(address.sin_port);
+	}
+	::close(socketFd);
+	return port;
+}
+
+// Publishing node: publishes the doubler, signals it on the pipe, then serves it until
+// the other end of the pipe is closed. Returns the exit status of the process.
+int runPublishingNode(uint16_t port, int readyFd, int doneFd)
+{
+	node_config cfg;
+	cfg.placement = {.mode = PlacementMode::Publish, .port = port};
+	caf::actor_system system{cfg};
+	try
+	{
+		placeActor<doubler_actor>(system, doubler_id, "doubler", cfg.placement,
+		                          [&system] { return system.spawn(doubler); });
+	}
+	catch (const std::exception&)
+	{
+		return 1;
+	}
+
+	const char ready = 1;
+	if (::write(readyFd, &ready, 1) != 1)
+	{
+		return 2;
+	}
+	char done = 0;
+	while (::read(doneFd, &done, 1) > 0)
+	{
+	}
+	return 0;
+}
+}  // namespace
+
+TEST("the placement modes are parsed with the configuration")
+{
+	node_config cfg;
+	check_eq(cfg.placement.mode, PlacementMode::Local);
+	require(!cfg.parse(caf::actor_system_config::string_list{"--placement.mode=remote"}));
+	check_eq(cfg.placement.mode, PlacementMode::Remote);
+
+	node_config invalid;
+	check(static_cast<bool>(
+	    invalid.parse(caf::actor_system_config::string_list{"--placement.mode=away"})));
+}
+
+TEST("an actor published by a process is placed remotely by another one")
+{
+	const uint16_t port = freePort();
+	require_ne(port, uint16_t{0});
+
+	// [0]: read end, [1]: write end
+	int ready[2];
+	int done[2];
+	require_eq(::pipe(ready), 0);
+	require_eq(::pipe(done), 0);
+
+	const pid_t child = ::fork();
+	require_ge(child, 0);
+	if (child == 0)
+	{
+		::close(ready[0]);
+		::close(done[1]);
+		::_exit(runPublishingNode(port, ready[1], done[0]));
+	}
+	::close(ready[1]);
+	::close(done[0]);
+
+	char signal = 0;
+	check_eq(::read(ready[0], &signal, 1), ssize_t{1});
+	{
+		node_config cfg;
+		cfg.placement = {.mode = PlacementMode::Remote, .port = port};
+		caf::actor_system system{cfg};
+		auto spawned = false;
+		const auto handle = placeActor<doubler_actor>(
+		    system, doubler_id, "doubler", cfg.placement,
+		    [&system, &spawned]
+		    {
+			    spawned = true;
+			    return system.spawn(doubler);
+		    });
+		require(handle.has_value());
+		check(!spawned);
+		check_eq(system.registry().get<doubler_actor>(doubler_id), *handle);
+
+		// Reached in the other process
+		caf::scoped_actor self{system};
+		self->mail(caf::get_atom_v, int32_t{21})
+		    .request(*handle, std::chrono::seconds(5))
+		    .receive([this](int32_t value) { check_eq(value, 42); },
+		             [this](const caf::error& err)
+		             { fail("no reply from the remote node: {}", err); });
+	}
+
+	::close(done[1]);
+	int status = 0;
+	check_eq(::waitpid(child, &status, 0), child);
+	check(WIFEXITED(status));
+	check_eq(WEXITSTATUS(status), 0);
+	::close(ready[0]);
+}
+
+TEST("an actor not part of the node is not placed")
+{
+	node_config cfg;
+	caf::actor_system system{cfg};
+	const auto handle = placeActor<doubler_actor>(
+	    system, doubler_id, "doubler", {.mode = PlacementMode::None},
+	    [&system] { return system.spawn(doubler); });
+	check(!handle.has_value());
+	check(!system.registry().get<doubler_actor>(doubler_id));
+}
+
+CAF_TEST_MAIN(caf::io::middleman)
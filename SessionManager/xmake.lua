@@ -5,12 +5,27 @@ target("session_manager")
     add_deps("workflow_manager")
     add_deps("echo_view_model")
     add_deps("domain_model")
+    add_deps("processing_module")
     add_deps("common_caf")
+    add_deps("common_frame")
     add_deps("common_logger")
+    add_deps("common_scheduler")
+    add_deps("common_simd")
+    add_deps("common_recorder")
 
     -- Set the CAF option --config-file to pass a configuration file to the target.
     --  
     on_run(function (target)
         local configfile = get_config("caf-config-file")
         os.execv(target:targetfile(), { "--config-file", configfile })
-    end)
\ No newline at end of file
+    end)
+-- Unit test target. The placement tests run a second node in a child process.
+target("session_manager_tests")
+    set_kind("binary")
+    add_files("tests/unit_tests/*.cpp")
+    add_includedirs("include")
+    add_deps("common_caf")
+    add_deps("common_logger")
+    add_packages("actor-framework", {components = {"caf_test"}})
+    add_links("caf_test")
+    add_tests("default", {runargs = {}}) -- Mark this target as a test
@@ -0,0 +1,40 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_ACQUISITIONCONFIG_HPP
+#define ACQUISITIONMODULE_ACQUISITIONCONFIG_HPP
+
+#include <string>
+
+namespace acq_module
+{
+
+/**
+ * \struct AcquisitionConfig
+ *
+ * @brief Configuration of the acquisition session, as read from the
+ * "icograph.acquisition" section of the CAF configuration file.
+ *
+ * - sequence_cache: directory of the compiled sequences (memory only if empty).
+ * - replay_file: capture of a session whose frames replace the hardware (disabled if
+ *   empty). The workflow and the consumers run as with the hardware.
+ * - replay_speed: pace of the replayed frames, "original" or "max" (see
+ *   recorder::ReplaySpeed).
+ */
+struct AcquisitionConfig
+{
+	std::string sequence_cache;
+	std::string replay_file;
+	std::string replay_speed = "original";
+};
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_ACQUISITIONCONFIG_HPP
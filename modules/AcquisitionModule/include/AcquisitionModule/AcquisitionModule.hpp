@@ -13,28 +13,72 @@
 
 #include <stdint.h>
 
+#include <filesystem>
+#include <memory>
+
+#include "AcquisitionParameters.hpp"
+#include "ModuleusSimulator.hpp"
+#include "SequenceCache.hpp"
+
 namespace acq_module
 {
 
 /**
  * \class AcquisitionModule
  *
- * @brief TODO (during implementation of Moduleus simulator)
+ * @brief Facade of the acquisition hardware. Until the Moduleus driver is integrated,
+ * the frames are produced by the ModuleusSimulator.
+ *
+ * The hardware is set up once and kept between acquisitions, along with its frame
+ * buffers, until it is reconfigured. The sequences are compiled once and cached.
+ *
+ * An acquisition produces the Doppler stream of the configuration, and a B-mode stream
+ * of compounded IQ frames at the B-mode rate of the configuration (if not 0). A sequence
+ * is only accepted on RF frames of its geometry: a channel per element of its probe,
+ * and its samples per plane wave.
  */
 class AcquisitionModule
 {
 public:
-	// Ctor
-	AcquisitionModule() = default;
+	/**
+	 * @brief: Ctor
+	 * @param simulatorConfig configuration of the simulated hardware
+	 * @param sequenceCache directory of the compiled sequences, empty to keep them in
+	 * memory only
+	 */
+	explicit AcquisitionModule(const SimulatorConfig& simulatorConfig,
+	                           std::filesystem::path sequenceCache = {});
 
 	// Dtor
 	~AcquisitionModule() = default;
 
 	/**
-	 * @brief: handler for the acquisition request
-	 * @param: dummy value
+	 * @brief: handler for the acquisition request. Sets the hardware up on the first
+	 * request only, and loads the sequence of the parameters.
+	 * @param parameters sequence of the acquisition
+	 * @return the simulators producing the frames of each stream of the acquisition
+	 * @throws std::invalid_argument if the simulator configuration or the parameters are
+	 * invalid, or if the RF frames of the configuration do not match the sequence
 	 */
-	void acquisitionRequest(int32_t parameterValue);
+	StreamSimulators acquisitionRequest(const AcquisitionParameters& parameters);
+
+	/**
+	 * @brief: Replaces the configuration of the hardware. The current configuration is
+	 * kept if the new one is invalid.
+	 * @param simulatorConfig configuration of the simulated hardware
+	 * @throws std::invalid_argument if the simulator configuration is invalid
+	 */
+	void reconfigure(const SimulatorConfig& simulatorConfig);
+
+	[[nodiscard]] const SimulatorConfig& config() const { return _simulatorConfig; }
+
+private:
+	SimulatorConfig _simulatorConfig;
+
+	// Created by the first acquisition request
+	StreamSimulators _simulators;
+
+	SequenceCache _sequenceCache;
 };
 }  // namespace acq_module
 
@@ -11,9 +11,30 @@
 #ifndef ACQUISITIONMODULE_ACQUISITIONMODULEACTOR_HPP
 #define ACQUISITIONMODULE_ACQUISITIONMODULEACTOR_HPP
 
-#include <caf/typed_event_based_actor.hpp>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 
+#include <caf/actor.hpp>
+#include <caf/disposable.hpp>
+#include <caf/result.hpp>
+#include <caf/type_list.hpp>
+#include <caf/typed_actor.hpp>
+#include <caf/typed_actor_pointer.hpp>
+
+#include "Frame/FrameStream.hpp"
+#include "Frame/StimulusEvent.hpp"
+#include "Recorder/ReplayActor.hpp"
+
+#include "AcquisitionConfig.hpp"
+#include "AcquisitionModule.hpp"
 #include "AcquisitionModuleTypeIds.hpp"
+#include "AcquisitionState.hpp"
+#include "FrameDriver.hpp"
+#include "ModuleusSimulator.hpp"
+#include "RecordedFrameSource.hpp"
 
 namespace acq_module
 {
@@ -24,18 +45,130 @@ namespace acq_module
 struct acq_module_trait
 {
 	using signatures =
-	    caf::type_list<caf::result<void>(acq_request, int32_t, std::vector<caf::actor>)>;
+	    caf::type_list<caf::result<void>(acq_start, AcquisitionParameters),
+	                   caf::result<void>(acq_subscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(acq_unsubscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(acq_pause),
+	                   caf::result<void>(acq_stop),
+	                   caf::result<void>(acq_reconfigure, SimulatorConfig),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent),
+	                   caf::result<AcquisitionState>(caf::get_atom)>;
 };
 
 // Definition of the statically typed actor
 using acq_module_actor = caf::typed_actor<acq_module_trait>;
 
 /**
- * @brief: Defines the callbacks upon message reception. In this case, the acquisition is
- * started, with the resulting data flow processed then transferred to subscribers.
+ * \class acquisition_session_state
+ *
+ * @brief State of the acquisition session actor. The session lives as long as the
+ * workflow: acquisitions are started, paused, resumed and stopped by messages, the
+ * hardware, its frame buffers and the subscribers are kept from one acquisition to the
+ * next.
+ *
+ * The frames are delivered by the ModuleusDriver on the thread of the hardware, or by
+ * the RecordedFrameDriver replaying a capture, through a wait-free ring that the
+ * session drains every millisecond. Each frame is published
+ * to the subscribers of its stream only, the streams without subscribers are not
+ * produced.
+ *
+ * Messages:
+ * - acq_start: starts an acquisition with the given sequence, or resumes the paused
+ *   one. A running or paused acquisition of another sequence is stopped and restarted
+ *   with the new one. An invalid sequence is rejected and logged, the current
+ *   acquisition goes on.
+ * - acq_subscribe: publishes the frames of a stream to an actor, from now on and for
+ *   the next acquisitions.
+ * - acq_unsubscribe: stops publishing the frames of a stream to an actor.
+ * - acq_pause: suspends the frames, the acquisition resumes where it stopped.
+ * - acq_stop: ends the acquisition. The subscribers of the Doppler stream, which align
+ *   the stimulus events, are told of the end after the last frame, as they are when
+ *   the acquisition completes by itself.
+ * - acq_reconfigure: replaces the configuration of the hardware, a running acquisition
+ *   is restarted with it.
+ * - publish_atom + StimulusEvent: forwards a trigger or paradigm event to the
+ *   subscribers of the Doppler stream, which align it on their frames. The event is
+ *   timestamped by its source and forwarded at once: it does not go through the ring
+ *   nor delay the frames.
+ * - get_atom: returns the state of the session.
  */
-acq_module_actor::behavior_type acquisition_actor_behavior(
-    acq_module_actor::pointer self);
+class acquisition_session_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: configuration of the simulated acquisition hardware
+	 * @param: sequence cache and replay of the session
+	 */
+	acquisition_session_state(acq_module_actor::pointer_view self,
+	                          SimulatorConfig simulatorConfig,
+	                          AcquisitionConfig acquisitionConfig);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	acq_module_actor::behavior_type make_behavior();
+
+private:
+	void start(const AcquisitionParameters& parameters);
+	void subscribe(frame::FrameStream stream, caf::actor subscriber);
+	void unsubscribe(frame::FrameStream stream, const caf::actor& subscriber);
+	void pause();
+	void stop();
+	caf::result<void> reconfigure(const SimulatorConfig& simulatorConfig);
+	void forwardStimulus(const frame::StimulusEvent& event);
+
+	// Sends acq_stop to the consumers of the stimulus events, after the last frame of
+	// the acquisition
+	void notifyEnd();
+
+	// Changes the state of the session, traced by the acquisition_transition probe
+	void setState(AcquisitionState state);
+
+	// Publishes the frames handed over by the driver, then schedules the next drain
+	void drainFrames();
+
+	// Streams with subscribers
+	[[nodiscard]] frame::StreamMask activeStreams() const;
+
+	// Ptr to current actor
+	acq_module_actor::pointer_view _self;
+
+	AcquisitionModule _acqModule;
+	StreamSimulators _simulators;
+
+	// Capture replayed instead of the hardware, opened by the first acquisition
+	std::string _replayFile;
+	recorder::ReplaySpeed _replaySpeed{recorder::ReplaySpeed::Original};
+	std::shared_ptr<RecordedFrameSource> _replay;
+
+	// Receivers of the frames of each stream, kept between acquisitions
+	std::array<std::vector<caf::actor>, frame::frame_stream_count> _subscribers;
+	AcquisitionParameters _parameters;
+
+	AcquisitionState _state{AcquisitionState::Idle};
+
+	// Hand-off from the thread of the hardware, kept between acquisitions. The driver
+	// only lives while the acquisition is running, it is declared last to be destroyed
+	// before the ring.
+	std::unique_ptr<FrameRing> _ring;
+	std::unique_ptr<FrameDriver> _driver;
+
+	// Frames drained at each activation, its capacity is reused
+	std::vector<frame::AcquisitionFrame> _batch;
+
+	// Next activation of drainFrames, disposed on pause and stop
+	caf::disposable _nextDrain;
+
+	// Frames of the current acquisition: Doppler frames produced by the drivers stopped
+	// by a pause, and frames published
+	uint64_t _framesProduced{0};
+	uint64_t _framesPublished{0};
+
+	// Overflows of the ring already reported
+	uint64_t _reportedOverflows{0};
+};
 
 }  // namespace acq_module
 
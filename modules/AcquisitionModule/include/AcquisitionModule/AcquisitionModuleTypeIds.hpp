@@ -15,9 +15,67 @@
 
 #include "CAF/CustomMessageIdentifier.hpp"
 
+#include "AcquisitionParameters.hpp"
+#include "AcquisitionState.hpp"
+#include "ModuleusSimulator.hpp"
+
 // Creates custom message types for the acquisition module
 CAF_BEGIN_TYPE_ID_BLOCK(custom_types_acq_module, common_caf::custom_types_acq_module_id)
-CAF_ADD_ATOM(custom_types_acq_module, acq_request)
+CAF_ADD_TYPE_ID(custom_types_acq_module, (acq_module::AcquisitionState))
+CAF_ADD_TYPE_ID(custom_types_acq_module, (acq_module::SimulatorConfig))
+CAF_ADD_TYPE_ID(custom_types_acq_module, (acq_module::AcquisitionParameters))
+CAF_ADD_ATOM(custom_types_acq_module, acq_start)
+CAF_ADD_ATOM(custom_types_acq_module, acq_pause)
+CAF_ADD_ATOM(custom_types_acq_module, acq_stop)
+CAF_ADD_ATOM(custom_types_acq_module, acq_reconfigure)
+CAF_ADD_ATOM(custom_types_acq_module, acq_subscribe)
+CAF_ADD_ATOM(custom_types_acq_module, acq_unsubscribe)
 CAF_END_TYPE_ID_BLOCK(custom_types_acq_module)
 
+namespace acq_module
+{
+
+// Inspect functions needed by CAF to serialize the custom message types
+
+template <class Inspector>
+bool inspect(Inspector& f, AcquisitionState& state)
+{
+	return caf::default_enum_inspect(f, state);
+}
+
+template <class Inspector>
+bool inspect(Inspector& f, SimulatorConfig& cfg)
+{
+	return f.object(cfg).fields(f.field("kind", cfg.kind),
+	                            f.field("depth-samples", cfg.depth_samples),
+	                            f.field("lateral-samples", cfg.lateral_samples),
+	                            f.field("channels", cfg.channels),
+	                            f.field("frame-rate", cfg.frame_rate),
+	                            f.field("bmode-rate", cfg.bmode_rate),
+	                            f.field("frame-count", cfg.frame_count),
+	                            f.field("noise-level", cfg.noise_level),
+	                            f.field("tissue-amplitude", cfg.tissue_amplitude),
+	                            f.field("flow-amplitude", cfg.flow_amplitude),
+	                            f.field("flow-velocity", cfg.flow_velocity),
+	                            f.field("buffer-count", cfg.buffer_count),
+	                            f.field("seed", cfg.seed));
+}
+
+template <class Inspector>
+bool inspect(Inspector& f, AcquisitionParameters& parameters)
+{
+	return f.object(parameters)
+	    .fields(f.field("angle-count", parameters.angle_count),
+	            f.field("max-angle", parameters.max_angle),
+	            f.field("element-count", parameters.element_count),
+	            f.field("pitch", parameters.pitch),
+	            f.field("center-frequency", parameters.center_frequency),
+	            f.field("sampling-frequency", parameters.sampling_frequency),
+	            f.field("sound-speed", parameters.sound_speed),
+	            f.field("depth-samples", parameters.depth_samples),
+	            f.field("apodization-taper", parameters.apodization_taper));
+}
+
+}  // namespace acq_module
+
 #endif  // ACQUISITIONMODULE_ACQUISITIONMODULETYPEIDS_HPP
@@ -0,0 +1,74 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_ACQUISITIONPARAMETERS_HPP
+#define ACQUISITIONMODULE_ACQUISITIONPARAMETERS_HPP
+
+#include <concepts>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+namespace acq_module
+{
+
+/**
+ * \struct AcquisitionParameters
+ *
+ * @brief Parameters of an ultrasound sequence: plane waves steered between -max_angle
+ * and +max_angle, sent and received by a linear probe. Sent with the acquisition
+ * request, each workflow uses its own small set of sequences.
+ */
+struct AcquisitionParameters
+{
+	// Plane waves per compounded frame
+	uint32_t angle_count = 11;
+	// Steering of the outermost plane waves, in degrees
+	float max_angle = 10.0f;
+	// Elements of the probe, and distance between two of them in meters
+	uint32_t element_count = 128;
+	float pitch = 0.1e-3f;
+	// Hz
+	float center_frequency = 15.625e6f;
+	float sampling_frequency = 62.5e6f;
+	// m/s
+	float sound_speed = 1540.0f;
+	// Samples received per element and plane wave
+	uint32_t depth_samples = 256;
+	// Tapered part of the receive apodization (0: rectangular, 1: Hann)
+	float apodization_taper = 0.25f;
+
+	bool operator==(const AcquisitionParameters&) const = default;
+};
+
+/**
+ * @brief References to the fields of the parameters, in a fixed order: used to hash and
+ * to persist them.
+ */
+template <class Parameters>
+    requires std::same_as<std::remove_const_t<Parameters>, AcquisitionParameters>
+constexpr auto fieldsOf(Parameters& parameters)
+{
+	return std::tie(parameters.angle_count, parameters.max_angle,
+	                parameters.element_count, parameters.pitch,
+	                parameters.center_frequency, parameters.sampling_frequency,
+	                parameters.sound_speed, parameters.depth_samples,
+	                parameters.apodization_taper);
+}
+
+/**
+ * @brief Hash of the parameters (FNV-1a of their fields), identifies a compiled sequence
+ * in memory and on disk.
+ */
+[[nodiscard]] uint64_t hashOf(const AcquisitionParameters& parameters);
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_ACQUISITIONPARAMETERS_HPP
@@ -0,0 +1,134 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_ACQUISITIONSTATE_HPP
+#define ACQUISITIONMODULE_ACQUISITIONSTATE_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace acq_module
+{
+
+/**
+ * @enum AcquisitionState
+ * @brief State of the acquisition session.
+ */
+enum class AcquisitionState : uint8_t
+{
+	Idle,     // No acquisition, or the last one was stopped or completed
+	Running,  // Frames are produced and published
+	Paused    // Frames are suspended, the acquisition resumes where it stopped
+};
+
+/**
+ * @brief Converts an AcquisitionState enum value to its string representation.
+ * @param state The AcquisitionState enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(AcquisitionState state)
+{
+	using namespace std::string_literals;
+
+	switch (state)
+	{
+	case AcquisitionState::Idle:
+		return "idle"s;
+	case AcquisitionState::Running:
+		return "running"s;
+	case AcquisitionState::Paused:
+		return "paused"s;
+	}
+
+	throw std::domain_error("Invalid value for AcquisitionState: " +
+	                        std::to_string(std::to_underlying(state)));
+}
+
+/**
+ * @brief Attempts to convert a string to an AcquisitionState enum value.
+ * @param str The string to convert.
+ * @param state Reference to the AcquisitionState enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, AcquisitionState& state)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "idle"sv)
+	{
+		state = AcquisitionState::Idle;
+		status = true;
+	}
+	else if (str == "running"sv)
+	{
+		state = AcquisitionState::Running;
+		status = true;
+	}
+	else if (str == "paused"sv)
+	{
+		state = AcquisitionState::Paused;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to an AcquisitionState enum value.
+ * @param value The integer value to convert.
+ * @param state Reference to the AcquisitionState enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<AcquisitionState> value,
+                                          AcquisitionState& state)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(AcquisitionState::Idle):
+		state = AcquisitionState::Idle;
+		status = true;
+		break;
+	case std::to_underlying(AcquisitionState::Running):
+		state = AcquisitionState::Running;
+		status = true;
+		break;
+	case std::to_underlying(AcquisitionState::Paused):
+		state = AcquisitionState::Paused;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace acq_module
+
+/**
+ * @brief Specialization of the std::format for AcquisitionState. Needed for logging
+ */
+template <>
+struct std::formatter<acq_module::AcquisitionState>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const acq_module::AcquisitionState& state, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", acq_module::to_string(state));
+	}
+};
+
+#endif  // ACQUISITIONMODULE_ACQUISITIONSTATE_HPP
@@ -0,0 +1,64 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_FRAMEDRIVER_HPP
+#define ACQUISITIONMODULE_FRAMEDRIVER_HPP
+
+#include <cstdint>
+
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/FrameStream.hpp"
+#include "Frame/SpscRing.hpp"
+
+namespace acq_module
+{
+
+// Ring between the thread of the hardware and the acquisition session
+using FrameRing = frame::SpscRing<frame::AcquisitionFrame>;
+
+/**
+ * \class FrameDriver
+ *
+ * @brief Source of the frames of an acquisition, running on a thread of its own and
+ * handing the frames over to the acquisition session through a FrameRing. Implemented by
+ * the hardware (ModuleusDriver) and by the replay of a capture (RecordedFrameDriver):
+ * the session and its subscribers do not know which one runs.
+ *
+ * The thread runs from the construction to the destruction of the driver, or until its
+ * frame budget is spent.
+ */
+class FrameDriver
+{
+public:
+	// Ctor
+	FrameDriver() = default;
+
+	// Dtor. Stops and joins the thread of the driver.
+	virtual ~FrameDriver() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	FrameDriver(const FrameDriver&) = delete;
+	FrameDriver& operator=(const FrameDriver&) = delete;
+	FrameDriver(FrameDriver&&) = delete;
+	FrameDriver& operator=(FrameDriver&&) = delete;
+
+	// Changes the streams delivered, from any thread
+	virtual void setActiveStreams(frame::StreamMask activeStreams) = 0;
+
+	// Frames of the Doppler stream produced so far, counted in the frame budget
+	[[nodiscard]] virtual uint64_t producedCount() const = 0;
+
+	// True once the frame budget is spent, or the source exhausted
+	[[nodiscard]] virtual bool finished() const = 0;
+};
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_FRAMEDRIVER_HPP
@@ -0,0 +1,118 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_MODULEUSDRIVER_HPP
+#define ACQUISITIONMODULE_MODULEUSDRIVER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/FrameStream.hpp"
+
+#include "FrameDriver.hpp"
+#include "ModuleusSimulator.hpp"
+
+namespace acq_module
+{
+
+/**
+ * \class ModuleusDriver
+ *
+ * @brief Delivers the frames of the hardware on a thread of its own, as the DMA
+ * callback of the Moduleus would. Until the driver is integrated the frames come from
+ * the simulators of the streams, each paced at its own frame rate and interleaved in
+ * the order of their due time.
+ *
+ * The frames of the streams without subscribers are skipped: they are not generated
+ * and cost nothing downstream. The frame budget counts the frames of the Doppler
+ * stream, skipped or not.
+ *
+ * The thread only hands the frames over through the FrameRing and never waits for the
+ * actor system nor for the allocator: when the ring is full the frame is dropped and
+ * counted as an overflow of the ring, and when all the buffers of the simulator are held
+ * downstream the frame is dropped and counted by its pool. The frames are read by the
+ * acquisition session.
+ *
+ * The thread runs from the construction to the destruction of the driver, or until the
+ * frame budget is spent.
+ */
+class ModuleusDriver : public FrameDriver
+{
+public:
+	/**
+	 * @brief: Ctor. Starts the thread of the hardware.
+	 * @param simulators generators of the frames of each stream
+	 * @param ring receives the frames, must outlive the driver
+	 * @param frameBudget frames of the Doppler stream to deliver, 0 until the driver is
+	 * destroyed
+	 * @param activeStreams streams delivered, the others are skipped
+	 * @throws std::invalid_argument if there is no simulator for the Doppler stream
+	 */
+	ModuleusDriver(StreamSimulators simulators,
+	               FrameRing& ring,
+	               uint64_t frameBudget,
+	               frame::StreamMask activeStreams);
+
+	// Dtor. Stops and joins the thread of the hardware.
+	~ModuleusDriver() override = default;
+
+	// Do not allow other types of ctor/assignment operators
+	ModuleusDriver(const ModuleusDriver&) = delete;
+	ModuleusDriver& operator=(const ModuleusDriver&) = delete;
+	ModuleusDriver(ModuleusDriver&&) = delete;
+	ModuleusDriver& operator=(ModuleusDriver&&) = delete;
+
+	// Changes the streams delivered, from any thread
+	void setActiveStreams(frame::StreamMask activeStreams) override
+	{
+		_activeStreams.store(activeStreams, std::memory_order_release);
+	}
+
+	// Frames of the Doppler stream produced by the hardware: delivered, dropped or
+	// skipped
+	[[nodiscard]] uint64_t producedCount() const override
+	{
+		return _produced.load(std::memory_order_acquire);
+	}
+
+	// True once the frame budget is spent
+	[[nodiscard]] bool finished() const override
+	{
+		return _finished.load(std::memory_order_acquire);
+	}
+
+private:
+	void run(std::stop_token stopToken);
+
+	StreamSimulators _simulators;
+	FrameRing& _ring;
+	const uint64_t _frameBudget;
+	std::atomic<frame::StreamMask> _activeStreams;
+
+	std::atomic<uint64_t> _produced{0};
+	std::atomic<bool> _finished{false};
+
+	// Wakes the thread up early when it is stopped
+	std::mutex _pacingMutex;
+	std::condition_variable_any _pacing;
+
+	// Last member: started once the others are initialized, joined first
+	std::jthread _thread;
+};
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_MODULEUSDRIVER_HPP
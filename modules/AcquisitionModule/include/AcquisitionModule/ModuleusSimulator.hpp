@@ -0,0 +1,169 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_MODULEUSSIMULATOR_HPP
+#define ACQUISITIONMODULE_MODULEUSSIMULATOR_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/FrameStream.hpp"
+#include "Frame/SampleBufferPool.hpp"
+
+namespace acq_module
+{
+
+/**
+ * \struct SimulatorConfig
+ *
+ * @brief Configuration of the Moduleus simulator, as read from the "icograph.simulator"
+ * section of the CAF configuration file.
+ */
+struct SimulatorConfig
+{
+	// "iq": compounded IQ frames, "rf": raw RF channel data
+	std::string kind = "iq";
+	uint32_t depth_samples = 256;
+	// Pixels per line of the IQ frames
+	uint32_t lateral_samples = 128;
+	// Channels of the RF frames
+	uint32_t channels = 128;
+	// Frames per second
+	double frame_rate = 1000.0;
+	// B-mode frames per second, interleaved with the frames above (0: no B-mode stream)
+	double bmode_rate = 20.0;
+	// Frames per acquisition, 0 until the acquisition is stopped
+	uint64_t frame_count = 0;
+	// Standard deviation of the white noise
+	float noise_level = 0.05f;
+	// Amplitude of the static tissue speckle
+	float tissue_amplitude = 1.0f;
+	// Amplitude of the blood speckle, inside the simulated vessel
+	float flow_amplitude = 0.1f;
+	// Doppler shift at the center of the vessel, as a fraction of the Nyquist frequency
+	// (frame_rate / 2)
+	float flow_velocity = 0.25f;
+	// Preallocated frame buffers
+	uint32_t buffer_count = 32;
+	uint32_t seed = 1;
+};
+
+/**
+ * \class ModuleusSimulator
+ *
+ * @brief Generates acquisition frames with the statistics of the Moduleus hardware:
+ * static tissue speckle, blood speckle rotating at the Doppler frequency of a parabolic
+ * flow in a horizontal vessel, and white noise. RF frames are the same signal modulated
+ * by a carrier at a quarter of the sampling frequency.
+ *
+ * Everything is precomputed except the noise and the rotation of the blood signal: the
+ * per-frame loops are plain arrays loops vectorized by the compiler, writing into
+ * buffers of a SampleBufferPool. A 256x128 frame takes a few tens of microseconds,
+ * kHz rates fit on one core.
+ *
+ * The simulator does not pace the frames: the caller emits them every framePeriod().
+ */
+class ModuleusSimulator
+{
+public:
+	/**
+	 * @brief: Ctor. Precomputes the signal of the scene and allocates the buffers.
+	 * @param cfg configuration of the simulator
+	 * @param stream stream of the generated frames
+	 * @throws std::invalid_argument if the configuration is invalid
+	 */
+	explicit ModuleusSimulator(const SimulatorConfig& cfg,
+	                           frame::FrameStream stream = frame::FrameStream::Doppler);
+
+	// Dtor
+	~ModuleusSimulator() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	ModuleusSimulator(const ModuleusSimulator&) = delete;
+	ModuleusSimulator& operator=(const ModuleusSimulator&) = delete;
+	ModuleusSimulator(ModuleusSimulator&&) = delete;
+	ModuleusSimulator& operator=(ModuleusSimulator&&) = delete;
+
+	/**
+	 * @brief Generates the next frame of the acquisition. Never allocates: if all the
+	 * buffers are in use, the frame is numbered but has no samples, and is dropped.
+	 */
+	[[nodiscard]] frame::AcquisitionFrame nextFrame();
+
+	// Time between two frames
+	[[nodiscard]] std::chrono::nanoseconds framePeriod() const;
+
+	[[nodiscard]] frame::FrameStream stream() const { return _stream; }
+	[[nodiscard]] frame::FrameKind kind() const { return _kind; }
+	[[nodiscard]] const frame::FrameGeometry& geometry() const { return _geometry; }
+
+	// Frames generated so far
+	[[nodiscard]] uint64_t frameCount() const { return _sequence; }
+
+	// Frame buffers, to monitor their reuse
+	[[nodiscard]] const frame::SampleBufferPool& pool() const { return _pool; }
+
+private:
+	// Independent generators of the noise, processed together by the vector units
+	static constexpr std::size_t noise_lanes = 16;
+
+	// Fills the first `count` values of _noise
+	void generateNoise(std::size_t count);
+
+	// Rotates the blood signal by one frame
+	void advanceFlow();
+
+	SimulatorConfig _cfg;
+	frame::FrameStream _stream{frame::FrameStream::Doppler};
+	frame::FrameKind _kind{frame::FrameKind::CompoundedIq};
+	frame::FrameGeometry _geometry;
+	frame::SampleBufferPool _pool;
+
+	// Number of complex samples of the simulated grid (depth x lines or channels)
+	std::size_t _gridSize{0};
+
+	// Static tissue speckle
+	std::vector<float> _tissueI;
+	std::vector<float> _tissueQ;
+
+	// Blood signal, its amplitude and its Doppler rotation per frame
+	std::vector<float> _flowI;
+	std::vector<float> _flowQ;
+	std::vector<float> _flowAmplitude;
+	std::vector<float> _rotationCos;
+	std::vector<float> _rotationSin;
+	// Depth samples of the vessel [begin, end)
+	std::size_t _vesselBegin{0};
+	std::size_t _vesselEnd{0};
+
+	// Carrier of the RF frames, per depth sample
+	std::vector<float> _carrierCos;
+	std::vector<float> _carrierSin;
+
+	// Noise of the current frame (I and Q) and state of the generators
+	std::vector<float> _noise;
+	std::array<uint32_t, noise_lanes> _noiseState{};
+	float _noiseScale{0.0f};
+
+	uint64_t _sequence{0};
+};
+
+// Simulators of the streams of an acquisition, null for the streams not produced
+using StreamSimulators =
+    std::array<std::shared_ptr<ModuleusSimulator>, frame::frame_stream_count>;
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_MODULEUSSIMULATOR_HPP
@@ -0,0 +1,115 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_RECORDEDFRAMEDRIVER_HPP
+#define ACQUISITIONMODULE_RECORDEDFRAMEDRIVER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+#include "Frame/FrameStream.hpp"
+#include "Recorder/ReplayActor.hpp"
+
+#include "FrameDriver.hpp"
+#include "RecordedFrameSource.hpp"
+
+namespace acq_module
+{
+
+/**
+ * \class RecordedFrameDriver
+ *
+ * @brief Replays the frames of a capture in place of the hardware, on a thread of its
+ * own. The acquisition session and its subscribers run unchanged.
+ *
+ * - Original speed: the frames keep the delays between their productions, as the
+ *   hardware would deliver them. A full ring drops the frame.
+ * - Max speed: the frames are delivered as fast as the session reads them. A full ring
+ *   holds the thread back instead of dropping the frame.
+ *
+ * The replayed frames are timestamped when delivered, the latencies measured downstream
+ * are those of this session.
+ */
+class RecordedFrameDriver : public FrameDriver
+{
+public:
+	/**
+	 * @brief: Ctor. Starts the thread of the replay, from the current frame of the
+	 * source.
+	 * @param source frames of the capture, read by the thread of the driver only
+	 * @param ring receives the frames, must outlive the driver
+	 * @param frameBudget frames of the Doppler stream to deliver, 0 until the end of the
+	 * capture
+	 * @param activeStreams streams delivered, the others are skipped
+	 * @param speed pace of the replay
+	 */
+	RecordedFrameDriver(std::shared_ptr<RecordedFrameSource> source,
+	                    FrameRing& ring,
+	                    uint64_t frameBudget,
+	                    frame::StreamMask activeStreams,
+	                    recorder::ReplaySpeed speed);
+
+	// Dtor. Stops and joins the thread of the replay.
+	~RecordedFrameDriver() override = default;
+
+	// Do not allow other types of ctor/assignment operators
+	RecordedFrameDriver(const RecordedFrameDriver&) = delete;
+	RecordedFrameDriver& operator=(const RecordedFrameDriver&) = delete;
+	RecordedFrameDriver(RecordedFrameDriver&&) = delete;
+	RecordedFrameDriver& operator=(RecordedFrameDriver&&) = delete;
+
+	void setActiveStreams(frame::StreamMask activeStreams) override
+	{
+		_activeStreams.store(activeStreams, std::memory_order_release);
+	}
+
+	[[nodiscard]] uint64_t producedCount() const override
+	{
+		return _produced.load(std::memory_order_acquire);
+	}
+
+	[[nodiscard]] bool finished() const override
+	{
+		return _finished.load(std::memory_order_acquire);
+	}
+
+private:
+	void run(std::stop_token stopToken);
+
+	// Waits until the given time, false if the driver is stopped meanwhile
+	bool waitUntil(const std::stop_token& stopToken,
+	               std::chrono::steady_clock::time_point due);
+
+	std::shared_ptr<RecordedFrameSource> _source;
+	FrameRing& _ring;
+	const uint64_t _frameBudget;
+	const recorder::ReplaySpeed _speed;
+	std::atomic<frame::StreamMask> _activeStreams;
+
+	std::atomic<uint64_t> _produced{0};
+	std::atomic<bool> _finished{false};
+
+	// Wakes the thread up early when it is stopped
+	std::mutex _pacingMutex;
+	std::condition_variable_any _pacing;
+
+	// Last member: started once the others are initialized, joined first
+	std::jthread _thread;
+};
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_RECORDEDFRAMEDRIVER_HPP
@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_RECORDEDFRAMESOURCE_HPP
+#define ACQUISITIONMODULE_RECORDEDFRAMESOURCE_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <utility>
+
+#include <caf/actor_system.hpp>
+
+#include "CAF/CustomActorIdentifier.hpp"
+#include "Frame/AcquisitionFrame.hpp"
+#include "Recorder/MappedCapture.hpp"
+
+namespace acq_module
+{
+
+/**
+ * \class RecordedFrameSource
+ *
+ * @brief Frames acquired during a recorded session, read back from its capture file
+ * (see recorder::MessageRecorder) in the order of their production.
+ *
+ * The capture holds one copy of a frame per consumer which received it, processed or
+ * not: only the frames received by one consumer are read, by default the domain model,
+ * which takes the frames of the acquisition as stored. The records of the other
+ * receivers are skipped on their header, without being deserialized. Of the frames
+ * received, only those of the hardware (IQ or RF) are returned, the processed ones are
+ * skipped. A frame recorded at a reduced precision (see frame::PackedFrame) is unpacked.
+ * The other messages of the capture are skipped.
+ */
+class RecordedFrameSource
+{
+public:
+	/**
+	 * @brief: Ctor. Maps the capture file.
+	 * @param system actor system used to deserialize the messages
+	 * @param filename capture of the session
+	 * @param receiver registry ID of the consumer whose frames are read
+	 * @throws std::runtime_error if the file cannot be read or is not a capture file
+	 */
+	RecordedFrameSource(caf::actor_system& system,
+	                    const std::filesystem::path& filename,
+	                    caf::actor_id receiver = common_caf::custom_domain_model_actor_id);
+
+	// Dtor
+	~RecordedFrameSource() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	RecordedFrameSource(const RecordedFrameSource&) = delete;
+	RecordedFrameSource& operator=(const RecordedFrameSource&) = delete;
+	RecordedFrameSource(RecordedFrameSource&&) = delete;
+	RecordedFrameSource& operator=(RecordedFrameSource&&) = delete;
+
+	/**
+	 * @brief Reads the next frame of the capture.
+	 * @return the frame as recorded, or std::nullopt at the end of the capture
+	 * @throws std::runtime_error if the capture is truncated or cannot be deserialized
+	 */
+	[[nodiscard]] std::optional<frame::AcquisitionFrame> nextFrame();
+
+	// Returns a frame read but not delivered: it is the next frame read
+	void unread(frame::AcquisitionFrame frame) { _unread = std::move(frame); }
+
+	// Goes back to the first frame of the capture
+	void rewind();
+
+	// Frames read since the last rewind
+	[[nodiscard]] uint64_t frameCount() const { return _frameCount; }
+
+private:
+	caf::actor_system& _system;
+	recorder::MappedCapture _capture;
+	caf::actor_id _receiver;
+
+	std::optional<frame::AcquisitionFrame> _unread;
+	uint64_t _frameCount{0};
+};
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_RECORDEDFRAMESOURCE_HPP
@@ -0,0 +1,124 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef ACQUISITIONMODULE_SEQUENCECACHE_HPP
+#define ACQUISITIONMODULE_SEQUENCECACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "AcquisitionParameters.hpp"
+
+namespace acq_module
+{
+
+/**
+ * \struct CompiledSequence
+ *
+ * @brief Tables of a sequence, computed from its parameters before the acquisition.
+ */
+struct CompiledSequence
+{
+	AcquisitionParameters parameters;
+
+	// Transmit delay of each element, in seconds [angle][element]
+	std::vector<float> transmit_delays;
+
+	// Receive weight of each element [element]
+	std::vector<float> apodization;
+
+	// Receive time of flight from a pixel to an element, in samples [depth][offset].
+	// The pixels are on the grid of the elements: the delay only depends on the depth of
+	// the pixel and on its lateral offset to the element, in pitches.
+	std::vector<float> receive_delays;
+
+	bool operator==(const CompiledSequence&) const = default;
+};
+
+/**
+ * @brief Steering of a plane wave of the sequence, in radians. The angles are evenly
+ * spread from -max_angle to +max_angle.
+ */
+[[nodiscard]] float steeringAngle(const AcquisitionParameters& parameters,
+                                  std::size_t angle);
+
+/**
+ * @brief Computes the tables of a sequence.
+ * @throws std::invalid_argument if the parameters cannot describe a sequence
+ */
+[[nodiscard]] CompiledSequence compileSequence(const AcquisitionParameters& parameters);
+
+/**
+ * \class SequenceCache
+ *
+ * @brief Compiled sequences, kept in memory and in a directory, by hash of their
+ * parameters. A sequence is compiled once, later requests find it in memory, or on disk
+ * after a restart of the application.
+ *
+ * Files are written in the native byte order, their header stores the parameters to
+ * tell a hash collision or a stale file from a valid one. An unreadable file is
+ * replaced. The disk is optional: failures to write are logged and ignored.
+ */
+class SequenceCache
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param directory where the sequences are persisted, created if needed. Empty for a
+	 * cache in memory only.
+	 */
+	explicit SequenceCache(std::filesystem::path directory);
+
+	// Dtor
+	~SequenceCache() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	SequenceCache(const SequenceCache&) = delete;
+	SequenceCache& operator=(const SequenceCache&) = delete;
+	SequenceCache(SequenceCache&&) = delete;
+	SequenceCache& operator=(SequenceCache&&) = delete;
+
+	/**
+	 * @brief Returns the sequence of the parameters, compiled if it is not cached.
+	 * @throws std::invalid_argument if the parameters cannot describe a sequence
+	 */
+	std::shared_ptr<const CompiledSequence> get(const AcquisitionParameters& parameters);
+
+	// Requests served from memory, from disk, and compiled
+	[[nodiscard]] uint64_t memoryHits() const { return _memoryHits; }
+	[[nodiscard]] uint64_t diskHits() const { return _diskHits; }
+	[[nodiscard]] uint64_t compilations() const { return _compilations; }
+
+private:
+	[[nodiscard]] std::filesystem::path fileOf(uint64_t hash) const;
+
+	// Reads the sequence of the parameters, nullptr if there is none or it is invalid
+	std::shared_ptr<CompiledSequence> load(uint64_t hash,
+	                                       const AcquisitionParameters& parameters) const;
+	void store(uint64_t hash, const CompiledSequence& sequence) const;
+
+	std::filesystem::path _directory;
+
+	// Keyed by hash: a collision replaces the sequence, it is not expected with a
+	// handful of sequences
+	std::unordered_map<uint64_t, std::shared_ptr<const CompiledSequence>> _sequences;
+
+	uint64_t _memoryHits{0};
+	uint64_t _diskHits{0};
+	uint64_t _compilations{0};
+};
+
+}  // namespace acq_module
+
+#endif  // ACQUISITIONMODULE_SEQUENCECACHE_HPP
@@ -8,7 +8,12 @@
  * Author: Alyson Roger <alyson.roger@iconeus.com>
  */
 
+#include <chrono>
 #include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 #include "Logger/Logger.hpp"
 
@@ -17,9 +22,122 @@
 namespace acq_module
 {
 
-void AcquisitionModule::acquisitionRequest(int32_t parameterValue)
+namespace
 {
-	MEDLOG_INFO("Acquisition request received with value: {}", parameterValue);
+// --------------------------------------------------------------------
+/**
+ * @brief Creates the simulators of the streams of a configuration.
+ * @throws std::invalid_argument if the configuration is invalid
+ */
+StreamSimulators simulatorsOf(const SimulatorConfig& cfg)
+{
+	if (!(cfg.bmode_rate >= 0.0))
+	{
+		throw std::invalid_argument("Invalid simulator B-mode rate: " +
+		                            std::to_string(cfg.bmode_rate));
+	}
+
+	StreamSimulators simulators;
+	simulators[std::to_underlying(frame::FrameStream::Doppler)] =
+	    std::make_shared<ModuleusSimulator>(cfg, frame::FrameStream::Doppler);
+
+	// Same scene seen by compounded IQ frames at the display rate
+	if (cfg.bmode_rate > 0.0)
+	{
+		SimulatorConfig bmode = cfg;
+		bmode.kind = to_string(frame::FrameKind::CompoundedIq);
+		bmode.frame_rate = cfg.bmode_rate;
+		simulators[std::to_underlying(frame::FrameStream::BMode)] =
+		    std::make_shared<ModuleusSimulator>(bmode, frame::FrameStream::BMode);
+	}
+	return simulators;
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Checks that the RF frames of a simulator can be beamformed with a sequence: a
+ * channel per element of the probe, and the samples received per plane wave.
+ * @throws std::invalid_argument otherwise
+ */
+void checkSequence(const ModuleusSimulator& simulator,
+                   const AcquisitionParameters& parameters)
+{
+	const frame::FrameGeometry& geometry = simulator.geometry();
+	if (simulator.kind() == frame::FrameKind::RawRf &&
+	    (geometry.channels != parameters.element_count ||
+	     geometry.depth_samples != parameters.depth_samples))
+	{
+		throw std::invalid_argument(
+		    "Sequence of " + std::to_string(parameters.element_count) + " elements x " +
+		    std::to_string(parameters.depth_samples) +
+		    " samples does not match the RF frames of " +
+		    std::to_string(geometry.channels) + " channels x " +
+		    std::to_string(geometry.depth_samples) + " samples");
+	}
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+AcquisitionModule::AcquisitionModule(const SimulatorConfig& simulatorConfig,
+                                     std::filesystem::path sequenceCache)
+    : _simulatorConfig(simulatorConfig), _sequenceCache(std::move(sequenceCache))
+{
+}
+
+// --------------------------------------------------------------------
+StreamSimulators AcquisitionModule::acquisitionRequest(
+    const AcquisitionParameters& parameters)
+{
+	const auto start = std::chrono::steady_clock::now();
+	// Compiled, or loaded, before the first frame; rejected if invalid
+	static_cast<void>(_sequenceCache.get(parameters));
+	MEDLOG_INFO("Acquisition request received: sequence {:016x} ready in {} us ({} "
+	            "compiled, {} loaded from disk)",
+	            hashOf(parameters),
+	            std::chrono::duration_cast<std::chrono::microseconds>(
+	                std::chrono::steady_clock::now() - start)
+	                .count(),
+	            _sequenceCache.compilations(), _sequenceCache.diskHits());
+
+	const std::shared_ptr<ModuleusSimulator>& doppler =
+	    _simulators[std::to_underlying(frame::FrameStream::Doppler)];
+	if (doppler)
+	{
+		checkSequence(*doppler, parameters);
+		return _simulators;
+	}
+
+	_simulators = simulatorsOf(_simulatorConfig);
+	checkSequence(*doppler, parameters);
+	for (const auto& simulator : _simulators)
+	{
+		if (simulator)
+		{
+			MEDLOG_INFO("Simulated {} stream: {} frames {}x{} every {} us",
+			            simulator->stream(), simulator->kind(),
+			            simulator->geometry().depth_samples,
+			            simulator->kind() == frame::FrameKind::CompoundedIq
+			                ? simulator->geometry().lateral_samples
+			                : simulator->geometry().channels,
+			            std::chrono::duration_cast<std::chrono::microseconds>(
+			                simulator->framePeriod())
+			                .count());
+		}
+	}
+	return _simulators;
+}
+
+// --------------------------------------------------------------------
+void AcquisitionModule::reconfigure(const SimulatorConfig& simulatorConfig)
+{
+	// Built before replacing anything: throws on an invalid configuration
+	StreamSimulators simulators = simulatorsOf(simulatorConfig);
+
+	_simulatorConfig = simulatorConfig;
+	_simulators = std::move(simulators);
+	MEDLOG_INFO("Acquisition hardware reconfigured: {} frames at {} Hz, B-mode at {} Hz",
+	            _simulatorConfig.kind, _simulatorConfig.frame_rate,
+	            _simulatorConfig.bmode_rate);
 }
 
 }  // namespace acq_module
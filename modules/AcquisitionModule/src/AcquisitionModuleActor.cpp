@@ -9,101 +9,377 @@
  */
 
 #include <algorithm>
-#include <execution>
+#include <chrono>
+#include <exception>
+#include <utility>
 #include <vector>
 
-#include <caf/actor_registry.hpp>
-#include <caf/event_based_actor.hpp>
-#include <caf/scheduled_actor/flow.hpp>
+#include <caf/error.hpp>
+#include <caf/sec.hpp>
 #include <caf/type_id.hpp>
+#include <caf/typed_event_based_actor.hpp>
 
-#include "AcquisitionModule/AcquisitionModule.hpp"
 #include "AcquisitionModule/AcquisitionModuleActor.hpp"
 #include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "AcquisitionModule/ModuleusDriver.hpp"
+#include "AcquisitionModule/RecordedFrameDriver.hpp"
 #include "CAF/CustomActorIdentifier.hpp"
+#include "Frame/FrameStatistics.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Logger/Logger.hpp"
+#include "Probe/Probe.hpp"
+#include "Recorder/MessageRecorder.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+MEDPROBE_SEMAPHORE(frame_fanout);
+MEDPROBE_SEMAPHORE(acquisition_transition);
 
 namespace acq_module
 {
 
-/**
- * @brief Creates a behavior that generates a stream of data (to be changed later by the
- * acquisition data. For now it returns a stream of integers called "int-flow" ). It shall
- * be used as a source of data for other actors that consume streams.
- *
- * @param self The current actor
- *
- * @return A `caf::behavior` that handles the `caf::get_atom` message.
- */
-static caf::behavior sourceFun(caf::event_based_actor* self)
-{
-	return {[self](caf::get_atom)
-	        {
-		        return self->make_observable().iota(1).take(5).to_stream(
-		            "int-flow", caf::defaults::stream::max_batch_delay, 100);
-	        }};
-}
+/// @brief Period at which the frames handed over by the driver are published
+constexpr caf::timespan drain_period = std::chrono::milliseconds(1);
 
 // --------------------------------------------------------------------
-/**
- * @brief Consumes a stream from a source actor and forwards each item to one or more
- * destination actors.
- *
- * @param self The current actor (must be an `caf::event_based_actor`).
- * @param src The source actor from which the stream is requested.
- * @param dests One or more destination actors to which each item of the stream will be
- * forwarded.
- *
- * @return An empty behavior, as all logic is handled asynchronously.
- */
-static caf::behavior consumeFun(caf::event_based_actor* self,
-                                caf::actor src,
-                                std::vector<caf::actor> destActors)
+acquisition_session_state::acquisition_session_state(acq_module_actor::pointer_view self,
+                                                     SimulatorConfig simulatorConfig,
+                                                     AcquisitionConfig acquisitionConfig)
+    : _self(self),
+      _acqModule(simulatorConfig, std::move(acquisitionConfig.sequence_cache)),
+      _replayFile(std::move(acquisitionConfig.replay_file))
 {
-	self->mail(caf::get_atom_v)
-	    .request(src, caf::infinite)
-	    .then(
-	        [=](caf::stream s)
-	        {
-		        // Turn the stream handle into an observable, then consume it.
-		        self->observe_as<int>(s, 50u, 10u)
-		            .for_each(
-		                [=](int x)
-		                {
-			                // Send each item of the stream to the destinatory actors
-			                std::for_each(
-			                    std::execution::par, destActors.begin(), destActors.end(),
-			                    [self, x](caf::actor destActor)
-			                    { self->mail(caf::publish_atom_v, x).send(destActor); });
-		                });
-	        },
-	        [=](caf::error& err) { self->println("get_atom failed: {}", err); });
-
-	return {};
+	// Checked by the session manager at startup
+	const std::string& speed = acquisitionConfig.replay_speed;
+	static_cast<void>(recorder::from_string(speed, _replaySpeed));
 }
 
 // --------------------------------------------------------------------
-acq_module_actor::behavior_type acquisition_actor_behavior(acq_module_actor::pointer self)
+acq_module_actor::behavior_type acquisition_session_state::make_behavior()
 {
 	return {
-	    [self](acq_request, int32_t parameterValue, std::vector<caf::actor> destActors)
+	    [this](acq_start, AcquisitionParameters parameters)
 	    {
-		    // Handle acquisition request (one day it will be a call to Moduleus
-		    // facade)
-		    AcquisitionModule acqModule;
-		    acqModule.acquisitionRequest(parameterValue);
-
-		    // Producer: Actor in which the flow of acquisition data will pass (this
-		    // is a theory that will be conformed in following work during Moduleus's
-		    // simulator creation).
-		    // The reason we use caf::stream and not plain caf::observable is because
-		    // observables cannot be read simultaneously by several observers at the
-		    // same time.
-		    auto srcActor = self->spawn(sourceFun);
-
-		    // Consumer: Will create an observer for the stream of data and will pass
-		    // the result to the viewer actor
-		    auto consumerActor = self->spawn(consumeFun, srcActor, destActors);
-	    }};
+		    recorder::capture(common_caf::custom_acquisition_actor_id,
+		                      _self->current_sender(), acq_start_v, parameters);
+		    start(parameters);
+	    },
+	    [this](acq_subscribe, frame::FrameStream stream, caf::actor subscriber)
+	    {
+		    recorder::capture(common_caf::custom_acquisition_actor_id,
+		                      _self->current_sender(), acq_subscribe_v, stream,
+		                      subscriber);
+		    subscribe(stream, std::move(subscriber));
+	    },
+	    [this](acq_unsubscribe, frame::FrameStream stream, caf::actor subscriber)
+	    {
+		    recorder::capture(common_caf::custom_acquisition_actor_id,
+		                      _self->current_sender(), acq_unsubscribe_v, stream,
+		                      subscriber);
+		    unsubscribe(stream, subscriber);
+	    },
+	    [this](acq_pause)
+	    {
+		    recorder::capture(common_caf::custom_acquisition_actor_id,
+		                      _self->current_sender(), acq_pause_v);
+		    pause();
+	    },
+	    [this](acq_stop)
+	    {
+		    recorder::capture(common_caf::custom_acquisition_actor_id,
+		                      _self->current_sender(), acq_stop_v);
+		    stop();
+	    },
+	    [this](acq_reconfigure, SimulatorConfig simulatorConfig)
+	    {
+		    recorder::capture(common_caf::custom_acquisition_actor_id,
+		                      _self->current_sender(), acq_reconfigure_v,
+		                      simulatorConfig);
+		    return reconfigure(simulatorConfig);
+	    },
+	    [this](caf::publish_atom, const frame::StimulusEvent& event)
+	    {
+		    recorder::capture(common_caf::custom_acquisition_actor_id,
+		                      _self->current_sender(), caf::publish_atom_v, event);
+		    forwardStimulus(event);
+	    },
+	    [this](caf::get_atom) { return _state; }};
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::start(const AcquisitionParameters& parameters)
+{
+	// A running or paused acquisition of another sequence restarts with the new one
+	const bool restart = _state != AcquisitionState::Idle && parameters != _parameters;
+	if (_state == AcquisitionState::Running && !restart)
+	{
+		MEDLOG_DEBUG("Acquisition already running");
+		return;
+	}
+
+	if (_state == AcquisitionState::Paused && !restart)
+	{
+		// Resume: the frames of the pause are not produced
+		MEDLOG_INFO("Acquisition resumed after {} frames", _framesPublished);
+	}
+	else
+	{
+		// Handle acquisition request (one day it will be a call to Moduleus facade,
+		// for now the frames come from its simulator). An invalid sequence leaves the
+		// current acquisition as it is.
+		try
+		{
+			_simulators = _acqModule.acquisitionRequest(parameters);
+			if (restart)
+			{
+				MEDLOG_INFO("Acquisition restarted with a new sequence after {} frames",
+				            _framesPublished);
+				stop();
+			}
+			if (!_replayFile.empty())
+			{
+				// Each acquisition replays the capture from its beginning
+				if (!_replay)
+				{
+					_replay = std::make_shared<RecordedFrameSource>(_self->system(),
+					                                                _replayFile);
+					MEDLOG_INFO("Acquisitions replayed from {} ({} speed)", _replayFile,
+					            to_string(_replaySpeed));
+				}
+				_replay->rewind();
+			}
+		}
+		catch (const std::exception& e)
+		{
+			MEDLOG_ERROR("Acquisition request rejected: {}", e.what());
+			return;
+		}
+		if (!_ring)
+		{
+			_ring = std::make_unique<FrameRing>(_acqModule.config().buffer_count);
+		}
+		_parameters = parameters;
+		_framesProduced = 0;
+		frame::restartSequenceTracking();
+		_framesPublished = 0;
+		MEDLOG_INFO("Acquisition started: {} Doppler and {} B-mode subscribers",
+		            _subscribers[std::to_underlying(frame::FrameStream::Doppler)].size(),
+		            _subscribers[std::to_underlying(frame::FrameStream::BMode)].size());
+	}
+
+	// No driver if the frame budget was spent before the pause
+	const uint64_t frameCount = _acqModule.config().frame_count;
+	if (frameCount == 0 || _framesProduced < frameCount)
+	{
+		const uint64_t budget = frameCount == 0 ? 0 : frameCount - _framesProduced;
+		if (_replay)
+		{
+			_driver = std::make_unique<RecordedFrameDriver>(
+			    _replay, *_ring, budget, activeStreams(), _replaySpeed);
+		}
+		else
+		{
+			_driver = std::make_unique<ModuleusDriver>(_simulators, *_ring, budget,
+			                                           activeStreams());
+		}
+	}
+	setState(AcquisitionState::Running);
+	_nextDrain = _self->run_delayed(drain_period, [this] { drainFrames(); });
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::subscribe(frame::FrameStream stream,
+                                          caf::actor subscriber)
+{
+	std::vector<caf::actor>& subscribers = _subscribers[std::to_underlying(stream)];
+	if (std::ranges::find(subscribers, subscriber) != subscribers.end())
+	{
+		return;
+	}
+
+	subscribers.push_back(std::move(subscriber));
+	MEDLOG_DEBUG("Acquisition: {} subscribers to the {} stream", subscribers.size(),
+	             stream);
+	if (_driver)
+	{
+		_driver->setActiveStreams(activeStreams());
+	}
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::unsubscribe(frame::FrameStream stream,
+                                            const caf::actor& subscriber)
+{
+	std::vector<caf::actor>& subscribers = _subscribers[std::to_underlying(stream)];
+	if (std::erase(subscribers, subscriber) == 0)
+	{
+		return;
+	}
+
+	MEDLOG_DEBUG("Acquisition: {} subscribers to the {} stream", subscribers.size(),
+	             stream);
+	if (_driver)
+	{
+		_driver->setActiveStreams(activeStreams());
+	}
+}
+
+// --------------------------------------------------------------------
+frame::StreamMask acquisition_session_state::activeStreams() const
+{
+	frame::StreamMask active = 0;
+	for (const frame::FrameStream stream : frame::frame_streams)
+	{
+		if (!_subscribers[std::to_underlying(stream)].empty())
+		{
+			active |= frame::maskOf(stream);
+		}
+	}
+	return active;
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::pause()
+{
+	if (_state != AcquisitionState::Running)
+	{
+		MEDLOG_DEBUG("No acquisition to pause");
+		return;
+	}
+
+	// The frames left in the ring are published on resume
+	_nextDrain.dispose();
+	if (_driver)
+	{
+		_framesProduced += _driver->producedCount();
+		_driver.reset();
+	}
+	setState(AcquisitionState::Paused);
+	MEDLOG_INFO("Acquisition paused after {} frames", _framesPublished);
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::stop()
+{
+	if (_state == AcquisitionState::Idle)
+	{
+		MEDLOG_DEBUG("No acquisition to stop");
+		return;
+	}
+
+	// The frames left in the ring are dropped
+	_nextDrain.dispose();
+	_driver.reset();
+	_ring->drain(_batch, _ring->capacity());
+	_batch.clear();
+	setState(AcquisitionState::Idle);
+	MEDLOG_INFO("Acquisition stopped after {} frames", _framesPublished);
+	notifyEnd();
+}
+
+// --------------------------------------------------------------------
+caf::result<void> acquisition_session_state::reconfigure(
+    const SimulatorConfig& simulatorConfig)
+{
+	const bool wasRunning = _state == AcquisitionState::Running;
+	stop();
+
+	try
+	{
+		_acqModule.reconfigure(simulatorConfig);
+	}
+	catch (const std::exception& e)
+	{
+		MEDLOG_ERROR("Acquisition reconfiguration rejected: {}", e.what());
+		if (wasRunning)
+		{
+			start(_parameters);
+		}
+		return caf::make_error(caf::sec::invalid_argument, e.what());
+	}
+
+	// Sized on the frame buffers of the new configuration
+	_ring.reset();
+	if (wasRunning)
+	{
+		start(_parameters);
+	}
+	return caf::unit;
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::setState(AcquisitionState state)
+{
+	MEDPROBE(acquisition_transition, std::to_underlying(_state),
+	         std::to_underlying(state), medprobe::timestamp());
+	_state = state;
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::forwardStimulus(const frame::StimulusEvent& event)
+{
+	// Events outside of an acquisition are kept: the consumers align them on the
+	// frames of the next one
+	for (const caf::actor& subscriber :
+	     _subscribers[std::to_underlying(frame::FrameStream::Doppler)])
+	{
+		_self->mail(caf::publish_atom_v, event).send(subscriber);
+	}
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::notifyEnd()
+{
+	// After the last frame: the consumers of the events, the storage among them, align
+	// the events left on the frames of the acquisition
+	for (const caf::actor& subscriber :
+	     _subscribers[std::to_underlying(frame::FrameStream::Doppler)])
+	{
+		_self->mail(acq_stop_v).send(subscriber);
+	}
+}
+
+// --------------------------------------------------------------------
+void acquisition_session_state::drainFrames()
+{
+	// A late activation catches up by batches of the throughput quota of the adaptive
+	// tuning
+	_ring->drain(_batch, scheduler::throughputQuota());
+
+	for (const frame::AcquisitionFrame& frame : _batch)
+	{
+		const std::vector<caf::actor>& subscribers =
+		    _subscribers[std::to_underlying(frame.stream)];
+		MEDPROBE(frame_fanout, frame.sequence, medprobe::timestamp(),
+		         subscribers.size());
+		frame::recordFrameArrival(frame::FrameStage::Published, frame);
+
+		// Enqueuing a message is cheap, the samples are shared by the subscribers
+		for (const caf::actor& subscriber : subscribers)
+		{
+			_self->mail(caf::publish_atom_v, frame).send(subscriber);
+		}
+	}
+	_framesPublished += _batch.size();
+	_batch.clear();
+
+	const uint64_t overflows = _ring->overflowCount();
+	if (overflows != _reportedOverflows)
+	{
+		MEDLOG_WARN("Acquisition: {} frames dropped by the hand-off ring ({} in total)",
+		            overflows - _reportedOverflows, overflows);
+		_reportedOverflows = overflows;
+	}
+
+	if ((!_driver || _driver->finished()) && _ring->size() == 0)
+	{
+		_driver.reset();
+		setState(AcquisitionState::Idle);
+		MEDLOG_INFO("Acquisition completed: {} frames", _framesPublished);
+		notifyEnd();
+		return;
+	}
+
+	_nextDrain = _self->run_delayed(drain_period, [this] { drainFrames(); });
 }
 
 }  // namespace acq_module
@@ -0,0 +1,46 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <cstring>
+#include <tuple>
+
+#include "AcquisitionModule/AcquisitionParameters.hpp"
+
+namespace acq_module
+{
+
+namespace
+{
+constexpr uint64_t fnv_offset_basis = 14695981039346656037ULL;
+constexpr uint64_t fnv_prime = 1099511628211ULL;
+
+// --------------------------------------------------------------------
+template <class T>
+void hashField(uint64_t& hash, const T& field)
+{
+	unsigned char bytes[sizeof(T)];
+	std::memcpy(bytes, &field, sizeof(T));
+	for (const unsigned char byte : bytes)
+	{
+		hash = (hash ^ byte) * fnv_prime;
+	}
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+uint64_t hashOf(const AcquisitionParameters& parameters)
+{
+	uint64_t hash = fnv_offset_basis;
+	std::apply([&hash](const auto&... fields) { (hashField(hash, fields), ...); },
+	           fieldsOf(parameters));
+	return hash;
+}
+
+}  // namespace acq_module
@@ -0,0 +1,119 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <array>
+#include <chrono>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+#include "Probe/Probe.hpp"
+
+#include "AcquisitionModule/ModuleusDriver.hpp"
+
+MEDPROBE_SEMAPHORE(frame_produced);
+
+namespace acq_module
+{
+
+namespace
+{
+constexpr std::size_t doppler_stream = std::to_underlying(frame::FrameStream::Doppler);
+
+// --------------------------------------------------------------------
+/**
+ * @brief Checks that the Doppler stream, which paces the budget, is produced.
+ * @throws std::invalid_argument otherwise
+ */
+StreamSimulators validated(StreamSimulators simulators)
+{
+	if (!simulators[doppler_stream])
+	{
+		throw std::invalid_argument("Moduleus driver without Doppler stream");
+	}
+	return simulators;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+ModuleusDriver::ModuleusDriver(StreamSimulators simulators,
+                               FrameRing& ring,
+                               uint64_t frameBudget,
+                               frame::StreamMask activeStreams)
+    : _simulators(validated(std::move(simulators))),
+      _ring(ring),
+      _frameBudget(frameBudget),
+      _activeStreams(activeStreams),
+      _thread([this](std::stop_token stopToken) { run(std::move(stopToken)); })
+{
+}
+
+// --------------------------------------------------------------------
+void ModuleusDriver::run(std::stop_token stopToken)
+{
+	const auto start = std::chrono::steady_clock::now();
+
+	// Frames of each stream due so far, produced or skipped. Paced on the start of the
+	// run: a late frame does not delay the next ones.
+	std::array<uint64_t, frame::frame_stream_count> ticks{};
+	auto dueOf = [&](std::size_t stream)
+	{
+		return start +
+		       _simulators[stream]->framePeriod() * static_cast<int64_t>(ticks[stream]);
+	};
+
+	while (!stopToken.stop_requested() &&
+	       (_frameBudget == 0 || ticks[doppler_stream] < _frameBudget))
+	{
+		// Next frame of the interleaved streams
+		std::size_t next = doppler_stream;
+		for (std::size_t stream = 0; stream < frame::frame_stream_count; ++stream)
+		{
+			if (_simulators[stream] && dueOf(stream) < dueOf(next))
+			{
+				next = stream;
+			}
+		}
+
+		{
+			std::unique_lock lock(_pacingMutex);
+			if (_pacing.wait_until(lock, stopToken, dueOf(next), [] { return false; }) ||
+			    stopToken.stop_requested())
+			{
+				break;
+			}
+		}
+
+		const frame::StreamMask active = _activeStreams.load(std::memory_order_acquire);
+		if (active & frame::maskOf(frame::frame_streams[next]))
+		{
+			frame::AcquisitionFrame frame = _simulators[next]->nextFrame();
+			MEDPROBE(frame_produced, frame.sequence, medprobe::timestamp());
+
+			// Dropped if no buffer was free (counted by the pool), or if the ring is
+			// full: its buffer returns to the pool
+			if (frame.samples)
+			{
+				static_cast<void>(_ring.tryPush(frame));
+			}
+		}
+
+		++ticks[next];
+		if (next == doppler_stream)
+		{
+			_produced.store(ticks[doppler_stream], std::memory_order_release);
+		}
+	}
+
+	_finished.store(_frameBudget != 0 && ticks[doppler_stream] >= _frameBudget,
+	                std::memory_order_release);
+}
+
+}  // namespace acq_module
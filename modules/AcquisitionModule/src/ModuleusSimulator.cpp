@@ -0,0 +1,301 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <stdexcept>
+
+#include "AcquisitionModule/ModuleusSimulator.hpp"
+
+namespace acq_module
+{
+
+namespace
+{
+/// @brief Frames between two renormalizations of the blood signal (rounding drift)
+constexpr uint64_t renormalization_period = 1024;
+
+/// @brief Attenuation of the tissue signal over the depth of the frame (amplitude ratio)
+constexpr float depth_attenuation = 0.3f;
+
+// --------------------------------------------------------------------
+/**
+ * @brief Checks the configuration of the simulator.
+ * @throws std::invalid_argument if the configuration is invalid
+ */
+const SimulatorConfig& validated(const SimulatorConfig& cfg)
+{
+	frame::FrameKind kind{};
+	// Plane wave images, Doppler maps and statistics are computed from the frames
+	if (!frame::from_string(cfg.kind, kind) || kind == frame::FrameKind::PowerDoppler ||
+	    kind == frame::FrameKind::PlaneWaveIq || kind == frame::FrameKind::ColorDoppler ||
+	    kind == frame::FrameKind::PixelStatistics ||
+	    kind == frame::FrameKind::ActivationMap)
+	{
+		throw std::invalid_argument("Invalid simulator frame kind '" + cfg.kind + "'");
+	}
+	const uint32_t lines =
+	    kind == frame::FrameKind::CompoundedIq ? cfg.lateral_samples : cfg.channels;
+	if (cfg.depth_samples == 0 || lines == 0)
+	{
+		throw std::invalid_argument("Invalid simulator geometry: empty frame");
+	}
+	if (!(cfg.frame_rate > 0.0))
+	{
+		throw std::invalid_argument("Invalid simulator frame rate: " +
+		                            std::to_string(cfg.frame_rate));
+	}
+	if (cfg.buffer_count == 0)
+	{
+		throw std::invalid_argument("Invalid simulator buffer count: 0");
+	}
+	return cfg;
+}
+
+// --------------------------------------------------------------------
+frame::FrameKind kindOf(const SimulatorConfig& cfg)
+{
+	frame::FrameKind kind{};
+	static_cast<void>(frame::from_string(cfg.kind, kind));
+	return kind;
+}
+
+// --------------------------------------------------------------------
+frame::FrameGeometry geometryOf(const SimulatorConfig& cfg)
+{
+	return kindOf(cfg) == frame::FrameKind::CompoundedIq
+	           ? frame::FrameGeometry{.depth_samples = cfg.depth_samples,
+	                                  .lateral_samples = cfg.lateral_samples,
+	                                  .channels = 0}
+	           : frame::FrameGeometry{.depth_samples = cfg.depth_samples,
+	                                  .lateral_samples = 0,
+	                                  .channels = cfg.channels};
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+ModuleusSimulator::ModuleusSimulator(const SimulatorConfig& cfg,
+                                     frame::FrameStream stream)
+    : _cfg(validated(cfg)),
+      _stream(stream),
+      _kind(kindOf(cfg)),
+      _geometry(geometryOf(cfg)),
+      _pool(_geometry.sampleCount(_kind), cfg.buffer_count)
+{
+	const std::size_t depth = _geometry.depth_samples;
+	const std::size_t lines = _kind == frame::FrameKind::CompoundedIq
+	                              ? _geometry.lateral_samples
+	                              : _geometry.channels;
+	_gridSize = depth * lines;
+
+	_tissueI.resize(_gridSize);
+	_tissueQ.resize(_gridSize);
+	_flowI.resize(_gridSize);
+	_flowQ.resize(_gridSize);
+	_flowAmplitude.resize(_gridSize);
+	_rotationCos.resize(_gridSize);
+	_rotationSin.resize(_gridSize);
+
+	std::mt19937 generator(_cfg.seed);
+	std::normal_distribution<float> speckle(0.0f, std::numbers::sqrt2_v<float> / 2.0f);
+
+	// Horizontal vessel at mid-depth, parabolic velocity profile
+	const float vesselCenter = static_cast<float>(depth) / 2.0f;
+	const float vesselRadius = std::max(static_cast<float>(depth) / 10.0f, 1.0f);
+	_vesselBegin = depth;
+	_vesselEnd = 0;
+
+	for (std::size_t line = 0; line < lines; ++line)
+	{
+		for (std::size_t z = 0; z < depth; ++z)
+		{
+			const std::size_t p = line * depth + z;
+			const float zRatio = static_cast<float>(z) / static_cast<float>(depth);
+			const float tissue =
+			    _cfg.tissue_amplitude * (1.0f - (1.0f - depth_attenuation) * zRatio);
+			_tissueI[p] = tissue * speckle(generator);
+			_tissueQ[p] = tissue * speckle(generator);
+
+			const float distance = (static_cast<float>(z) - vesselCenter) / vesselRadius;
+			if (std::abs(distance) < 1.0f)
+			{
+				// Blood replaces the tissue inside the vessel
+				_tissueI[p] *= 0.1f;
+				_tissueQ[p] *= 0.1f;
+
+				_flowI[p] = _cfg.flow_amplitude * speckle(generator);
+				_flowQ[p] = _cfg.flow_amplitude * speckle(generator);
+				_flowAmplitude[p] = std::hypot(_flowI[p], _flowQ[p]);
+
+				const float velocity = _cfg.flow_velocity * (1.0f - distance * distance);
+				const float phase = std::numbers::pi_v<float> * velocity;
+				_rotationCos[p] = std::cos(phase);
+				_rotationSin[p] = std::sin(phase);
+
+				_vesselBegin = std::min(_vesselBegin, z);
+				_vesselEnd = std::max(_vesselEnd, z + 1);
+			}
+			else
+			{
+				_rotationCos[p] = 1.0f;
+			}
+		}
+	}
+
+	// Carrier at fs / 4: (1, 0, -1, 0) and (0, 1, 0, -1)
+	if (_kind == frame::FrameKind::RawRf)
+	{
+		_carrierCos.resize(depth);
+		_carrierSin.resize(depth);
+		for (std::size_t z = 0; z < depth; ++z)
+		{
+			const float phase = std::numbers::pi_v<float> / 2.0f * static_cast<float>(z);
+			_carrierCos[z] = std::round(std::cos(phase));
+			_carrierSin[z] = std::round(std::sin(phase));
+		}
+	}
+
+	// Uniform noise in [-1, 1] scaled to the configured standard deviation
+	const std::size_t noiseSize = 2 * _gridSize;
+	_noise.resize((noiseSize + noise_lanes - 1) / noise_lanes * noise_lanes);
+	for (uint32_t& state : _noiseState)
+	{
+		// Xorshift generators must not start at 0
+		state = static_cast<uint32_t>(generator()) | 1U;
+	}
+	_noiseScale = _cfg.noise_level * std::numbers::sqrt3_v<float> / 2147483648.0f;
+}
+
+// --------------------------------------------------------------------
+std::chrono::nanoseconds ModuleusSimulator::framePeriod() const
+{
+	return std::chrono::nanoseconds(static_cast<int64_t>(1e9 / _cfg.frame_rate));
+}
+
+// --------------------------------------------------------------------
+void ModuleusSimulator::generateNoise(std::size_t count)
+{
+	// One xorshift32 generator per lane: the lanes are independent so the inner loop
+	// maps onto the vector registers.
+	// The states are kept in a local copy, which cannot alias the output.
+	std::array<uint32_t, noise_lanes> states = _noiseState;
+	float* noise = _noise.data();
+	const float scale = _noiseScale;
+	for (std::size_t i = 0; i < count; i += noise_lanes)
+	{
+		for (std::size_t lane = 0; lane < noise_lanes; ++lane)
+		{
+			uint32_t state = states[lane];
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			states[lane] = state;
+			noise[i + lane] = static_cast<float>(static_cast<int32_t>(state)) * scale;
+		}
+	}
+	_noiseState = states;
+}
+
+// --------------------------------------------------------------------
+void ModuleusSimulator::advanceFlow()
+{
+	float* flowI = _flowI.data();
+	float* flowQ = _flowQ.data();
+	const float* rotationCos = _rotationCos.data();
+	const float* rotationSin = _rotationSin.data();
+	const std::size_t depth = _geometry.depth_samples;
+
+	// Only the samples of the vessel carry a blood signal
+	for (std::size_t offset = 0; offset < _gridSize; offset += depth)
+	{
+		for (std::size_t p = offset + _vesselBegin; p < offset + _vesselEnd; ++p)
+		{
+			const float i = flowI[p] * rotationCos[p] - flowQ[p] * rotationSin[p];
+			const float q = flowI[p] * rotationSin[p] + flowQ[p] * rotationCos[p];
+			flowI[p] = i;
+			flowQ[p] = q;
+		}
+	}
+
+	// Rotations slowly change the amplitude through rounding errors
+	if (_sequence % renormalization_period == renormalization_period - 1)
+	{
+		for (std::size_t p = 0; p < _gridSize; ++p)
+		{
+			const float amplitude = std::hypot(flowI[p], flowQ[p]);
+			if (amplitude > 0.0f)
+			{
+				flowI[p] *= _flowAmplitude[p] / amplitude;
+				flowQ[p] *= _flowAmplitude[p] / amplitude;
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+frame::AcquisitionFrame ModuleusSimulator::nextFrame()
+{
+	auto buffer = _pool.acquire();
+	if (!buffer)
+	{
+		// All the buffers are held downstream: the frame is dropped, nothing is allocated
+		return frame::AcquisitionFrame{.sequence = _sequence++,
+		                               .timestamp = frame::monotonicTimestamp(),
+		                               .stream = _stream,
+		                               .kind = _kind,
+		                               .geometry = _geometry,
+		                               .samples = nullptr};
+	}
+	float* out = buffer->data();
+
+	generateNoise(2 * _gridSize);
+	advanceFlow();
+
+	const float* tissueI = _tissueI.data();
+	const float* tissueQ = _tissueQ.data();
+	const float* flowI = _flowI.data();
+	const float* flowQ = _flowQ.data();
+	const float* noise = _noise.data();
+
+	if (_kind == frame::FrameKind::CompoundedIq)
+	{
+		for (std::size_t p = 0; p < _gridSize; ++p)
+		{
+			out[2 * p] = tissueI[p] + flowI[p] + noise[2 * p];
+			out[2 * p + 1] = tissueQ[p] + flowQ[p] + noise[2 * p + 1];
+		}
+	}
+	else
+	{
+		const std::size_t depth = _geometry.depth_samples;
+		for (std::size_t channel = 0; channel < _geometry.channels; ++channel)
+		{
+			const std::size_t offset = channel * depth;
+			for (std::size_t z = 0; z < depth; ++z)
+			{
+				const std::size_t p = offset + z;
+				const float i = tissueI[p] + flowI[p] + noise[2 * p];
+				const float q = tissueQ[p] + flowQ[p] + noise[2 * p + 1];
+				out[p] = i * _carrierCos[z] - q * _carrierSin[z];
+			}
+		}
+	}
+
+	return frame::AcquisitionFrame{.sequence = _sequence++,
+	                               .timestamp = frame::monotonicTimestamp(),
+	                               .stream = _stream,
+	                               .kind = _kind,
+	                               .geometry = _geometry,
+	                               .samples = std::move(buffer)};
+}
+
+}  // namespace acq_module
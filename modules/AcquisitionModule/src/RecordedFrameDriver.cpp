@@ -0,0 +1,135 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "Logger/Logger.hpp"
+#include "Probe/Probe.hpp"
+
+#include "AcquisitionModule/RecordedFrameDriver.hpp"
+
+// Defined with the hardware driver
+MEDPROBE_SEMAPHORE_DECLARE(frame_produced);
+
+namespace acq_module
+{
+
+namespace
+{
+/// @brief Period at which a replay at max speed checks for room in the full ring
+constexpr auto full_ring_backoff = std::chrono::microseconds(100);
+}  // namespace
+
+// --------------------------------------------------------------------
+RecordedFrameDriver::RecordedFrameDriver(std::shared_ptr<RecordedFrameSource> source,
+                                         FrameRing& ring,
+                                         uint64_t frameBudget,
+                                         frame::StreamMask activeStreams,
+                                         recorder::ReplaySpeed speed)
+    : _source(std::move(source)),
+      _ring(ring),
+      _frameBudget(frameBudget),
+      _speed(speed),
+      _activeStreams(activeStreams),
+      _thread([this](std::stop_token stopToken) { run(std::move(stopToken)); })
+{
+}
+
+// --------------------------------------------------------------------
+bool RecordedFrameDriver::waitUntil(const std::stop_token& stopToken,
+                                    std::chrono::steady_clock::time_point due)
+{
+	std::unique_lock lock(_pacingMutex);
+	return !_pacing.wait_until(lock, stopToken, due, [] { return false; }) &&
+	       !stopToken.stop_requested();
+}
+
+// --------------------------------------------------------------------
+void RecordedFrameDriver::run(std::stop_token stopToken)
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::optional<int64_t> firstTimestamp;
+
+	uint64_t produced = 0;
+	bool exhausted = false;
+	while (!stopToken.stop_requested() && (_frameBudget == 0 || produced < _frameBudget))
+	{
+		std::optional<frame::AcquisitionFrame> frame;
+		try
+		{
+			frame = _source->nextFrame();
+		}
+		catch (const std::exception& e)
+		{
+			MEDLOG_ERROR("Replay of the acquisition aborted: {}", e.what());
+			exhausted = true;
+			break;
+		}
+		if (!frame)
+		{
+			exhausted = true;
+			break;
+		}
+
+		// Paced on the start of the run, with the delays of the capture
+		if (_speed == recorder::ReplaySpeed::Original)
+		{
+			if (!firstTimestamp)
+			{
+				firstTimestamp = frame->timestamp;
+			}
+			const auto delay =
+			    std::chrono::nanoseconds(frame->timestamp - *firstTimestamp);
+			if (!waitUntil(stopToken, start + delay))
+			{
+				// Delivered by the next driver, after a pause
+				_source->unread(std::move(*frame));
+				break;
+			}
+		}
+
+		const frame::StreamMask active = _activeStreams.load(std::memory_order_acquire);
+		if (active & frame::maskOf(frame->stream))
+		{
+			// No frame is lost at max speed: the session is the bottleneck
+			if (_speed == recorder::ReplaySpeed::Max)
+			{
+				bool stopped = false;
+				while (!stopped && _ring.size() == _ring.capacity())
+				{
+					const auto now = std::chrono::steady_clock::now();
+					stopped = !waitUntil(stopToken, now + full_ring_backoff);
+				}
+				if (stopped)
+				{
+					_source->unread(std::move(*frame));
+					break;
+				}
+			}
+
+			frame->timestamp = frame::monotonicTimestamp();
+			MEDPROBE(frame_produced, frame->sequence, medprobe::timestamp());
+			static_cast<void>(_ring.tryPush(*frame));
+		}
+
+		if (frame->stream == frame::FrameStream::Doppler)
+		{
+			_produced.store(++produced, std::memory_order_release);
+		}
+	}
+
+	_finished.store(exhausted || (_frameBudget != 0 && produced >= _frameBudget),
+	                std::memory_order_release);
+}
+
+}  // namespace acq_module
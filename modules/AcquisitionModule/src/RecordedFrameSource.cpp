@@ -0,0 +1,101 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <caf/binary_deserializer.hpp>
+#include <caf/message.hpp>
+
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/SampleConverter.hpp"
+
+#include "AcquisitionModule/RecordedFrameSource.hpp"
+
+namespace acq_module
+{
+
+namespace
+{
+// --------------------------------------------------------------------
+bool isAcquired(frame::FrameKind kind)
+{
+	return kind == frame::FrameKind::CompoundedIq || kind == frame::FrameKind::RawRf;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+RecordedFrameSource::RecordedFrameSource(caf::actor_system& system,
+                                         const std::filesystem::path& filename,
+                                         caf::actor_id receiver)
+    : _system(system), _capture(filename), _receiver(receiver)
+{
+	rewind();
+}
+
+// --------------------------------------------------------------------
+std::optional<frame::AcquisitionFrame> RecordedFrameSource::nextFrame()
+{
+	if (_unread)
+	{
+		return std::exchange(_unread, std::nullopt);
+	}
+
+	while (std::optional<recorder::CaptureRecord> record = _capture.next())
+	{
+		// The copies received by the other consumers are not deserialized
+		if (record->header.receiver_id != _receiver)
+		{
+			continue;
+		}
+
+		caf::message content;
+		caf::binary_deserializer source{_system, record->payload};
+		if (!source.apply(content))
+		{
+			throw std::runtime_error("Cannot deserialize message to actor " +
+			                         std::to_string(record->header.receiver_id) + ": " +
+			                         caf::to_string(source.get_error()));
+		}
+
+		// The domain model records the frames as it stores them, packed: they are only
+		// unpacked if they are returned
+		if (content.match_elements<caf::publish_atom, frame::AcquisitionFrame>())
+		{
+			const auto& recorded = content.get_as<frame::AcquisitionFrame>(1);
+			if (isAcquired(recorded.kind))
+			{
+				++_frameCount;
+				return recorded;
+			}
+		}
+		else if (content.match_elements<caf::publish_atom, frame::PackedFrame>())
+		{
+			const auto& packed = content.get_as<frame::PackedFrame>(1);
+			if (isAcquired(packed.kind))
+			{
+				++_frameCount;
+				return frame::SampleConverter(packed.precision).unpack(packed);
+			}
+		}
+	}
+	return std::nullopt;
+}
+
+// --------------------------------------------------------------------
+void RecordedFrameSource::rewind()
+{
+	_capture.rewind();
+	_unread.reset();
+	_frameCount = 0;
+}
+
+}  // namespace acq_module
@@ -0,0 +1,316 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <format>
+#include <fstream>
+#include <numbers>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <utility>
+
+#include "Logger/Logger.hpp"
+
+#include "AcquisitionModule/SequenceCache.hpp"
+
+namespace acq_module
+{
+
+namespace
+{
+/// @brief Identifies the files of the sequence cache and the version of their format
+constexpr std::array<char, 8> file_magic{'I', 'C', 'O', 'S', 'E', 'Q', '0', '1'};
+
+// --------------------------------------------------------------------
+/**
+ * @brief Checks the parameters of a sequence.
+ * @throws std::invalid_argument if the parameters cannot describe a sequence
+ */
+void validate(const AcquisitionParameters& parameters)
+{
+	if (parameters.angle_count == 0 || parameters.element_count == 0 ||
+	    parameters.depth_samples == 0)
+	{
+		throw std::invalid_argument("Invalid acquisition sequence: empty");
+	}
+	if (!(parameters.pitch > 0.0f) || !(parameters.sampling_frequency > 0.0f) ||
+	    !(parameters.sound_speed > 0.0f))
+	{
+		throw std::invalid_argument(
+		    "Invalid acquisition sequence: pitch, sampling frequency and sound speed "
+		    "must be positive");
+	}
+	if (!(parameters.max_angle >= 0.0f && parameters.max_angle < 90.0f) ||
+	    !(parameters.apodization_taper >= 0.0f && parameters.apodization_taper <= 1.0f))
+	{
+		throw std::invalid_argument(
+		    "Invalid acquisition sequence: angle or apodization out of range");
+	}
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Tukey window: flat in the middle, cosine tapered on `taper` of its width.
+ */
+float tukey(std::size_t index, std::size_t size, float taper)
+{
+	if (size == 1 || taper <= 0.0f)
+	{
+		return 1.0f;
+	}
+
+	const float x = static_cast<float>(index) / static_cast<float>(size - 1);
+	const float edge = std::min(x, 1.0f - x);
+	if (edge >= taper / 2.0f)
+	{
+		return 1.0f;
+	}
+	return 0.5f * (1.0f + std::cos(2.0f * std::numbers::pi_v<float> / taper *
+	                               (edge - taper / 2.0f)));
+}
+
+// --------------------------------------------------------------------
+template <class T>
+void writeValue(std::ofstream& out, const T& value)
+{
+	out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <class T>
+bool readValue(std::ifstream& in, T& value)
+{
+	return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(T)));
+}
+
+// --------------------------------------------------------------------
+void writeTable(std::ofstream& out, const std::vector<float>& table)
+{
+	writeValue(out, static_cast<uint64_t>(table.size()));
+	out.write(reinterpret_cast<const char*>(table.data()),
+	          static_cast<std::streamsize>(table.size() * sizeof(float)));
+}
+
+/**
+ * @brief Reads a table of the expected size.
+ */
+bool readTable(std::ifstream& in, std::vector<float>& table, std::size_t expectedSize)
+{
+	uint64_t size{0};
+	if (!readValue(in, size) || size != expectedSize)
+	{
+		return false;
+	}
+	table.resize(expectedSize);
+	return static_cast<bool>(
+	    in.read(reinterpret_cast<char*>(table.data()),
+	            static_cast<std::streamsize>(expectedSize * sizeof(float))));
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+float steeringAngle(const AcquisitionParameters& parameters, std::size_t angle)
+{
+	const std::size_t angles = parameters.angle_count;
+	const float ratio =
+	    angles <= 1 ? 0.0f
+	                : 2.0f * static_cast<float>(angle) / static_cast<float>(angles - 1) -
+	                      1.0f;
+	return ratio * parameters.max_angle * std::numbers::pi_v<float> / 180.0f;
+}
+
+// --------------------------------------------------------------------
+CompiledSequence compileSequence(const AcquisitionParameters& parameters)
+{
+	validate(parameters);
+
+	const std::size_t angles = parameters.angle_count;
+	const std::size_t elements = parameters.element_count;
+	const std::size_t depth = parameters.depth_samples;
+	const float c = parameters.sound_speed;
+	const float fs = parameters.sampling_frequency;
+
+	CompiledSequence sequence{.parameters = parameters,
+	                          .transmit_delays = std::vector<float>(angles * elements),
+	                          .apodization = std::vector<float>(elements),
+	                          .receive_delays = std::vector<float>(depth * elements)};
+
+	// Plane waves: the first element to fire is the one on the side of the steering
+	const float center = static_cast<float>(elements - 1) / 2.0f;
+	for (std::size_t a = 0; a < angles; ++a)
+	{
+		const float slope = std::sin(steeringAngle(parameters, a)) / c;
+
+		float* delays = sequence.transmit_delays.data() + a * elements;
+		for (std::size_t e = 0; e < elements; ++e)
+		{
+			delays[e] = (static_cast<float>(e) - center) * parameters.pitch * slope;
+		}
+		const float first = *std::min_element(delays, delays + elements);
+		std::transform(delays, delays + elements, delays,
+		               [first](float delay) { return delay - first; });
+	}
+
+	for (std::size_t e = 0; e < elements; ++e)
+	{
+		sequence.apodization[e] = tukey(e, elements, parameters.apodization_taper);
+	}
+
+	// Depth sample i is received after a round trip to z = i c / (2 fs)
+	for (std::size_t i = 0; i < depth; ++i)
+	{
+		const float z = static_cast<float>(i) * c / (2.0f * fs);
+		float* delays = sequence.receive_delays.data() + i * elements;
+		for (std::size_t offset = 0; offset < elements; ++offset)
+		{
+			const float x = static_cast<float>(offset) * parameters.pitch;
+			delays[offset] = std::hypot(z, x) / c * fs;
+		}
+	}
+
+	return sequence;
+}
+
+// --------------------------------------------------------------------
+SequenceCache::SequenceCache(std::filesystem::path directory)
+    : _directory(std::move(directory))
+{
+	if (_directory.empty())
+	{
+		return;
+	}
+
+	std::error_code error;
+	std::filesystem::create_directories(_directory, error);
+	if (error)
+	{
+		MEDLOG_WARN("Sequence cache kept in memory only, cannot create {}: {}",
+		            _directory.string(), error.message());
+		_directory.clear();
+	}
+}
+
+// --------------------------------------------------------------------
+std::shared_ptr<const CompiledSequence> SequenceCache::get(
+    const AcquisitionParameters& parameters)
+{
+	const uint64_t hash = hashOf(parameters);
+
+	if (auto cached = _sequences.find(hash);
+	    cached != _sequences.end() && cached->second->parameters == parameters)
+	{
+		++_memoryHits;
+		return cached->second;
+	}
+
+	std::shared_ptr<const CompiledSequence> sequence = load(hash, parameters);
+	if (sequence)
+	{
+		++_diskHits;
+	}
+	else
+	{
+		sequence = std::make_shared<const CompiledSequence>(compileSequence(parameters));
+		++_compilations;
+		store(hash, *sequence);
+	}
+
+	_sequences.insert_or_assign(hash, sequence);
+	return sequence;
+}
+
+// --------------------------------------------------------------------
+std::filesystem::path SequenceCache::fileOf(uint64_t hash) const
+{
+	return _directory / std::format("{:016x}.seq", hash);
+}
+
+// --------------------------------------------------------------------
+std::shared_ptr<CompiledSequence> SequenceCache::load(
+    uint64_t hash,
+    const AcquisitionParameters& parameters) const
+{
+	if (_directory.empty())
+	{
+		return nullptr;
+	}
+
+	const std::filesystem::path path = fileOf(hash);
+	std::ifstream in(path, std::ios::binary);
+	if (!in)
+	{
+		return nullptr;
+	}
+
+	std::array<char, file_magic.size()> magic{};
+	uint64_t storedHash{0};
+	auto sequence = std::make_shared<CompiledSequence>();
+	const bool valid =
+	    readValue(in, magic) && magic == file_magic && readValue(in, storedHash) &&
+	    storedHash == hash &&
+	    std::apply([&in](auto&... fields) { return (readValue(in, fields) && ...); },
+	               fieldsOf(sequence->parameters)) &&
+	    sequence->parameters == parameters &&
+	    readTable(in, sequence->transmit_delays,
+	              std::size_t{parameters.angle_count} * parameters.element_count) &&
+	    readTable(in, sequence->apodization, parameters.element_count) &&
+	    readTable(in, sequence->receive_delays,
+	              std::size_t{parameters.depth_samples} * parameters.element_count);
+
+	if (!valid)
+	{
+		MEDLOG_WARN("Invalid sequence file {}, the sequence is compiled again",
+		            path.string());
+		return nullptr;
+	}
+	return sequence;
+}
+
+// --------------------------------------------------------------------
+void SequenceCache::store(uint64_t hash, const CompiledSequence& sequence) const
+{
+	if (_directory.empty())
+	{
+		return;
+	}
+
+	// Written aside then renamed: a reader never sees a partial file
+	const std::filesystem::path path = fileOf(hash);
+	std::filesystem::path partial = path;
+	partial += ".partial";
+	{
+		std::ofstream out(partial, std::ios::binary | std::ios::trunc);
+		writeValue(out, file_magic);
+		writeValue(out, hash);
+		std::apply([&out](const auto&... fields) { (writeValue(out, fields), ...); },
+		           fieldsOf(sequence.parameters));
+		writeTable(out, sequence.transmit_delays);
+		writeTable(out, sequence.apodization);
+		writeTable(out, sequence.receive_delays);
+		if (!out.flush())
+		{
+			MEDLOG_WARN("Cannot write the sequence file {}", partial.string());
+			return;
+		}
+	}
+
+	std::error_code error;
+	std::filesystem::rename(partial, path, error);
+	if (error)
+	{
+		MEDLOG_WARN("Cannot write the sequence file {}: {}", path.string(),
+		            error.message());
+	}
+}
+
+}  // namespace acq_module
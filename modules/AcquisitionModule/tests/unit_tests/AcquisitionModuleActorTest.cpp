@@ -1,40 +1,209 @@
 #include <caf/actor_from_state.hpp>
 #include <caf/test/caf_test_main.hpp>
+#include <caf/test/fixture/deterministic.hpp>
 #include <caf/test/test.hpp>
-#include "caf/test/fixture/deterministic.hpp"
 
-#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameTypeIds.hpp"
 
-/**
- * \struct Definition of the mock-up to simulate the recepting actor
-//  */
-// struct mock_actor_state
-// {
-// 	/**
-// 	 * @brief: Defines the callbacks upon message reception
-// 	 */
-// 	domain_model::domain_model_actor::behavior_type make_behavior()
-// 	{
-// 		return {[this](caf::publish_atom, int x) { _dataReceived.push_back(x); }};
-// 	};
-
-// 	std::vector<int> getReceivedData() { return _dataReceived; };
-
-// private:
-// 	std::vector<int> _dataReceived;
-// };
-
-TEST("a simple test")
-{
-	check_eq(1, 1);
-	// auto mockDomainModelActor = sys.spawn(caf::actor_from_state<mock_actor_state>);
-	// auto mockEchoViewerActor = sys.spawn(caf::actor_from_state<mock_actor_state>);
-
-	// // Spawn acquisition module actor.
-	// auto acquisitionModuleActorHandle =
-	//     sys->spawn(acq_module::acquisition_actor_behavior);
+namespace
+{
+acq_module::SimulatorConfig sessionConfig()
+{
+	acq_module::SimulatorConfig cfg;
+	cfg.depth_samples = 16;
+	cfg.lateral_samples = 4;
+	cfg.frame_rate = 100.0;
+	cfg.buffer_count = 4;
+	return cfg;
+}
+
+// Receives the frames and the responses of the session
+caf::behavior subscriberImpl()
+{
+	return {[](caf::publish_atom, const frame::AcquisitionFrame&) {},
+	        [](caf::publish_atom, const frame::StimulusEvent&) {},
+	        [](acq_stop) {},
+	        [](acq_module::AcquisitionState) {}};
+}
+}  // namespace
+
+WITH_FIXTURE(caf::test::fixture::deterministic)
+{
+
+TEST("the acquisition session is started, paused, resumed and stopped")
+{
+	auto session = sys.spawn(caf::actor_from_state<acq_module::acquisition_session_state>,
+	                         sessionConfig(), acq_module::AcquisitionConfig{});
+	auto subscriber = sys.spawn(subscriberImpl);
+
+	// The frames are delivered by the thread of the driver, not checked here
+	inject()
+	    .with(acq_subscribe_v, frame::FrameStream::Doppler, subscriber)
+	    .from(subscriber)
+	    .to(session);
+	inject()
+	    .with(acq_start_v, acq_module::AcquisitionParameters{})
+	    .from(subscriber)
+	    .to(session);
+
+	inject().with(caf::get_atom_v).from(subscriber).to(session);
+	expect<acq_module::AcquisitionState>()
+	    .with(acq_module::AcquisitionState::Running)
+	    .from(session)
+	    .to(subscriber);
+
+	inject().with(acq_pause_v).from(subscriber).to(session);
+	inject().with(caf::get_atom_v).from(subscriber).to(session);
+	expect<acq_module::AcquisitionState>()
+	    .with(acq_module::AcquisitionState::Paused)
+	    .from(session)
+	    .to(subscriber);
+
+	// Resumed with the same subscribers, which can change streams while running
+	inject()
+	    .with(acq_start_v, acq_module::AcquisitionParameters{})
+	    .from(subscriber)
+	    .to(session);
+	inject()
+	    .with(acq_subscribe_v, frame::FrameStream::BMode, subscriber)
+	    .from(subscriber)
+	    .to(session);
+	inject()
+	    .with(acq_unsubscribe_v, frame::FrameStream::Doppler, subscriber)
+	    .from(subscriber)
+	    .to(session);
+
+	inject().with(acq_stop_v).from(subscriber).to(session);
+	inject().with(caf::get_atom_v).from(subscriber).to(session);
+	expect<acq_module::AcquisitionState>()
+	    .with(acq_module::AcquisitionState::Idle)
+	    .from(session)
+	    .to(subscriber);
+}
+
+TEST("a new sequence restarts the acquisition, an invalid one is rejected")
+{
+	auto session = sys.spawn(caf::actor_from_state<acq_module::acquisition_session_state>,
+	                         sessionConfig(), acq_module::AcquisitionConfig{});
+	auto subscriber = sys.spawn(subscriberImpl);
+	inject()
+	    .with(acq_subscribe_v, frame::FrameStream::Doppler, subscriber)
+	    .from(subscriber)
+	    .to(session);
+	inject()
+	    .with(acq_start_v, acq_module::AcquisitionParameters{})
+	    .from(subscriber)
+	    .to(session);
+
+	// The running acquisition is kept
+	acq_module::AcquisitionParameters parameters;
+	parameters.angle_count = 0;
+	inject()
+	    .with(acq_start_v, parameters)
+	    .from(subscriber)
+	    .to(session);
+	inject().with(caf::get_atom_v).from(subscriber).to(session);
+	expect<acq_module::AcquisitionState>()
+	    .with(acq_module::AcquisitionState::Running)
+	    .from(session)
+	    .to(subscriber);
+
+	// A paused acquisition is restarted, not resumed, with another sequence
+	inject().with(acq_pause_v).from(subscriber).to(session);
+	parameters.angle_count = 5;
+	inject()
+	    .with(acq_start_v, parameters)
+	    .from(subscriber)
+	    .to(session);
+	expect<acq_stop>().from(session).to(subscriber);
+	inject().with(caf::get_atom_v).from(subscriber).to(session);
+	expect<acq_module::AcquisitionState>()
+	    .with(acq_module::AcquisitionState::Running)
+	    .from(session)
+	    .to(subscriber);
+	inject().with(acq_stop_v).from(subscriber).to(session);
 }
 
-CAF_TEST_MAIN()
+TEST("stimulus events are forwarded to the Doppler subscribers")
+{
+	auto session = sys.spawn(caf::actor_from_state<acq_module::acquisition_session_state>,
+	                         sessionConfig(), acq_module::AcquisitionConfig{});
+	auto doppler = sys.spawn(subscriberImpl);
+	auto bmode = sys.spawn(subscriberImpl);
+	inject()
+	    .with(acq_subscribe_v, frame::FrameStream::Doppler, doppler)
+	    .from(doppler)
+	    .to(session);
+	inject()
+	    .with(acq_subscribe_v, frame::FrameStream::BMode, bmode)
+	    .from(bmode)
+	    .to(session);
+
+	// Forwarded without an acquisition running, with the timestamp of its source
+	const frame::StimulusEvent event{
+	    .timestamp = 42, .source = frame::StimulusSource::Paradigm, .code = 3};
+	inject().with(caf::publish_atom_v, event).from(doppler).to(session);
+	expect<caf::publish_atom, frame::StimulusEvent>()
+	    .with(caf::publish_atom_v, event)
+	    .from(session)
+	    .to(doppler);
+	check(!allow<caf::publish_atom, frame::StimulusEvent>().to(bmode));
+
+	// The end of the acquisition follows its last frame, to the same subscribers
+	inject()
+	    .with(acq_start_v, acq_module::AcquisitionParameters{})
+	    .from(doppler)
+	    .to(session);
+	inject().with(acq_stop_v).from(doppler).to(session);
+	expect<acq_stop>().from(session).to(doppler);
+	check(!allow<acq_stop>().to(bmode));
+}
+
+TEST("the hardware is kept between acquisitions")
+{
+	constexpr auto doppler = std::to_underlying(frame::FrameStream::Doppler);
+	constexpr auto bmode = std::to_underlying(frame::FrameStream::BMode);
+
+	acq_module::AcquisitionModule acqModule(sessionConfig());
+	auto first = acqModule.acquisitionRequest({});
+	check(acqModule.acquisitionRequest({}) == first);
+	check(first[doppler] != nullptr);
+	check(first[bmode] != nullptr);
+
+	// An invalid configuration leaves the hardware as it was
+	auto invalid = sessionConfig();
+	invalid.kind = "doppler";
+	check_throws<std::invalid_argument>([&] { acqModule.reconfigure(invalid); });
+	check(acqModule.acquisitionRequest({}) == first);
+
+	// The B-mode stream stays in IQ
+	auto rf = sessionConfig();
+	rf.kind = "rf";
+	acqModule.reconfigure(rf);
+	acq_module::AcquisitionParameters sequence;
+	sequence.depth_samples = rf.depth_samples;
+	auto streams = acqModule.acquisitionRequest(sequence);
+	check_eq(streams[doppler]->kind(), frame::FrameKind::RawRf);
+	check_eq(streams[bmode]->kind(), frame::FrameKind::CompoundedIq);
+
+	// The RF frames must have the geometry of the sequence
+	check_throws<std::invalid_argument>([&] { acqModule.acquisitionRequest({}); });
+	sequence.element_count = rf.channels / 2;
+	check_throws<std::invalid_argument>(
+	    [&] { acqModule.acquisitionRequest(sequence); });
+
+	rf.bmode_rate = 0.0;
+	acqModule.reconfigure(rf);
+	sequence.element_count = rf.channels;
+	check(acqModule.acquisitionRequest(sequence)[bmode] == nullptr);
+}
+
+}  // WITH_FIXTURE(caf::test::fixture::deterministic)
+
+CAF_TEST_MAIN(caf::id_block::custom_types_general, caf::id_block::custom_types_acq_module)
@@ -0,0 +1,146 @@
+#include <caf/test/test.hpp>
+
+#include <array>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "AcquisitionModule/ModuleusDriver.hpp"
+
+using namespace acq_module;
+
+namespace
+{
+SimulatorConfig fastConfig()
+{
+	SimulatorConfig cfg;
+	cfg.depth_samples = 16;
+	cfg.lateral_samples = 4;
+	cfg.frame_rate = 10000.0;
+	cfg.buffer_count = 64;
+	return cfg;
+}
+
+// Doppler stream only
+StreamSimulators fastSimulators()
+{
+	StreamSimulators simulators;
+	simulators[std::to_underlying(frame::FrameStream::Doppler)] =
+	    std::make_shared<ModuleusSimulator>(fastConfig());
+	return simulators;
+}
+
+constexpr frame::StreamMask all_streams =
+    frame::maskOf(frame::FrameStream::Doppler) | frame::maskOf(frame::FrameStream::BMode);
+
+void waitFinished(const ModuleusDriver& driver)
+{
+	while (!driver.finished())
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST("the driver hands the frames over in order")
+{
+	FrameRing ring(32);
+	ModuleusDriver driver(fastSimulators(), ring, 20, all_streams);
+	waitFinished(driver);
+	check_eq(driver.producedCount(), 20u);
+
+	std::vector<frame::AcquisitionFrame> frames;
+	check_eq(ring.drain(frames, 64), 20u);
+	for (std::size_t i = 0; i < frames.size(); ++i)
+	{
+		check_eq(frames[i].sequence, i);
+	}
+	check_eq(ring.overflowCount(), 0u);
+}
+
+// --------------------------------------------------------------------
+
+TEST("frames are dropped when the ring is full")
+{
+	FrameRing ring(4);
+	ModuleusDriver driver(fastSimulators(), ring, 10, all_streams);
+	waitFinished(driver);
+
+	check_eq(ring.size(), 4u);
+	check_eq(ring.overflowCount(), 6u);
+}
+
+// --------------------------------------------------------------------
+
+TEST("an endless driver stops when destroyed")
+{
+	FrameRing ring(4);
+	{
+		ModuleusDriver driver(fastSimulators(), ring, 0, all_streams);
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+		check(!driver.finished());
+	}
+	check(ring.size() > 0u);
+}
+
+// --------------------------------------------------------------------
+
+TEST("the streams are interleaved at their own rate")
+{
+	StreamSimulators simulators = fastSimulators();
+	SimulatorConfig bmode = fastConfig();
+	bmode.frame_rate = 2000.0;
+	simulators[std::to_underlying(frame::FrameStream::BMode)] =
+	    std::make_shared<ModuleusSimulator>(bmode, frame::FrameStream::BMode);
+
+	FrameRing ring(64);
+	ModuleusDriver driver(simulators, ring, 20, all_streams);
+	waitFinished(driver);
+
+	std::vector<frame::AcquisitionFrame> frames;
+	ring.drain(frames, 64);
+
+	// One B-mode frame every 5 Doppler frames, each stream numbered from 0
+	std::array<uint64_t, frame::frame_stream_count> counts{};
+	for (const frame::AcquisitionFrame& frame : frames)
+	{
+		check_eq(frame.sequence, counts[std::to_underlying(frame.stream)]++);
+	}
+	check_eq(counts[std::to_underlying(frame::FrameStream::Doppler)], 20u);
+	check_eq(counts[std::to_underlying(frame::FrameStream::BMode)], 4u);
+}
+
+// --------------------------------------------------------------------
+
+TEST("the streams without subscribers are not produced")
+{
+	StreamSimulators simulators = fastSimulators();
+	simulators[std::to_underlying(frame::FrameStream::BMode)] =
+	    std::make_shared<ModuleusSimulator>(fastConfig(), frame::FrameStream::BMode);
+
+	FrameRing ring(64);
+	ModuleusDriver driver(simulators, ring, 10, frame::maskOf(frame::FrameStream::BMode));
+	waitFinished(driver);
+
+	// The skipped Doppler frames count for the budget
+	check_eq(driver.producedCount(), 10u);
+	check_eq(simulators[std::to_underlying(frame::FrameStream::Doppler)]->frameCount(),
+	         0u);
+
+	std::vector<frame::AcquisitionFrame> frames;
+	check(ring.drain(frames, 64) > 0u);
+	for (const frame::AcquisitionFrame& frame : frames)
+	{
+		check_eq(frame.stream, frame::FrameStream::BMode);
+	}
+
+	// The Doppler stream paces the budget
+	check_throws<std::invalid_argument>(
+	    [&] { ModuleusDriver invalid(StreamSimulators{}, ring, 1, 0); });
+}
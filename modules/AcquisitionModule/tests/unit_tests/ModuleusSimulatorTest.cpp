@@ -0,0 +1,109 @@
+#include <caf/test/test.hpp>
+
+#include <stdexcept>
+
+#include "AcquisitionModule/ModuleusSimulator.hpp"
+
+using namespace acq_module;
+
+namespace
+{
+SimulatorConfig smallConfig()
+{
+	return SimulatorConfig{.kind = "iq",
+	                       .depth_samples = 40,
+	                       .lateral_samples = 8,
+	                       .channels = 4,
+	                       .frame_rate = 500.0,
+	                       .bmode_rate = 0.0,
+	                       .frame_count = 0,
+	                       .noise_level = 0.0f,
+	                       .tissue_amplitude = 1.0f,
+	                       .flow_amplitude = 0.5f,
+	                       .flow_velocity = 0.5f,
+	                       .buffer_count = 2,
+	                       .seed = 3};
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST("simulated IQ frames")
+{
+	ModuleusSimulator simulator(smallConfig());
+	check_eq(simulator.framePeriod(), std::chrono::milliseconds(2));
+
+	auto first = simulator.nextFrame();
+	auto second = simulator.nextFrame();
+	check_eq(first.sequence, 0U);
+	check_eq(second.sequence, 1U);
+	check_eq(first.kind, frame::FrameKind::CompoundedIq);
+	check_eq(first.samples->size(), 2U * 40U * 8U);
+
+	// Without noise, only the blood signal of the vessel at mid-depth moves
+	const std::size_t tissue = 2 * 2;
+	const std::size_t vessel = 2 * 20;
+	check_eq((*first.samples)[tissue], (*second.samples)[tissue]);
+	check_ne((*first.samples)[vessel], (*second.samples)[vessel]);
+}
+
+// --------------------------------------------------------------------
+
+TEST("simulated RF frames")
+{
+	auto cfg = smallConfig();
+	cfg.kind = "rf";
+	ModuleusSimulator simulator(cfg);
+
+	auto rf = simulator.nextFrame();
+	check_eq(rf.kind, frame::FrameKind::RawRf);
+	check_eq(rf.samples->size(), 40U * 4U);
+}
+
+// --------------------------------------------------------------------
+
+TEST("frame buffers are recycled")
+{
+	ModuleusSimulator simulator(smallConfig());
+	for (int i = 0; i < 10; ++i)
+	{
+		auto frame = simulator.nextFrame();
+	}
+	check_eq(simulator.frameCount(), 10U);
+	check_eq(simulator.pool().dropCount(), 0U);
+}
+
+// --------------------------------------------------------------------
+
+TEST("frames are dropped while all the buffers are held")
+{
+	ModuleusSimulator simulator(smallConfig());
+	auto first = simulator.nextFrame();
+	auto second = simulator.nextFrame();
+	auto dropped = simulator.nextFrame();
+	check(!dropped.samples);
+	check_eq(dropped.sequence, 2U);
+	check_eq(simulator.pool().dropCount(), 1U);
+
+	first = {};
+	check(simulator.nextFrame().samples != nullptr);
+}
+
+// --------------------------------------------------------------------
+
+TEST("invalid configurations are rejected")
+{
+	auto cfg = smallConfig();
+	cfg.kind = "doppler";
+	check_throws<std::invalid_argument>([&cfg] { ModuleusSimulator simulator(cfg); });
+
+	cfg = smallConfig();
+	cfg.depth_samples = 0;
+	check_throws<std::invalid_argument>([&cfg] { ModuleusSimulator simulator(cfg); });
+
+	cfg = smallConfig();
+	cfg.frame_rate = 0.0;
+	check_throws<std::invalid_argument>([&cfg] { ModuleusSimulator simulator(cfg); });
+}
@@ -0,0 +1,189 @@
+#include <caf/test/fixture/deterministic.hpp>
+#include <caf/test/test.hpp>
+
+#include <chrono>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "AcquisitionModule/RecordedFrameDriver.hpp"
+#include "CAF/CustomActorIdentifier.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/SampleConverter.hpp"
+#include "Recorder/MessageRecorder.hpp"
+
+using namespace acq_module;
+
+namespace
+{
+constexpr frame::StreamMask all_streams =
+    frame::maskOf(frame::FrameStream::Doppler) | frame::maskOf(frame::FrameStream::BMode);
+
+frame::AcquisitionFrame recordedFrame(frame::FrameStream stream, uint64_t sequence,
+                                      int64_t timestamp)
+{
+	const frame::FrameGeometry geometry{
+	    .depth_samples = 2, .lateral_samples = 2, .channels = 0};
+	return frame::AcquisitionFrame{
+	    .sequence = sequence,
+	    .timestamp = timestamp,
+	    .stream = stream,
+	    .kind = frame::FrameKind::CompoundedIq,
+	    .geometry = geometry,
+	    .samples = std::make_shared<const frame::SampleBuffer>(
+	        geometry.sampleCount(frame::FrameKind::CompoundedIq),
+	        static_cast<float>(sequence))};
+}
+
+constexpr caf::actor_id viewer_id = common_caf::custom_echo_viewer_actor_id;
+constexpr caf::actor_id storage_id = common_caf::custom_domain_model_actor_id;
+
+/**
+ * @brief Records a session of 4 Doppler frames and 1 B-mode frame. Every frame is
+ * received by two consumers, the echo viewer and the domain model, which also receives
+ * a power Doppler image.
+ */
+std::filesystem::path recordSession(caf::actor_system& system, const std::string& name)
+{
+	const auto path = std::filesystem::temp_directory_path() / name;
+	recorder::MessageRecorder rec(system, path);
+	for (uint64_t i = 0; i < 4; ++i)
+	{
+		const auto frame = recordedFrame(frame::FrameStream::Doppler, i,
+		                                 static_cast<int64_t>(i) * 1000);
+		rec.record(viewer_id, 40, caf::make_message(caf::publish_atom_v, frame));
+		rec.record(storage_id, 40, caf::make_message(caf::publish_atom_v, frame));
+		if (i == 1)
+		{
+			const auto bmode = recordedFrame(frame::FrameStream::BMode, 0, 1500);
+			rec.record(viewer_id, 40, caf::make_message(caf::publish_atom_v, bmode));
+			rec.record(storage_id, 40, caf::make_message(caf::publish_atom_v, bmode));
+
+			// Processed frames are not replayed
+			auto power = recordedFrame(frame::FrameStream::PowerDoppler, 0, 1600);
+			power.kind = frame::FrameKind::PowerDoppler;
+			rec.record(storage_id, 50, caf::make_message(caf::publish_atom_v, power));
+		}
+		// Other messages of the session are skipped
+		rec.record(30, 0, caf::make_message(caf::get_atom_v));
+	}
+	return path;
+}
+
+void waitFinished(const FrameDriver& driver)
+{
+	while (!driver.finished())
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+}  // namespace
+
+WITH_FIXTURE(caf::test::fixture::deterministic)
+{
+
+TEST("each recorded frame is read once, in order")
+{
+	const auto path = recordSession(sys, "recorded_frame_source.rec");
+	RecordedFrameSource source(sys, path);
+
+	std::vector<frame::AcquisitionFrame> frames;
+	while (auto frame = source.nextFrame())
+	{
+		frames.push_back(std::move(*frame));
+	}
+	require_eq(frames.size(), 5u);
+	check_eq(frames[2].stream, frame::FrameStream::BMode);
+	check_eq(frames[3].sequence, 2u);
+	check_eq(frames[3].samples->front(), 2.0f);
+
+	// Frames read back after a rewind
+	source.rewind();
+	auto first = source.nextFrame();
+	require(first.has_value());
+	check_eq(first->sequence, 0u);
+	source.unread(std::move(*first));
+	check_eq(source.nextFrame()->sequence, 0u);
+	std::filesystem::remove(path);
+}
+
+// --------------------------------------------------------------------
+
+TEST("frames recorded at a reduced precision are unpacked")
+{
+	const auto path = std::filesystem::temp_directory_path() / "recorded_packed.rec";
+	{
+		recorder::MessageRecorder rec(sys, path);
+		const frame::SampleConverter converter(frame::SamplePrecision::Float16);
+		for (uint64_t i = 0; i < 2; ++i)
+		{
+			const auto packed = converter.pack(recordedFrame(
+			    frame::FrameStream::Doppler, i, static_cast<int64_t>(i) * 1000));
+			rec.record(storage_id, 40, caf::make_message(caf::publish_atom_v, packed));
+		}
+	}
+	RecordedFrameSource source(sys, path);
+
+	auto first = source.nextFrame();
+	require(first.has_value());
+	check_eq(first->stream, frame::FrameStream::Doppler);
+	check_eq(first->samples->size(), 8u);
+	auto second = source.nextFrame();
+	require(second.has_value());
+	check_eq(second->sequence, 1u);
+	check_eq(second->samples->front(), 1.0f);
+	check(!source.nextFrame().has_value());
+	std::filesystem::remove(path);
+}
+
+// --------------------------------------------------------------------
+
+TEST("the replay delivers the active streams without losing frames")
+{
+	const auto path = recordSession(sys, "recorded_frame_driver.rec");
+	auto source = std::make_shared<RecordedFrameSource>(sys, path);
+
+	// Smaller than the capture: the max speed waits for the consumer
+	FrameRing ring(2);
+	const frame::StreamMask doppler = frame::maskOf(frame::FrameStream::Doppler);
+	RecordedFrameDriver driver(source, ring, 0, doppler, recorder::ReplaySpeed::Max);
+
+	std::vector<frame::AcquisitionFrame> frames;
+	while (!driver.finished() || ring.size() > 0)
+	{
+		static_cast<void>(ring.drain(frames, 2));
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+	require_eq(frames.size(), 4u);
+	for (std::size_t i = 0; i < frames.size(); ++i)
+	{
+		check_eq(frames[i].stream, frame::FrameStream::Doppler);
+		check_eq(frames[i].sequence, i);
+	}
+	check_eq(ring.overflowCount(), 0u);
+	check_eq(driver.producedCount(), 4u);
+	std::filesystem::remove(path);
+}
+
+// --------------------------------------------------------------------
+
+TEST("the budget of the replay counts the Doppler frames")
+{
+	const auto path = recordSession(sys, "recorded_frame_budget.rec");
+	auto source = std::make_shared<RecordedFrameSource>(sys, path);
+
+	FrameRing ring(8);
+	RecordedFrameDriver driver(source, ring, 3, all_streams, recorder::ReplaySpeed::Max);
+	waitFinished(driver);
+
+	// Doppler 0, Doppler 1, B-mode 0, Doppler 2
+	std::vector<frame::AcquisitionFrame> frames;
+	check_eq(ring.drain(frames, 8), 4u);
+	check_eq(frames[2].stream, frame::FrameStream::BMode);
+	check_eq(driver.producedCount(), 3u);
+	std::filesystem::remove(path);
+}
+
+}  // WITH_FIXTURE(caf::test::fixture::deterministic)
@@ -0,0 +1,99 @@
+#include <caf/test/test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "AcquisitionModule/SequenceCache.hpp"
+
+using namespace acq_module;
+
+namespace
+{
+std::filesystem::path cacheDirectory(const std::string& name)
+{
+	auto directory = std::filesystem::temp_directory_path() / name;
+	std::filesystem::remove_all(directory);
+	return directory;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST("sequences are compiled once")
+{
+	SequenceCache cache({});
+	AcquisitionParameters parameters;
+
+	auto first = cache.get(parameters);
+	check(cache.get(parameters) == first);
+	check_eq(cache.compilations(), 1u);
+	check_eq(cache.memoryHits(), 1u);
+
+	// Another sequence of the workflow
+	parameters.angle_count = 7;
+	check(cache.get(parameters) != first);
+	check_eq(cache.compilations(), 2u);
+	check_ne(hashOf(parameters), hashOf(AcquisitionParameters{}));
+}
+
+// --------------------------------------------------------------------
+
+TEST("compiled sequences")
+{
+	AcquisitionParameters parameters;
+	parameters.angle_count = 3;
+	parameters.element_count = 8;
+	parameters.depth_samples = 4;
+	const CompiledSequence sequence = compileSequence(parameters);
+
+	check_eq(sequence.transmit_delays.size(), 3u * 8u);
+	check_eq(sequence.apodization.size(), 8u);
+	check_eq(sequence.receive_delays.size(), 4u * 8u);
+
+	// The central plane wave fires all the elements at once, the steered ones start on
+	// one side
+	check_eq(sequence.transmit_delays[8], 0.0f);
+	check_eq(sequence.transmit_delays[7], 0.0f);
+	check_eq(sequence.transmit_delays[2 * 8], 0.0f);
+
+	// Right under an element the receive delay is the one-way time of flight
+	check_eq(sequence.receive_delays[2 * 8], 1.0f);
+
+	parameters.element_count = 0;
+	check_throws<std::invalid_argument>(
+	    [&] { static_cast<void>(compileSequence(parameters)); });
+}
+
+// --------------------------------------------------------------------
+
+TEST("sequences are persisted on disk")
+{
+	const auto directory = cacheDirectory("icograph_sequence_cache_test");
+	AcquisitionParameters parameters;
+	{
+		SequenceCache cache(directory);
+		static_cast<void>(cache.get(parameters));
+		check_eq(cache.compilations(), 1u);
+	}
+
+	SequenceCache restarted(directory);
+	auto loaded = restarted.get(parameters);
+	check_eq(restarted.diskHits(), 1u);
+	check_eq(restarted.compilations(), 0u);
+	check(*loaded == compileSequence(parameters));
+
+	// A corrupted file is replaced
+	for (const auto& entry : std::filesystem::directory_iterator(directory))
+	{
+		std::ofstream(entry.path(), std::ios::binary | std::ios::trunc) << "garbage";
+	}
+	SequenceCache recovered(directory);
+	check(*recovered.get(parameters) == *loaded);
+	check_eq(recovered.compilations(), 1u);
+
+	std::filesystem::remove_all(directory);
+}
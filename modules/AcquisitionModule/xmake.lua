@@ -3,7 +3,12 @@ target("acquisition_module")
     add_files("src/*.cpp")
     add_includedirs("include", {public = true})
     add_deps("common_caf")
+    add_deps("common_frame")
     add_deps("common_logger")
+    add_deps("common_scheduler")
+    add_deps("common_recorder")
+    add_deps("common_probe")
+    add_deps("common_simd")
     add_rpathdirs("$ORIGIN") 
 
     -- Unit test target
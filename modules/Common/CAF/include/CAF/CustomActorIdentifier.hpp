@@ -11,6 +11,8 @@
 #ifndef CAF_CUSTOMACTORIDENTIFIER_HPP
 #define CAF_CUSTOMACTORIDENTIFIER_HPP
 
+#include <string_view>
+
 #include <caf/fwd.hpp>
 
 namespace common_caf
@@ -32,6 +34,10 @@ namespace common_caf
  * - The values are chosen to avoid conflicts with CAF's built-in IDs and other custom
  * IDs.
  *
+ * - Each ID comes with a name, used as key in the "icograph.placement" section of the
+ *   configuration file. When an actor is published or looked up on a remote node, the
+ *   proxy is registered under the same ID so that lookups are location-transparent.
+ *
  * @warning
  * Do not reuse or reassign these IDs for other actor types.
  * Changing these values after deployment may break actor communication.
@@ -46,6 +52,21 @@ constexpr auto custom_echo_viewer_actor_id = caf::actor_id(20);
 /** @brief Unique ID for the domain model actor. */
 constexpr auto custom_domain_model_actor_id = caf::actor_id(30);
 
+/** @brief Unique ID for the acquisition actor of the running acquisition. */
+constexpr auto custom_acquisition_actor_id = caf::actor_id(40);
+
+/** @brief Configuration name of the workflow manager actor. */
+constexpr std::string_view custom_workflow_manager_actor_name = "workflow-manager";
+
+/** @brief Configuration name of the echo viewer actor. */
+constexpr std::string_view custom_echo_viewer_actor_name = "echo-viewer";
+
+/** @brief Configuration name of the domain model actor. */
+constexpr std::string_view custom_domain_model_actor_name = "domain-model";
+
+/** @brief Configuration name of the acquisition actor. */
+constexpr std::string_view custom_acquisition_actor_name = "acquisition";
+
 }  // namespace common_caf
 
 #endif  // CAF_CUSTOMACTORIDENTIFIER_HPP
@@ -0,0 +1,129 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_ACQUISITIONFRAME_HPP
+#define FRAME_ACQUISITIONFRAME_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "FrameKind.hpp"
+#include "FrameStream.hpp"
+
+namespace frame
+{
+
+/// @brief Storage of the samples of a frame
+using SampleBuffer = std::vector<float>;
+
+/**
+ * @brief Samples of each pixel in the frames of a kind (see FrameGeometry).
+ */
+constexpr std::size_t componentCount(FrameKind kind)
+{
+	switch (kind)
+	{
+	case FrameKind::CompoundedIq:
+	case FrameKind::PlaneWaveIq:
+	case FrameKind::ColorDoppler:
+		return 2;
+	case FrameKind::ActivationMap:
+		return 3;
+	case FrameKind::PixelStatistics:
+		return 4;
+	case FrameKind::PowerDoppler:
+	case FrameKind::RawRf:
+		break;
+	}
+	return 1;
+}
+
+/**
+ * \struct FrameGeometry
+ *
+ * @brief Dimensions of a frame. Samples are stored depth first: sample (z, x) is at
+ * index x * depth_samples + z.
+ *
+ * - CompoundedIq, PlaneWaveIq: depth_samples x lateral_samples pixels, 2 floats (I, Q)
+ *   per pixel.
+ * - RawRf: depth_samples x channels real samples.
+ * - PowerDoppler: depth_samples x lateral_samples pixels, 1 float per pixel.
+ * - ColorDoppler: depth_samples x lateral_samples pixels, 2 floats (axial velocity in
+ *   m/s, variance) per pixel.
+ * - PixelStatistics: depth_samples x lateral_samples pixels, 4 floats (mean, variance,
+ *   min, max of the pixel over a series of images) per pixel.
+ * - ActivationMap: depth_samples x lateral_samples pixels, 3 floats (t statistic,
+ *   partial correlation, relative change of the pixel with the stimulus) per pixel.
+ *
+ * See viewOf() (Frame.hpp) for a view of the samples of a frame in this layout.
+ */
+struct FrameGeometry
+{
+	uint32_t depth_samples = 0;
+	uint32_t lateral_samples = 0;
+	uint32_t channels = 0;
+
+	/**
+	 * @brief Number of floats of a frame of the given kind.
+	 */
+	[[nodiscard]] constexpr std::size_t sampleCount(FrameKind kind) const
+	{
+		return componentCount(kind) * depth_samples * columnCount(kind);
+	}
+
+	/**
+	 * @brief Columns of a frame of the given kind: lines of pixels, or channels of the RF
+	 * frames.
+	 */
+	[[nodiscard]] constexpr uint32_t columnCount(FrameKind kind) const
+	{
+		return kind == FrameKind::RawRf ? channels : lateral_samples;
+	}
+
+	friend bool operator==(const FrameGeometry&, const FrameGeometry&) = default;
+};
+
+/**
+ * \struct AcquisitionFrame
+ *
+ * @brief One frame produced by the acquisition. The samples are shared between the
+ * consumers and must not be modified once the frame is published: copying a frame is
+ * cheap. The buffer returns to its pool (see SampleBufferPool) when the last frame
+ * referencing it is destroyed.
+ */
+struct AcquisitionFrame
+{
+	// Index of the frame in its stream since the start of the acquisition
+	uint64_t sequence = 0;
+	// Production of the frame by the hardware, see monotonicTimestamp()
+	int64_t timestamp = 0;
+	FrameStream stream = FrameStream::Doppler;
+	FrameKind kind = FrameKind::CompoundedIq;
+	FrameGeometry geometry;
+	std::shared_ptr<const SampleBuffer> samples;
+};
+
+/**
+ * @brief Current time of the steady clock in nanoseconds, the clock of the frame
+ * timestamps. Only comparable within a process.
+ */
+[[nodiscard]] inline int64_t monotonicTimestamp()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+	           std::chrono::steady_clock::now().time_since_epoch())
+	    .count();
+}
+
+}  // namespace frame
+
+#endif  // FRAME_ACQUISITIONFRAME_HPP
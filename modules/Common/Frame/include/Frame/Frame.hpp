@@ -0,0 +1,259 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAME_HPP
+#define FRAME_FRAME_HPP
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "AcquisitionFrame.hpp"
+#include "FrameLayout.hpp"
+
+namespace frame
+{
+
+/**
+ * \class StridedView
+ *
+ * @brief View of one component of a frame, depth x lateral samples at regular strides
+ * (see Frame::component).
+ */
+template <typename T>
+class StridedView
+{
+public:
+	StridedView(T* data, uint32_t depth, uint32_t lateral, const Strides& strides)
+	    : _data(data + strides.offset),
+	      _depth(depth),
+	      _lateral(lateral),
+	      _depthStride(strides.depth),
+	      _lateralStride(strides.lateral)
+	{
+	}
+
+	[[nodiscard]] T& operator()(std::size_t z, std::size_t x) const
+	{
+		return _data[z * _depthStride + x * _lateralStride];
+	}
+
+	[[nodiscard]] uint32_t depth() const { return _depth; }
+	[[nodiscard]] uint32_t lateral() const { return _lateral; }
+
+	// Samples between two pixels of a column, and between two columns
+	[[nodiscard]] std::size_t depthStride() const { return _depthStride; }
+	[[nodiscard]] std::size_t lateralStride() const { return _lateralStride; }
+
+private:
+	T* _data;
+	uint32_t _depth;
+	uint32_t _lateral;
+	std::size_t _depthStride;
+	std::size_t _lateralStride;
+};
+
+/**
+ * \class Frame
+ *
+ * @brief Samples of a frame of depth x lateral pixels in the layout `Layout` (see
+ * FrameLayout.hpp), the container the processing stages and the viewer take their frames
+ * in. The frame is a view: it does not own its samples, copying it is cheap, and the
+ * samples must outlive it. A Frame<const T> views them read-only.
+ *
+ * The layout is part of the type: a kernel states the layout it expects and gets a
+ * compile error rather than a silent misreading of the samples. The reinterpretations
+ * that need no copy (read-only view, plane of a planar frame, complex samples of an
+ * interleaved frame) are views of the same samples, the others go through relayout()
+ * (see Relayout.hpp).
+ *
+ * @tparam T type of the samples, const for a read-only view
+ * @tparam Layout layout of the samples, see FrameLayout
+ */
+template <typename T, FrameLayout Layout>
+class Frame
+{
+public:
+	using Element = T;
+	using LayoutType = Layout;
+	static constexpr std::size_t components = Layout::components;
+
+	Frame() = default;
+
+	/**
+	 * @brief: Ctor
+	 * @param samples Layout::size(depth, lateral) samples
+	 * @throws std::invalid_argument if the size of `samples` does not match
+	 */
+	Frame(std::span<T> samples, uint32_t depth, uint32_t lateral)
+	    : _samples(samples), _depth(depth), _lateral(lateral)
+	{
+		if (samples.size() != Layout::size(depth, lateral))
+		{
+			throw std::invalid_argument(
+			    "Frame: " + std::to_string(samples.size()) + " samples for " +
+			    std::to_string(depth) + "x" + std::to_string(lateral) + " pixels, " +
+			    std::to_string(Layout::size(depth, lateral)) + " expected");
+		}
+	}
+
+	// Read-only view of the same samples
+	operator Frame<const T, Layout>() const
+	    requires(!std::is_const_v<T>)
+	{
+		return Frame<const T, Layout>(_samples, _depth, _lateral);
+	}
+
+	/**
+	 * @brief Sample c of pixel (z, x).
+	 */
+	[[nodiscard]] T& operator()(std::size_t z, std::size_t x, std::size_t c = 0) const
+	{
+		return _samples[Layout::index(_depth, _lateral, z, x, c)];
+	}
+
+	[[nodiscard]] uint32_t depth() const { return _depth; }
+	[[nodiscard]] uint32_t lateral() const { return _lateral; }
+	[[nodiscard]] std::size_t pixelCount() const
+	{
+		return std::size_t{_depth} * _lateral;
+	}
+
+	// All the samples, padding included
+	[[nodiscard]] std::span<T> samples() const { return _samples; }
+	[[nodiscard]] T* data() const { return _samples.data(); }
+
+	// Same dimensions, whatever the layouts
+	template <typename U, FrameLayout Other>
+	[[nodiscard]] bool sameShape(const Frame<U, Other>& other) const
+	{
+		return _depth == other.depth() && _lateral == other.lateral();
+	}
+
+	/**
+	 * @brief Samples of column x, contiguous.
+	 */
+	[[nodiscard]] std::span<T> column(std::size_t x) const
+	    requires Layout::contiguous_columns
+	{
+		const std::size_t size = std::size_t{_depth} * components;
+		return _samples.subspan(x * size, size);
+	}
+
+	/**
+	 * @brief Component c of the pixels, without copy.
+	 */
+	[[nodiscard]] StridedView<T> component(std::size_t c) const
+	    requires StridedLayout<Layout>
+	{
+		return StridedView<T>(_samples.data(), _depth, _lateral,
+		                      Layout::strides(_depth, _lateral, c));
+	}
+
+	/**
+	 * @brief Plane c of a planar frame, as a frame of its own, without copy.
+	 */
+	[[nodiscard]] Frame<T, Interleaved<1>> plane(std::size_t c) const
+	    requires std::is_same_v<Layout, Planar<components>>
+	{
+		return Frame<T, Interleaved<1>>(_samples.subspan(c * pixelCount(), pixelCount()),
+		                                _depth, _lateral);
+	}
+
+private:
+	std::span<T> _samples;
+	uint32_t _depth = 0;
+	uint32_t _lateral = 0;
+};
+
+/**
+ * @brief I and Q interleaved samples of a frame as complex samples, without copy: an
+ * array of std::complex<float> has the layout of an array of float pairs.
+ */
+template <typename T>
+    requires std::is_same_v<std::remove_const_t<T>, float>
+[[nodiscard]] auto asComplex(const Frame<T, Interleaved<2>>& iq)
+{
+	using Complex = std::conditional_t<std::is_const_v<T>, const std::complex<float>,
+	                                   std::complex<float>>;
+	return Frame<Complex, Interleaved<1>>(
+	    std::span<Complex>(reinterpret_cast<Complex*>(iq.data()), iq.pixelCount()),
+	    iq.depth(), iq.lateral());
+}
+
+// Implementation details.
+// Should not be called directly from outside.
+namespace detail
+{
+template <std::size_t Components, typename T>
+Frame<T, Interleaved<Components>> viewOf(std::span<T> samples,
+                                         const FrameGeometry& geometry,
+                                         FrameKind kind)
+{
+	if (componentCount(kind) != Components)
+	{
+		throw std::invalid_argument("Frame: " + to_string(kind) + " frame has " +
+		                            std::to_string(componentCount(kind)) +
+		                            " samples per pixel instead of " +
+		                            std::to_string(Components));
+	}
+	return Frame<T, Interleaved<Components>>(samples, geometry.depth_samples,
+	                                         geometry.columnCount(kind));
+}
+}  // namespace detail
+
+/**
+ * @brief Samples of a frame of a kind and a geometry, in the interleaved layout of the
+ * acquisition frames: depth_samples x lateral_samples pixels, depth_samples x channels
+ * samples for the RF frames.
+ * @throws std::invalid_argument if the frames of the kind do not have `Components`
+ * samples per pixel, or if the size of `samples` does not match the geometry
+ */
+template <std::size_t Components>
+[[nodiscard]] Frame<float, Interleaved<Components>> viewOf(SampleBuffer& samples,
+                                                           const FrameGeometry& geometry,
+                                                           FrameKind kind)
+{
+	return detail::viewOf<Components>(std::span<float>(samples), geometry, kind);
+}
+
+template <std::size_t Components>
+[[nodiscard]] Frame<const float, Interleaved<Components>> viewOf(
+    std::span<const float> samples,
+    const FrameGeometry& geometry,
+    FrameKind kind)
+{
+	return detail::viewOf<Components>(samples, geometry, kind);
+}
+
+/**
+ * @brief Read-only samples of an acquisition frame, see viewOf() above.
+ * @throws std::invalid_argument if the frame has no samples, or as viewOf() above
+ */
+template <std::size_t Components>
+[[nodiscard]] Frame<const float, Interleaved<Components>> viewOf(
+    const AcquisitionFrame& frame)
+{
+	if (!frame.samples)
+	{
+		throw std::invalid_argument("Frame: " + to_string(frame.kind) +
+		                            " frame without samples");
+	}
+	return viewOf<Components>(std::span<const float>(*frame.samples), frame.geometry,
+	                          frame.kind);
+}
+
+}  // namespace frame
+
+#endif  // FRAME_FRAME_HPP
@@ -0,0 +1,79 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAMECACHE_HPP
+#define FRAME_FRAMECACHE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+#include "FrameStream.hpp"
+#include "PackedFrame.hpp"
+
+namespace frame
+{
+
+/**
+ * \class FrameCache
+ *
+ * @brief Most recent frames of each stream, within a budget of bytes of samples: the
+ * oldest frames of all the streams are dropped first. The frames are held packed, a
+ * reduced precision holding twice as many frames for the same budget.
+ */
+class FrameCache
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param capacity bytes of samples held at most, 0 to hold no frame
+	 */
+	explicit FrameCache(std::size_t capacity) : _capacity(capacity) {}
+
+	/**
+	 * @brief Holds a frame, dropping the oldest ones beyond the capacity. A frame larger
+	 * than the capacity is not held.
+	 */
+	void add(PackedFrame frame);
+
+	/**
+	 * @brief Frame of a stream held in the cache, the most recent one if the sequence was
+	 * reused by another acquisition.
+	 * @return the frame, nullptr if it is not held
+	 */
+	[[nodiscard]] const PackedFrame* find(FrameStream stream, uint64_t sequence) const;
+
+	// Drops all the frames
+	void clear();
+
+	// Bytes of samples held
+	[[nodiscard]] std::size_t byteCount() const { return _byteCount; }
+
+	// Frames held, all streams
+	[[nodiscard]] std::size_t frameCount() const;
+
+	// Bytes of samples held at most
+	[[nodiscard]] std::size_t capacity() const { return _capacity; }
+
+private:
+	// Drops the oldest frame of all the streams
+	void dropOldest();
+
+	std::size_t _capacity;
+	std::size_t _byteCount{0};
+
+	// Frames of each stream in their order of arrival
+	std::array<std::deque<PackedFrame>, frame_stream_count> _frames;
+};
+
+}  // namespace frame
+
+#endif  // FRAME_FRAMECACHE_HPP
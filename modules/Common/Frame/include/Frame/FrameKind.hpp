@@ -0,0 +1,181 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAMEKIND_HPP
+#define FRAME_FRAMEKIND_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace frame
+{
+
+/**
+ * @enum FrameKind
+ * @brief Type of data carried by an acquisition frame.
+ */
+enum class FrameKind : uint8_t
+{
+	CompoundedIq,     // Beamformed and compounded IQ image, interleaved I/Q per pixel
+	RawRf,            // Raw RF data, one real sample per depth sample and channel
+	PowerDoppler,     // Power of the blood signal, one real sample per pixel
+	PlaneWaveIq,      // Beamformed IQ image of one plane wave, before compounding
+	ColorDoppler,     // Axial velocity and variance of the blood, interleaved per pixel
+	PixelStatistics,  // Mean, variance, min and max of each pixel over a series of images
+	ActivationMap     // Response of each pixel to the stimuli of a paradigm
+};
+
+/**
+ * @brief Converts a FrameKind enum value to its string representation.
+ * @param kind The FrameKind enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(FrameKind kind)
+{
+	using namespace std::string_literals;
+
+	switch (kind)
+	{
+	case FrameKind::CompoundedIq:
+		return "iq"s;
+	case FrameKind::RawRf:
+		return "rf"s;
+	case FrameKind::PowerDoppler:
+		return "power-doppler"s;
+	case FrameKind::PlaneWaveIq:
+		return "plane-wave-iq"s;
+	case FrameKind::ColorDoppler:
+		return "color-doppler"s;
+	case FrameKind::PixelStatistics:
+		return "pixel-statistics"s;
+	case FrameKind::ActivationMap:
+		return "activation-map"s;
+	}
+
+	throw std::domain_error("Invalid value for FrameKind: " +
+	                        std::to_string(std::to_underlying(kind)));
+}
+
+/**
+ * @brief Attempts to convert a string to a FrameKind enum value.
+ * @param str The string to convert.
+ * @param kind Reference to the FrameKind enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, FrameKind& kind)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "iq"sv)
+	{
+		kind = FrameKind::CompoundedIq;
+		status = true;
+	}
+	else if (str == "rf"sv)
+	{
+		kind = FrameKind::RawRf;
+		status = true;
+	}
+	else if (str == "power-doppler"sv)
+	{
+		kind = FrameKind::PowerDoppler;
+		status = true;
+	}
+	else if (str == "plane-wave-iq"sv)
+	{
+		kind = FrameKind::PlaneWaveIq;
+		status = true;
+	}
+	else if (str == "color-doppler"sv)
+	{
+		kind = FrameKind::ColorDoppler;
+		status = true;
+	}
+	else if (str == "pixel-statistics"sv)
+	{
+		kind = FrameKind::PixelStatistics;
+		status = true;
+	}
+	else if (str == "activation-map"sv)
+	{
+		kind = FrameKind::ActivationMap;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a FrameKind enum value.
+ * @param value The integer value to convert.
+ * @param kind Reference to the FrameKind enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<FrameKind> value,
+                                          FrameKind& kind)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(FrameKind::CompoundedIq):
+		kind = FrameKind::CompoundedIq;
+		status = true;
+		break;
+	case std::to_underlying(FrameKind::RawRf):
+		kind = FrameKind::RawRf;
+		status = true;
+		break;
+	case std::to_underlying(FrameKind::PowerDoppler):
+		kind = FrameKind::PowerDoppler;
+		status = true;
+		break;
+	case std::to_underlying(FrameKind::PlaneWaveIq):
+		kind = FrameKind::PlaneWaveIq;
+		status = true;
+		break;
+	case std::to_underlying(FrameKind::ColorDoppler):
+		kind = FrameKind::ColorDoppler;
+		status = true;
+		break;
+	case std::to_underlying(FrameKind::PixelStatistics):
+		kind = FrameKind::PixelStatistics;
+		status = true;
+		break;
+	case std::to_underlying(FrameKind::ActivationMap):
+		kind = FrameKind::ActivationMap;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace frame
+
+/**
+ * @brief Specialization of the std::format for FrameKind. Needed for logging
+ */
+template <>
+struct std::formatter<frame::FrameKind>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const frame::FrameKind& kind, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", frame::to_string(kind));
+	}
+};
+
+#endif  // FRAME_FRAMEKIND_HPP
@@ -0,0 +1,173 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAMELAYOUT_HPP
+#define FRAME_FRAMELAYOUT_HPP
+
+#include <concepts>
+#include <cstddef>
+
+/**
+ * @brief Layouts of the samples of a frame: depth x lateral pixels of `components`
+ * samples each, sample c of pixel (z, x) at index(depth, lateral, z, x, c) of a storage
+ * of size(depth, lateral) samples.
+ *
+ * - Interleaved: the samples of a pixel are contiguous, the pixels depth first. The
+ *   layout of the acquisition frames (see FrameGeometry), I and Q interleaved.
+ * - Planar: one plane per component (real and imaginary planes for instance), each
+ *   depth first.
+ * - Tiled: blocks of TileDepth x TileLateral pixels, interleaved within a block, the
+ *   blocks depth first. The last blocks are padded to their full size.
+ *
+ * The layouts with strides (Interleaved, Planar) give strided views of one component
+ * (see Frame::component). Contiguous columns hold all the samples of a column of pixels
+ * (see Frame::column).
+ */
+
+namespace frame
+{
+
+/**
+ * \struct Strides
+ *
+ * @brief Position of the samples of one component of a frame: sample (z, x) at
+ * offset + z * depth + x * lateral.
+ */
+struct Strides
+{
+	std::size_t offset = 0;
+	std::size_t depth = 0;
+	std::size_t lateral = 0;
+};
+
+// --------------------------------------------------------------------
+template <std::size_t Components>
+struct Interleaved
+{
+	static_assert(Components > 0, "A pixel has one sample at least");
+
+	static constexpr std::size_t components = Components;
+	static constexpr bool contiguous_columns = true;
+
+	static constexpr std::size_t size(std::size_t depth, std::size_t lateral)
+	{
+		return depth * lateral * components;
+	}
+
+	static constexpr std::size_t index(std::size_t depth,
+	                                   std::size_t /*lateral*/,
+	                                   std::size_t z,
+	                                   std::size_t x,
+	                                   std::size_t c)
+	{
+		return (x * depth + z) * components + c;
+	}
+
+	static constexpr Strides strides(std::size_t depth,
+	                                 std::size_t /*lateral*/,
+	                                 std::size_t c)
+	{
+		return {.offset = c, .depth = components, .lateral = depth * components};
+	}
+};
+
+// --------------------------------------------------------------------
+template <std::size_t Components>
+struct Planar
+{
+	static_assert(Components > 0, "A pixel has one sample at least");
+
+	static constexpr std::size_t components = Components;
+	static constexpr bool contiguous_columns = Components == 1;
+
+	static constexpr std::size_t size(std::size_t depth, std::size_t lateral)
+	{
+		return depth * lateral * components;
+	}
+
+	static constexpr std::size_t index(std::size_t depth,
+	                                   std::size_t lateral,
+	                                   std::size_t z,
+	                                   std::size_t x,
+	                                   std::size_t c)
+	{
+		return c * depth * lateral + x * depth + z;
+	}
+
+	static constexpr Strides strides(std::size_t depth,
+	                                 std::size_t lateral,
+	                                 std::size_t c)
+	{
+		return {.offset = c * depth * lateral, .depth = 1, .lateral = depth};
+	}
+};
+
+// --------------------------------------------------------------------
+template <std::size_t TileDepth, std::size_t TileLateral, std::size_t Components = 1>
+struct Tiled
+{
+	static_assert(TileDepth > 0 && TileLateral > 0 && Components > 0,
+	              "A tile has one sample at least");
+
+	static constexpr std::size_t components = Components;
+	static constexpr std::size_t tile_depth = TileDepth;
+	static constexpr std::size_t tile_lateral = TileLateral;
+	static constexpr std::size_t tile_size = TileDepth * TileLateral * Components;
+	static constexpr bool contiguous_columns = false;
+
+	// Tiles along the depth and along the lateral axis
+	static constexpr std::size_t depthTiles(std::size_t depth)
+	{
+		return (depth + TileDepth - 1) / TileDepth;
+	}
+	static constexpr std::size_t lateralTiles(std::size_t lateral)
+	{
+		return (lateral + TileLateral - 1) / TileLateral;
+	}
+
+	static constexpr std::size_t size(std::size_t depth, std::size_t lateral)
+	{
+		return depthTiles(depth) * lateralTiles(lateral) * tile_size;
+	}
+
+	static constexpr std::size_t index(std::size_t depth,
+	                                   std::size_t /*lateral*/,
+	                                   std::size_t z,
+	                                   std::size_t x,
+	                                   std::size_t c)
+	{
+		const std::size_t tile = (x / TileLateral) * depthTiles(depth) + z / TileDepth;
+		const std::size_t pixel = (x % TileLateral) * TileDepth + z % TileDepth;
+		return tile * tile_size + pixel * Components + c;
+	}
+};
+
+/**
+ * @brief Layout policy of a frame.
+ */
+template <typename Layout>
+concept FrameLayout = requires(std::size_t n) {
+	{ Layout::components } -> std::convertible_to<std::size_t>;
+	{ Layout::contiguous_columns } -> std::convertible_to<bool>;
+	{ Layout::size(n, n) } -> std::same_as<std::size_t>;
+	{ Layout::index(n, n, n, n, n) } -> std::same_as<std::size_t>;
+};
+
+/**
+ * @brief Layout whose components are at regular strides.
+ */
+template <typename Layout>
+concept StridedLayout = FrameLayout<Layout> && requires(std::size_t n) {
+	{ Layout::strides(n, n, n) } -> std::same_as<Strides>;
+};
+
+}  // namespace frame
+
+#endif  // FRAME_FRAMELAYOUT_HPP
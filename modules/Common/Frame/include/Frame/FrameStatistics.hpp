@@ -0,0 +1,115 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAMESTATISTICS_HPP
+#define FRAME_FRAMESTATISTICS_HPP
+
+#include <array>
+#include <cstdint>
+#include <format>
+#include <string>
+
+#include "AcquisitionFrame.hpp"
+#include "LatencyHistogram.hpp"
+
+namespace frame
+{
+
+/**
+ * @enum FrameStage
+ * @brief Stages of the pipeline where the frames are timed.
+ */
+enum class FrameStage : uint8_t
+{
+	Published,  // Handed over by the acquisition session to the subscribers
+	Stored,     // Received by the domain model
+	Displayed   // Received by the echo viewer
+};
+
+constexpr std::size_t frame_stage_count = 3;
+
+constexpr std::array<FrameStage, frame_stage_count> frame_stages{
+    FrameStage::Published, FrameStage::Stored, FrameStage::Displayed};
+
+/**
+ * @brief Converts a FrameStage enum value to its string representation.
+ */
+constexpr std::string to_string(FrameStage stage)
+{
+	using namespace std::string_literals;
+
+	switch (stage)
+	{
+	case FrameStage::Published:
+		return "published"s;
+	case FrameStage::Stored:
+		return "stored"s;
+	case FrameStage::Displayed:
+		return "displayed"s;
+	}
+	return "unknown"s;
+}
+
+/**
+ * \struct StageStatistics
+ *
+ * @brief Frames received by a stage since the start of the application: latency from
+ * the production of the frames, and the frames missing or late in the sequence.
+ */
+struct StageStatistics
+{
+	uint64_t frames = 0;
+	// Jumps in the sequence, and frames skipped by these jumps
+	uint64_t gaps = 0;
+	uint64_t missing = 0;
+	// Frames received after a frame of a higher sequence
+	uint64_t reordered = 0;
+	LatencyHistogram latency;
+
+	// Removes the frames of an earlier state of the same stage
+	StageStatistics& operator-=(const StageStatistics& earlier);
+};
+
+/**
+ * @brief Records the arrival of a frame at a stage. Lock-free. Each stage is fed by one
+ * actor at a time: the gaps are detected on the sequence of each stream.
+ */
+void recordFrameArrival(FrameStage stage, const AcquisitionFrame& frame);
+
+/**
+ * @brief Returns the statistics of a stage since the start of the application. Callable
+ * from any thread while frames are recorded: the counters of a snapshot may be off by
+ * the frames recorded during the copy.
+ */
+[[nodiscard]] StageStatistics stageStatistics(FrameStage stage);
+
+/**
+ * @brief Forgets the last sequence of each stage and stream: called when a new
+ * acquisition starts its sequence from 0, so that it is not seen as reordered.
+ */
+void restartSequenceTracking();
+
+}  // namespace frame
+
+/**
+ * @brief Specialization of the std::format for FrameStage. Needed for logging
+ */
+template <>
+struct std::formatter<frame::FrameStage>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const frame::FrameStage& stage, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", frame::to_string(stage));
+	}
+};
+
+#endif  // FRAME_FRAMESTATISTICS_HPP
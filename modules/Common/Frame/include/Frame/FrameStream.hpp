@@ -0,0 +1,176 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAMESTREAM_HPP
+#define FRAME_FRAMESTREAM_HPP
+
+#include <array>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace frame
+{
+
+/**
+ * @enum FrameStream
+ * @brief Streams multiplexed by one acquisition. Each stream has its own frame rate and
+ * its own subscribers, and numbers its frames from 0.
+ */
+enum class FrameStream : uint8_t
+{
+	Doppler,       // Ultrafast frames of the Doppler sequence: compounded IQ or raw RF
+	BMode,         // Compounded IQ frames at a display rate, between the Doppler ones
+	PowerDoppler,  // Power Doppler images computed from ensembles of Doppler frames
+	ColorDoppler,  // Axial velocity and variance maps of the same ensembles
+	Activation     // Activation maps of the power Doppler images against the paradigm
+};
+
+constexpr std::size_t frame_stream_count = 5;
+
+constexpr std::array<FrameStream, frame_stream_count> frame_streams{
+    FrameStream::Doppler, FrameStream::BMode, FrameStream::PowerDoppler,
+    FrameStream::ColorDoppler, FrameStream::Activation};
+
+/// @brief Set of streams, one bit per stream
+using StreamMask = uint32_t;
+
+/**
+ * @brief Bit of a stream in a StreamMask.
+ */
+[[nodiscard]] constexpr StreamMask maskOf(FrameStream stream)
+{
+	return StreamMask{1} << std::to_underlying(stream);
+}
+
+/**
+ * @brief Converts a FrameStream enum value to its string representation.
+ * @param stream The FrameStream enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(FrameStream stream)
+{
+	using namespace std::string_literals;
+
+	switch (stream)
+	{
+	case FrameStream::Doppler:
+		return "doppler"s;
+	case FrameStream::BMode:
+		return "bmode"s;
+	case FrameStream::PowerDoppler:
+		return "power-doppler"s;
+	case FrameStream::ColorDoppler:
+		return "color-doppler"s;
+	case FrameStream::Activation:
+		return "activation"s;
+	}
+
+	throw std::domain_error("Invalid value for FrameStream: " +
+	                        std::to_string(std::to_underlying(stream)));
+}
+
+/**
+ * @brief Attempts to convert a string to a FrameStream enum value.
+ * @param str The string to convert.
+ * @param stream Reference to the FrameStream enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, FrameStream& stream)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "doppler"sv)
+	{
+		stream = FrameStream::Doppler;
+		status = true;
+	}
+	else if (str == "bmode"sv)
+	{
+		stream = FrameStream::BMode;
+		status = true;
+	}
+	else if (str == "power-doppler"sv)
+	{
+		stream = FrameStream::PowerDoppler;
+		status = true;
+	}
+	else if (str == "color-doppler"sv)
+	{
+		stream = FrameStream::ColorDoppler;
+		status = true;
+	}
+	else if (str == "activation"sv)
+	{
+		stream = FrameStream::Activation;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a FrameStream enum value.
+ * @param value The integer value to convert.
+ * @param stream Reference to the FrameStream enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<FrameStream> value,
+                                          FrameStream& stream)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(FrameStream::Doppler):
+		stream = FrameStream::Doppler;
+		status = true;
+		break;
+	case std::to_underlying(FrameStream::BMode):
+		stream = FrameStream::BMode;
+		status = true;
+		break;
+	case std::to_underlying(FrameStream::PowerDoppler):
+		stream = FrameStream::PowerDoppler;
+		status = true;
+		break;
+	case std::to_underlying(FrameStream::ColorDoppler):
+		stream = FrameStream::ColorDoppler;
+		status = true;
+		break;
+	case std::to_underlying(FrameStream::Activation):
+		stream = FrameStream::Activation;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace frame
+
+/**
+ * @brief Specialization of the std::format for FrameStream. Needed for logging
+ */
+template <>
+struct std::formatter<frame::FrameStream>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const frame::FrameStream& stream, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", frame::to_string(stream));
+	}
+};
+
+#endif  // FRAME_FRAMESTREAM_HPP
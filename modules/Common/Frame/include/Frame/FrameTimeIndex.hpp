@@ -0,0 +1,93 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAMETIMEINDEX_HPP
+#define FRAME_FRAMETIMEINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace frame
+{
+
+/**
+ * \class FrameTimeIndex
+ *
+ * @brief Timestamps of the frames of one stream, in the order of their production, to
+ * find the frame nearest to an instant in O(log n).
+ *
+ * Each frame takes 8 bytes: its timestamp and its sequence are stored as 32 bits
+ * offsets from the first frame of their block. A block starts whenever an offset would
+ * not fit (about 4 s of frames), or the sequence restarts with a new acquisition.
+ */
+class FrameTimeIndex
+{
+public:
+	/**
+	 * \struct Entry
+	 *
+	 * @brief One indexed frame.
+	 */
+	struct Entry
+	{
+		uint64_t sequence = 0;
+		int64_t timestamp = 0;
+
+		friend bool operator==(const Entry&, const Entry&) = default;
+	};
+
+	/**
+	 * @brief Indexes the next frame of the stream.
+	 * @throws std::invalid_argument if the frame precedes the last frame indexed
+	 */
+	void append(uint64_t sequence, int64_t timestamp);
+
+	/**
+	 * @brief Frame nearest to an instant, the earlier one on a tie.
+	 * @return the frame, or std::nullopt if the index is empty
+	 */
+	[[nodiscard]] std::optional<Entry> nearest(int64_t timestamp) const;
+
+	[[nodiscard]] std::optional<Entry> last() const;
+
+	[[nodiscard]] std::size_t size() const { return _timeOffsets.size(); }
+	[[nodiscard]] bool empty() const { return _timeOffsets.empty(); }
+
+	void clear();
+
+private:
+	/**
+	 * \struct Block
+	 *
+	 * @brief Frames [first, first of the next block) of the index.
+	 */
+	struct Block
+	{
+		std::size_t first = 0;
+		uint64_t sequence = 0;
+		int64_t timestamp = 0;
+	};
+
+	// Frame at a position of the index
+	[[nodiscard]] Entry entryAt(std::size_t position) const;
+
+	// Position of the first frame not earlier than the instant, size() if none
+	[[nodiscard]] std::size_t lowerBound(int64_t timestamp) const;
+
+	std::vector<Block> _blocks;
+	std::vector<uint32_t> _timeOffsets;
+	std::vector<uint32_t> _sequenceOffsets;
+};
+
+}  // namespace frame
+
+#endif  // FRAME_FRAMETIMEINDEX_HPP
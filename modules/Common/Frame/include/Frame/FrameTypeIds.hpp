@@ -0,0 +1,134 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_FRAMETYPEIDS_HPP
+#define FRAME_FRAMETYPEIDS_HPP
+
+#include <memory>
+#include <utility>
+
+#include <caf/type_id.hpp>
+
+#include "CAF/CustomMessageIdentifier.hpp"
+
+#include "AcquisitionFrame.hpp"
+#include "FrameKind.hpp"
+#include "FrameStream.hpp"
+#include "PackedFrame.hpp"
+#include "SamplePrecision.hpp"
+#include "StimulusEvent.hpp"
+
+// Definition of the frame types exchanged between the modules
+CAF_BEGIN_TYPE_ID_BLOCK(custom_types_general, common_caf::custom_types_general_id)
+CAF_ADD_TYPE_ID(custom_types_general, (frame::FrameKind))
+CAF_ADD_TYPE_ID(custom_types_general, (frame::FrameStream))
+CAF_ADD_TYPE_ID(custom_types_general, (frame::FrameGeometry))
+CAF_ADD_TYPE_ID(custom_types_general, (frame::AcquisitionFrame))
+CAF_ADD_TYPE_ID(custom_types_general, (frame::StimulusSource))
+CAF_ADD_TYPE_ID(custom_types_general, (frame::StimulusEvent))
+CAF_ADD_TYPE_ID(custom_types_general, (frame::SamplePrecision))
+CAF_ADD_TYPE_ID(custom_types_general, (frame::PackedFrame))
+CAF_END_TYPE_ID_BLOCK(custom_types_general)
+
+namespace frame
+{
+
+// Inspect functions needed by CAF to serialize the frames (remote nodes, recorder)
+
+template <class Inspector>
+bool inspect(Inspector& f, FrameKind& kind)
+{
+	return caf::default_enum_inspect(f, kind);
+}
+
+template <class Inspector>
+bool inspect(Inspector& f, FrameStream& stream)
+{
+	return caf::default_enum_inspect(f, stream);
+}
+
+template <class Inspector>
+bool inspect(Inspector& f, FrameGeometry& geometry)
+{
+	return f.object(geometry).fields(f.field("depth-samples", geometry.depth_samples),
+	                                 f.field("lateral-samples", geometry.lateral_samples),
+	                                 f.field("channels", geometry.channels));
+}
+
+/**
+ * @brief The samples are copied when serialized: frames only cross the process boundary
+ * when an actor lives on a remote node or when the session is recorded.
+ */
+template <class Inspector>
+bool inspect(Inspector& f, AcquisitionFrame& frame)
+{
+	auto getSamples = [&frame]
+	{ return frame.samples ? *frame.samples : SampleBuffer{}; };
+	auto setSamples = [&frame](SampleBuffer samples)
+	{
+		frame.samples = std::make_shared<const SampleBuffer>(std::move(samples));
+		return true;
+	};
+
+	return f.object(frame).fields(f.field("sequence", frame.sequence),
+	                              f.field("timestamp", frame.timestamp),
+	                              f.field("stream", frame.stream),
+	                              f.field("kind", frame.kind),
+	                              f.field("geometry", frame.geometry),
+	                              f.field("samples", getSamples, setSamples));
+}
+
+template <class Inspector>
+bool inspect(Inspector& f, StimulusSource& source)
+{
+	return caf::default_enum_inspect(f, source);
+}
+
+template <class Inspector>
+bool inspect(Inspector& f, StimulusEvent& event)
+{
+	return f.object(event).fields(f.field("timestamp", event.timestamp),
+	                              f.field("source", event.source),
+	                              f.field("code", event.code));
+}
+
+template <class Inspector>
+bool inspect(Inspector& f, SamplePrecision& precision)
+{
+	return caf::default_enum_inspect(f, precision);
+}
+
+/**
+ * @brief Same as AcquisitionFrame, with the packed words in place of the floats.
+ */
+template <class Inspector>
+bool inspect(Inspector& f, PackedFrame& frame)
+{
+	auto getSamples = [&frame]
+	{ return frame.samples ? *frame.samples : PackedBuffer{}; };
+	auto setSamples = [&frame](PackedBuffer samples)
+	{
+		frame.samples = std::make_shared<const PackedBuffer>(std::move(samples));
+		return true;
+	};
+
+	return f.object(frame).fields(f.field("sequence", frame.sequence),
+	                              f.field("timestamp", frame.timestamp),
+	                              f.field("stream", frame.stream),
+	                              f.field("kind", frame.kind),
+	                              f.field("geometry", frame.geometry),
+	                              f.field("precision", frame.precision),
+	                              f.field("scale", frame.scale),
+	                              f.field("samples", getSamples, setSamples));
+}
+
+}  // namespace frame
+
+#endif  // FRAME_FRAMETYPEIDS_HPP
@@ -0,0 +1,76 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_LATENCYHISTOGRAM_HPP
+#define FRAME_LATENCYHISTOGRAM_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace frame
+{
+
+/**
+ * \class LatencyHistogram
+ *
+ * @brief Histogram of latencies in nanoseconds with log-linear buckets: each power of
+ * two is split in 8 buckets, the relative error of a percentile is below 12.5% from a
+ * few nanoseconds to hours. Values are plain counters, see FrameStatistics for the
+ * concurrent recording.
+ */
+class LatencyHistogram
+{
+public:
+	// Sub-buckets per power of two: 2^sub_bucket_bits
+	static constexpr unsigned sub_bucket_bits = 3;
+	static constexpr std::size_t sub_bucket_count = std::size_t{1} << sub_bucket_bits;
+	static constexpr std::size_t bucket_count = sub_bucket_count * (65 - sub_bucket_bits);
+
+	// Bucket of a latency
+	[[nodiscard]] static std::size_t bucketOf(uint64_t latencyNs);
+
+	// Smallest latency of a bucket
+	[[nodiscard]] static uint64_t bucketLowerBound(std::size_t bucket);
+
+	void record(uint64_t latencyNs) { add(bucketOf(latencyNs), 1, latencyNs); }
+
+	/**
+	 * @brief Adds `count` latencies to a bucket.
+	 * @param total sum of the latencies, for the mean
+	 */
+	void add(std::size_t bucket, uint64_t count, uint64_t total);
+
+	// Removes the latencies of an earlier state of the same histogram
+	LatencyHistogram& operator-=(const LatencyHistogram& earlier);
+
+	[[nodiscard]] uint64_t count() const { return _count; }
+	[[nodiscard]] uint64_t bucketCount(std::size_t bucket) const
+	{
+		return _buckets[bucket];
+	}
+	[[nodiscard]] uint64_t mean() const { return _count == 0 ? 0 : _total / _count; }
+
+	/**
+	 * @brief Latency below which lie `quantile` of the recorded latencies: the lower
+	 * bound of the bucket holding that rank. 0 if the histogram is empty.
+	 * @param quantile in [0, 1]
+	 */
+	[[nodiscard]] uint64_t percentile(double quantile) const;
+
+private:
+	std::array<uint64_t, bucket_count> _buckets{};
+	uint64_t _count{0};
+	uint64_t _total{0};
+};
+
+}  // namespace frame
+
+#endif  // FRAME_LATENCYHISTOGRAM_HPP
@@ -0,0 +1,58 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_PACKEDFRAME_HPP
+#define FRAME_PACKEDFRAME_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "AcquisitionFrame.hpp"
+#include "FrameKind.hpp"
+#include "FrameStream.hpp"
+#include "SamplePrecision.hpp"
+
+namespace frame
+{
+
+/// @brief Storage of the samples of a packed frame, in 16-bit words
+using PackedBuffer = std::vector<uint16_t>;
+
+/**
+ * \struct PackedFrame
+ *
+ * @brief An AcquisitionFrame whose samples are stored at a reduced precision, the form
+ * of the frames held by the domain model (see SampleConverter). A float32 sample takes
+ * two words, the others one.
+ */
+struct PackedFrame
+{
+	uint64_t sequence = 0;
+	int64_t timestamp = 0;
+	FrameStream stream = FrameStream::Doppler;
+	FrameKind kind = FrameKind::CompoundedIq;
+	FrameGeometry geometry;
+	SamplePrecision precision = SamplePrecision::Float32;
+	// Int16: value of one step, a sample is (word as int16) * scale. 1 otherwise
+	float scale = 1.0f;
+	std::shared_ptr<const PackedBuffer> samples;
+
+	// Bytes of the samples
+	[[nodiscard]] std::size_t byteCount() const
+	{
+		return samples ? samples->size() * sizeof(uint16_t) : 0;
+	}
+};
+
+}  // namespace frame
+
+#endif  // FRAME_PACKEDFRAME_HPP
@@ -0,0 +1,152 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_RELAYOUT_HPP
+#define FRAME_RELAYOUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "Simd/SimdLevel.hpp"
+
+#include "Frame.hpp"
+
+namespace frame
+{
+
+/**
+ * @brief Splits pairs of samples into two planes: first[i] = pairs[2 i] and
+ * second[i] = pairs[2 i + 1]. Vectorized, the variant of the level active at the call
+ * (see simd::activeLevel).
+ * @throws std::invalid_argument if the planes do not hold the pairs
+ */
+void deinterleave(std::span<const float> pairs,
+                  std::span<float> first,
+                  std::span<float> second);
+
+/**
+ * @brief Interleaves two planes into pairs of samples, the inverse of deinterleave().
+ * @throws std::invalid_argument if the pairs do not hold the planes
+ */
+void interleave(std::span<const float> first,
+                std::span<const float> second,
+                std::span<float> pairs);
+
+// Instruction set of the variants of deinterleave() and interleave() run at the call
+[[nodiscard]] simd::SimdLevel relayoutLevel();
+
+/**
+ * @brief Layout of blocks of pixels (see Tiled).
+ */
+template <typename Layout>
+concept TiledLayout = FrameLayout<Layout> && requires {
+	Layout::tile_depth;
+	Layout::tile_lateral;
+};
+
+/**
+ * @brief Copies the samples of a frame into a frame of another layout, of the same
+ * dimensions and components. The conversions between the acquisition layout and the
+ * other ones run on contiguous runs of samples: the float pairs are split into planes
+ * and back by vector shuffles, each column of a tile is one copy. The padding of a tiled
+ * frame is set to zero. The other conversions go sample by sample.
+ * @throws std::invalid_argument if the dimensions of the frames differ
+ */
+template <typename In, FrameLayout From, typename Out, FrameLayout To>
+    requires(std::is_same_v<std::remove_const_t<In>, Out> && !std::is_const_v<Out> &&
+             From::components == To::components)
+void relayout(const Frame<In, From>& in, const Frame<Out, To>& out)
+{
+	if (!in.sameShape(out))
+	{
+		throw std::invalid_argument(
+		    "Relayout: frame of " + std::to_string(in.depth()) + "x" +
+		    std::to_string(in.lateral()) + " pixels into a frame of " +
+		    std::to_string(out.depth()) + "x" + std::to_string(out.lateral()));
+	}
+
+	constexpr std::size_t components = From::components;
+	const std::size_t depth = in.depth();
+	const std::size_t lateral = in.lateral();
+	if constexpr (std::is_same_v<From, To>)
+	{
+		std::ranges::copy(in.samples(), out.samples().begin());
+	}
+	else if constexpr (std::is_same_v<Out, float> &&
+	                   std::is_same_v<From, Interleaved<2>> &&
+	                   std::is_same_v<To, Planar<2>>)
+	{
+		deinterleave(in.samples(), out.plane(0).samples(), out.plane(1).samples());
+	}
+	else if constexpr (std::is_same_v<Out, float> &&
+	                   std::is_same_v<From, Planar<2>> &&
+	                   std::is_same_v<To, Interleaved<2>>)
+	{
+		interleave(in.plane(0).samples(), in.plane(1).samples(), out.samples());
+	}
+	else if constexpr (TiledLayout<To> && std::is_same_v<From, Interleaved<components>>)
+	{
+		// A column of a tile is a run of samples in both layouts
+		const std::size_t run = To::tile_depth * components;
+		const std::size_t columns = To::lateralTiles(lateral) * To::tile_lateral;
+		for (std::size_t x = 0; x < columns; ++x)
+		{
+			for (std::size_t z = 0; z < depth; z += To::tile_depth)
+			{
+				Out* tile = out.data() + To::index(depth, lateral, z, x, 0);
+				const std::size_t count =
+				    x < lateral ? std::min(To::tile_depth, depth - z) * components : 0;
+				if (count > 0)
+				{
+					std::copy_n(&in(z, x), count, tile);
+				}
+				std::fill(tile + count, tile + run, Out{});
+			}
+		}
+	}
+	else if constexpr (TiledLayout<From> && std::is_same_v<To, Interleaved<components>>)
+	{
+		for (std::size_t x = 0; x < lateral; ++x)
+		{
+			for (std::size_t z = 0; z < depth; z += From::tile_depth)
+			{
+				const std::size_t count =
+				    std::min(From::tile_depth, depth - z) * components;
+				std::copy_n(in.data() + From::index(depth, lateral, z, x, 0), count,
+				            &out(z, x));
+			}
+		}
+	}
+	else
+	{
+		if constexpr (TiledLayout<To>)
+		{
+			std::ranges::fill(out.samples(), Out{});
+		}
+		for (std::size_t x = 0; x < lateral; ++x)
+		{
+			for (std::size_t z = 0; z < depth; ++z)
+			{
+				for (std::size_t c = 0; c < components; ++c)
+				{
+					out(z, x, c) = in(z, x, c);
+				}
+			}
+		}
+	}
+}
+
+}  // namespace frame
+
+#endif  // FRAME_RELAYOUT_HPP
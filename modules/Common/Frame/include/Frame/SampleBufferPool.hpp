@@ -0,0 +1,75 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_SAMPLEBUFFERPOOL_HPP
+#define FRAME_SAMPLEBUFFERPOOL_HPP
+
+#include <cstddef>
+#include <memory>
+
+#include "AcquisitionFrame.hpp"
+
+namespace frame
+{
+
+/**
+ * \class SampleBufferPool
+ *
+ * @brief Preallocated sample buffers of one size, recycled when the last reference to a
+ * buffer is released. Neither the acquisition nor the release of a buffer locks or
+ * allocates: the free buffers are kept in a lock-free list, and the control blocks of
+ * the shared pointers are built in room reserved next to each buffer. When all the
+ * buffers are in use, no buffer is returned and the frame is dropped by the caller; the
+ * drops are counted (see dropCount). Buffers released after the destruction of the pool
+ * are freed with the last of them. Thread-safe.
+ */
+class SampleBufferPool
+{
+public:
+	/**
+	 * @brief: Ctor. Allocates the buffers.
+	 * @param bufferSize number of floats per buffer
+	 * @param capacity number of preallocated buffers
+	 * @throws std::invalid_argument if there are too many buffers to index
+	 */
+	SampleBufferPool(std::size_t bufferSize, std::size_t capacity);
+
+	// Dtor
+	~SampleBufferPool() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	SampleBufferPool(const SampleBufferPool&) = delete;
+	SampleBufferPool& operator=(const SampleBufferPool&) = delete;
+	SampleBufferPool(SampleBufferPool&&) = delete;
+	SampleBufferPool& operator=(SampleBufferPool&&) = delete;
+
+	/**
+	 * @brief Takes a free buffer of bufferSize() floats. Its content is unspecified.
+	 * @return the buffer, or null if all the buffers are in use
+	 */
+	[[nodiscard]] std::shared_ptr<SampleBuffer> acquire();
+
+	// Number of floats per buffer
+	[[nodiscard]] std::size_t bufferSize() const;
+
+	// Number of buffers ready to be acquired
+	[[nodiscard]] std::size_t available() const;
+
+	// Number of acquisitions that found the pool empty
+	[[nodiscard]] std::size_t dropCount() const;
+
+private:
+	struct Storage;
+	std::shared_ptr<Storage> _storage;
+};
+
+}  // namespace frame
+
+#endif  // FRAME_SAMPLEBUFFERPOOL_HPP
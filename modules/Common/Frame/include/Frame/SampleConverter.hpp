@@ -0,0 +1,108 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_SAMPLECONVERTER_HPP
+#define FRAME_SAMPLECONVERTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include "Simd/SimdLevel.hpp"
+
+#include "AcquisitionFrame.hpp"
+#include "PackedFrame.hpp"
+#include "SamplePrecision.hpp"
+
+namespace frame
+{
+
+/**
+ * \class SampleConverter
+ *
+ * @brief Conversion of float samples to a precision and back, with the kernels of the
+ * SIMD level active when the converter is built (F16C or AVX-512 for float16). Halves
+ * the memory of the frames held for their bandwidth; the processing stays in float32.
+ *
+ * Rounding is to nearest. Float16 saturates to infinity beyond 65504; int16 maps the
+ * largest magnitude of the samples to 32767 and NaN to -32767.
+ */
+class SampleConverter
+{
+public:
+	/**
+	 * @brief: Ctor. Selects the kernels of the precision.
+	 */
+	explicit SampleConverter(SamplePrecision precision);
+
+	// Dtor
+	~SampleConverter() = default;
+
+	// Copyable: the kernels are stateless
+	SampleConverter(const SampleConverter&) = default;
+	SampleConverter& operator=(const SampleConverter&) = default;
+
+	// Precision of the packed samples
+	[[nodiscard]] SamplePrecision precision() const { return _precision; }
+
+	// Instruction set of the selected kernels
+	[[nodiscard]] simd::SimdLevel simdLevel() const { return _simdLevel; }
+
+	/**
+	 * @brief Number of words of `sampleCount` packed samples.
+	 */
+	[[nodiscard]] std::size_t packedSize(std::size_t sampleCount) const
+	{
+		return sampleCount * sampleBytes(_precision) / sizeof(uint16_t);
+	}
+
+	/**
+	 * @brief Packs the samples.
+	 * @param packed packedSize(samples.size()) words
+	 * @return scale of the packed samples (see PackedFrame::scale)
+	 * @throws std::invalid_argument if the sizes do not match
+	 */
+	float pack(std::span<const float> samples, std::span<uint16_t> packed) const;
+
+	/**
+	 * @brief Unpacks samples packed with the same precision.
+	 * @param scale value returned by pack
+	 * @param samples packed.size() / packedSize(1) floats
+	 * @throws std::invalid_argument if the sizes do not match
+	 */
+	void unpack(std::span<const uint16_t> packed,
+	            float scale,
+	            std::span<float> samples) const;
+
+	/**
+	 * @brief Copy of the frame with its samples packed.
+	 */
+	[[nodiscard]] PackedFrame pack(const AcquisitionFrame& frame) const;
+
+	/**
+	 * @brief Frame with the samples unpacked in a new buffer.
+	 * @throws std::invalid_argument if the frame was packed at another precision
+	 */
+	[[nodiscard]] AcquisitionFrame unpack(const PackedFrame& frame) const;
+
+	// Kernels of a precision, see the definitions
+	using PackFunction = float(const float*, std::size_t, uint16_t*);
+	using UnpackFunction = void(const uint16_t*, std::size_t, float, float*);
+
+private:
+	SamplePrecision _precision;
+	simd::SimdLevel _simdLevel{simd::SimdLevel::Scalar};
+	PackFunction* _pack{nullptr};
+	UnpackFunction* _unpack{nullptr};
+};
+
+}  // namespace frame
+
+#endif  // FRAME_SAMPLECONVERTER_HPP
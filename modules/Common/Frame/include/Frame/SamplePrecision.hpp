@@ -0,0 +1,155 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_SAMPLEPRECISION_HPP
+#define FRAME_SAMPLEPRECISION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace frame
+{
+
+/**
+ * @enum SamplePrecision
+ * @brief Representation of the samples of a stored frame (see PackedFrame).
+ */
+enum class SamplePrecision : uint8_t
+{
+	Float32,   // As processed, no loss
+	Float16,   // IEEE half: 11 significant bits, values up to 65504
+	BFloat16,  // Upper half of a float: 8 significant bits, range of a float
+	Int16      // Fixed point, one scale per frame set by its largest magnitude
+};
+
+/**
+ * @brief Bytes per sample of a precision.
+ */
+[[nodiscard]] constexpr std::size_t sampleBytes(SamplePrecision precision)
+{
+	return precision == SamplePrecision::Float32 ? 4 : 2;
+}
+
+/**
+ * @brief Converts a SamplePrecision enum value to its string representation.
+ * @param precision The SamplePrecision enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(SamplePrecision precision)
+{
+	using namespace std::string_literals;
+
+	switch (precision)
+	{
+	case SamplePrecision::Float32:
+		return "float32"s;
+	case SamplePrecision::Float16:
+		return "float16"s;
+	case SamplePrecision::BFloat16:
+		return "bfloat16"s;
+	case SamplePrecision::Int16:
+		return "int16"s;
+	}
+
+	throw std::domain_error("Invalid value for SamplePrecision: " +
+	                        std::to_string(std::to_underlying(precision)));
+}
+
+/**
+ * @brief Attempts to convert a string to a SamplePrecision enum value.
+ * @param str The string to convert.
+ * @param precision Reference to the SamplePrecision enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, SamplePrecision& precision)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "float32"sv)
+	{
+		precision = SamplePrecision::Float32;
+		status = true;
+	}
+	else if (str == "float16"sv)
+	{
+		precision = SamplePrecision::Float16;
+		status = true;
+	}
+	else if (str == "bfloat16"sv)
+	{
+		precision = SamplePrecision::BFloat16;
+		status = true;
+	}
+	else if (str == "int16"sv)
+	{
+		precision = SamplePrecision::Int16;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a SamplePrecision enum value.
+ * @param value The integer value to convert.
+ * @param precision Reference to the SamplePrecision enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<SamplePrecision> value,
+                                          SamplePrecision& precision)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(SamplePrecision::Float32):
+		precision = SamplePrecision::Float32;
+		status = true;
+		break;
+	case std::to_underlying(SamplePrecision::Float16):
+		precision = SamplePrecision::Float16;
+		status = true;
+		break;
+	case std::to_underlying(SamplePrecision::BFloat16):
+		precision = SamplePrecision::BFloat16;
+		status = true;
+		break;
+	case std::to_underlying(SamplePrecision::Int16):
+		precision = SamplePrecision::Int16;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace frame
+
+/**
+ * @brief Specialization of the std::format for SamplePrecision. Needed for logging
+ */
+template <>
+struct std::formatter<frame::SamplePrecision>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const frame::SamplePrecision& precision, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", frame::to_string(precision));
+	}
+};
+
+#endif  // FRAME_SAMPLEPRECISION_HPP
@@ -0,0 +1,156 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_SPSCRING_HPP
+#define FRAME_SPSCRING_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace frame
+{
+
+/**
+ * \class SpscRing
+ *
+ * @brief Bounded ring between one producer thread and one consumer thread.
+ *
+ * Both sides are wait-free: a push or a pop is a few loads and one release store, it
+ * never locks nor allocates. The producer is meant to be a hardware callback thread that
+ * must not block: when the ring is full the item is rejected and counted as an overflow,
+ * the producer decides what to do with it (usually drop it).
+ *
+ * The indices only grow, the slot of an index is `index & mask`. Each side caches the
+ * index of the other side to touch the shared cache line only when the ring looks full
+ * or empty.
+ *
+ * @tparam T item type, default constructible and nothrow movable
+ */
+template <class T>
+class SpscRing
+{
+	static_assert(std::is_nothrow_move_assignable_v<T> &&
+	                  std::is_nothrow_default_constructible_v<T>,
+	              "SpscRing items must be nothrow movable and default constructible");
+
+public:
+	/**
+	 * @brief: Ctor. Allocates all the slots.
+	 * @param capacity minimal number of items, rounded up to a power of two
+	 */
+	explicit SpscRing(std::size_t capacity)
+	    : _slots(std::bit_ceil(std::max<std::size_t>(capacity, 1))),
+	      _mask(_slots.size() - 1)
+	{
+	}
+
+	// Dtor
+	~SpscRing() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	SpscRing(const SpscRing&) = delete;
+	SpscRing& operator=(const SpscRing&) = delete;
+	SpscRing(SpscRing&&) = delete;
+	SpscRing& operator=(SpscRing&&) = delete;
+
+	/**
+	 * @brief Producer side. Moves the item into the ring.
+	 * @return false if the ring is full: the item is left untouched and the overflow is
+	 * counted
+	 */
+	[[nodiscard]] bool tryPush(T& item) noexcept
+	{
+		const std::size_t tail = _producer.tail.load(std::memory_order_relaxed);
+		if (tail - _producer.cachedHead == _slots.size())
+		{
+			_producer.cachedHead = _consumer.head.load(std::memory_order_acquire);
+			if (tail - _producer.cachedHead == _slots.size())
+			{
+				_producer.overflows.fetch_add(1, std::memory_order_relaxed);
+				return false;
+			}
+		}
+
+		_slots[tail & _mask] = std::move(item);
+		_producer.tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	/**
+	 * @brief Consumer side. Moves up to `maxItems` items at the end of `out`. The slots
+	 * are reset so that they do not keep the resources of the items alive.
+	 * @return the number of items moved
+	 */
+	std::size_t drain(std::vector<T>& out, std::size_t maxItems)
+	{
+		const std::size_t head = _consumer.head.load(std::memory_order_relaxed);
+		if (_consumer.cachedTail - head < maxItems)
+		{
+			_consumer.cachedTail = _producer.tail.load(std::memory_order_acquire);
+		}
+
+		const std::size_t count = std::min(_consumer.cachedTail - head, maxItems);
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			T& slot = _slots[(head + i) & _mask];
+			out.push_back(std::move(slot));
+			slot = T{};
+		}
+
+		_consumer.head.store(head + count, std::memory_order_release);
+		return count;
+	}
+
+	[[nodiscard]] std::size_t capacity() const noexcept { return _slots.size(); }
+
+	// Items in the ring. Exact only when called from one of the two sides while the
+	// other is idle.
+	[[nodiscard]] std::size_t size() const noexcept
+	{
+		return _producer.tail.load(std::memory_order_acquire) -
+		       _consumer.head.load(std::memory_order_acquire);
+	}
+
+	// Items rejected because the ring was full
+	[[nodiscard]] uint64_t overflowCount() const noexcept
+	{
+		return _producer.overflows.load(std::memory_order_relaxed);
+	}
+
+private:
+	// Keeps the indices of the two sides on different cache lines
+	static constexpr std::size_t cache_line_size = 64;
+
+	std::vector<T> _slots;
+	const std::size_t _mask;
+
+	struct alignas(cache_line_size) Producer
+	{
+		std::atomic<std::size_t> tail{0};
+		std::size_t cachedHead{0};
+		std::atomic<uint64_t> overflows{0};
+	} _producer;
+
+	struct alignas(cache_line_size) Consumer
+	{
+		std::atomic<std::size_t> head{0};
+		std::size_t cachedTail{0};
+	} _consumer;
+};
+
+}  // namespace frame
+
+#endif  // FRAME_SPSCRING_HPP
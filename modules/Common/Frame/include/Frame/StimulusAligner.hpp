@@ -0,0 +1,96 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_STIMULUSALIGNER_HPP
+#define FRAME_STIMULUSALIGNER_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "AcquisitionFrame.hpp"
+#include "FrameStream.hpp"
+#include "FrameTimeIndex.hpp"
+#include "PackedFrame.hpp"
+#include "StimulusEvent.hpp"
+
+namespace frame
+{
+
+/**
+ * \class StimulusAligner
+ *
+ * @brief Aligns the stimulus events on the frames of a stream. Frames and events arrive
+ * independently: an event is aligned once a frame at or after it has arrived, its
+ * nearest frame being known from then on. Events arriving after their frames are
+ * aligned at once.
+ *
+ * The frames of the whole session are indexed (see FrameTimeIndex), not copied.
+ */
+class StimulusAligner
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param stream stream of the frames the events are aligned on
+	 */
+	explicit StimulusAligner(FrameStream stream = FrameStream::Doppler)
+	    : _stream(stream)
+	{
+	}
+
+	/**
+	 * @brief Indexes a frame. Frames of the other streams are ignored.
+	 * @return true if events are ready, see takeAligned()
+	 */
+	bool addFrame(const AcquisitionFrame& frame);
+
+	// Same for a stored frame
+	bool addFrame(const PackedFrame& frame);
+
+	/**
+	 * @brief Queues an event until its nearest frame is known.
+	 * @return true if events are ready, see takeAligned()
+	 */
+	bool addEvent(const StimulusEvent& event);
+
+	/**
+	 * @brief Moves the events aligned so far into `aligned`, in the order of their
+	 * timestamps.
+	 */
+	void takeAligned(std::vector<AlignedStimulus>& aligned);
+
+	/**
+	 * @brief Aligns the pending events on the last frame, e.g. at the end of the
+	 * acquisition. Events without any frame are kept.
+	 */
+	void flush(std::vector<AlignedStimulus>& aligned);
+
+	// Events waiting for a later frame
+	[[nodiscard]] std::size_t pendingCount() const { return _pending.size(); }
+
+	[[nodiscard]] const FrameTimeIndex& index() const { return _index; }
+
+private:
+	// Indexes a frame of any stream
+	bool addFrame(FrameStream stream, uint64_t sequence, int64_t timestamp);
+
+	// True if the first pending event can be aligned
+	[[nodiscard]] bool ready() const;
+
+	FrameStream _stream;
+	FrameTimeIndex _index;
+
+	// Sorted by timestamp
+	std::vector<StimulusEvent> _pending;
+};
+
+}  // namespace frame
+
+#endif  // FRAME_STIMULUSALIGNER_HPP
@@ -0,0 +1,163 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef FRAME_STIMULUSEVENT_HPP
+#define FRAME_STIMULUSEVENT_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "AcquisitionFrame.hpp"
+
+namespace frame
+{
+
+/**
+ * @enum StimulusSource
+ * @brief Origin of a stimulus event.
+ */
+enum class StimulusSource : uint8_t
+{
+	Trigger,  // TTL input of the hardware, the code is the input line
+	Paradigm  // Event of the stimulation paradigm, the code is the condition
+};
+
+/**
+ * @brief Converts a StimulusSource enum value to its string representation.
+ * @param source The StimulusSource enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(StimulusSource source)
+{
+	using namespace std::string_literals;
+
+	switch (source)
+	{
+	case StimulusSource::Trigger:
+		return "trigger"s;
+	case StimulusSource::Paradigm:
+		return "paradigm"s;
+	}
+
+	throw std::domain_error("Invalid value for StimulusSource: " +
+	                        std::to_string(std::to_underlying(source)));
+}
+
+/**
+ * @brief Attempts to convert a string to a StimulusSource enum value.
+ * @param str The string to convert.
+ * @param source Reference to the StimulusSource enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, StimulusSource& source)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "trigger"sv)
+	{
+		source = StimulusSource::Trigger;
+		status = true;
+	}
+	else if (str == "paradigm"sv)
+	{
+		source = StimulusSource::Paradigm;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a StimulusSource enum value.
+ * @param value The integer value to convert.
+ * @param source Reference to the StimulusSource enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<StimulusSource> value,
+                                          StimulusSource& source)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(StimulusSource::Trigger):
+		source = StimulusSource::Trigger;
+		status = true;
+		break;
+	case std::to_underlying(StimulusSource::Paradigm):
+		source = StimulusSource::Paradigm;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+/**
+ * \struct StimulusEvent
+ *
+ * @brief External event to correlate with the frames: a TTL trigger or an event of the
+ * paradigm. Timestamped by its source on the clock of the frames.
+ */
+struct StimulusEvent
+{
+	// Occurrence of the event, see monotonicTimestamp()
+	int64_t timestamp = 0;
+	StimulusSource source = StimulusSource::Trigger;
+	uint32_t code = 0;
+
+	friend bool operator==(const StimulusEvent&, const StimulusEvent&) = default;
+};
+
+/**
+ * @brief Event of the given source and code occurring now.
+ */
+[[nodiscard]] inline StimulusEvent stimulusNow(StimulusSource source, uint32_t code)
+{
+	return StimulusEvent{
+	    .timestamp = monotonicTimestamp(), .source = source, .code = code};
+}
+
+/**
+ * \struct AlignedStimulus
+ *
+ * @brief Stimulus event and the frame of a stream nearest to it in time.
+ */
+struct AlignedStimulus
+{
+	StimulusEvent event;
+	uint64_t frame_sequence = 0;
+	int64_t frame_timestamp = 0;
+
+	// Time from the frame to the event, negative if the event precedes the frame
+	[[nodiscard]] int64_t offset() const { return event.timestamp - frame_timestamp; }
+};
+
+}  // namespace frame
+
+/**
+ * @brief Specialization of the std::format for StimulusSource. Needed for logging
+ */
+template <>
+struct std::formatter<frame::StimulusSource>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const frame::StimulusSource& source, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", frame::to_string(source));
+	}
+};
+
+#endif  // FRAME_STIMULUSEVENT_HPP
@@ -0,0 +1,83 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <utility>
+
+#include "Frame/FrameCache.hpp"
+
+namespace frame
+{
+
+void FrameCache::add(PackedFrame frame)
+{
+	const std::size_t bytes = frame.byteCount();
+	if (bytes > _capacity)
+	{
+		return;
+	}
+	while (_byteCount + bytes > _capacity)
+	{
+		dropOldest();
+	}
+
+	_byteCount += bytes;
+	_frames[std::to_underlying(frame.stream)].push_back(std::move(frame));
+}
+
+// --------------------------------------------------------------------
+const PackedFrame* FrameCache::find(FrameStream stream, uint64_t sequence) const
+{
+	const std::deque<PackedFrame>& frames = _frames[std::to_underlying(stream)];
+	const auto found = std::find_if(frames.rbegin(), frames.rend(),
+	                                [sequence](const PackedFrame& frame)
+	                                { return frame.sequence == sequence; });
+	return found != frames.rend() ? &*found : nullptr;
+}
+
+// --------------------------------------------------------------------
+void FrameCache::clear()
+{
+	for (std::deque<PackedFrame>& frames : _frames)
+	{
+		frames.clear();
+	}
+	_byteCount = 0;
+}
+
+// --------------------------------------------------------------------
+std::size_t FrameCache::frameCount() const
+{
+	std::size_t count = 0;
+	for (const std::deque<PackedFrame>& frames : _frames)
+	{
+		count += frames.size();
+	}
+	return count;
+}
+
+// --------------------------------------------------------------------
+void FrameCache::dropOldest()
+{
+	std::deque<PackedFrame>* oldest = nullptr;
+	for (std::deque<PackedFrame>& frames : _frames)
+	{
+		if (!frames.empty() &&
+		    (oldest == nullptr || frames.front().timestamp < oldest->front().timestamp))
+		{
+			oldest = &frames;
+		}
+	}
+
+	_byteCount -= oldest->front().byteCount();
+	oldest->pop_front();
+}
+
+}  // namespace frame
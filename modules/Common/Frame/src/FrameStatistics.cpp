@@ -0,0 +1,139 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+#include "Frame/FrameStatistics.hpp"
+
+namespace frame
+{
+
+namespace
+{
+/**
+ * \struct StageCounters
+ *
+ * @brief Live statistics of a stage, updated by its actor and read by any thread.
+ */
+struct StageCounters
+{
+	std::atomic<uint64_t> frames{0};
+	std::atomic<uint64_t> gaps{0};
+	std::atomic<uint64_t> missing{0};
+	std::atomic<uint64_t> reordered{0};
+	std::array<std::atomic<uint64_t>, LatencyHistogram::bucket_count> latencyBuckets{};
+	std::atomic<uint64_t> latencyTotal{0};
+
+	// Highest sequence received per stream, valid if tracking is set
+	std::array<std::atomic<uint64_t>, frame_stream_count> lastSequence{};
+	std::array<std::atomic<bool>, frame_stream_count> tracking{};
+};
+
+std::array<StageCounters, frame_stage_count> _stages;
+
+// --------------------------------------------------------------------
+StageCounters& countersOf(FrameStage stage)
+{
+	return _stages[std::to_underlying(stage)];
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+StageStatistics& StageStatistics::operator-=(const StageStatistics& earlier)
+{
+	frames -= earlier.frames;
+	gaps -= earlier.gaps;
+	missing -= earlier.missing;
+	reordered -= earlier.reordered;
+	latency -= earlier.latency;
+	return *this;
+}
+
+// --------------------------------------------------------------------
+void recordFrameArrival(FrameStage stage, const AcquisitionFrame& frame)
+{
+	StageCounters& counters = countersOf(stage);
+
+	const int64_t elapsed = monotonicTimestamp() - frame.timestamp;
+	const auto latency = static_cast<uint64_t>(std::max<int64_t>(elapsed, 0));
+	counters.latencyBuckets[LatencyHistogram::bucketOf(latency)].fetch_add(
+	    1, std::memory_order_relaxed);
+	counters.latencyTotal.fetch_add(latency, std::memory_order_relaxed);
+
+	// One writer per stage: plain loads and stores of the last sequence
+	const std::size_t stream = std::to_underlying(frame.stream);
+	std::atomic<uint64_t>& lastSequence = counters.lastSequence[stream];
+	std::atomic<bool>& tracking = counters.tracking[stream];
+	if (!tracking.load(std::memory_order_relaxed))
+	{
+		lastSequence.store(frame.sequence, std::memory_order_relaxed);
+		tracking.store(true, std::memory_order_relaxed);
+	}
+	else
+	{
+		const uint64_t last = lastSequence.load(std::memory_order_relaxed);
+		if (frame.sequence > last)
+		{
+			if (frame.sequence > last + 1)
+			{
+				counters.gaps.fetch_add(1, std::memory_order_relaxed);
+				counters.missing.fetch_add(frame.sequence - last - 1,
+				                           std::memory_order_relaxed);
+			}
+			lastSequence.store(frame.sequence, std::memory_order_relaxed);
+		}
+		else
+		{
+			counters.reordered.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	counters.frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+// --------------------------------------------------------------------
+StageStatistics stageStatistics(FrameStage stage)
+{
+	const StageCounters& counters = countersOf(stage);
+
+	StageStatistics statistics;
+	statistics.frames = counters.frames.load(std::memory_order_relaxed);
+	statistics.gaps = counters.gaps.load(std::memory_order_relaxed);
+	statistics.missing = counters.missing.load(std::memory_order_relaxed);
+	statistics.reordered = counters.reordered.load(std::memory_order_relaxed);
+
+	const uint64_t total = counters.latencyTotal.load(std::memory_order_relaxed);
+	for (std::size_t i = 0; i < LatencyHistogram::bucket_count; ++i)
+	{
+		const uint64_t count = counters.latencyBuckets[i].load(std::memory_order_relaxed);
+		if (count != 0)
+		{
+			statistics.latency.add(i, count, 0);
+		}
+	}
+	statistics.latency.add(0, 0, total);
+	return statistics;
+}
+
+// --------------------------------------------------------------------
+void restartSequenceTracking()
+{
+	for (StageCounters& counters : _stages)
+	{
+		for (std::atomic<bool>& tracking : counters.tracking)
+		{
+			tracking.store(false, std::memory_order_relaxed);
+		}
+	}
+}
+
+}  // namespace frame
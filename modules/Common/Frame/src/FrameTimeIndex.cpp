@@ -0,0 +1,131 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "Frame/FrameTimeIndex.hpp"
+
+namespace frame
+{
+
+namespace
+{
+constexpr uint64_t max_offset = std::numeric_limits<uint32_t>::max();
+}  // namespace
+
+// --------------------------------------------------------------------
+void FrameTimeIndex::append(uint64_t sequence, int64_t timestamp)
+{
+	if (!_blocks.empty())
+	{
+		const Entry previous = entryAt(size() - 1);
+		if (timestamp < previous.timestamp)
+		{
+			throw std::invalid_argument("Frame " + std::to_string(sequence) +
+			                            " indexed before the frame " +
+			                            std::to_string(previous.sequence));
+		}
+	}
+
+	const bool fitsLastBlock =
+	    !_blocks.empty() && sequence >= _blocks.back().sequence &&
+	    sequence - _blocks.back().sequence <= max_offset &&
+	    static_cast<uint64_t>(timestamp - _blocks.back().timestamp) <= max_offset;
+	if (!fitsLastBlock)
+	{
+		_blocks.push_back(
+		    Block{.first = size(), .sequence = sequence, .timestamp = timestamp});
+	}
+
+	const Block& block = _blocks.back();
+	_timeOffsets.push_back(static_cast<uint32_t>(timestamp - block.timestamp));
+	_sequenceOffsets.push_back(static_cast<uint32_t>(sequence - block.sequence));
+}
+
+// --------------------------------------------------------------------
+std::optional<FrameTimeIndex::Entry> FrameTimeIndex::nearest(int64_t timestamp) const
+{
+	if (empty())
+	{
+		return std::nullopt;
+	}
+
+	// The nearest frame is the first one not earlier, or the one before it
+	const std::size_t position = lowerBound(timestamp);
+	if (position == size())
+	{
+		return entryAt(position - 1);
+	}
+	const Entry after = entryAt(position);
+	if (position == 0)
+	{
+		return after;
+	}
+	const Entry before = entryAt(position - 1);
+	return timestamp - before.timestamp <= after.timestamp - timestamp ? before : after;
+}
+
+// --------------------------------------------------------------------
+std::optional<FrameTimeIndex::Entry> FrameTimeIndex::last() const
+{
+	if (empty())
+	{
+		return std::nullopt;
+	}
+	return entryAt(size() - 1);
+}
+
+// --------------------------------------------------------------------
+void FrameTimeIndex::clear()
+{
+	_blocks.clear();
+	_timeOffsets.clear();
+	_sequenceOffsets.clear();
+}
+
+// --------------------------------------------------------------------
+FrameTimeIndex::Entry FrameTimeIndex::entryAt(std::size_t position) const
+{
+	const auto block =
+	    std::prev(std::ranges::upper_bound(_blocks, position, {}, &Block::first));
+	return Entry{.sequence = block->sequence + _sequenceOffsets[position],
+	             .timestamp = block->timestamp + _timeOffsets[position]};
+}
+
+// --------------------------------------------------------------------
+std::size_t FrameTimeIndex::lowerBound(int64_t timestamp) const
+{
+	// Last block starting at or before the instant
+	const auto next = std::ranges::upper_bound(_blocks, timestamp, {}, &Block::timestamp);
+	if (next == _blocks.begin())
+	{
+		return 0;
+	}
+	const auto block = std::prev(next);
+	const std::size_t end = next == _blocks.end() ? size() : next->first;
+
+	// The instant may lie after the whole block
+	const uint64_t offset = static_cast<uint64_t>(timestamp - block->timestamp);
+	if (offset > max_offset)
+	{
+		return end;
+	}
+	const auto first = _timeOffsets.begin() + static_cast<std::ptrdiff_t>(block->first);
+	const auto last = _timeOffsets.begin() + static_cast<std::ptrdiff_t>(end);
+	return static_cast<std::size_t>(
+	    std::lower_bound(first, last, static_cast<uint32_t>(offset)) -
+	    _timeOffsets.begin());
+}
+
+}  // namespace frame
@@ -0,0 +1,95 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "Frame/LatencyHistogram.hpp"
+
+namespace frame
+{
+
+// --------------------------------------------------------------------
+std::size_t LatencyHistogram::bucketOf(uint64_t latencyNs)
+{
+	// The first buckets hold one value each
+	if (latencyNs < sub_bucket_count)
+	{
+		return static_cast<std::size_t>(latencyNs);
+	}
+
+	// Power of two of the latency, then its next sub_bucket_bits bits
+	const unsigned exponent = static_cast<unsigned>(std::bit_width(latencyNs)) - 1;
+	const unsigned shift = exponent - sub_bucket_bits;
+	const auto mantissa =
+	    static_cast<std::size_t>((latencyNs >> shift) & (sub_bucket_count - 1));
+	return sub_bucket_count * (shift + 1) + mantissa;
+}
+
+// --------------------------------------------------------------------
+uint64_t LatencyHistogram::bucketLowerBound(std::size_t bucket)
+{
+	if (bucket < sub_bucket_count)
+	{
+		return bucket;
+	}
+
+	const std::size_t shift = bucket / sub_bucket_count - 1;
+	const uint64_t mantissa = bucket % sub_bucket_count;
+	return (sub_bucket_count + mantissa) << shift;
+}
+
+// --------------------------------------------------------------------
+void LatencyHistogram::add(std::size_t bucket, uint64_t count, uint64_t total)
+{
+	_buckets[bucket] += count;
+	_count += count;
+	_total += total;
+}
+
+// --------------------------------------------------------------------
+LatencyHistogram& LatencyHistogram::operator-=(const LatencyHistogram& earlier)
+{
+	for (std::size_t i = 0; i < bucket_count; ++i)
+	{
+		_buckets[i] -= earlier._buckets[i];
+	}
+	_count -= earlier._count;
+	_total -= earlier._total;
+	return *this;
+}
+
+// --------------------------------------------------------------------
+uint64_t LatencyHistogram::percentile(double quantile) const
+{
+	if (_count == 0)
+	{
+		return 0;
+	}
+
+	// Rank of the latency, from 1 to _count
+	const auto ceilRank =
+	    static_cast<uint64_t>(std::ceil(quantile * static_cast<double>(_count)));
+	const uint64_t rank = std::clamp<uint64_t>(ceilRank, 1, _count);
+
+	uint64_t seen = 0;
+	for (std::size_t i = 0; i < bucket_count; ++i)
+	{
+		seen += _buckets[i];
+		if (seen >= rank)
+		{
+			return bucketLowerBound(i);
+		}
+	}
+	return bucketLowerBound(bucket_count - 1);
+}
+
+}  // namespace frame
@@ -0,0 +1,201 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#include "Simd/Dispatch.hpp"
+
+#if MEDSIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "Frame/Relayout.hpp"
+
+namespace frame
+{
+
+namespace
+{
+// Kernels: pairs, pairs in the planes, first and second planes
+using SplitFunction = void(const float*, std::size_t, float*, float*);
+// Kernels: first and second planes, samples of each, pairs
+using MergeFunction = void(const float*, const float*, std::size_t, float*);
+
+// --------------------------------------------------------------------
+void deinterleaveScalar(const float* pairs,
+                        std::size_t count,
+                        float* first,
+                        float* second)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		first[i] = pairs[2 * i];
+		second[i] = pairs[2 * i + 1];
+	}
+}
+
+void interleaveScalar(const float* first,
+                      const float* second,
+                      std::size_t count,
+                      float* pairs)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		pairs[2 * i] = first[i];
+		pairs[2 * i + 1] = second[i];
+	}
+}
+
+#if MEDSIMD_X86
+// --------------------------------------------------------------------
+// AVX2: the shuffles work within the 128-bit lanes, the 64-bit blocks are put back in
+// order across the lanes.
+
+MEDSIMD_TARGET_AVX2
+void deinterleaveAvx2(const float* pairs, std::size_t count, float* first, float* second)
+{
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		const __m256 a = _mm256_loadu_ps(pairs + 2 * i);
+		const __m256 b = _mm256_loadu_ps(pairs + 2 * i + 8);
+		// a0 a2 b0 b2 | a4 a6 b4 b6, then a0 a2 a4 a6 b0 b2 b4 b6
+		const __m256 even = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+		const __m256 odd = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+		_mm256_storeu_ps(first + i, _mm256_castpd_ps(_mm256_permute4x64_pd(
+		                                _mm256_castps_pd(even), 0xD8)));
+		_mm256_storeu_ps(second + i, _mm256_castpd_ps(_mm256_permute4x64_pd(
+		                                 _mm256_castps_pd(odd), 0xD8)));
+	}
+	deinterleaveScalar(pairs + 2 * i, count - i, first + i, second + i);
+}
+
+MEDSIMD_TARGET_AVX2
+void interleaveAvx2(const float* first,
+                    const float* second,
+                    std::size_t count,
+                    float* pairs)
+{
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		const __m256 a = _mm256_loadu_ps(first + i);
+		const __m256 b = _mm256_loadu_ps(second + i);
+		// a0 b0 a1 b1 | a4 b4 a5 b5 and a2 b2 a3 b3 | a6 b6 a7 b7
+		const __m256 low = _mm256_unpacklo_ps(a, b);
+		const __m256 high = _mm256_unpackhi_ps(a, b);
+		_mm256_storeu_ps(pairs + 2 * i, _mm256_permute2f128_ps(low, high, 0x20));
+		_mm256_storeu_ps(pairs + 2 * i + 8, _mm256_permute2f128_ps(low, high, 0x31));
+	}
+	interleaveScalar(first + i, second + i, count - i, pairs + 2 * i);
+}
+
+// --------------------------------------------------------------------
+// AVX-512: one permutation of two registers per output register.
+
+MEDSIMD_TARGET_AVX512
+void deinterleaveAvx512(const float* pairs,
+                        std::size_t count,
+                        float* first,
+                        float* second)
+{
+	const __m512i evenIndices =
+	    _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+	const __m512i oddIndices =
+	    _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		const __m512 a = _mm512_loadu_ps(pairs + 2 * i);
+		const __m512 b = _mm512_loadu_ps(pairs + 2 * i + 16);
+		_mm512_storeu_ps(first + i, _mm512_permutex2var_ps(a, evenIndices, b));
+		_mm512_storeu_ps(second + i, _mm512_permutex2var_ps(a, oddIndices, b));
+	}
+	deinterleaveScalar(pairs + 2 * i, count - i, first + i, second + i);
+}
+
+MEDSIMD_TARGET_AVX512
+void interleaveAvx512(const float* first,
+                      const float* second,
+                      std::size_t count,
+                      float* pairs)
+{
+	const __m512i lowIndices =
+	    _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+	const __m512i highIndices =
+	    _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		const __m512 a = _mm512_loadu_ps(first + i);
+		const __m512 b = _mm512_loadu_ps(second + i);
+		_mm512_storeu_ps(pairs + 2 * i, _mm512_permutex2var_ps(a, lowIndices, b));
+		_mm512_storeu_ps(pairs + 2 * i + 16, _mm512_permutex2var_ps(a, highIndices, b));
+	}
+	interleaveScalar(first + i, second + i, count - i, pairs + 2 * i);
+}
+#endif
+
+/// @brief Kernels for each instruction set
+constexpr simd::KernelVariants<SplitFunction> split_kernels{
+    .scalar = deinterleaveScalar,
+#if MEDSIMD_X86
+    .avx2 = deinterleaveAvx2,
+    .avx512 = deinterleaveAvx512,
+#endif
+};
+
+constexpr simd::KernelVariants<MergeFunction> merge_kernels{
+    .scalar = interleaveScalar,
+#if MEDSIMD_X86
+    .avx2 = interleaveAvx2,
+    .avx512 = interleaveAvx512,
+#endif
+};
+}  // namespace
+
+// --------------------------------------------------------------------
+void deinterleave(std::span<const float> pairs,
+                  std::span<float> first,
+                  std::span<float> second)
+{
+	if (pairs.size() != 2 * first.size() || first.size() != second.size())
+	{
+		throw std::invalid_argument(
+		    "Relayout: " + std::to_string(pairs.size()) + " samples into planes of " +
+		    std::to_string(first.size()) + " and " + std::to_string(second.size()));
+	}
+	split_kernels.select()(pairs.data(), first.size(), first.data(), second.data());
+}
+
+// --------------------------------------------------------------------
+void interleave(std::span<const float> first,
+                std::span<const float> second,
+                std::span<float> pairs)
+{
+	if (pairs.size() != 2 * first.size() || first.size() != second.size())
+	{
+		throw std::invalid_argument(
+		    "Relayout: planes of " + std::to_string(first.size()) + " and " +
+		    std::to_string(second.size()) + " into " + std::to_string(pairs.size()) +
+		    " samples");
+	}
+	merge_kernels.select()(first.data(), second.data(), first.size(), pairs.data());
+}
+
+// --------------------------------------------------------------------
+simd::SimdLevel relayoutLevel()
+{
+	return split_kernels.levelFor();
+}
+
+}  // namespace frame
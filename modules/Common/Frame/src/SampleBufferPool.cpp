@@ -0,0 +1,215 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "Frame/SampleBufferPool.hpp"
+
+namespace frame
+{
+
+namespace
+{
+/// @brief Room for the control block of a buffer: counts, pointer and allocator
+constexpr std::size_t control_block_size = 128;
+
+/// @brief Index of no slot, the end of the free list
+constexpr uint32_t no_slot = std::numeric_limits<uint32_t>::max();
+
+// --------------------------------------------------------------------
+constexpr uint64_t headOf(uint32_t tag, uint32_t slot)
+{
+	return (uint64_t{tag} << 32) | slot;
+}
+
+// --------------------------------------------------------------------
+constexpr uint32_t slotOf(uint64_t head)
+{
+	return static_cast<uint32_t>(head);
+}
+
+// --------------------------------------------------------------------
+constexpr uint32_t tagOf(uint64_t head)
+{
+	return static_cast<uint32_t>(head >> 32);
+}
+
+/// @brief The buffer is owned by its slot: releasing it only returns the slot
+struct KeepBuffer
+{
+	void operator()(SampleBuffer*) const noexcept {}
+};
+}  // namespace
+
+/**
+ * \struct SampleBufferPool::Storage
+ *
+ * @brief Slots of the pool, each holding a buffer and the room for the control block of
+ * the shared pointers to it. The free slots are linked in a lock-free stack; its head
+ * carries a tag incremented at each change, so that a slot taken and released between
+ * the read and the exchange of the head does not corrupt the list.
+ *
+ * Shared with the allocators of the control blocks so that a buffer can be released
+ * after the destruction of the pool.
+ */
+struct SampleBufferPool::Storage
+{
+	struct Slot
+	{
+		SampleBuffer buffer;
+		std::atomic<uint32_t> next{no_slot};
+		alignas(std::max_align_t) std::byte controlBlock[control_block_size];
+	};
+
+	/**
+	 * \struct SlotAllocator
+	 *
+	 * @brief Allocator of the control block of a buffer: returns the room of the slot,
+	 * and releases the slot once the control block is destroyed.
+	 */
+	template <typename T>
+	struct SlotAllocator
+	{
+		using value_type = T;
+
+		SlotAllocator(std::shared_ptr<Storage> owner, uint32_t index)
+		    : storage(std::move(owner)), slot(index)
+		{
+		}
+
+		template <typename U>
+		explicit SlotAllocator(const SlotAllocator<U>& other)
+		    : storage(other.storage), slot(other.slot)
+		{
+		}
+
+		T* allocate(std::size_t count)
+		{
+			static_assert(sizeof(T) <= control_block_size &&
+			                  alignof(T) <= alignof(std::max_align_t),
+			              "The control block does not fit in its slot");
+			if (count != 1)
+			{
+				throw std::bad_alloc();
+			}
+			return reinterpret_cast<T*>(storage->slots[slot].controlBlock);
+		}
+
+		void deallocate(T*, std::size_t) noexcept { storage->push(slot); }
+
+		template <typename U>
+		bool operator==(const SlotAllocator<U>& other) const noexcept
+		{
+			return storage == other.storage && slot == other.slot;
+		}
+
+		std::shared_ptr<Storage> storage;
+		uint32_t slot;
+	};
+
+	Storage(std::size_t size, std::size_t capacity)
+	    : bufferSize(size), slotCount(capacity), slots(std::make_unique<Slot[]>(capacity))
+	{
+		if (capacity >= no_slot)
+		{
+			throw std::invalid_argument("Too many buffers in the pool");
+		}
+		for (std::size_t i = 0; i < capacity; ++i)
+		{
+			slots[i].buffer.resize(size);
+			push(static_cast<uint32_t>(i));
+		}
+	}
+
+	// Takes a free slot, no_slot if there is none
+	uint32_t pop()
+	{
+		uint64_t head = freeHead.load(std::memory_order_acquire);
+		while (slotOf(head) != no_slot)
+		{
+			const uint32_t next = slots[slotOf(head)].next.load(std::memory_order_relaxed);
+			if (freeHead.compare_exchange_weak(head, headOf(tagOf(head) + 1, next),
+			                                   std::memory_order_acquire,
+			                                   std::memory_order_acquire))
+			{
+				freeCount.fetch_sub(1, std::memory_order_relaxed);
+				return slotOf(head);
+			}
+		}
+		return no_slot;
+	}
+
+	// Returns a slot to the free list
+	void push(uint32_t slot)
+	{
+		uint64_t head = freeHead.load(std::memory_order_relaxed);
+		do
+		{
+			slots[slot].next.store(slotOf(head), std::memory_order_relaxed);
+		} while (!freeHead.compare_exchange_weak(head, headOf(tagOf(head) + 1, slot),
+		                                         std::memory_order_release,
+		                                         std::memory_order_relaxed));
+		freeCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	const std::size_t bufferSize;
+	const std::size_t slotCount;
+	std::unique_ptr<Slot[]> slots;
+	std::atomic<uint64_t> freeHead{headOf(0, no_slot)};
+	std::atomic<std::size_t> freeCount{0};
+	std::atomic<std::size_t> drops{0};
+};
+
+// --------------------------------------------------------------------
+SampleBufferPool::SampleBufferPool(std::size_t bufferSize, std::size_t capacity)
+    : _storage(std::make_shared<Storage>(bufferSize, capacity))
+{
+}
+
+// --------------------------------------------------------------------
+std::shared_ptr<SampleBuffer> SampleBufferPool::acquire()
+{
+	const uint32_t slot = _storage->pop();
+	if (slot == no_slot)
+	{
+		_storage->drops.fetch_add(1, std::memory_order_relaxed);
+		return {};
+	}
+
+	// The control block is built in the slot: nothing is allocated
+	return {&_storage->slots[slot].buffer, KeepBuffer{},
+	        Storage::SlotAllocator<SampleBuffer>(_storage, slot)};
+}
+
+// --------------------------------------------------------------------
+std::size_t SampleBufferPool::bufferSize() const
+{
+	return _storage->bufferSize;
+}
+
+// --------------------------------------------------------------------
+std::size_t SampleBufferPool::available() const
+{
+	return _storage->freeCount.load(std::memory_order_relaxed);
+}
+
+// --------------------------------------------------------------------
+std::size_t SampleBufferPool::dropCount() const
+{
+	return _storage->drops.load(std::memory_order_relaxed);
+}
+
+}  // namespace frame
@@ -0,0 +1,637 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "Simd/Dispatch.hpp"
+
+#if MEDSIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "Frame/SampleConverter.hpp"
+
+namespace frame
+{
+
+namespace
+{
+using PackFunction = SampleConverter::PackFunction;
+using UnpackFunction = SampleConverter::UnpackFunction;
+
+/// @brief Largest magnitude of the int16 steps, symmetric around 0
+constexpr float int16_steps = 32767.0f;
+
+
+// --------------------------------------------------------------------
+// Conversions of one sample, branchless but for the special values: the loops calling
+// them are vectorized by the compiler.
+
+/**
+ * @brief Half of a float, rounded to nearest even (after the public domain conversions
+ * of F. Giesen). NaN becomes the canonical quiet NaN.
+ */
+inline uint16_t toHalf(float value)
+{
+	constexpr uint32_t infinity = 255U << 23;
+	// 65536: the first value rounded to the half infinity by every path
+	constexpr uint32_t half_overflow = (127U + 16U) << 23;
+	// 2^-14, smallest normal half
+	constexpr uint32_t half_normal = 113U << 23;
+	// Adding 0.5 shifts the subnormal halves to the low bits of the mantissa
+	constexpr uint32_t subnormal_magic = ((127U - 15U) + (23U - 10U) + 1U) << 23;
+
+	uint32_t bits = std::bit_cast<uint32_t>(value);
+	const auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000U);
+	bits &= 0x7FFFFFFFU;
+
+	uint32_t half = 0;
+	if (bits >= half_overflow)
+	{
+		half = bits > infinity ? 0x7E00U : 0x7C00U;
+	}
+	else if (bits < half_normal)
+	{
+		const float shifted = std::bit_cast<float>(bits) +
+		                      std::bit_cast<float>(subnormal_magic);
+		half = std::bit_cast<uint32_t>(shifted) - subnormal_magic;
+	}
+	else
+	{
+		const uint32_t odd = (bits >> 13) & 1U;
+		half = (bits + ((15U - 127U) << 23) + 0xFFFU + odd) >> 13;
+	}
+	return static_cast<uint16_t>(sign | half);
+}
+
+/**
+ * @brief Float of a half, exact.
+ */
+inline float fromHalf(uint16_t half)
+{
+	constexpr uint32_t exponent_mask = 0x7C00U << 13;
+	// 2^-14, rescales the subnormal halves
+	constexpr float subnormal_magic = 0x1p-14f;
+
+	uint32_t bits = (uint32_t{half} & 0x7FFFU) << 13;
+	const uint32_t exponent = bits & exponent_mask;
+	bits += (127U - 15U) << 23;
+	float value = 0.0f;
+	if (exponent == exponent_mask)
+	{
+		// Infinity or NaN
+		value = std::bit_cast<float>(bits + ((128U - 16U) << 23));
+	}
+	else if (exponent == 0)
+	{
+		value = std::bit_cast<float>(bits + (1U << 23)) - subnormal_magic;
+	}
+	else
+	{
+		value = std::bit_cast<float>(bits);
+	}
+	return std::bit_cast<float>(std::bit_cast<uint32_t>(value) |
+	                            ((uint32_t{half} & 0x8000U) << 16));
+}
+
+/**
+ * @brief Upper half of a float, rounded to nearest even. NaN stays a quiet NaN instead
+ * of being rounded to infinity.
+ */
+inline uint16_t toBFloat16(float value)
+{
+	const uint32_t bits = std::bit_cast<uint32_t>(value);
+	if ((bits & 0x7FFFFFFFU) > 0x7F800000U)
+	{
+		return static_cast<uint16_t>((bits >> 16) | 0x40U);
+	}
+	return static_cast<uint16_t>((bits + 0x7FFFU + ((bits >> 16) & 1U)) >> 16);
+}
+
+inline float fromBFloat16(uint16_t word)
+{
+	return std::bit_cast<float>(uint32_t{word} << 16);
+}
+
+// --------------------------------------------------------------------
+// Loops of the kernels, inlined in each variant
+
+inline float packHalves(const float* samples, std::size_t count, uint16_t* packed)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		packed[i] = toHalf(samples[i]);
+	}
+	return 1.0f;
+}
+
+inline void unpackHalves(const uint16_t* packed,
+                         std::size_t count,
+                         float /*scale*/,
+                         float* samples)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		samples[i] = fromHalf(packed[i]);
+	}
+}
+
+inline float packBFloat16(const float* samples, std::size_t count, uint16_t* packed)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		packed[i] = toBFloat16(samples[i]);
+	}
+	return 1.0f;
+}
+
+inline void unpackBFloat16(const uint16_t* packed,
+                           std::size_t count,
+                           float /*scale*/,
+                           float* samples)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		samples[i] = fromBFloat16(packed[i]);
+	}
+}
+
+/**
+ * @brief Largest magnitude of the samples and of `largest`. The operands of max are
+ * ordered for NaN to be ignored.
+ */
+inline float largestMagnitude(const float* samples, std::size_t count, float largest)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		largest = std::max(largest, std::abs(samples[i]));
+	}
+	return largest;
+}
+
+inline float int16Scale(float largest)
+{
+	return largest > 0.0f ? largest / int16_steps : 1.0f;
+}
+
+/**
+ * @brief Steps of the samples, rounded half away from zero. The operands of max are
+ * ordered for NaN to be clamped to the lowest step, as in the SIMD variants.
+ */
+inline void quantize(const float* samples,
+                     std::size_t count,
+                     float inverse,
+                     uint16_t* packed)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const float step =
+		    std::min(int16_steps, std::max(-int16_steps, samples[i] * inverse));
+		const auto rounded = static_cast<int32_t>(step + std::copysign(0.5f, step));
+		packed[i] = static_cast<uint16_t>(static_cast<int16_t>(rounded));
+	}
+}
+
+inline void unpackInt16(const uint16_t* packed,
+                        std::size_t count,
+                        float scale,
+                        float* samples)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		samples[i] = static_cast<float>(static_cast<int16_t>(packed[i])) * scale;
+	}
+}
+
+// --------------------------------------------------------------------
+// Scalar variants, the references of the others
+
+float packFloat32Scalar(const float* samples, std::size_t count, uint16_t* packed)
+{
+	std::memcpy(packed, samples, count * sizeof(float));
+	return 1.0f;
+}
+
+void unpackFloat32Scalar(const uint16_t* packed,
+                         std::size_t count,
+                         float /*scale*/,
+                         float* samples)
+{
+	std::memcpy(samples, packed, count * sizeof(float));
+}
+
+float packHalvesScalar(const float* samples, std::size_t count, uint16_t* packed)
+{
+	return packHalves(samples, count, packed);
+}
+
+void unpackHalvesScalar(const uint16_t* packed,
+                        std::size_t count,
+                        float scale,
+                        float* samples)
+{
+	unpackHalves(packed, count, scale, samples);
+}
+
+float packBFloat16Scalar(const float* samples, std::size_t count, uint16_t* packed)
+{
+	return packBFloat16(samples, count, packed);
+}
+
+void unpackBFloat16Scalar(const uint16_t* packed,
+                          std::size_t count,
+                          float scale,
+                          float* samples)
+{
+	unpackBFloat16(packed, count, scale, samples);
+}
+
+float packInt16Scalar(const float* samples, std::size_t count, uint16_t* packed)
+{
+	const float scale = int16Scale(largestMagnitude(samples, count, 0.0f));
+	quantize(samples, count, 1.0f / scale, packed);
+	return scale;
+}
+
+void unpackInt16Scalar(const uint16_t* packed,
+                       std::size_t count,
+                       float scale,
+                       float* samples)
+{
+	unpackInt16(packed, count, scale, samples);
+}
+
+#if MEDSIMD_X86
+// --------------------------------------------------------------------
+// Halves: conversion instructions of F16C and AVX-512 F, the remainder in scalar. The
+// masked AVX-512 forms avoid an undefined source register, which GCC 12 reports as
+// uninitialized.
+
+MEDSIMD_TARGET_AVX2
+float packHalvesAvx2(const float* samples, std::size_t count, uint16_t* packed)
+{
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		const __m128i halves =
+		    _mm256_cvtps_ph(_mm256_loadu_ps(samples + i), _MM_FROUND_TO_NEAREST_INT);
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(packed + i), halves);
+	}
+	return packHalvesScalar(samples + i, count - i, packed + i);
+}
+
+MEDSIMD_TARGET_AVX2
+void unpackHalvesAvx2(const uint16_t* packed,
+                      std::size_t count,
+                      float scale,
+                      float* samples)
+{
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		const __m128i halves =
+		    _mm_loadu_si128(reinterpret_cast<const __m128i*>(packed + i));
+		_mm256_storeu_ps(samples + i, _mm256_cvtph_ps(halves));
+	}
+	unpackHalvesScalar(packed + i, count - i, scale, samples + i);
+}
+
+MEDSIMD_TARGET_AVX512
+float packHalvesAvx512(const float* samples, std::size_t count, uint16_t* packed)
+{
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		const __m256i halves = _mm512_maskz_cvtps_ph(0xFFFF, _mm512_loadu_ps(samples + i),
+		                                             _MM_FROUND_TO_NEAREST_INT);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(packed + i), halves);
+	}
+	return packHalvesScalar(samples + i, count - i, packed + i);
+}
+
+MEDSIMD_TARGET_AVX512
+void unpackHalvesAvx512(const uint16_t* packed,
+                        std::size_t count,
+                        float scale,
+                        float* samples)
+{
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		const __m256i halves =
+		    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(packed + i));
+		_mm512_storeu_ps(samples + i, _mm512_maskz_cvtph_ps(0xFFFF, halves));
+	}
+	unpackHalvesScalar(packed + i, count - i, scale, samples + i);
+}
+
+// --------------------------------------------------------------------
+// Int16 packing: the compiler vectorizes neither the maximum nor the narrowing, the
+// remainder in scalar with the same rounding
+
+MEDSIMD_TARGET_AVX2
+inline __m256i stepsAvx2(__m256 samples, __m256 inverse)
+{
+	// max returns its second operand for NaN: the lowest step
+	const __m256 scaled = _mm256_mul_ps(samples, inverse);
+	const __m256 lowest = _mm256_set1_ps(-int16_steps);
+	const __m256 clamped =
+	    _mm256_min_ps(_mm256_max_ps(scaled, lowest), _mm256_set1_ps(int16_steps));
+	const __m256 half = _mm256_or_ps(_mm256_and_ps(clamped, _mm256_set1_ps(-0.0f)),
+	                                 _mm256_set1_ps(0.5f));
+	return _mm256_cvttps_epi32(_mm256_add_ps(clamped, half));
+}
+
+MEDSIMD_TARGET_AVX2
+float packInt16Avx2(const float* samples, std::size_t count, uint16_t* packed)
+{
+	const __m256 magnitude = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+	__m256 largest = _mm256_setzero_ps();
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8)
+	{
+		const __m256 x = _mm256_and_ps(_mm256_loadu_ps(samples + i), magnitude);
+		largest = _mm256_max_ps(x, largest);
+	}
+	std::array<float, 8> lanes{};
+	_mm256_storeu_ps(lanes.data(), largest);
+	const float scale = int16Scale(largestMagnitude(
+	    samples + i, count - i, largestMagnitude(lanes.data(), lanes.size(), 0.0f)));
+	const float inverse = 1.0f / scale;
+
+	// packs interleaves the 128-bit halves of its operands
+	const __m256 factor = _mm256_set1_ps(inverse);
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		const __m256i low = stepsAvx2(_mm256_loadu_ps(samples + i), factor);
+		const __m256i high = stepsAvx2(_mm256_loadu_ps(samples + i + 8), factor);
+		const __m256i words =
+		    _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xD8);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(packed + i), words);
+	}
+	quantize(samples + i, count - i, inverse, packed + i);
+	return scale;
+}
+
+MEDSIMD_TARGET_AVX512
+float packInt16Avx512(const float* samples, std::size_t count, uint16_t* packed)
+{
+	const __m512i magnitude = _mm512_set1_epi32(0x7FFFFFFF);
+	__m512 largest = _mm512_setzero_ps();
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16)
+	{
+		const __m512i bits = _mm512_castps_si512(_mm512_loadu_ps(samples + i));
+		const __m512 x = _mm512_castsi512_ps(_mm512_and_si512(bits, magnitude));
+		largest = _mm512_maskz_max_ps(0xFFFF, x, largest);
+	}
+	std::array<float, 16> lanes{};
+	_mm512_storeu_ps(lanes.data(), largest);
+	const float scale = int16Scale(largestMagnitude(
+	    samples + i, count - i, largestMagnitude(lanes.data(), lanes.size(), 0.0f)));
+	const float inverse = 1.0f / scale;
+
+	const __m512 factor = _mm512_set1_ps(inverse);
+	const __m512 lowest = _mm512_set1_ps(-int16_steps);
+	const __m512 highest = _mm512_set1_ps(int16_steps);
+	const __m512i sign = _mm512_set1_epi32(static_cast<int32_t>(0x80000000U));
+	const __m512i half = _mm512_castps_si512(_mm512_set1_ps(0.5f));
+	for (i = 0; i + 16 <= count; i += 16)
+	{
+		const __m512 scaled = _mm512_mul_ps(_mm512_loadu_ps(samples + i), factor);
+		const __m512 clamped = _mm512_maskz_min_ps(
+		    0xFFFF, _mm512_maskz_max_ps(0xFFFF, scaled, lowest), highest);
+		const __m512i away = _mm512_or_si512(
+		    _mm512_and_si512(_mm512_castps_si512(clamped), sign), half);
+		const __m512i steps = _mm512_maskz_cvttps_epi32(
+		    0xFFFF, _mm512_add_ps(clamped, _mm512_castsi512_ps(away)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(packed + i),
+		                    _mm512_maskz_cvtepi32_epi16(0xFFFF, steps));
+	}
+	quantize(samples + i, count - i, inverse, packed + i);
+	return scale;
+}
+
+// --------------------------------------------------------------------
+// Bfloat16 and int16 unpacking: integer arithmetic vectorized by the compiler for the
+// wider registers (flatten)
+
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+float packBFloat16Avx2(const float* samples, std::size_t count, uint16_t* packed)
+{
+	return packBFloat16(samples, count, packed);
+}
+
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+void unpackBFloat16Avx2(const uint16_t* packed,
+                        std::size_t count,
+                        float scale,
+                        float* samples)
+{
+	unpackBFloat16(packed, count, scale, samples);
+}
+
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+void unpackInt16Avx2(const uint16_t* packed,
+                     std::size_t count,
+                     float scale,
+                     float* samples)
+{
+	unpackInt16(packed, count, scale, samples);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+float packBFloat16Avx512(const float* samples, std::size_t count, uint16_t* packed)
+{
+	return packBFloat16(samples, count, packed);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+void unpackBFloat16Avx512(const uint16_t* packed,
+                          std::size_t count,
+                          float scale,
+                          float* samples)
+{
+	unpackBFloat16(packed, count, scale, samples);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+void unpackInt16Avx512(const uint16_t* packed,
+                       std::size_t count,
+                       float scale,
+                       float* samples)
+{
+	unpackInt16(packed, count, scale, samples);
+}
+#endif
+
+/**
+ * \struct Kernels
+ *
+ * @brief Kernels of a precision for each instruction set.
+ */
+struct Kernels
+{
+	simd::KernelVariants<PackFunction> pack;
+	simd::KernelVariants<UnpackFunction> unpack;
+};
+
+constexpr Kernels float32_kernels{.pack = {.scalar = packFloat32Scalar},
+                                  .unpack = {.scalar = unpackFloat32Scalar}};
+
+constexpr Kernels float16_kernels{
+    .pack = {.scalar = packHalvesScalar,
+#if MEDSIMD_X86
+             .avx2 = packHalvesAvx2,
+             .avx512 = packHalvesAvx512
+#endif
+    },
+    .unpack = {.scalar = unpackHalvesScalar,
+#if MEDSIMD_X86
+               .avx2 = unpackHalvesAvx2,
+               .avx512 = unpackHalvesAvx512
+#endif
+    }};
+
+constexpr Kernels bfloat16_kernels{.pack = {.scalar = packBFloat16Scalar,
+#if MEDSIMD_X86
+                                            .avx2 = packBFloat16Avx2,
+                                            .avx512 = packBFloat16Avx512
+#endif
+                                   },
+                                   .unpack = {.scalar = unpackBFloat16Scalar,
+#if MEDSIMD_X86
+                                              .avx2 = unpackBFloat16Avx2,
+                                              .avx512 = unpackBFloat16Avx512
+#endif
+                                   }};
+
+constexpr Kernels int16_kernels{.pack = {.scalar = packInt16Scalar,
+#if MEDSIMD_X86
+                                         .avx2 = packInt16Avx2,
+                                         .avx512 = packInt16Avx512
+#endif
+                                },
+                                .unpack = {.scalar = unpackInt16Scalar,
+#if MEDSIMD_X86
+                                           .avx2 = unpackInt16Avx2,
+                                           .avx512 = unpackInt16Avx512
+#endif
+                                }};
+
+// --------------------------------------------------------------------
+const Kernels& kernelsOf(SamplePrecision precision)
+{
+	switch (precision)
+	{
+	case SamplePrecision::Float32:
+		return float32_kernels;
+	case SamplePrecision::Float16:
+		return float16_kernels;
+	case SamplePrecision::BFloat16:
+		return bfloat16_kernels;
+	case SamplePrecision::Int16:
+		break;
+	}
+	return int16_kernels;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+SampleConverter::SampleConverter(SamplePrecision precision) : _precision(precision)
+{
+	const Kernels& kernels = kernelsOf(precision);
+	_simdLevel = kernels.pack.levelFor();
+	_pack = kernels.pack.select(_simdLevel);
+	_unpack = kernels.unpack.select(_simdLevel);
+}
+
+// --------------------------------------------------------------------
+float SampleConverter::pack(std::span<const float> samples,
+                            std::span<uint16_t> packed) const
+{
+	if (packed.size() != packedSize(samples.size()))
+	{
+		throw std::invalid_argument("Sample conversion: " +
+		                            std::to_string(packed.size()) + " words for " +
+		                            std::to_string(samples.size()) + " " +
+		                            to_string(_precision) + " samples");
+	}
+	return _pack(samples.data(), samples.size(), packed.data());
+}
+
+// --------------------------------------------------------------------
+void SampleConverter::unpack(std::span<const uint16_t> packed,
+                             float scale,
+                             std::span<float> samples) const
+{
+	if (packed.size() != packedSize(samples.size()))
+	{
+		throw std::invalid_argument("Sample conversion: " +
+		                            std::to_string(packed.size()) + " words for " +
+		                            std::to_string(samples.size()) + " " +
+		                            to_string(_precision) + " samples");
+	}
+	_unpack(packed.data(), samples.size(), scale, samples.data());
+}
+
+// --------------------------------------------------------------------
+PackedFrame SampleConverter::pack(const AcquisitionFrame& frame) const
+{
+	PackedFrame packed{.sequence = frame.sequence,
+	                   .timestamp = frame.timestamp,
+	                   .stream = frame.stream,
+	                   .kind = frame.kind,
+	                   .geometry = frame.geometry,
+	                   .precision = _precision,
+	                   .scale = 1.0f,
+	                   .samples = nullptr};
+	if (frame.samples)
+	{
+		auto words = std::make_shared<PackedBuffer>(packedSize(frame.samples->size()));
+		packed.scale = pack(*frame.samples, *words);
+		packed.samples = std::move(words);
+	}
+	return packed;
+}
+
+// --------------------------------------------------------------------
+AcquisitionFrame SampleConverter::unpack(const PackedFrame& frame) const
+{
+	if (frame.precision != _precision)
+	{
+		throw std::invalid_argument("Sample conversion: " + to_string(frame.precision) +
+		                            " frame unpacked as " + to_string(_precision));
+	}
+
+	AcquisitionFrame unpacked{.sequence = frame.sequence,
+	                          .timestamp = frame.timestamp,
+	                          .stream = frame.stream,
+	                          .kind = frame.kind,
+	                          .geometry = frame.geometry,
+	                          .samples = nullptr};
+	if (frame.samples)
+	{
+		auto samples =
+		    std::make_shared<SampleBuffer>(frame.samples->size() / packedSize(1));
+		unpack(*frame.samples, frame.scale, *samples);
+		unpacked.samples = std::move(samples);
+	}
+	return unpacked;
+}
+
+}  // namespace frame
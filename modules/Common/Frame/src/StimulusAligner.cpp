@@ -0,0 +1,96 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+
+#include "Frame/StimulusAligner.hpp"
+
+namespace frame
+{
+
+// --------------------------------------------------------------------
+bool StimulusAligner::addFrame(const AcquisitionFrame& frame)
+{
+	return addFrame(frame.stream, frame.sequence, frame.timestamp);
+}
+
+// --------------------------------------------------------------------
+bool StimulusAligner::addFrame(const PackedFrame& frame)
+{
+	return addFrame(frame.stream, frame.sequence, frame.timestamp);
+}
+
+// --------------------------------------------------------------------
+bool StimulusAligner::addFrame(FrameStream stream, uint64_t sequence, int64_t timestamp)
+{
+	if (stream != _stream)
+	{
+		return false;
+	}
+	_index.append(sequence, timestamp);
+	return ready();
+}
+
+// --------------------------------------------------------------------
+bool StimulusAligner::addEvent(const StimulusEvent& event)
+{
+	// Events of different sources may arrive out of order
+	const auto position = std::ranges::upper_bound(_pending, event.timestamp, {},
+	                                               &StimulusEvent::timestamp);
+	_pending.insert(position, event);
+	return ready();
+}
+
+// --------------------------------------------------------------------
+void StimulusAligner::takeAligned(std::vector<AlignedStimulus>& aligned)
+{
+	std::size_t count = 0;
+	const auto last = _index.last();
+	while (last && count < _pending.size() &&
+	       _pending[count].timestamp <= last->timestamp)
+	{
+		const StimulusEvent& event = _pending[count];
+		const auto frame = _index.nearest(event.timestamp);
+		aligned.push_back(AlignedStimulus{.event = event,
+		                                  .frame_sequence = frame->sequence,
+		                                  .frame_timestamp = frame->timestamp});
+		++count;
+	}
+	_pending.erase(_pending.begin(),
+	               _pending.begin() + static_cast<std::ptrdiff_t>(count));
+}
+
+// --------------------------------------------------------------------
+void StimulusAligner::flush(std::vector<AlignedStimulus>& aligned)
+{
+	const auto last = _index.last();
+	if (!last)
+	{
+		return;
+	}
+
+	takeAligned(aligned);
+	for (const StimulusEvent& event : _pending)
+	{
+		aligned.push_back(AlignedStimulus{.event = event,
+		                                  .frame_sequence = last->sequence,
+		                                  .frame_timestamp = last->timestamp});
+	}
+	_pending.clear();
+}
+
+// --------------------------------------------------------------------
+bool StimulusAligner::ready() const
+{
+	const auto last = _index.last();
+	return last && !_pending.empty() && _pending.front().timestamp <= last->timestamp;
+}
+
+}  // namespace frame
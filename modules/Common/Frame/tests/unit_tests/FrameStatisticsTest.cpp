@@ -0,0 +1,112 @@
+
+#include <catch2/catch_all.hpp>
+
+#include "Frame/FrameStatistics.hpp"
+#include "Frame/LatencyHistogram.hpp"
+
+using namespace frame;
+
+namespace
+{
+AcquisitionFrame frameOf(uint64_t sequence, FrameStream stream = FrameStream::Doppler)
+{
+	AcquisitionFrame frame;
+	frame.sequence = sequence;
+	frame.stream = stream;
+	frame.timestamp = monotonicTimestamp();
+	return frame;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("Latency buckets")
+{
+	CHECK(LatencyHistogram::bucketOf(5) == 5);
+	CHECK(LatencyHistogram::bucketLowerBound(LatencyHistogram::bucketOf(1000)) == 960);
+	CHECK(LatencyHistogram::bucketOf(UINT64_MAX) == LatencyHistogram::bucket_count - 1);
+
+	// Each bucket starts where the previous one ends
+	for (std::size_t i = 1; i < LatencyHistogram::bucket_count; ++i)
+	{
+		const uint64_t lower = LatencyHistogram::bucketLowerBound(i);
+		REQUIRE(LatencyHistogram::bucketOf(lower) == i);
+		REQUIRE(LatencyHistogram::bucketOf(lower - 1) == i - 1);
+	}
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Latency percentiles")
+{
+	LatencyHistogram histogram;
+	CHECK(histogram.percentile(0.5) == 0);
+
+	for (uint64_t i = 1; i <= 1000; ++i)
+	{
+		histogram.record(i * 1000);
+	}
+	CHECK(histogram.count() == 1000);
+	CHECK(histogram.mean() == 500500);
+
+	// Within the 12.5% of the buckets
+	CHECK(histogram.percentile(0.5) <= 500000);
+	CHECK(histogram.percentile(0.5) > 500000 * 7 / 8);
+	CHECK(histogram.percentile(1.0) <= 1000000);
+	CHECK(histogram.percentile(1.0) > 1000000 * 7 / 8);
+
+	LatencyHistogram earlier;
+	earlier.record(1000);
+	histogram -= earlier;
+	CHECK(histogram.count() == 999);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Gaps and reordering of the frames")
+{
+	restartSequenceTracking();
+	const StageStatistics before = stageStatistics(FrameStage::Stored);
+
+	for (const uint64_t sequence : {10, 11, 14, 13, 15, 20})
+	{
+		recordFrameArrival(FrameStage::Stored, frameOf(sequence));
+	}
+
+	StageStatistics statistics = stageStatistics(FrameStage::Stored);
+	statistics -= before;
+	CHECK(statistics.frames == 6);
+	CHECK(statistics.latency.count() == 6);
+	CHECK(statistics.gaps == 2);
+	CHECK(statistics.missing == 6);
+	CHECK(statistics.reordered == 1);
+
+	// A new acquisition starts from 0
+	restartSequenceTracking();
+	recordFrameArrival(FrameStage::Stored, frameOf(0));
+	statistics = stageStatistics(FrameStage::Stored);
+	statistics -= before;
+	CHECK(statistics.reordered == 1);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Sequences of interleaved streams are tracked separately")
+{
+	restartSequenceTracking();
+	const StageStatistics before = stageStatistics(FrameStage::Displayed);
+
+	recordFrameArrival(FrameStage::Displayed, frameOf(100));
+	recordFrameArrival(FrameStage::Displayed, frameOf(0, FrameStream::BMode));
+	recordFrameArrival(FrameStage::Displayed, frameOf(101));
+	recordFrameArrival(FrameStage::Displayed, frameOf(2, FrameStream::BMode));
+
+	StageStatistics statistics = stageStatistics(FrameStage::Displayed);
+	statistics -= before;
+	CHECK(statistics.frames == 4);
+	CHECK(statistics.reordered == 0);
+	CHECK(statistics.gaps == 1);
+	CHECK(statistics.missing == 1);
+}
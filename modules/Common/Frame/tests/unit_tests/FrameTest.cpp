@@ -0,0 +1,192 @@
+
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "Frame/Frame.hpp"
+#include "Frame/Relayout.hpp"
+#include "Simd/Dispatch.hpp"
+
+using namespace frame;
+
+namespace
+{
+// Samples 0, 1, 2... of a frame of the layout
+template <typename Layout>
+std::vector<float> countingSamples(uint32_t depth, uint32_t lateral)
+{
+	std::vector<float> samples(Layout::size(depth, lateral));
+	std::iota(samples.begin(), samples.end(), 0.0f);
+	return samples;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("Layouts place the samples of the pixels")
+{
+	// 3 pixels deep, 2 columns, 2 components
+	CHECK(Interleaved<2>::index(3, 2, 1, 1, 1) == 9);
+	CHECK(Planar<2>::index(3, 2, 1, 1, 1) == 10);
+	CHECK(Planar<2>::index(3, 2, 2, 0, 0) == 2);
+
+	// Tiles of 2x2 pixels: 2 tiles along the depth, the last one padded
+	using Tiles = Tiled<2, 2, 2>;
+	CHECK(Tiles::size(3, 2) == 16);
+	CHECK(Tiles::index(3, 2, 0, 0, 0) == 0);
+	CHECK(Tiles::index(3, 2, 1, 0, 1) == 3);
+	CHECK(Tiles::index(3, 2, 0, 1, 0) == 4);
+	CHECK(Tiles::index(3, 2, 2, 0, 0) == 8);
+	CHECK(Tiles::index(3, 2, 2, 1, 1) == 13);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Frames check their size and view their columns and components")
+{
+	std::vector<float> samples = countingSamples<Interleaved<2>>(3, 2);
+	const Frame<float, Interleaved<2>> iq(samples, 3, 2);
+	CHECK(iq.pixelCount() == 6);
+	CHECK(iq(2, 1, 1) == 11.0f);
+	CHECK(iq.column(1).front() == 6.0f);
+	CHECK(iq.column(1).size() == 6);
+
+	const StridedView<float> quadrature = iq.component(1);
+	CHECK(quadrature(0, 0) == 1.0f);
+	CHECK(quadrature(2, 1) == 11.0f);
+	CHECK(quadrature.depthStride() == 2);
+	CHECK(quadrature.lateralStride() == 6);
+
+	const Frame<float, Planar<2>> planes(samples, 3, 2);
+	CHECK(planes.component(1)(2, 1) == 11.0f);
+	CHECK(planes.component(1).depthStride() == 1);
+
+	std::vector<float> wrong(11);
+	CHECK_THROWS_AS((Frame<float, Interleaved<2>>(wrong, 3, 2)), std::invalid_argument);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Reinterpretations share the samples")
+{
+	std::vector<float> samples = countingSamples<Planar<2>>(4, 3);
+	const Frame<float, Planar<2>> planes(samples, 4, 3);
+	const Frame<float, Interleaved<1>> second = planes.plane(1);
+	CHECK(second.data() == samples.data() + 12);
+	CHECK(second(1, 2) == 21.0f);
+
+	const Frame<const float, Planar<2>> readOnly = planes;
+	CHECK(readOnly.data() == samples.data());
+
+	const Frame<float, Interleaved<2>> iq(samples, 4, 3);
+	const auto complex = asComplex(iq);
+	CHECK(static_cast<void*>(complex.data()) == static_cast<void*>(samples.data()));
+	CHECK(complex(1, 0) == std::complex<float>(2.0f, 3.0f));
+	complex(0, 0) = {7.0f, 8.0f};
+	CHECK(samples[1] == 8.0f);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Relayout round trips between the layouts")
+{
+	// Dimensions not multiple of the tiles nor of the registers
+	constexpr uint32_t depth = 37;
+	constexpr uint32_t lateral = 5;
+	const std::vector<float> samples = countingSamples<Interleaved<2>>(depth, lateral);
+	const Frame<const float, Interleaved<2>> iq(samples, depth, lateral);
+
+	std::vector<float> planar(Planar<2>::size(depth, lateral));
+	const Frame<float, Planar<2>> planes(planar, depth, lateral);
+	relayout(iq, planes);
+	CHECK(planes(36, 4, 0) == iq(36, 4, 0));
+	CHECK(planes(36, 4, 1) == iq(36, 4, 1));
+
+	using Tiles = Tiled<8, 2, 2>;
+	std::vector<float> tiled(Tiles::size(depth, lateral), -1.0f);
+	const Frame<float, Tiles> tiles(tiled, depth, lateral);
+	relayout(iq, tiles);
+	CHECK(tiles(36, 4, 1) == iq(36, 4, 1));
+	// Padding along the depth and along the lateral axis
+	CHECK(tiled[Tiles::index(depth, lateral, 38, 4, 0)] == 0.0f);
+	CHECK(tiled[Tiles::index(depth, lateral, 0, 5, 1)] == 0.0f);
+
+	std::vector<float> back(samples.size());
+	relayout(tiles, Frame<float, Interleaved<2>>(back, depth, lateral));
+	CHECK(back == samples);
+
+	// Sample by sample
+	std::vector<float> fromPlanes(tiled.size(), -1.0f);
+	relayout(planes, Frame<float, Tiles>(fromPlanes, depth, lateral));
+	CHECK(fromPlanes == tiled);
+
+	relayout(planes, Frame<float, Interleaved<2>>(back, depth, lateral));
+	CHECK(back == samples);
+
+	std::vector<float> other(Interleaved<2>::size(depth, lateral + 1));
+	CHECK_THROWS_AS(relayout(iq, Frame<float, Interleaved<2>>(other, depth, lateral + 1)),
+	                std::invalid_argument);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Relayout variants match the scalar reference")
+{
+	const std::vector<float> pairs = countingSamples<Interleaved<2>>(1037, 1);
+	for (const simd::SimdLevel level :
+	     {simd::SimdLevel::Scalar, simd::SimdLevel::Avx2, simd::SimdLevel::Avx512})
+	{
+		simd::limitLevel(level);
+		CAPTURE(relayoutLevel());
+
+		std::vector<float> first(1037);
+		std::vector<float> second(1037);
+		deinterleave(pairs, first, second);
+		for (std::size_t i = 0; i < first.size(); ++i)
+		{
+			CHECK(first[i] == static_cast<float>(2 * i));
+			CHECK(second[i] == static_cast<float>(2 * i + 1));
+		}
+
+		std::vector<float> merged(pairs.size());
+		interleave(first, second, merged);
+		CHECK(merged == pairs);
+	}
+	simd::limitLevel(simd::SimdLevel::Avx512);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Acquisition frames are viewed in their layout")
+{
+	AcquisitionFrame rf{
+	    .sequence = 0,
+	    .timestamp = 0,
+	    .stream = FrameStream::Doppler,
+	    .kind = FrameKind::RawRf,
+	    .geometry = {.depth_samples = 4, .lateral_samples = 0, .channels = 3},
+	    .samples = std::make_shared<const SampleBuffer>(12)};
+	const Frame<const float, Interleaved<1>> channels = viewOf<1>(rf);
+	CHECK(channels.depth() == 4);
+	CHECK(channels.lateral() == 3);
+	CHECK_THROWS_AS(viewOf<2>(rf), std::invalid_argument);
+
+	SampleBuffer iq(2 * 4 * 3);
+	const Frame<float, Interleaved<2>> image = viewOf<2>(
+	    iq, {.depth_samples = 4, .lateral_samples = 3, .channels = 0},
+	    FrameKind::CompoundedIq);
+	CHECK(image.data() == iq.data());
+	const FrameGeometry narrower{.depth_samples = 4, .lateral_samples = 2, .channels = 0};
+	CHECK_THROWS_AS(viewOf<2>(iq, narrower, FrameKind::CompoundedIq),
+	                std::invalid_argument);
+
+	rf.samples.reset();
+	CHECK_THROWS_AS(viewOf<1>(rf), std::invalid_argument);
+}
@@ -0,0 +1,120 @@
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "Frame/SampleBufferPool.hpp"
+
+using namespace frame;
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("Buffers return to the pool")
+{
+	SampleBufferPool pool(64, 2);
+	CHECK(pool.available() == 2);
+
+	auto first = pool.acquire();
+	REQUIRE(first->size() == 64);
+	const SampleBuffer* address = first.get();
+	CHECK(pool.available() == 1);
+
+	// The buffer is recycled once the last frame referencing it is gone
+	std::shared_ptr<const SampleBuffer> shared = first;
+	first.reset();
+	CHECK(pool.available() == 1);
+	shared.reset();
+	CHECK(pool.available() == 2);
+
+	auto again = pool.acquire();
+	auto other = pool.acquire();
+	CHECK((again.get() == address || other.get() == address));
+	CHECK(pool.dropCount() == 0);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Empty pool drops and counts")
+{
+	SampleBufferPool pool(16, 1);
+
+	std::vector<std::shared_ptr<SampleBuffer>> buffers;
+	for (int i = 0; i < 3; ++i)
+	{
+		buffers.push_back(pool.acquire());
+	}
+	CHECK(buffers[0] != nullptr);
+	CHECK(buffers[1] == nullptr);
+	CHECK(buffers[2] == nullptr);
+	CHECK(pool.dropCount() == 2);
+
+	// Nothing was allocated for the dropped frames
+	buffers.clear();
+	CHECK(pool.available() == 1);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Buffers are shared across threads")
+{
+	SampleBufferPool pool(4, 8);
+
+	// The threads take and release the buffers concurrently
+	std::vector<std::thread> threads;
+	std::atomic<std::size_t> acquired{0};
+	for (std::size_t t = 0; t < 4; ++t)
+	{
+		threads.emplace_back(
+		    [&pool, &acquired]
+		    {
+			    for (int i = 0; i < 10000; ++i)
+			    {
+				    std::shared_ptr<SampleBuffer> buffer = pool.acquire();
+				    if (buffer)
+				    {
+					    (*buffer)[0] = static_cast<float>(i);
+					    std::shared_ptr<SampleBuffer> copy = buffer;
+					    acquired.fetch_add(1, std::memory_order_relaxed);
+				    }
+			    }
+		    });
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	CHECK(acquired.load() + pool.dropCount() == 40000);
+	CHECK(pool.available() == 8);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Buffers outliving the pool are freed")
+{
+	std::shared_ptr<SampleBuffer> buffer;
+	{
+		SampleBufferPool pool(8, 1);
+		buffer = pool.acquire();
+	}
+	(*buffer)[0] = 1.0f;
+	buffer.reset();
+	SUCCEED();
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Frame sample count")
+{
+	const FrameGeometry geometry{
+	    .depth_samples = 10, .lateral_samples = 4, .channels = 3};
+	CHECK(geometry.sampleCount(FrameKind::CompoundedIq) == 80);
+	CHECK(geometry.sampleCount(FrameKind::RawRf) == 30);
+	CHECK(geometry.sampleCount(FrameKind::ColorDoppler) == 80);
+	CHECK(geometry.sampleCount(FrameKind::ActivationMap) == 120);
+}
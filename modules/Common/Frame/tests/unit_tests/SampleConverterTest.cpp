@@ -0,0 +1,260 @@
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "Frame/FrameCache.hpp"
+#include "Frame/SampleConverter.hpp"
+#include "Simd/Dispatch.hpp"
+
+using namespace frame;
+
+namespace
+{
+// Samples spanning the range of the IQ frames, the size not a multiple of the registers
+std::vector<float> randomSamples(std::size_t count)
+{
+	std::mt19937 generator(3);
+	std::normal_distribution<float> noise(0.0f, 100.0f);
+	std::vector<float> samples(count);
+	for (float& sample : samples)
+	{
+		sample = noise(generator);
+	}
+	return samples;
+}
+
+std::vector<float> roundTrip(const SampleConverter& converter,
+                             const std::vector<float>& samples)
+{
+	std::vector<uint16_t> packed(converter.packedSize(samples.size()));
+	const float scale = converter.pack(samples, packed);
+	std::vector<float> unpacked(samples.size());
+	converter.unpack(packed, scale, unpacked);
+	return unpacked;
+}
+
+PackedFrame packedFrame(FrameStream stream, uint64_t sequence, std::size_t words)
+{
+	return PackedFrame{.sequence = sequence,
+	                   .timestamp = static_cast<int64_t>(sequence),
+	                   .stream = stream,
+	                   .kind = FrameKind::CompoundedIq,
+	                   .geometry = {},
+	                   .precision = SamplePrecision::Float16,
+	                   .samples = std::make_shared<const PackedBuffer>(words)};
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("Round trip within the precision")
+{
+	const std::vector<float> samples = randomSamples(1001);
+
+	const auto check = [&samples](SamplePrecision precision, float tolerance)
+	{
+		const std::vector<float> unpacked =
+		    roundTrip(SampleConverter(precision), samples);
+		for (std::size_t i = 0; i < samples.size(); ++i)
+		{
+			CHECK(std::abs(unpacked[i] - samples[i]) <= tolerance);
+		}
+	};
+	check(SamplePrecision::Float32, 0.0f);
+	// Half a unit in the last place at the largest magnitudes (< 512)
+	check(SamplePrecision::Float16, 0.125f);
+	check(SamplePrecision::BFloat16, 1.0f);
+	// Half a step of the largest magnitude over 32767
+	check(SamplePrecision::Int16, 0.01f);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Reduced precisions halve the packed size")
+{
+	CHECK(SampleConverter(SamplePrecision::Float32).packedSize(10) == 20);
+	CHECK(SampleConverter(SamplePrecision::Float16).packedSize(10) == 10);
+	CHECK(SampleConverter(SamplePrecision::BFloat16).packedSize(10) == 10);
+	CHECK(SampleConverter(SamplePrecision::Int16).packedSize(10) == 10);
+
+	std::vector<float> samples(10);
+	std::vector<uint16_t> packed(9);
+	CHECK_THROWS_AS(SampleConverter(SamplePrecision::Float16).pack(samples, packed),
+	                std::invalid_argument);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Half conversions of the special values")
+{
+	const SampleConverter converter(SamplePrecision::Float16);
+	const float infinity = std::numeric_limits<float>::infinity();
+	const std::vector<float> samples{0.0f,    -0.0f,   1.0f,      -2.5f,    65504.0f,
+	                                 1.0e5f,  -1.0e5f, infinity,  0x1p-24f, 0x1p-20f,
+	                                 0x1p-14f, 1.0e-9f, 1.00048828125f};
+	std::vector<uint16_t> packed(samples.size());
+	static_cast<void>(converter.pack(samples, packed));
+
+	CHECK(packed[0] == 0x0000);
+	CHECK(packed[1] == 0x8000);
+	CHECK(packed[2] == 0x3C00);
+	CHECK(packed[3] == 0xC100);
+	CHECK(packed[4] == 0x7BFF);
+	CHECK(packed[5] == 0x7C00);
+	CHECK(packed[6] == 0xFC00);
+	CHECK(packed[7] == 0x7C00);
+	// Subnormal halves
+	CHECK(packed[8] == 0x0001);
+	CHECK(packed[9] == 0x0010);
+	CHECK(packed[10] == 0x0400);
+	CHECK(packed[11] == 0x0000);
+	// Tie between 1 and the next half, rounded to even
+	CHECK(packed[12] == 0x3C00);
+
+	std::vector<float> unpacked(samples.size());
+	converter.unpack(packed, 1.0f, unpacked);
+	CHECK(std::bit_cast<uint32_t>(unpacked[1]) == 0x80000000U);
+	CHECK(unpacked[4] == 65504.0f);
+	CHECK(unpacked[5] == infinity);
+	CHECK(unpacked[8] == 0x1p-24f);
+	CHECK(unpacked[9] == 0x1p-20f);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("NaN stays NaN in the floating point precisions")
+{
+	const std::vector<float> samples(3, std::numeric_limits<float>::quiet_NaN());
+	CHECK(std::isnan(roundTrip(SampleConverter(SamplePrecision::Float16), samples)[0]));
+	CHECK(std::isnan(roundTrip(SampleConverter(SamplePrecision::BFloat16), samples)[0]));
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Int16 scale follows the largest magnitude")
+{
+	const SampleConverter converter(SamplePrecision::Int16);
+	const std::vector<float> samples{0.5f, -2.0f, 1.0f, 0.0f};
+	std::vector<uint16_t> packed(samples.size());
+	const float scale = converter.pack(samples, packed);
+
+	CHECK(scale == 2.0f / 32767.0f);
+	CHECK(static_cast<int16_t>(packed[1]) == -32767);
+	CHECK(static_cast<int16_t>(packed[2]) == 16384);
+	CHECK(packed[3] == 0);
+
+	// Silent frames keep a usable scale
+	const std::vector<float> silence(4, 0.0f);
+	CHECK(converter.pack(silence, packed) == 1.0f);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Variants match the scalar reference")
+{
+	// With the values handled apart: NaN, ties, subnormal halves
+	std::vector<float> samples = randomSamples(1037);
+	samples[3] = std::numeric_limits<float>::quiet_NaN();
+	samples[5] = 1.00048828125f;
+	samples[7] = 0x1p-20f;
+	samples[11] = -0.0f;
+	for (const SamplePrecision precision :
+	     {SamplePrecision::Float16, SamplePrecision::BFloat16, SamplePrecision::Int16})
+	{
+		simd::limitLevel(simd::SimdLevel::Scalar);
+		const SampleConverter reference(precision);
+		std::vector<uint16_t> expected(samples.size());
+		const float scale = reference.pack(samples, expected);
+		std::vector<float> expectedSamples(samples.size());
+		reference.unpack(expected, scale, expectedSamples);
+
+		for (const simd::SimdLevel level :
+		     {simd::SimdLevel::Avx2, simd::SimdLevel::Avx512})
+		{
+			simd::limitLevel(level);
+			const SampleConverter converter(precision);
+			CAPTURE(precision, converter.simdLevel());
+
+			std::vector<uint16_t> packed(samples.size());
+			CHECK(converter.pack(samples, packed) == scale);
+			CHECK(packed == expected);
+
+			std::vector<float> unpacked(samples.size());
+			converter.unpack(expected, scale, unpacked);
+			CHECK(std::memcmp(unpacked.data(), expectedSamples.data(),
+			                  unpacked.size() * sizeof(float)) == 0);
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Frames keep their header through packing")
+{
+	const SampleConverter converter(SamplePrecision::BFloat16);
+	const AcquisitionFrame frame{
+	    .sequence = 7,
+	    .timestamp = 42,
+	    .stream = FrameStream::PowerDoppler,
+	    .kind = FrameKind::PowerDoppler,
+	    .geometry = {.depth_samples = 2, .lateral_samples = 2},
+	    .samples = std::make_shared<const SampleBuffer>(SampleBuffer{1, 2, 3, 4})};
+
+	const PackedFrame packed = converter.pack(frame);
+	CHECK(packed.precision == SamplePrecision::BFloat16);
+	CHECK(packed.byteCount() == 8);
+
+	const AcquisitionFrame unpacked = converter.unpack(packed);
+	CHECK(unpacked.sequence == 7);
+	CHECK(unpacked.timestamp == 42);
+	CHECK(unpacked.stream == FrameStream::PowerDoppler);
+	CHECK(unpacked.geometry == frame.geometry);
+	CHECK(*unpacked.samples == *frame.samples);
+
+	CHECK_THROWS_AS(SampleConverter(SamplePrecision::Int16).unpack(packed),
+	                std::invalid_argument);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Cache drops the oldest frames beyond its capacity")
+{
+	// 3 frames of 100 words
+	FrameCache cache(600);
+	cache.add(packedFrame(FrameStream::Doppler, 0, 100));
+	cache.add(packedFrame(FrameStream::PowerDoppler, 1, 100));
+	cache.add(packedFrame(FrameStream::Doppler, 2, 100));
+	CHECK(cache.frameCount() == 3);
+	CHECK(cache.byteCount() == 600);
+
+	cache.add(packedFrame(FrameStream::Doppler, 3, 100));
+	CHECK(cache.frameCount() == 3);
+	CHECK(cache.find(FrameStream::Doppler, 0) == nullptr);
+	REQUIRE(cache.find(FrameStream::PowerDoppler, 1) != nullptr);
+	CHECK(cache.find(FrameStream::PowerDoppler, 1)->sequence == 1);
+	CHECK(cache.find(FrameStream::PowerDoppler, 3) == nullptr);
+
+	// Across the streams
+	cache.add(packedFrame(FrameStream::Doppler, 4, 100));
+	CHECK(cache.find(FrameStream::PowerDoppler, 1) == nullptr);
+	CHECK(cache.find(FrameStream::Doppler, 2) != nullptr);
+
+	// Larger than the cache
+	cache.add(packedFrame(FrameStream::Doppler, 5, 1000));
+	CHECK(cache.find(FrameStream::Doppler, 5) == nullptr);
+	CHECK(cache.frameCount() == 3);
+
+	cache.clear();
+	CHECK(cache.byteCount() == 0);
+	CHECK(cache.frameCount() == 0);
+}
@@ -0,0 +1,98 @@
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "Frame/SpscRing.hpp"
+
+using namespace frame;
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("Ring keeps the order of the items")
+{
+	SpscRing<int> ring(3);
+	REQUIRE(ring.capacity() == 4);
+
+	for (int i = 0; i < 4; ++i)
+	{
+		int item = i;
+		CHECK(ring.tryPush(item));
+	}
+	CHECK(ring.size() == 4);
+
+	std::vector<int> out;
+	CHECK(ring.drain(out, 3) == 3);
+	CHECK(ring.drain(out, 3) == 1);
+	CHECK(out == std::vector<int>{0, 1, 2, 3});
+	CHECK(ring.drain(out, 3) == 0);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Full ring rejects and counts the items")
+{
+	SpscRing<std::shared_ptr<int>> ring(2);
+	auto first = std::make_shared<int>(1);
+	auto second = std::make_shared<int>(2);
+	auto third = std::make_shared<int>(3);
+	CHECK(ring.tryPush(first));
+	CHECK(ring.tryPush(second));
+
+	// The rejected item stays with the producer
+	CHECK_FALSE(ring.tryPush(third));
+	CHECK(third);
+	CHECK(ring.overflowCount() == 1);
+
+	// Drained slots release the items
+	std::vector<std::shared_ptr<int>> out;
+	CHECK(ring.drain(out, 8) == 2);
+	std::weak_ptr<int> weak = out.front();
+	out.clear();
+	CHECK(weak.expired());
+	CHECK(ring.tryPush(third));
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Items cross between two threads")
+{
+	constexpr uint64_t itemCount = 100000;
+	SpscRing<uint64_t> ring(64);
+
+	std::thread producer(
+	    [&ring]
+	    {
+		    for (uint64_t i = 1; i <= itemCount; ++i)
+		    {
+			    uint64_t item = i;
+			    while (!ring.tryPush(item))
+			    {
+				    std::this_thread::yield();
+			    }
+		    }
+	    });
+
+	std::vector<uint64_t> out;
+	out.reserve(itemCount);
+	while (out.size() < itemCount)
+	{
+		if (ring.drain(out, 16) == 0)
+		{
+			std::this_thread::yield();
+		}
+	}
+	producer.join();
+
+	bool ordered = true;
+	for (uint64_t i = 0; i < itemCount; ++i)
+	{
+		ordered = ordered && out[i] == i + 1;
+	}
+	CHECK(ordered);
+}
@@ -0,0 +1,133 @@
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "Frame/FrameTimeIndex.hpp"
+#include "Frame/StimulusAligner.hpp"
+
+using namespace frame;
+
+namespace
+{
+// 1 ms between two frames
+constexpr int64_t frame_period = 1'000'000;
+
+AcquisitionFrame frameAt(uint64_t sequence, FrameStream stream = FrameStream::Doppler)
+{
+	AcquisitionFrame frame;
+	frame.sequence = sequence;
+	frame.stream = stream;
+	frame.timestamp = static_cast<int64_t>(sequence) * frame_period;
+	return frame;
+}
+
+StimulusEvent eventAt(int64_t timestamp, uint32_t code = 0)
+{
+	return StimulusEvent{
+	    .timestamp = timestamp, .source = StimulusSource::Trigger, .code = code};
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("Nearest frame of an instant")
+{
+	FrameTimeIndex index;
+	CHECK(!index.nearest(0).has_value());
+
+	for (uint64_t i = 0; i < 100; ++i)
+	{
+		index.append(i, static_cast<int64_t>(i) * frame_period);
+	}
+	CHECK(index.nearest(-5)->sequence == 0);
+	CHECK(index.nearest(41 * frame_period + 400'000)->sequence == 41);
+	CHECK(index.nearest(41 * frame_period + 600'000)->sequence == 42);
+	// The earlier frame on a tie
+	CHECK(index.nearest(41 * frame_period + 500'000)->sequence == 41);
+	CHECK(index.nearest(1000 * frame_period)->sequence == 99);
+
+	CHECK_THROWS_AS(index.append(100, 0), std::invalid_argument);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Index spanning several blocks")
+{
+	// 1 s between frames: a block of 32 bits offsets spans about 4 s
+	constexpr int64_t second = 1'000'000'000;
+	FrameTimeIndex index;
+	for (uint64_t i = 0; i < 20; ++i)
+	{
+		index.append(i, static_cast<int64_t>(i) * second);
+	}
+	// A new acquisition numbers its frames from 0
+	index.append(0, 20 * second);
+
+	REQUIRE(index.size() == 21);
+	CHECK(index.nearest(13 * second + 1)->sequence == 13);
+	CHECK(index.nearest(7 * second - 1)->timestamp == 7 * second);
+	CHECK(index.nearest(20 * second) == FrameTimeIndex::Entry{.sequence = 0,
+	                                                          .timestamp = 20 * second});
+	CHECK(index.last()->sequence == 0);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Events wait for their nearest frame")
+{
+	StimulusAligner aligner;
+	std::vector<AlignedStimulus> aligned;
+
+	// Before any frame
+	CHECK(!aligner.addEvent(eventAt(2 * frame_period + 100, 1)));
+	CHECK(!aligner.addFrame(frameAt(0)));
+	CHECK(!aligner.addFrame(frameAt(1)));
+	// Frames of the other streams are not indexed
+	CHECK(!aligner.addFrame(frameAt(5, FrameStream::BMode)));
+	CHECK(aligner.addFrame(frameAt(3)));
+
+	aligner.takeAligned(aligned);
+	REQUIRE(aligned.size() == 1);
+	CHECK(aligned[0].event.code == 1);
+	CHECK(aligned[0].frame_sequence == 3);
+	CHECK(aligned[0].offset() == 100 - frame_period);
+
+	// After its frames: aligned at once
+	CHECK(aligner.addEvent(eventAt(frame_period / 4, 2)));
+	aligner.takeAligned(aligned);
+	REQUIRE(aligned.size() == 2);
+	CHECK(aligned[1].frame_sequence == 0);
+	CHECK(aligner.pendingCount() == 0);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Events are aligned in the order of their timestamps")
+{
+	StimulusAligner aligner;
+	static_cast<void>(aligner.addEvent(eventAt(5 * frame_period, 5)));
+	static_cast<void>(aligner.addEvent(eventAt(3 * frame_period, 3)));
+	static_cast<void>(aligner.addEvent(eventAt(9 * frame_period, 9)));
+	for (uint64_t i = 0; i < 6; ++i)
+	{
+		static_cast<void>(aligner.addFrame(frameAt(i)));
+	}
+
+	std::vector<AlignedStimulus> aligned;
+	aligner.takeAligned(aligned);
+	REQUIRE(aligned.size() == 2);
+	CHECK(aligned[0].event.code == 3);
+	CHECK(aligned[1].event.code == 5);
+	CHECK(aligner.pendingCount() == 1);
+
+	// End of the acquisition: the last event goes to the last frame
+	aligner.flush(aligned);
+	REQUIRE(aligned.size() == 3);
+	CHECK(aligned[2].frame_sequence == 5);
+	CHECK(aligner.pendingCount() == 0);
+}
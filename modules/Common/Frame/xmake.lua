@@ -0,0 +1,16 @@
+target("common_frame")
+    set_kind("shared")
+    add_includedirs("include", {public = true})
+    add_files("src/*.cpp")
+    add_deps("common_caf")
+    add_deps("common_simd")
+
+
+-- Unit test target
+target("common_frame_tests")
+    set_kind("binary")  
+    add_files("tests/unit_tests/*.cpp")
+    add_deps("common_frame") 
+    add_deps("common_simd")
+    add_packages("catch2")
+    add_tests("default")
@@ -11,6 +11,7 @@
 #include <iostream>
 #include <memory>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
 #include <spdlog/async.h>
@@ -18,6 +19,10 @@
 #include <spdlog/spdlog.h>
 
 #include "Logger/Logger.hpp"
+#include "Probe/Probe.hpp"
+
+MEDPROBE_SEMAPHORE(log_enqueue);
+MEDPROBE_SEMAPHORE(log_queue_full);
 
 namespace medlog
 {
@@ -74,39 +79,70 @@ constexpr spdlog::level::level_enum convertLogLevel(LogLevel level) noexcept
 	return true;
 }
 
+// --------------------------------------------------------------------
+/**
+ * @brief: Fires the probes of the log queue before a message is pushed to it. Only
+ * evaluated while a tracer is attached to one of them.
+ * @param level The log level of the message
+ */
+static void probeEnqueue(LogLevel level)
+{
+	if (!MEDPROBE_ENABLED(log_enqueue) && !MEDPROBE_ENABLED(log_queue_full))
+	{
+		return;
+	}
+
+	const auto pool = spdlog::thread_pool();
+	const std::size_t queued = pool ? pool->queue_size() : 0;
+	const std::int64_t now = medprobe::timestamp();
+	MEDPROBE(log_enqueue, std::to_underlying(level), queued, now);
+	// The loggers block on a full queue: the caller waits, the message is kept
+	if (queued >= _cfg->async_queue_size)
+	{
+		MEDPROBE(log_queue_full, std::to_underlying(level), queued, now);
+	}
+}
+
 // --------------------------------------------------------------------
 void trace(std::string_view msg)
 {
+	probeEnqueue(LogLevel::Trace);
 	spdlog::trace(msg);
 }
 // --------------------------------------------------------------------
 void debug(std::string_view msg)
 {
+	probeEnqueue(LogLevel::Debug);
 	spdlog::debug(msg);
 }
 // --------------------------------------------------------------------
 void info(std::string_view msg)
 {
+	probeEnqueue(LogLevel::Info);
 	spdlog::info(msg);
 }
 // --------------------------------------------------------------------
 void warn(std::string_view msg)
 {
+	probeEnqueue(LogLevel::Warn);
 	spdlog::warn(msg);
 }
 // --------------------------------------------------------------------
 void error(std::string_view msg)
 {
+	probeEnqueue(LogLevel::Error);
 	spdlog::error(msg);
 }
 // --------------------------------------------------------------------
 void critical(std::string_view msg)
 {
+	probeEnqueue(LogLevel::Critical);
 	spdlog::critical(msg);
 }
 // --------------------------------------------------------------------
 void userEvent(std::string_view msg)
 {
+	probeEnqueue(LogLevel::Info);
 	spdlog::get(_cfg->user_event_name)->info(msg);
 }
 
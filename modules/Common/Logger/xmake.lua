@@ -3,6 +3,7 @@ target("common_logger")
     add_includedirs("include", {public = true})
     add_files("src/*.cpp")
     add_packages("spdlog", {public = true})
+    add_deps("common_probe")
 
 
 -- Unit test target
@@ -0,0 +1,138 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROBE_PROBE_HPP
+#define PROBE_PROBE_HPP
+
+#include <cstdint>
+#include <ctime>
+
+/**
+ * @brief USDT static probes of the "icograph" provider, to trace production systems with
+ * bpftrace or perf without rebuilding or raising the log level (see tools/bpftrace).
+ *
+ * Probes are guarded by a semaphore: their arguments are only evaluated while a tracer is
+ * attached, otherwise a probe costs a load and a branch.
+ *
+ * Usage:
+ *   1. Define the semaphore of each probe once, at global scope, in the source file
+ *      firing it: "MEDPROBE_SEMAPHORE(frame_produced);". The semaphore has to live in the
+ *      same shared library as the probe.
+ *      Other source files of the same shared library firing the probe declare it:
+ *      "MEDPROBE_SEMAPHORE_DECLARE(frame_produced);".
+ *   2. Fire the probe: "MEDPROBE(frame_produced, seq, medprobe::timestamp());".
+ *
+ * Probes of the application (arguments):
+ *   - frame_produced(seq, timestamp_ns): frame emitted by the acquisition source
+ *   - frame_fanout(seq, timestamp_ns, destination_count): frame sent to the consumers
+ *   - frame_stored(seq, timestamp_ns): frame handled by the domain model
+ *   - frame_displayed(seq, timestamp_ns): frame handled by the echo viewer
+ *   - workflow_transition(workflow_type, timestamp_ns): workflow started
+ *   - acquisition_transition(previous_state, state, timestamp_ns): acquisition started,
+ *     paused, resumed, stopped or completed (see acq_module::AcquisitionState)
+ *   - log_enqueue(level, queue_size, timestamp_ns): message pushed to the log queue
+ *   - log_queue_full(level, queue_size, timestamp_ns): log queue full, the caller blocks
+ *     until the message fits (the loggers never drop a message)
+ *
+ * Probes compile to nothing if <sys/sdt.h> is not available or if MEDPROBE_DISABLED is
+ * defined.
+ */
+
+#if defined(__linux__) && !defined(MEDPROBE_DISABLED) && __has_include(<sys/sdt.h>)
+#define MEDPROBE_AVAILABLE 1
+#define _SDT_HAS_SEMAPHORES 1
+#include <sys/sdt.h>
+#else
+#define MEDPROBE_AVAILABLE 0
+#endif
+
+namespace medprobe
+{
+
+/**
+ * @brief Timestamp of the probes, in nanoseconds. Same clock as "nsecs" in bpftrace
+ * (CLOCK_MONOTONIC) so that scripts can compare probe arguments with the trace time.
+ */
+[[nodiscard]] inline std::int64_t timestamp() noexcept
+{
+	timespec now{};
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return static_cast<std::int64_t>(now.tv_sec) * 1'000'000'000 + now.tv_nsec;
+}
+
+}  // namespace medprobe
+
+#if MEDPROBE_AVAILABLE
+
+/**
+ * @brief Defines the semaphore of a probe, incremented by the tracers attached to it.
+ * Must be used once at global scope, in the shared library firing the probe.
+ */
+#define MEDPROBE_SEMAPHORE(name)                                    \
+	extern "C" {                                                    \
+	__attribute__((used, section(".probes"), visibility("hidden"))) \
+	volatile unsigned short icograph_##name##_semaphore = 0;        \
+	}                                                               \
+	static_assert(true)
+
+/**
+ * @brief Declares the semaphore of a probe defined in another source file of the same
+ * shared library.
+ */
+#define MEDPROBE_SEMAPHORE_DECLARE(name)                                           \
+	extern "C" {                                                                   \
+	extern __attribute__((visibility("hidden"))) volatile unsigned short           \
+	    icograph_##name##_semaphore;                                               \
+	}                                                                              \
+	static_assert(true)
+
+/**
+ * @brief True while a tracer is attached to the probe.
+ */
+#define MEDPROBE_ENABLED(name) __builtin_expect(icograph_##name##_semaphore != 0, 0)
+
+/**
+ * @brief Fires a probe. Arguments are only evaluated while a tracer is attached.
+ */
+#define MEDPROBE(name, ...)                                       \
+	do                                                            \
+	{                                                             \
+		if (MEDPROBE_ENABLED(name))                               \
+		{                                                         \
+			STAP_PROBEV(icograph, name __VA_OPT__(, ) __VA_ARGS__); \
+		}                                                         \
+	} while (0)
+
+#else
+
+namespace medprobe::detail
+{
+// Keeps the probe arguments referenced, they are never evaluated
+template <typename... Ts>
+constexpr void unused(const Ts&...) noexcept
+{
+}
+}  // namespace medprobe::detail
+
+#define MEDPROBE_SEMAPHORE(name) static_assert(true)
+#define MEDPROBE_SEMAPHORE_DECLARE(name) static_assert(true)
+#define MEDPROBE_ENABLED(name) false
+#define MEDPROBE(name, ...)                                         \
+	do                                                              \
+	{                                                               \
+		if (false)                                                  \
+		{                                                           \
+			::medprobe::detail::unused(__VA_ARGS__);                \
+		}                                                           \
+	} while (0)
+
+#endif
+
+#endif  // PROBE_PROBE_HPP
@@ -0,0 +1,3 @@
+target("common_probe")
+    set_kind("headeronly")
+    add_includedirs("include", {public = true})
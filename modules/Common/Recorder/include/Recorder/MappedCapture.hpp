@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef RECORDER_MAPPEDCAPTURE_HPP
+#define RECORDER_MAPPEDCAPTURE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include <caf/byte_span.hpp>
+
+#include "MessageRecorder.hpp"
+
+namespace recorder
+{
+
+/**
+ * \struct CaptureRecord
+ *
+ * @brief One record of a capture file, not deserialized. The payload points into the
+ * mapping of the file and is valid as long as the MappedCapture lives.
+ */
+struct CaptureRecord
+{
+	RecordHeader header{};
+	caf::const_byte_span payload;
+};
+
+/**
+ * \class MappedCapture
+ *
+ * @brief Read-only mapping of a capture file written by MessageRecorder, walked record by
+ * record. The records are read in place: no copy of the payload, and the pages are
+ * loaded by the kernel ahead of the reads.
+ *
+ * On systems without mmap the file is read in memory at once.
+ */
+class MappedCapture
+{
+public:
+	/**
+	 * @brief: Ctor. Maps the capture file and checks its header.
+	 * @param filename path of the capture file
+	 * @throws std::runtime_error if the file cannot be read or is not a capture file
+	 */
+	explicit MappedCapture(const std::filesystem::path& filename);
+
+	// Dtor. Unmaps the file.
+	~MappedCapture();
+
+	// Do not allow other types of ctor/assignment operators
+	MappedCapture(const MappedCapture&) = delete;
+	MappedCapture& operator=(const MappedCapture&) = delete;
+	MappedCapture(MappedCapture&&) = delete;
+	MappedCapture& operator=(MappedCapture&&) = delete;
+
+	/**
+	 * @brief Returns the next record.
+	 * @return the record, or std::nullopt at the end of the capture
+	 * @throws std::runtime_error if the record is truncated
+	 */
+	[[nodiscard]] std::optional<CaptureRecord> next();
+
+	// Goes back to the first record
+	void rewind();
+
+	// Size of the file in bytes
+	[[nodiscard]] std::size_t size() const { return _size; }
+
+private:
+	const std::byte* _data{nullptr};
+	std::size_t _size{0};
+	// Offset of the next record
+	std::size_t _offset{0};
+
+	// Content of the file when it is not mapped
+	std::vector<std::byte> _buffer;
+	bool _mapped{false};
+};
+
+}  // namespace recorder
+
+#endif  // RECORDER_MAPPEDCAPTURE_HPP
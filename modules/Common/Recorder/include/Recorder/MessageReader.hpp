@@ -0,0 +1,86 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef RECORDER_MESSAGEREADER_HPP
+#define RECORDER_MESSAGEREADER_HPP
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+
+#include <caf/actor_system.hpp>
+#include <caf/message.hpp>
+
+#include "MappedCapture.hpp"
+
+namespace recorder
+{
+
+/**
+ * \struct RecordedMessage
+ *
+ * @brief One message read back from a capture file.
+ */
+struct RecordedMessage
+{
+	// Time of delivery since the start of the capture
+	std::chrono::nanoseconds timestamp{0};
+	// Actor ID of the sender during the capture, 0 for anonymous messages
+	caf::actor_id sender_id{0};
+	// Custom ID of the receiver in the actor registry
+	caf::actor_id receiver_id{0};
+	caf::message content;
+};
+
+/**
+ * \class MessageReader
+ *
+ * @brief Reads sequentially the messages of a capture file written by MessageRecorder.
+ * The messages are deserialized from the mapping of the file (see MappedCapture).
+ *
+ * Actor handles carried by the messages (e.g. destination actors of an acquisition
+ * request) refer to the actors of the captured session: they are invalid in another
+ * session.
+ */
+class MessageReader
+{
+public:
+	/**
+	 * @brief: Ctor. Opens the capture file and checks its header.
+	 * @param system actor system used to deserialize the messages
+	 * @param filename path of the capture file
+	 * @throws std::runtime_error if the file cannot be read or is not a capture file
+	 */
+	MessageReader(caf::actor_system& system, const std::filesystem::path& filename);
+
+	// Dtor
+	~MessageReader() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	MessageReader(const MessageReader&) = delete;
+	MessageReader& operator=(const MessageReader&) = delete;
+	MessageReader(MessageReader&&) = delete;
+	MessageReader& operator=(MessageReader&&) = delete;
+
+	/**
+	 * @brief Reads the next message.
+	 * @return the message, or std::nullopt at the end of the capture
+	 * @throws std::runtime_error if the record is truncated or cannot be deserialized
+	 */
+	[[nodiscard]] std::optional<RecordedMessage> next();
+
+private:
+	caf::actor_system& _system;
+	MappedCapture _capture;
+};
+
+}  // namespace recorder
+
+#endif  // RECORDER_MESSAGEREADER_HPP
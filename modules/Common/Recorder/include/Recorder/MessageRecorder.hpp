@@ -0,0 +1,175 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef RECORDER_MESSAGERECORDER_HPP
+#define RECORDER_MESSAGERECORDER_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+#include <caf/actor_control_block.hpp>
+#include <caf/actor_system.hpp>
+#include <caf/message.hpp>
+
+/**
+ * @brief Capture of the messages delivered to the registered actors.
+ *
+ * File format (little endian, native layout):
+ *   - file header: magic "ICOREC01"
+ *   - one record per message: RecordHeader followed by `payload_size` bytes holding the
+ *     caf::message serialized with caf::binary_serializer.
+ *
+ * Usage:
+ *   1. Create a capture in main: "recorder::Capture capture(system, path)".
+ *   2. Call recorder::capture(...) at the beginning of the message handlers. It is a
+ *      no-op (no message built) when no capture is running.
+ */
+
+namespace recorder
+{
+
+/// @brief First bytes of a capture file
+constexpr std::array<char, 8> file_magic = {'I', 'C', 'O', 'R', 'E', 'C', '0', '1'};
+
+/**
+ * \struct RecordHeader
+ *
+ * @brief Header of one recorded message.
+ */
+struct RecordHeader
+{
+	// Time of delivery since the start of the capture (steady clock)
+	std::int64_t timestamp_ns;
+	// Actor ID of the sender, 0 for anonymous messages
+	std::uint64_t sender_id;
+	// Custom ID of the receiver in the actor registry (see CustomActorIdentifier.hpp)
+	std::uint64_t receiver_id;
+	// Size of the serialized message following the header
+	std::uint32_t payload_size;
+	std::uint32_t reserved;
+};
+
+/**
+ * \class MessageRecorder
+ *
+ * @brief Appends the delivered messages to a capture file. Thread-safe: the messages are
+ * serialized on the calling thread, only the write to the file is serialized.
+ */
+class MessageRecorder
+{
+public:
+	/**
+	 * @brief: Ctor. Creates the capture file.
+	 * @param system actor system used to serialize the messages
+	 * @param filename path of the capture file
+	 * @throws std::runtime_error if the file cannot be created
+	 */
+	MessageRecorder(caf::actor_system& system, const std::filesystem::path& filename);
+
+	// Dtor. Flushes the file.
+	~MessageRecorder() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	MessageRecorder(const MessageRecorder&) = delete;
+	MessageRecorder& operator=(const MessageRecorder&) = delete;
+	MessageRecorder(MessageRecorder&&) = delete;
+	MessageRecorder& operator=(MessageRecorder&&) = delete;
+
+	/**
+	 * @brief Appends a message to the capture.
+	 * @param receiverId registry ID of the receiver
+	 * @param senderId actor ID of the sender, 0 if anonymous
+	 * @param msg content of the message
+	 */
+	void record(caf::actor_id receiverId,
+	            caf::actor_id senderId,
+	            const caf::message& msg);
+
+	// Number of messages recorded so far
+	[[nodiscard]] std::uint64_t recordCount() const;
+
+private:
+	caf::actor_system& _system;
+	std::chrono::steady_clock::time_point _start;
+
+	mutable std::mutex _mutex;
+	std::ofstream _file;
+	std::uint64_t _recordCount{0};
+};
+
+/**
+ * \class Capture
+ *
+ * @brief Lifetime management of the capture of the process (RAII idiom). Messages passed
+ * to recorder::capture are recorded as long as this object lives.
+ */
+class Capture
+{
+public:
+	// Ctor
+	Capture(caf::actor_system& system, const std::filesystem::path& filename);
+	// Dtor
+	~Capture();
+
+	// Do not allow other types of ctor/assignment operators
+	Capture() = delete;
+	Capture(const Capture&) = delete;
+	Capture& operator=(const Capture&) = delete;
+	Capture(Capture&&) = delete;
+	Capture& operator=(Capture&&) = delete;
+
+private:
+	MessageRecorder _recorder;
+};
+
+// Implementation details.
+// Should not be called directly from outside.
+namespace detail
+{
+/**
+ * @brief Recorder of the running capture, nullptr if none.
+ */
+[[nodiscard]] MessageRecorder* currentRecorder();
+}  // namespace detail
+
+/**
+ * @brief True if a capture is running.
+ */
+[[nodiscard]] inline bool isCapturing()
+{
+	return detail::currentRecorder() != nullptr;
+}
+
+/**
+ * @brief Records a message delivered to a registered actor if a capture is running.
+ *
+ * @param receiverId registry ID of the receiver
+ * @param sender sender of the message (self->current_sender())
+ * @param xs content of the message, as received by the handler
+ */
+template <typename... Ts>
+void capture(caf::actor_id receiverId,
+             const caf::strong_actor_ptr& sender,
+             const Ts&... xs)
+{
+	if (MessageRecorder* recorder = detail::currentRecorder())
+	{
+		recorder->record(receiverId, sender ? sender->id() : caf::actor_id{0},
+		                 caf::make_message(xs...));
+	}
+}
+
+}  // namespace recorder
+
+#endif  // RECORDER_MESSAGERECORDER_HPP
@@ -0,0 +1,147 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef RECORDER_REPLAYACTOR_HPP
+#define RECORDER_REPLAYACTOR_HPP
+
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <caf/actor.hpp>
+#include <caf/behavior.hpp>
+#include <caf/event_based_actor.hpp>
+
+#include "MessageReader.hpp"
+
+namespace recorder
+{
+
+/**
+ * @enum ReplaySpeed
+ * @brief Pace of the replay of a capture.
+ */
+enum class ReplaySpeed : uint8_t
+{
+	Original,  // Messages delivered with the delays of the capture
+	Max        // Messages delivered as fast as possible
+};
+
+/**
+ * @brief Converts a ReplaySpeed enum value to its string representation.
+ * @param speed The ReplaySpeed enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(ReplaySpeed speed)
+{
+	using namespace std::string_literals;
+
+	switch (speed)
+	{
+	case ReplaySpeed::Original:
+		return "original"s;
+	case ReplaySpeed::Max:
+		return "max"s;
+	}
+
+	throw std::domain_error("Invalid value for ReplaySpeed: " +
+	                        std::to_string(std::to_underlying(speed)));
+}
+
+/**
+ * @brief Attempts to convert a string to a ReplaySpeed enum value.
+ * @param str The string to convert.
+ * @param speed Reference to the ReplaySpeed enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, ReplaySpeed& speed)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "original"sv)
+	{
+		speed = ReplaySpeed::Original;
+		status = true;
+	}
+	else if (str == "max"sv)
+	{
+		speed = ReplaySpeed::Max;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * \struct RecordingConfig
+ *
+ * @brief Capture and replay of the session, as read from the "icograph.recording"
+ * section of the CAF configuration file.
+ *
+ * - capture_file: records the messages delivered to the registered actors (disabled if
+ *   empty).
+ * - replay_file: replays a capture instead of driving the workflow (disabled if empty).
+ * - stubs: names of the registered actors replaced by stubs during the replay. A stub
+ *   absorbs and logs the messages, so that the side effects of an actor are not executed
+ *   twice (e.g. the acquisition replayed on top of the frames it published).
+ */
+struct RecordingConfig
+{
+	std::string capture_file;
+	std::string replay_file;
+	std::string replay_speed = "original";
+	std::vector<std::string> stubs;
+};
+
+/// @brief Messages delivered by the replay driver per activation
+constexpr std::size_t replay_batch_size = 64;
+
+/**
+ * @brief Behavior of the replay driver. Delivers the messages of a capture to the actors
+ * of the session, at the original pace or as fast as possible, then quits. Messages are
+ * delivered anonymously: replies of the receivers are dropped.
+ *
+ * The receiver of each message is looked up in the registry when the message is
+ * delivered: an actor registered after the start of the replay, or restarted under the
+ * same ID, receives the messages from then on. Messages to an ID with no registered
+ * actor at that time are skipped.
+ *
+ * @param self The current actor
+ * @param reader opened capture file
+ * @param receivers registry IDs of the receivers of the replayed messages. Messages to
+ * other receivers are skipped.
+ * @param speed pace of the replay
+ *
+ * @return A `caf::behavior` pacing the replay with `caf::tick_atom` messages.
+ */
+caf::behavior replay_driver(caf::event_based_actor* self,
+                            std::shared_ptr<MessageReader> reader,
+                            std::vector<caf::actor_id> receivers,
+                            ReplaySpeed speed);
+
+/**
+ * @brief Behavior of a stub replacing a registered actor. Accepts any message and logs
+ * it at debug level.
+ *
+ * @param self The current actor
+ * @param name name of the replaced actor, for the log
+ *
+ * @return A `caf::behavior` answering (get_atom, ok_atom) with the number of messages
+ * received.
+ */
+caf::behavior replay_stub(caf::event_based_actor* self, std::string name);
+
+}  // namespace recorder
+
+#endif  // RECORDER_REPLAYACTOR_HPP
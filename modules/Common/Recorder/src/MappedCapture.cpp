@@ -0,0 +1,135 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Recorder/MappedCapture.hpp"
+
+namespace recorder
+{
+
+MappedCapture::MappedCapture(const std::filesystem::path& filename)
+{
+#ifdef __linux__
+	const int fd = ::open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+	{
+		throw std::runtime_error("Cannot open the capture file " + filename.string());
+	}
+
+	struct stat status{};
+	if (::fstat(fd, &status) != 0)
+	{
+		::close(fd);
+		throw std::runtime_error("Cannot open the capture file " + filename.string());
+	}
+	_size = static_cast<std::size_t>(status.st_size);
+
+	if (_size > 0)
+	{
+		void* mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (mapping == MAP_FAILED)
+		{
+			::close(fd);
+			throw std::runtime_error("Cannot map the capture file " + filename.string());
+		}
+		// Read front to back: the kernel reads ahead, and the pages already read can
+		// be dropped under memory pressure
+		::madvise(mapping, _size, MADV_SEQUENTIAL);
+		_data = static_cast<const std::byte*>(mapping);
+		_mapped = true;
+	}
+	// The mapping stays valid once the descriptor is closed
+	::close(fd);
+#else
+	std::ifstream file(filename, std::ios::binary | std::ios::ate);
+	if (!file)
+	{
+		throw std::runtime_error("Cannot open the capture file " + filename.string());
+	}
+	_buffer.resize(static_cast<std::size_t>(file.tellg()));
+	file.seekg(0);
+	file.read(reinterpret_cast<char*>(_buffer.data()),
+	          static_cast<std::streamsize>(_buffer.size()));
+	_data = _buffer.data();
+	_size = _buffer.size();
+#endif
+
+	if (_size < file_magic.size() ||
+	    std::memcmp(_data, file_magic.data(), file_magic.size()) != 0)
+	{
+		// The destructor is not called when the ctor throws
+#ifdef __linux__
+		if (_mapped)
+		{
+			::munmap(const_cast<std::byte*>(_data), _size);
+		}
+#endif
+		throw std::runtime_error(filename.string() + " is not a capture file");
+	}
+	_offset = file_magic.size();
+}
+
+// --------------------------------------------------------------------
+MappedCapture::~MappedCapture()
+{
+#ifdef __linux__
+	if (_mapped)
+	{
+		::munmap(const_cast<std::byte*>(_data), _size);
+	}
+#endif
+}
+
+// --------------------------------------------------------------------
+std::optional<CaptureRecord> MappedCapture::next()
+{
+	if (_offset == _size)
+	{
+		return std::nullopt;
+	}
+	if (_size - _offset < sizeof(RecordHeader))
+	{
+		throw std::runtime_error("Truncated record header in capture file");
+	}
+
+	// The records are not aligned in the file
+	CaptureRecord record;
+	std::memcpy(&record.header, _data + _offset, sizeof(RecordHeader));
+	_offset += sizeof(RecordHeader);
+
+	if (_size - _offset < record.header.payload_size)
+	{
+		throw std::runtime_error("Truncated message of " +
+		                         std::to_string(record.header.payload_size) +
+		                         " bytes in capture file");
+	}
+	record.payload = caf::const_byte_span{_data + _offset, record.header.payload_size};
+	_offset += record.header.payload_size;
+	return record;
+}
+
+// --------------------------------------------------------------------
+void MappedCapture::rewind()
+{
+	_offset = file_magic.size();
+}
+
+}  // namespace recorder
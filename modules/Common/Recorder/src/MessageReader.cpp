@@ -0,0 +1,54 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <stdexcept>
+#include <string>
+
+#include <caf/binary_deserializer.hpp>
+
+#include "Recorder/MessageReader.hpp"
+#include "Recorder/MessageRecorder.hpp"
+
+namespace recorder
+{
+
+MessageReader::MessageReader(caf::actor_system& system,
+                             const std::filesystem::path& filename)
+    : _system(system), _capture(filename)
+{
+}
+
+// --------------------------------------------------------------------
+std::optional<RecordedMessage> MessageReader::next()
+{
+	std::optional<CaptureRecord> record = _capture.next();
+	if (!record)
+	{
+		return std::nullopt;
+	}
+	const RecordHeader& header = record->header;
+
+	RecordedMessage recorded{.timestamp = std::chrono::nanoseconds(header.timestamp_ns),
+	                         .sender_id = header.sender_id,
+	                         .receiver_id = header.receiver_id,
+	                         .content = {}};
+
+	caf::binary_deserializer source{_system, record->payload};
+	if (!source.apply(recorded.content))
+	{
+		throw std::runtime_error("Cannot deserialize message to actor " +
+		                         std::to_string(header.receiver_id) + ": " +
+		                         caf::to_string(source.get_error()));
+	}
+
+	return recorded;
+}
+
+}  // namespace recorder
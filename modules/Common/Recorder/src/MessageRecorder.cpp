@@ -0,0 +1,112 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <atomic>
+#include <stdexcept>
+
+#include <caf/binary_serializer.hpp>
+#include <caf/byte_buffer.hpp>
+
+#include "Logger/Logger.hpp"
+
+#include "Recorder/MessageRecorder.hpp"
+
+namespace recorder
+{
+
+namespace
+{
+/// @brief Recorder of the running capture
+std::atomic<MessageRecorder*> _currentRecorder{nullptr};
+}  // namespace
+
+// --------------------------------------------------------------------
+MessageRecorder::MessageRecorder(caf::actor_system& system,
+                                 const std::filesystem::path& filename)
+    : _system(system),
+      _start(std::chrono::steady_clock::now()),
+      _file(filename, std::ios::binary | std::ios::trunc)
+{
+	if (!_file)
+	{
+		throw std::runtime_error("Cannot create the capture file " + filename.string());
+	}
+
+	_file.write(file_magic.data(), file_magic.size());
+}
+
+// --------------------------------------------------------------------
+void MessageRecorder::record(caf::actor_id receiverId,
+                             caf::actor_id senderId,
+                             const caf::message& msg)
+{
+	const auto elapsed = std::chrono::steady_clock::now() - _start;
+
+	// Serialized outside of the lock, in a buffer reused by the thread
+	thread_local caf::byte_buffer payload;
+	payload.clear();
+	caf::binary_serializer sink{_system, payload};
+	if (!sink.apply(msg))
+	{
+		MEDLOG_WARN("Message to actor {} not recorded: {}", receiverId,
+		            caf::to_string(sink.get_error()));
+		return;
+	}
+
+	const RecordHeader header{
+	    .timestamp_ns =
+	        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count(),
+	    .sender_id = senderId,
+	    .receiver_id = receiverId,
+	    .payload_size = static_cast<std::uint32_t>(payload.size()),
+	    .reserved = 0};
+
+	std::lock_guard lock(_mutex);
+	_file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	_file.write(reinterpret_cast<const char*>(payload.data()),
+	            static_cast<std::streamsize>(payload.size()));
+	++_recordCount;
+}
+
+// --------------------------------------------------------------------
+std::uint64_t MessageRecorder::recordCount() const
+{
+	std::lock_guard lock(_mutex);
+	return _recordCount;
+}
+
+// --------------------------------------------------------------------
+//
+// C L A S S   C A P T U R E
+//
+// --------------------------------------------------------------------
+Capture::Capture(caf::actor_system& system, const std::filesystem::path& filename)
+    : _recorder(system, filename)
+{
+	MessageRecorder* expected{nullptr};
+	if (!_currentRecorder.compare_exchange_strong(expected, &_recorder))
+	{
+		throw std::logic_error("Message capture already running.");
+	}
+}
+
+// --------------------------------------------------------------------
+Capture::~Capture()
+{
+	_currentRecorder.store(nullptr, std::memory_order_release);
+}
+
+// --------------------------------------------------------------------
+MessageRecorder* detail::currentRecorder()
+{
+	return _currentRecorder.load(std::memory_order_acquire);
+}
+
+}  // namespace recorder
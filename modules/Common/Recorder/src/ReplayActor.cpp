@@ -0,0 +1,165 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <optional>
+
+#include <caf/abstract_actor.hpp>
+#include <caf/actor_cast.hpp>
+#include <caf/actor_registry.hpp>
+#include <caf/actor_system.hpp>
+#include <caf/mailbox_element.hpp>
+#include <caf/message_id.hpp>
+#include <caf/skippable_result.hpp>
+
+#include "Logger/Logger.hpp"
+
+#include "Recorder/ReplayActor.hpp"
+
+namespace recorder
+{
+
+namespace
+{
+/**
+ * \struct ReplayState
+ *
+ * @brief Progress of one replay.
+ */
+struct ReplayState
+{
+	std::shared_ptr<MessageReader> reader;
+	std::vector<caf::actor_id> receivers;
+	ReplaySpeed speed{ReplaySpeed::Original};
+	std::chrono::steady_clock::time_point start;
+
+	// Message read but not yet due
+	std::optional<RecordedMessage> pending;
+	std::uint64_t delivered{0};
+	std::uint64_t skipped{0};
+};
+
+// --------------------------------------------------------------------
+/**
+ * @brief Enqueues a recorded message as is in the mailbox of the actor registered as its
+ * receiver now.
+ */
+void deliver(caf::event_based_actor* self, ReplayState& state, RecordedMessage& recorded)
+{
+	if (std::ranges::find(state.receivers, recorded.receiver_id) == state.receivers.end())
+	{
+		++state.skipped;
+		return;
+	}
+	auto target = self->system().registry().get<caf::actor>(recorded.receiver_id);
+	if (!target)
+	{
+		++state.skipped;
+		return;
+	}
+
+	// The content is already a complete message: bypass the mail API that would wrap it
+	// in another one.
+	caf::actor_cast<caf::abstract_actor*>(target)
+	    ->enqueue(caf::make_mailbox_element(nullptr, caf::make_message_id(),
+	                                        std::move(recorded.content)),
+	              nullptr);
+	++state.delivered;
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Delivers the messages due, up to replay_batch_size, then schedules the next
+ * activation of the driver. Quits at the end of the capture.
+ */
+void replayBatch(caf::event_based_actor* self, ReplayState& state)
+{
+	for (std::size_t i = 0; i < replay_batch_size; ++i)
+	{
+		if (!state.pending)
+		{
+			try
+			{
+				state.pending = state.reader->next();
+			}
+			catch (const std::exception& e)
+			{
+				MEDLOG_ERROR("Replay aborted: {}", e.what());
+				self->quit();
+				return;
+			}
+
+			if (!state.pending)
+			{
+				MEDLOG_INFO("Replay done: {} messages delivered, {} skipped",
+				            state.delivered, state.skipped);
+				self->quit();
+				return;
+			}
+		}
+
+		if (state.speed == ReplaySpeed::Original)
+		{
+			const auto due = state.start + state.pending->timestamp;
+			const auto now = std::chrono::steady_clock::now();
+			if (due > now)
+			{
+				self->mail(caf::tick_atom_v).delay(due - now).send(self);
+				return;
+			}
+		}
+
+		deliver(self, state, *state.pending);
+		state.pending.reset();
+	}
+
+	// Yield between batches so that the other messages of the driver are processed
+	self->mail(caf::tick_atom_v).send(self);
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+caf::behavior replay_driver(caf::event_based_actor* self,
+                            std::shared_ptr<MessageReader> reader,
+                            std::vector<caf::actor_id> receivers,
+                            ReplaySpeed speed)
+{
+	auto state = std::make_shared<ReplayState>();
+	state->reader = std::move(reader);
+	state->receivers = std::move(receivers);
+	state->speed = speed;
+	state->start = std::chrono::steady_clock::now();
+
+	MEDLOG_INFO("Replay started ({} speed, {} receivers)", to_string(speed),
+	            state->receivers.size());
+	self->mail(caf::tick_atom_v).send(self);
+
+	return {[self, state](caf::tick_atom) { replayBatch(self, *state); }};
+}
+
+// --------------------------------------------------------------------
+caf::behavior replay_stub(caf::event_based_actor* self, std::string name)
+{
+	auto received = std::make_shared<std::uint64_t>(0);
+
+	self->set_default_handler(
+	    [name, received](caf::message& msg) -> caf::skippable_result
+	    {
+		    ++*received;
+		    MEDLOG_DEBUG("Stub {} received {}", name, caf::to_string(msg));
+		    return caf::message{};
+	    });
+
+	return {[received](caf::get_atom, caf::ok_atom) { return *received; }};
+}
+
+}  // namespace recorder
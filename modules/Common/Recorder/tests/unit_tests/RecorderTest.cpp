@@ -0,0 +1,157 @@
+#include <caf/test/caf_test_main.hpp>
+#include <caf/test/fixture/deterministic.hpp>
+#include <caf/test/test.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <caf/actor_registry.hpp>
+#include <caf/event_based_actor.hpp>
+
+#include "Recorder/MappedCapture.hpp"
+#include "Recorder/MessageReader.hpp"
+#include "Recorder/MessageRecorder.hpp"
+#include "Recorder/ReplayActor.hpp"
+
+namespace
+{
+std::filesystem::path captureFile(const std::string& name)
+{
+	return std::filesystem::temp_directory_path() / name;
+}
+}  // namespace
+
+WITH_FIXTURE(caf::test::fixture::deterministic)
+{
+
+TEST("recorded messages are read back in order")
+{
+	const auto path = captureFile("recorder_roundtrip.rec");
+	{
+		recorder::MessageRecorder rec(sys, path);
+		rec.record(20, 7, caf::make_message(caf::publish_atom_v, 1));
+		rec.record(30, 0, caf::make_message(caf::publish_atom_v, 2));
+		check_eq(rec.recordCount(), 2u);
+	}
+
+	recorder::MessageReader reader(sys, path);
+
+	auto first = reader.next();
+	require(first.has_value());
+	check_eq(first->receiver_id, caf::actor_id{20});
+	check_eq(first->sender_id, caf::actor_id{7});
+	check(first->content.match_elements<caf::publish_atom, int>());
+	check_eq(first->content.get_as<int>(1), 1);
+
+	auto second = reader.next();
+	require(second.has_value());
+	check_eq(second->receiver_id, caf::actor_id{30});
+	check_eq(second->sender_id, caf::actor_id{0});
+	check_eq(second->content.get_as<int>(1), 2);
+	check(second->timestamp >= first->timestamp);
+
+	check(!reader.next().has_value());
+	std::filesystem::remove(path);
+}
+
+TEST("capture is a no-op when not running")
+{
+	check(!recorder::isCapturing());
+
+	const auto path = captureFile("recorder_capture.rec");
+	{
+		recorder::Capture capture(sys, path);
+		check(recorder::isCapturing());
+		recorder::capture(20, nullptr, caf::publish_atom_v, 42);
+	}
+	check(!recorder::isCapturing());
+	recorder::capture(20, nullptr, caf::publish_atom_v, 43);
+
+	recorder::MessageReader reader(sys, path);
+	auto recorded = reader.next();
+	require(recorded.has_value());
+	check_eq(recorded->content.get_as<int>(1), 42);
+	check(!reader.next().has_value());
+	std::filesystem::remove(path);
+}
+
+TEST("mapped capture is read again after a rewind")
+{
+	const auto path = captureFile("recorder_mapped.rec");
+	{
+		recorder::MessageRecorder rec(sys, path);
+		rec.record(20, 7, caf::make_message(caf::publish_atom_v, 1));
+		rec.record(30, 0, caf::make_message(caf::publish_atom_v, 2));
+	}
+
+	recorder::MappedCapture capture(path);
+	check_eq(capture.size(), std::filesystem::file_size(path));
+
+	auto first = capture.next();
+	require(first.has_value());
+	check_eq(first->header.receiver_id, 20u);
+	check_eq(first->payload.size(), std::size_t{first->header.payload_size});
+	auto second = capture.next();
+	require(second.has_value());
+	check_eq(second->header.receiver_id, 30u);
+	check(!capture.next().has_value());
+
+	capture.rewind();
+	auto again = capture.next();
+	require(again.has_value());
+	check_eq(again->header.receiver_id, 20u);
+	std::filesystem::remove(path);
+}
+
+TEST("invalid capture files are rejected")
+{
+	const auto path = captureFile("recorder_invalid.rec");
+	std::ofstream(path) << "not a capture";
+	check_throws<std::runtime_error>([&] { recorder::MessageReader reader(sys, path); });
+	check_throws<std::runtime_error>([&] { recorder::MappedCapture capture(path); });
+	std::filesystem::remove(path);
+}
+
+TEST("replayed messages reach the actor registered at delivery")
+{
+	const auto path = captureFile("recorder_replay.rec");
+	{
+		recorder::MessageRecorder rec(sys, path);
+		rec.record(20, 0, caf::make_message(caf::publish_atom_v, 1));
+		rec.record(30, 0, caf::make_message(caf::publish_atom_v, 2));
+		rec.record(20, 0, caf::make_message(caf::publish_atom_v, 3));
+	}
+
+	auto received = std::make_shared<std::vector<int>>();
+	auto receiver = sys.spawn(
+	    [received](caf::event_based_actor*) -> caf::behavior
+	    { return {[received](caf::publish_atom, int x) { received->push_back(x); }}; });
+	auto reader = std::make_shared<recorder::MessageReader>(sys, path);
+	sys.spawn(recorder::replay_driver, std::move(reader), std::vector<caf::actor_id>{20},
+	          recorder::ReplaySpeed::Max);
+
+	// Registered after the start of the replay, as a restarted actor would be
+	sys.registry().put(caf::actor_id{20}, receiver);
+	dispatch_messages();
+	check_eq(*received, std::vector<int>({1, 3}));
+
+	sys.registry().erase(caf::actor_id{20});
+	std::filesystem::remove(path);
+}
+
+TEST("replay speed parsing")
+{
+	recorder::ReplaySpeed speed{recorder::ReplaySpeed::Original};
+	check(from_string("max", speed));
+	check_eq(speed, recorder::ReplaySpeed::Max);
+	check(!from_string("fast", speed));
+	check_eq(recorder::to_string(recorder::ReplaySpeed::Original), "original");
+}
+
+}  // WITH_FIXTURE(caf::test::fixture::deterministic)
+
+CAF_TEST_MAIN()
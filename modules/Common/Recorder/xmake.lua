@@ -0,0 +1,16 @@
+target("common_recorder")
+    set_kind("shared")
+    add_includedirs("include", {public = true})
+    add_files("src/*.cpp")
+    add_deps("common_caf")
+    add_deps("common_logger")
+
+
+-- Unit test target
+target("common_recorder_tests")
+    set_kind("binary")  
+    add_files("tests/unit_tests/*.cpp")
+    add_deps("common_recorder") 
+    add_packages("actor-framework", {components = {"caf_test"}})
+    add_links("caf_test")
+    add_tests("default")
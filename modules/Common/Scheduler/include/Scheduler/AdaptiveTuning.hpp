@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SCHEDULER_ADAPTIVETUNING_HPP
+#define SCHEDULER_ADAPTIVETUNING_HPP
+
+#include <chrono>
+#include <cstddef>
+
+#include "LoadMonitor.hpp"
+
+namespace scheduler
+{
+
+using namespace std::chrono_literals;
+
+/**
+ * \struct AdaptiveTuningConfig
+ *
+ * @brief Bounds and thresholds of the adaptive tuning. Read from the
+ * "icograph.adaptive-tuning" section of the CAF configuration file.
+ */
+struct AdaptiveTuningConfig final
+{
+	bool enabled = true;
+
+	// Sampling period of the load
+	std::chrono::nanoseconds period = 500ms;
+
+	// Bounds of the active workers of the task pool. 0 for max_workers means all the
+	// workers of the pool.
+	std::size_t min_workers = 1;
+	std::size_t max_workers = 0;
+
+	// Bounds of the per-actor throughput quota (items per batch)
+	std::size_t min_quota = 10;
+	std::size_t max_quota = 1000;
+
+	// Handler latency above which the process is considered overloaded
+	std::chrono::nanoseconds target_latency = 5ms;
+
+	// Messages waiting in the mailbox of an actor above which the process is considered
+	// overloaded
+	std::size_t max_mailbox_depth = 4;
+
+	// Consecutive idle samples before stepping down
+	std::size_t idle_samples = 4;
+};
+
+/**
+ * \struct TuningState
+ *
+ * @brief Values applied by the adaptive tuning.
+ */
+struct TuningState final
+{
+	std::size_t workers = 1;
+	std::size_t quota = 100;
+
+	bool operator==(const TuningState&) const = default;
+};
+
+/**
+ * \class AdaptiveTuningPolicy
+ *
+ * @brief Decides the number of active workers and the throughput quota from the load
+ * samples. Steps up as soon as the run queue of the task pool outgrows the workers, the
+ * mailbox of an actor outgrows its bound or a handler exceeds the target latency
+ * (throughput under load), steps down after several idle samples (latency when idle,
+ * fewer wake-ups).
+ */
+class AdaptiveTuningPolicy
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param cfg bounds and thresholds. max_workers must already be resolved.
+	 * @param initial state applied before the first sample, clamped to the bounds
+	 */
+	AdaptiveTuningPolicy(const AdaptiveTuningConfig& cfg, const TuningState& initial);
+
+	/**
+	 * @brief Computes the next state.
+	 * @param sample handler latencies and mailbox depths of the last period
+	 * @param runQueue jobs waiting in the task pool
+	 * @return the state to apply, unchanged if no decision is taken
+	 */
+	TuningState update(const LoadSample& sample, std::size_t runQueue);
+
+	[[nodiscard]] const TuningState& state() const { return _state; }
+
+private:
+	AdaptiveTuningConfig _cfg;
+	TuningState _state;
+	std::size_t _idleCount{0};
+};
+
+}  // namespace scheduler
+
+#endif  // SCHEDULER_ADAPTIVETUNING_HPP
@@ -0,0 +1,86 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SCHEDULER_CPUBUDGET_HPP
+#define SCHEDULER_CPUBUDGET_HPP
+
+#include <cstddef>
+
+namespace scheduler
+{
+
+/**
+ * \struct CpuBudgetConfig
+ *
+ * @brief Configurable parameters of the CPU budget of the process. Read once from the
+ * "icograph.cpu-budget" section of the CAF configuration file.
+ */
+struct CpuBudgetConfig final
+{
+	// Number of threads allowed to run simultaneously. 0 means all the cores left after
+	// the reservation.
+	std::size_t threads = 0;
+
+	// Number of cores removed from the affinity of the process (OS, acquisition driver).
+	std::size_t reserved_cores = 1;
+
+	// Number of workers of the shared task pool running the parallel kernels and the
+	// background jobs. 0 means half of the budget left after the logger.
+	std::size_t kernel_threads = 0;
+};
+
+/**
+ * \struct CpuBudget
+ *
+ * @brief Split of the CPU budget between the thread pools of the process: the CAF
+ * scheduler, the shared task pool and the asynchronous logger. Their sum never exceeds
+ * the budget, so that no more threads than cores are runnable. The budget is at least
+ * 2 threads: one for the actors and one for the logger, which is mostly sleeping.
+ */
+struct CpuBudget final
+{
+	std::size_t total = 2;
+	std::size_t caf_threads = 1;
+	std::size_t kernel_threads = 0;
+	std::size_t logger_threads = 1;
+};
+
+/**
+ * @brief Computes the split of the CPU budget.
+ *
+ * @param cfg configuration of the budget
+ * @param availableCores number of cores the process may run on
+ *
+ * @return the number of threads granted to each pool, and the budget raised to its
+ * minimum if needed
+ *
+ * @throws std::invalid_argument if the configuration cannot be satisfied
+ */
+[[nodiscard]] CpuBudget computeCpuBudget(const CpuBudgetConfig& cfg,
+                                         std::size_t availableCores);
+
+/**
+ * @brief Number of cores the current process may run on (affinity aware).
+ */
+[[nodiscard]] std::size_t availableCores();
+
+/**
+ * @brief Removes the reserved cores from the affinity of the process. Must be called
+ * before any thread is started so that every thread inherits it.
+ *
+ * @param reservedCores number of cores to reserve, taken from the lowest indices
+ *
+ * @return false if the affinity cannot be changed on this platform
+ */
+bool reserveCores(std::size_t reservedCores);
+
+}  // namespace scheduler
+
+#endif  // SCHEDULER_CPUBUDGET_HPP
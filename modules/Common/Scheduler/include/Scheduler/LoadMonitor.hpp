@@ -0,0 +1,93 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SCHEDULER_LOADMONITOR_HPP
+#define SCHEDULER_LOADMONITOR_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace scheduler
+{
+
+/**
+ * \struct LoadSample
+ *
+ * @brief Handler latencies and actor backlogs measured since the previous sample.
+ */
+struct LoadSample final
+{
+	std::uint64_t handler_count = 0;
+	std::chrono::nanoseconds mean_latency{0};
+	std::chrono::nanoseconds max_latency{0};
+	// Most messages seen waiting in the mailbox of an actor
+	std::size_t max_mailbox_depth = 0;
+};
+
+/**
+ * @brief Records the duration of one message handler. Lock-free, callable from any
+ * actor.
+ */
+void recordHandlerLatency(std::chrono::nanoseconds latency);
+
+/**
+ * @brief Records the messages waiting in the mailbox of an actor, its run queue, when one
+ * of its handlers starts. Lock-free, callable from any actor.
+ */
+void recordMailboxDepth(std::size_t depth);
+
+/**
+ * @brief Returns the latencies and the mailbox depths recorded since the previous call
+ * and starts a new window.
+ */
+[[nodiscard]] LoadSample takeLoadSample();
+
+/**
+ * @brief Number of items an actor should process per batch (stream batches, ring drains).
+ * Adjusted at runtime by the adaptive tuning.
+ */
+[[nodiscard]] std::size_t throughputQuota();
+
+// Sets the per-actor throughput quota
+void setThroughputQuota(std::size_t quota);
+
+/**
+ * \class HandlerTimer
+ *
+ * @brief Measures the duration of a message handler from its construction to its
+ * destruction (RAII idiom), and records the depth of the mailbox of the actor.
+ */
+class HandlerTimer
+{
+public:
+	// Ctor. mailboxDepth: messages waiting behind the one handled
+	explicit HandlerTimer(std::size_t mailboxDepth = 0)
+	    : _start(std::chrono::steady_clock::now())
+	{
+		recordMailboxDepth(mailboxDepth);
+	}
+
+	// Dtor
+	~HandlerTimer() { recordHandlerLatency(std::chrono::steady_clock::now() - _start); }
+
+	// Do not allow other types of ctor/assignment operators
+	HandlerTimer(const HandlerTimer&) = delete;
+	HandlerTimer& operator=(const HandlerTimer&) = delete;
+	HandlerTimer(HandlerTimer&&) = delete;
+	HandlerTimer& operator=(HandlerTimer&&) = delete;
+
+private:
+	std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace scheduler
+
+#endif  // SCHEDULER_LOADMONITOR_HPP
@@ -0,0 +1,172 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SCHEDULER_TASKPOOL_HPP
+#define SCHEDULER_TASKPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Shared CPU budget of the process.
+ * The CAF scheduler, the parallel kernels and the background jobs draw from one budget
+ * configured in the CAF configuration file (see CpuBudget.hpp). The parallel kernels and
+ * the background jobs run on a single work-stealing task pool instead of ad-hoc thread
+ * pools (std::execution::par, std::async...).
+ *
+ * Usage:
+ *   1. Create the shared pool in main:
+ *      "scheduler::SharedTaskPool pool(budget.kernel_threads)".
+ *   2. Use scheduler::parallelFor and scheduler::post from anywhere.
+ *   3. Without a shared pool (unit tests for instance) the work runs on the caller.
+ */
+
+namespace scheduler
+{
+
+/**
+ * \class TaskPool
+ *
+ * @brief Work-stealing thread pool. Each worker owns a deque of jobs: it pops its own
+ * jobs from the back and steals the jobs of the other workers from the front when idle.
+ */
+class TaskPool
+{
+public:
+	using Job = std::function<void()>;
+
+	// Body of a parallel loop, called with a sub-range [begin, end)
+	using RangeBody = std::function<void(std::size_t, std::size_t)>;
+
+	// Ctor. A pool without thread runs every job on the caller.
+	explicit TaskPool(std::size_t threadCount);
+
+	// Dtor. Runs the pending jobs then joins the workers.
+	~TaskPool();
+
+	// Do not allow other types of ctor/assignment operators
+	TaskPool() = delete;
+	TaskPool(const TaskPool&) = delete;
+	TaskPool& operator=(const TaskPool&) = delete;
+	TaskPool(TaskPool&&) = delete;
+	TaskPool& operator=(TaskPool&&) = delete;
+
+	/**
+	 * @brief Queues a background job. Jobs posted from a worker go to its own deque,
+	 * others are distributed round-robin.
+	 */
+	void post(Job job);
+
+	/**
+	 * @brief Runs body over [begin, end) split in chunks of `grain` indices. The caller
+	 * takes part in the loop so that nested loops and calls from the actor scheduler
+	 * never wait for a free worker. If a chunk throws, the chunks not started are
+	 * skipped and the first exception is rethrown once the running ones are done.
+	 */
+	void parallelFor(std::size_t begin,
+	                 std::size_t end,
+	                 std::size_t grain,
+	                 const RangeBody& body);
+
+	// Number of worker threads
+	[[nodiscard]] std::size_t threadCount() const { return _workers.size(); }
+
+	/**
+	 * @brief Parks the workers above `count` (at least one worker stays active). Parked
+	 * workers sleep and receive no job; their queued jobs are stolen by the others.
+	 */
+	void setActiveWorkers(std::size_t count);
+
+	// Number of workers taking jobs
+	[[nodiscard]] std::size_t activeWorkers() const { return _activeWorkers.load(); }
+
+	// Number of jobs queued and not started yet
+	[[nodiscard]] std::size_t pendingJobs() const { return _pending.load(); }
+
+	// Shared pool of the process, nullptr if none is installed
+	[[nodiscard]] static TaskPool* shared();
+
+private:
+	struct Worker
+	{
+		std::mutex mutex;
+		std::deque<Job> jobs;
+	};
+
+	// Main loop of the worker threads
+	void run(std::size_t index);
+
+	// Pops a job from the own deque first, then steals from the others
+	bool tryPop(std::size_t index, Job& job);
+
+	std::vector<std::unique_ptr<Worker>> _workers;
+	std::vector<std::jthread> _threads;
+
+	std::atomic<std::size_t> _pending{0};
+	std::atomic<std::size_t> _nextWorker{0};
+	std::atomic<std::size_t> _activeWorkers{0};
+	std::atomic<bool> _stopping{false};
+
+	std::mutex _sleepMutex;
+	std::condition_variable _wakeUp;
+};
+
+/**
+ * \class SharedTaskPool
+ *
+ * @brief Lifetime management of the shared pool of the process (RAII idiom). The pool is
+ * reachable through TaskPool::shared() as long as this object lives.
+ */
+class SharedTaskPool
+{
+public:
+	// Ctor
+	explicit SharedTaskPool(std::size_t threadCount);
+	// Dtor
+	~SharedTaskPool();
+
+	// Do not allow other types of ctor/assignment operators
+	SharedTaskPool() = delete;
+	SharedTaskPool(const SharedTaskPool&) = delete;
+	SharedTaskPool& operator=(const SharedTaskPool&) = delete;
+	SharedTaskPool(SharedTaskPool&&) = delete;
+	SharedTaskPool& operator=(SharedTaskPool&&) = delete;
+
+	TaskPool& pool() { return _pool; }
+
+private:
+	TaskPool _pool;
+};
+
+/**
+ * @brief Runs body over [begin, end) on the shared pool, or on the caller if there is
+ * none.
+ */
+void parallelFor(std::size_t begin,
+                 std::size_t end,
+                 std::size_t grain,
+                 const TaskPool::RangeBody& body);
+
+/**
+ * @brief Queues a background job on the shared pool, or runs it on the caller if there is
+ * none.
+ */
+void post(TaskPool::Job job);
+
+}  // namespace scheduler
+
+#endif  // SCHEDULER_TASKPOOL_HPP
@@ -0,0 +1,59 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+
+#include "Scheduler/AdaptiveTuning.hpp"
+
+namespace scheduler
+{
+
+AdaptiveTuningPolicy::AdaptiveTuningPolicy(const AdaptiveTuningConfig& cfg,
+                                           const TuningState& initial)
+    : _cfg(cfg)
+{
+	_cfg.max_workers = std::max(_cfg.max_workers, _cfg.min_workers);
+	_cfg.max_quota = std::max(_cfg.max_quota, _cfg.min_quota);
+
+	_state.workers = std::clamp(initial.workers, _cfg.min_workers, _cfg.max_workers);
+	_state.quota = std::clamp(initial.quota, _cfg.min_quota, _cfg.max_quota);
+}
+
+// --------------------------------------------------------------------
+TuningState AdaptiveTuningPolicy::update(const LoadSample& sample, std::size_t runQueue)
+{
+	const bool overloaded = runQueue > _state.workers ||
+	                        sample.max_mailbox_depth > _cfg.max_mailbox_depth ||
+	                        sample.max_latency > _cfg.target_latency;
+	const bool idle = runQueue == 0 && sample.max_mailbox_depth == 0 &&
+	                  sample.mean_latency < _cfg.target_latency / 4;
+
+	if (overloaded)
+	{
+		_idleCount = 0;
+		_state.workers = std::min(_state.workers + 1, _cfg.max_workers);
+		_state.quota = std::min(_state.quota * 2, _cfg.max_quota);
+	}
+	else if (idle && ++_idleCount >= _cfg.idle_samples)
+	{
+		_idleCount = 0;
+		_state.workers =
+		    _state.workers > _cfg.min_workers ? _state.workers - 1 : _cfg.min_workers;
+		_state.quota = std::max(_state.quota / 2, _cfg.min_quota);
+	}
+	else if (!idle)
+	{
+		_idleCount = 0;
+	}
+
+	return _state;
+}
+
+}  // namespace scheduler
@@ -0,0 +1,92 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include "Scheduler/CpuBudget.hpp"
+
+namespace scheduler
+{
+
+CpuBudget computeCpuBudget(const CpuBudgetConfig& cfg, std::size_t availableCores)
+{
+	// The logger preserves the message order with a single worker, which is mostly
+	// sleeping: the smallest budget runs it beside a single actor thread.
+	constexpr std::size_t min_threads = 2;
+
+	CpuBudget budget;
+	budget.total = std::max(cfg.threads != 0 ? cfg.threads : availableCores, min_threads);
+	budget.logger_threads = 1;
+	const std::size_t remaining = budget.total - budget.logger_threads;
+
+	budget.kernel_threads = cfg.kernel_threads != 0 ? cfg.kernel_threads : remaining / 2;
+	if (budget.kernel_threads >= remaining)
+	{
+		throw std::invalid_argument(
+		    "Invalid CPU budget: " + std::to_string(cfg.kernel_threads) +
+		    " kernel threads leave no thread to the actor scheduler (budget of " +
+		    std::to_string(budget.total) + " threads)");
+	}
+
+	budget.caf_threads = remaining - budget.kernel_threads;
+	return budget;
+}
+
+// --------------------------------------------------------------------
+std::size_t availableCores()
+{
+#ifdef __linux__
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	if (sched_getaffinity(0, sizeof(set), &set) == 0)
+	{
+		return static_cast<std::size_t>(CPU_COUNT(&set));
+	}
+#endif
+	return std::max(std::thread::hardware_concurrency(), 1U);
+}
+
+// --------------------------------------------------------------------
+bool reserveCores(std::size_t reservedCores)
+{
+#ifdef __linux__
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	if (sched_getaffinity(0, sizeof(set), &set) != 0)
+	{
+		return false;
+	}
+
+	// Always keep at least one core for the process
+	std::size_t toRemove =
+	    std::min(reservedCores, static_cast<std::size_t>(CPU_COUNT(&set)) - 1);
+	for (int cpu = 0; cpu < CPU_SETSIZE && toRemove > 0; ++cpu)
+	{
+		if (CPU_ISSET(cpu, &set))
+		{
+			CPU_CLR(cpu, &set);
+			--toRemove;
+		}
+	}
+
+	return sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+	return reservedCores == 0;
+#endif
+}
+
+}  // namespace scheduler
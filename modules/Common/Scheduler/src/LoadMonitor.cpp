@@ -0,0 +1,88 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <atomic>
+
+#include "Scheduler/LoadMonitor.hpp"
+
+namespace scheduler
+{
+
+namespace
+{
+/// @brief Latencies of the current window
+std::atomic<std::uint64_t> _handlerCount{0};
+std::atomic<std::uint64_t> _totalLatencyNs{0};
+std::atomic<std::uint64_t> _maxLatencyNs{0};
+std::atomic<std::size_t> _maxMailboxDepth{0};
+
+/// @brief Current per-actor throughput quota
+std::atomic<std::size_t> _throughputQuota{100};
+}  // namespace
+
+// --------------------------------------------------------------------
+void recordHandlerLatency(std::chrono::nanoseconds latency)
+{
+	const auto latencyNs = static_cast<std::uint64_t>(latency.count());
+
+	_handlerCount.fetch_add(1, std::memory_order_relaxed);
+	_totalLatencyNs.fetch_add(latencyNs, std::memory_order_relaxed);
+
+	std::uint64_t currentMax = _maxLatencyNs.load(std::memory_order_relaxed);
+	while (latencyNs > currentMax &&
+	       !_maxLatencyNs.compare_exchange_weak(currentMax, latencyNs,
+	                                            std::memory_order_relaxed))
+	{
+	}
+}
+
+// --------------------------------------------------------------------
+void recordMailboxDepth(std::size_t depth)
+{
+	std::size_t currentMax = _maxMailboxDepth.load(std::memory_order_relaxed);
+	while (depth > currentMax &&
+	       !_maxMailboxDepth.compare_exchange_weak(currentMax, depth,
+	                                               std::memory_order_relaxed))
+	{
+	}
+}
+
+// --------------------------------------------------------------------
+LoadSample takeLoadSample()
+{
+	// The counters are not reset atomically together: a handler recorded in
+	// between is attributed to one window or the other, which is fine for tuning.
+	LoadSample sample;
+	sample.handler_count = _handlerCount.exchange(0, std::memory_order_relaxed);
+	const std::uint64_t totalNs = _totalLatencyNs.exchange(0, std::memory_order_relaxed);
+	sample.max_latency =
+	    std::chrono::nanoseconds(_maxLatencyNs.exchange(0, std::memory_order_relaxed));
+	sample.max_mailbox_depth = _maxMailboxDepth.exchange(0, std::memory_order_relaxed);
+
+	if (sample.handler_count != 0)
+	{
+		sample.mean_latency = std::chrono::nanoseconds(totalNs / sample.handler_count);
+	}
+	return sample;
+}
+
+// --------------------------------------------------------------------
+std::size_t throughputQuota()
+{
+	return _throughputQuota.load(std::memory_order_relaxed);
+}
+
+// --------------------------------------------------------------------
+void setThroughputQuota(std::size_t quota)
+{
+	_throughputQuota.store(quota, std::memory_order_relaxed);
+}
+
+}  // namespace scheduler
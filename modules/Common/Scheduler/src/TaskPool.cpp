@@ -0,0 +1,304 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <exception>
+#include <stdexcept>
+
+#include "Scheduler/TaskPool.hpp"
+
+namespace scheduler
+{
+
+namespace
+{
+/// @brief Pool installed as the shared pool of the process
+std::atomic<TaskPool*> _sharedPool{nullptr};
+
+/// @brief Pool and index of the worker running on the current thread, if any
+thread_local TaskPool* _currentPool{nullptr};
+thread_local std::size_t _currentWorker{0};
+
+/**
+ * \struct LoopState
+ *
+ * @brief Progress of one parallel loop, shared between the caller and the helpers.
+ * Helpers may start after the loop is over: they then find no chunk left. Once a chunk
+ * has thrown, the chunks left are skipped and the first exception is rethrown to the
+ * caller.
+ */
+struct LoopState
+{
+	std::atomic<std::size_t> nextChunk{0};
+	std::atomic<std::size_t> doneChunks{0};
+	std::atomic<bool> failed{false};
+	std::exception_ptr error;
+	std::mutex mutex;
+	std::condition_variable finished;
+};
+}  // namespace
+
+// --------------------------------------------------------------------
+TaskPool::TaskPool(std::size_t threadCount) : _activeWorkers(threadCount)
+{
+	_workers.reserve(threadCount);
+	for (std::size_t i = 0; i < threadCount; ++i)
+	{
+		_workers.push_back(std::make_unique<Worker>());
+	}
+
+	_threads.reserve(threadCount);
+	for (std::size_t i = 0; i < threadCount; ++i)
+	{
+		_threads.emplace_back([this, i] { run(i); });
+	}
+}
+
+// --------------------------------------------------------------------
+TaskPool::~TaskPool()
+{
+	{
+		std::lock_guard lock(_sleepMutex);
+		_stopping = true;
+	}
+	_wakeUp.notify_all();
+
+	// Join before the synchronization primitives are destroyed
+	_threads.clear();
+}
+
+// --------------------------------------------------------------------
+TaskPool* TaskPool::shared()
+{
+	return _sharedPool.load(std::memory_order_acquire);
+}
+
+// --------------------------------------------------------------------
+void TaskPool::post(Job job)
+{
+	if (_workers.empty())
+	{
+		job();
+		return;
+	}
+
+	const std::size_t active = _activeWorkers.load();
+	const std::size_t index = _currentPool == this && _currentWorker < active
+	                              ? _currentWorker
+	                              : _nextWorker.fetch_add(1) % active;
+	{
+		std::lock_guard lock(_workers[index]->mutex);
+		_workers[index]->jobs.push_back(std::move(job));
+	}
+
+	{
+		std::lock_guard lock(_sleepMutex);
+		_pending.fetch_add(1);
+	}
+	_wakeUp.notify_one();
+}
+
+// --------------------------------------------------------------------
+void TaskPool::parallelFor(std::size_t begin,
+                           std::size_t end,
+                           std::size_t grain,
+                           const RangeBody& body)
+{
+	if (begin >= end)
+	{
+		return;
+	}
+
+	grain = std::max<std::size_t>(grain, 1);
+	const std::size_t chunkCount = (end - begin + grain - 1) / grain;
+	if (_workers.empty() || chunkCount == 1)
+	{
+		body(begin, end);
+		return;
+	}
+
+	auto state = std::make_shared<LoopState>();
+
+	// Body reference stays valid: the caller returns, or rethrows, only once every chunk
+	// is done, and no chunk can be taken afterwards
+	auto runChunks = [state, begin, end, grain, chunkCount, &body]
+	{
+		std::size_t chunk = state->nextChunk.fetch_add(1);
+		while (chunk < chunkCount)
+		{
+			if (!state->failed.load())
+			{
+				try
+				{
+					const std::size_t chunkBegin = begin + chunk * grain;
+					body(chunkBegin, std::min(chunkBegin + grain, end));
+				}
+				catch (...)
+				{
+					std::lock_guard lock(state->mutex);
+					if (!state->error)
+					{
+						state->error = std::current_exception();
+					}
+					state->failed = true;
+				}
+			}
+
+			if (state->doneChunks.fetch_add(1) + 1 == chunkCount)
+			{
+				std::lock_guard lock(state->mutex);
+				state->finished.notify_all();
+			}
+			chunk = state->nextChunk.fetch_add(1);
+		}
+	};
+
+	const std::size_t helperCount = std::min(_activeWorkers.load(), chunkCount - 1);
+	for (std::size_t i = 0; i < helperCount; ++i)
+	{
+		post(runChunks);
+	}
+
+	runChunks();
+
+	std::unique_lock lock(state->mutex);
+	state->finished.wait(lock, [&state, chunkCount]
+	                     { return state->doneChunks.load() == chunkCount; });
+	if (state->error)
+	{
+		std::rethrow_exception(state->error);
+	}
+}
+
+// --------------------------------------------------------------------
+void TaskPool::run(std::size_t index)
+{
+	_currentPool = this;
+	_currentWorker = index;
+
+	while (true)
+	{
+		Job job;
+		if (index < _activeWorkers.load() && tryPop(index, job))
+		{
+			_pending.fetch_sub(1);
+			job();
+			continue;
+		}
+
+		std::unique_lock lock(_sleepMutex);
+		if (_stopping && (index >= _activeWorkers.load() || _pending.load() == 0))
+		{
+			return;
+		}
+		_wakeUp.wait(lock,
+		             [this, index]
+		             {
+			             return _stopping ||
+			                    (index < _activeWorkers.load() && _pending.load() > 0);
+		             });
+	}
+}
+
+// --------------------------------------------------------------------
+void TaskPool::setActiveWorkers(std::size_t count)
+{
+	if (_workers.empty())
+	{
+		return;
+	}
+
+	{
+		std::lock_guard lock(_sleepMutex);
+		_activeWorkers = std::clamp<std::size_t>(count, 1, _workers.size());
+	}
+	_wakeUp.notify_all();
+}
+
+// --------------------------------------------------------------------
+bool TaskPool::tryPop(std::size_t index, Job& job)
+{
+	{
+		Worker& own = *_workers[index];
+		std::lock_guard lock(own.mutex);
+		if (!own.jobs.empty())
+		{
+			job = std::move(own.jobs.back());
+			own.jobs.pop_back();
+			return true;
+		}
+	}
+
+	// Steal the oldest job of the other workers
+	for (std::size_t offset = 1; offset < _workers.size(); ++offset)
+	{
+		Worker& victim = *_workers[(index + offset) % _workers.size()];
+		std::lock_guard lock(victim.mutex);
+		if (!victim.jobs.empty())
+		{
+			job = std::move(victim.jobs.front());
+			victim.jobs.pop_front();
+			return true;
+		}
+	}
+
+	return false;
+}
+
+// --------------------------------------------------------------------
+//
+// C L A S S   S H A R E D T A S K P O O L
+//
+// --------------------------------------------------------------------
+SharedTaskPool::SharedTaskPool(std::size_t threadCount) : _pool(threadCount)
+{
+	TaskPool* expected{nullptr};
+	if (!_sharedPool.compare_exchange_strong(expected, &_pool))
+	{
+		throw std::logic_error("Shared task pool already initialized.");
+	}
+}
+
+// --------------------------------------------------------------------
+SharedTaskPool::~SharedTaskPool()
+{
+	_sharedPool.store(nullptr, std::memory_order_release);
+}
+
+// --------------------------------------------------------------------
+void parallelFor(std::size_t begin,
+                 std::size_t end,
+                 std::size_t grain,
+                 const TaskPool::RangeBody& body)
+{
+	if (TaskPool* pool = TaskPool::shared())
+	{
+		pool->parallelFor(begin, end, grain, body);
+	}
+	else if (begin < end)
+	{
+		body(begin, end);
+	}
+}
+
+// --------------------------------------------------------------------
+void post(TaskPool::Job job)
+{
+	if (TaskPool* pool = TaskPool::shared())
+	{
+		pool->post(std::move(job));
+	}
+	else
+	{
+		job();
+	}
+}
+
+}  // namespace scheduler
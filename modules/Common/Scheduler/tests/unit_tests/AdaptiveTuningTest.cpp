@@ -0,0 +1,130 @@
+
+#include <chrono>
+
+#include <catch2/catch_all.hpp>
+
+#include "Scheduler/AdaptiveTuning.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+using namespace scheduler;
+using namespace std::chrono_literals;
+
+/**
+ * @brief: Configuration with small bounds to reach them in a few samples.
+ */
+AdaptiveTuningConfig getConfigForTest()
+{
+	AdaptiveTuningConfig cfg;
+	cfg.min_workers = 1;
+	cfg.max_workers = 3;
+	cfg.min_quota = 10;
+	cfg.max_quota = 80;
+	cfg.target_latency = 1ms;
+	cfg.idle_samples = 2;
+
+	return cfg;
+}
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("Initial state is clamped to the bounds")
+{
+	AdaptiveTuningPolicy policy(getConfigForTest(),
+	                            TuningState{.workers = 8, .quota = 1});
+
+	CHECK(policy.state() == TuningState{.workers = 3, .quota = 10});
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Steps up under load up to the bounds")
+{
+	AdaptiveTuningPolicy policy(getConfigForTest(),
+	                            TuningState{.workers = 1, .quota = 10});
+
+	// Run queue longer than the active workers
+	CHECK(policy.update(LoadSample{}, 5) == TuningState{.workers = 2, .quota = 20});
+
+	// Handler slower than the target
+	const LoadSample slow{.handler_count = 10, .mean_latency = 1ms, .max_latency = 3ms};
+	CHECK(policy.update(slow, 0) == TuningState{.workers = 3, .quota = 40});
+	CHECK(policy.update(slow, 0) == TuningState{.workers = 3, .quota = 80});
+	CHECK(policy.update(slow, 0) == TuningState{.workers = 3, .quota = 80});
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Steps up when the mailbox of an actor backs up")
+{
+	AdaptiveTuningPolicy policy(getConfigForTest(),
+	                            TuningState{.workers = 1, .quota = 10});
+
+	// Idle task pool, fast handlers, but messages waiting for an actor
+	LoadSample backlog{.handler_count = 10, .mean_latency = 10us, .max_latency = 50us};
+	backlog.max_mailbox_depth = 4;
+	CHECK(policy.update(backlog, 0) == TuningState{.workers = 1, .quota = 10});
+	backlog.max_mailbox_depth = 5;
+	CHECK(policy.update(backlog, 0) == TuningState{.workers = 2, .quota = 20});
+
+	// A waiting message is not idle
+	backlog.max_mailbox_depth = 1;
+	for (int i = 0; i < 10; ++i)
+	{
+		CHECK(policy.update(backlog, 0) == TuningState{.workers = 2, .quota = 20});
+	}
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Steps down after consecutive idle samples")
+{
+	AdaptiveTuningPolicy policy(getConfigForTest(),
+	                            TuningState{.workers = 3, .quota = 80});
+
+	const LoadSample idle{.handler_count = 10, .mean_latency = 10us, .max_latency = 50us};
+	CHECK(policy.update(idle, 0) == TuningState{.workers = 3, .quota = 80});
+	CHECK(policy.update(idle, 0) == TuningState{.workers = 2, .quota = 40});
+
+	// A busy sample resets the idle streak
+	const LoadSample busy{
+	    .handler_count = 10, .mean_latency = 500us, .max_latency = 900us};
+	CHECK(policy.update(idle, 0) == TuningState{.workers = 2, .quota = 40});
+	CHECK(policy.update(busy, 1) == TuningState{.workers = 2, .quota = 40});
+	CHECK(policy.update(idle, 0) == TuningState{.workers = 2, .quota = 40});
+	CHECK(policy.update(idle, 0) == TuningState{.workers = 1, .quota = 20});
+
+	for (int i = 0; i < 10; ++i)
+	{
+		(void)policy.update(idle, 0);
+	}
+	CHECK(policy.state() == TuningState{.workers = 1, .quota = 10});
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Load sample windows")
+{
+	(void)takeLoadSample();
+
+	recordHandlerLatency(1ms);
+	recordHandlerLatency(3ms);
+	{
+		HandlerTimer timer(2);
+	}
+	recordMailboxDepth(7);
+	recordMailboxDepth(1);
+
+	auto sample = takeLoadSample();
+	CHECK(sample.handler_count == 3);
+	CHECK(sample.max_latency == 3ms);
+	CHECK(sample.mean_latency >= 1ms);
+	CHECK(sample.max_mailbox_depth == 7);
+
+	// New window
+	sample = takeLoadSample();
+	CHECK(sample.handler_count == 0);
+	CHECK(sample.max_latency == 0ns);
+	CHECK(sample.max_mailbox_depth == 0);
+}
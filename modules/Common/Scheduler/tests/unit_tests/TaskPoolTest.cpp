@@ -0,0 +1,242 @@
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <catch2/catch_all.hpp>
+
+#include "Scheduler/CpuBudget.hpp"
+#include "Scheduler/TaskPool.hpp"
+
+using namespace scheduler;
+using namespace std::chrono_literals;
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("CPU budget split")
+{
+	CpuBudgetConfig cfg;
+	cfg.threads = 16;
+
+	auto budget = computeCpuBudget(cfg, 32);
+	CHECK(budget.total == 16);
+	CHECK(budget.logger_threads == 1);
+	CHECK(budget.kernel_threads == 7);
+	CHECK(budget.caf_threads == 8);
+	CHECK(budget.logger_threads + budget.kernel_threads + budget.caf_threads <=
+	      budget.total);
+
+	// Budget follows the available cores when not configured
+	cfg.threads = 0;
+	cfg.kernel_threads = 2;
+	budget = computeCpuBudget(cfg, 6);
+	CHECK(budget.total == 6);
+	CHECK(budget.kernel_threads == 2);
+	CHECK(budget.caf_threads == 3);
+
+	// Single core: raised to one actor thread and the logger, no kernel worker
+	cfg.kernel_threads = 0;
+	budget = computeCpuBudget(cfg, 1);
+	CHECK(budget.total == 2);
+	CHECK(budget.caf_threads == 1);
+	CHECK(budget.kernel_threads == 0);
+	CHECK(budget.logger_threads == 1);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("CPU budget split never exceeds the budget")
+{
+	for (std::size_t threads = 0; threads <= 16; ++threads)
+	{
+		for (std::size_t kernelThreads = 0; kernelThreads <= 16; ++kernelThreads)
+		{
+			CpuBudgetConfig cfg;
+			cfg.threads = threads;
+			cfg.kernel_threads = kernelThreads;
+			try
+			{
+				const auto budget = computeCpuBudget(cfg, 1);
+				CHECK(budget.total >= std::max<std::size_t>(threads, 2));
+				CHECK(budget.caf_threads >= 1);
+				CHECK(budget.logger_threads == 1);
+				CHECK(budget.logger_threads + budget.kernel_threads +
+				          budget.caf_threads <=
+				      budget.total);
+			}
+			catch (const std::invalid_argument&)
+			{
+				CHECK(kernelThreads + 2 > std::max<std::size_t>(threads, 2));
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("CPU budget with too many kernel threads")
+{
+	CpuBudgetConfig cfg;
+	cfg.threads = 4;
+	cfg.kernel_threads = 3;
+
+	CHECK_THROWS_AS(computeCpuBudget(cfg, 4), std::invalid_argument);
+
+	// No thread left to the actors on a single core
+	cfg.threads = 0;
+	cfg.kernel_threads = 1;
+	CHECK_THROWS_AS(computeCpuBudget(cfg, 1), std::invalid_argument);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Parallel loop covers the range once")
+{
+	TaskPool pool(3);
+
+	std::vector<std::atomic<int>> hits(1000);
+	pool.parallelFor(0, hits.size(), 7,
+	                 [&hits](std::size_t begin, std::size_t end)
+	                 {
+		                 for (std::size_t i = begin; i < end; ++i)
+		                 {
+			                 hits[i].fetch_add(1);
+		                 }
+	                 });
+
+	for (const auto& hit : hits)
+	{
+		REQUIRE(hit.load() == 1);
+	}
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Parallel loop rethrows once every running chunk is done")
+{
+	TaskPool pool(3);
+
+	std::atomic<int> running{0};
+	std::atomic<int> started{0};
+	auto body = [&running, &started](std::size_t begin, std::size_t)
+	{
+		running.fetch_add(1);
+		started.fetch_add(1);
+		std::this_thread::sleep_for(1ms);
+		running.fetch_sub(1);
+		if (begin == 0)
+		{
+			throw std::runtime_error("chunk failed");
+		}
+	};
+
+	CHECK_THROWS_AS(pool.parallelFor(0, 100, 1, body), std::runtime_error);
+	CHECK(running.load() == 0);
+	// The chunks not started when the first one threw are skipped
+	CHECK(started.load() < 100);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Nested parallel loops do not deadlock")
+{
+	TaskPool pool(2);
+
+	std::atomic<std::size_t> sum{0};
+	pool.parallelFor(0, 8, 1,
+	                 [&pool, &sum](std::size_t, std::size_t)
+	                 {
+		                 pool.parallelFor(0, 100, 10,
+		                                  [&sum](std::size_t begin, std::size_t end)
+		                                  { sum.fetch_add(end - begin); });
+	                 });
+
+	CHECK(sum.load() == 800);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Background jobs run on the shared pool")
+{
+	SharedTaskPool shared(2);
+	REQUIRE(TaskPool::shared() == &shared.pool());
+
+	std::vector<std::future<int>> results;
+	for (int i = 0; i < 20; ++i)
+	{
+		auto promise = std::make_shared<std::promise<int>>();
+		results.push_back(promise->get_future());
+		post([promise, i] { promise->set_value(i); });
+	}
+
+	int total{0};
+	for (auto& result : results)
+	{
+		REQUIRE(result.wait_for(1s) == std::future_status::ready);
+		total += result.get();
+	}
+	CHECK(total == 190);
+
+	CHECK_THROWS_AS(SharedTaskPool(1), std::logic_error);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Without shared pool the work runs on the caller")
+{
+	REQUIRE(TaskPool::shared() == nullptr);
+
+	const auto caller = std::this_thread::get_id();
+	bool onCaller{false};
+	post([&] { onCaller = std::this_thread::get_id() == caller; });
+	CHECK(onCaller);
+
+	std::size_t covered{0};
+	parallelFor(0, 42, 4,
+	            [&](std::size_t begin, std::size_t end) { covered += end - begin; });
+	CHECK(covered == 42);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("Parked workers take no job")
+{
+	TaskPool pool(4);
+	pool.setActiveWorkers(1);
+	CHECK(pool.activeWorkers() == 1);
+
+	std::mutex mutex;
+	std::set<std::thread::id> threads;
+	std::atomic<int> done{0};
+	for (int i = 0; i < 50; ++i)
+	{
+		pool.post(
+		    [&]
+		    {
+			    std::lock_guard lock(mutex);
+			    threads.insert(std::this_thread::get_id());
+			    done.fetch_add(1);
+		    });
+	}
+
+	while (done.load() != 50)
+	{
+		std::this_thread::sleep_for(1ms);
+	}
+	CHECK(threads.size() == 1);
+
+	// Never below one active worker
+	pool.setActiveWorkers(0);
+	CHECK(pool.activeWorkers() == 1);
+	pool.setActiveWorkers(10);
+	CHECK(pool.activeWorkers() == 4);
+}
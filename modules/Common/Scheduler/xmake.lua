@@ -0,0 +1,14 @@
+target("common_scheduler")
+    set_kind("shared")
+    add_includedirs("include", {public = true})
+    add_files("src/*.cpp")
+    add_deps("common_logger")
+
+
+-- Unit test target
+target("common_scheduler_tests")
+    set_kind("binary")  
+    add_files("tests/unit_tests/*.cpp")
+    add_deps("common_scheduler") 
+    add_packages("catch2")
+    add_tests("default")
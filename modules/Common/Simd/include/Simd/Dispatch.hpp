@@ -0,0 +1,119 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SIMD_DISPATCH_HPP
+#define SIMD_DISPATCH_HPP
+
+#include "SimdLevel.hpp"
+
+/**
+ * @brief Runtime selection of the variants of the hot kernels: one binary runs the
+ * AVX-512 variants on the machines supporting them, and the others elsewhere.
+ *
+ * Usage:
+ *   1. Compile each variant of a kernel in the same source file, the SIMD ones under
+ *      MEDSIMD_X86 and with the target attribute of their instruction set:
+ *      "MEDSIMD_TARGET_AVX512 float sumAvx512(const float* x, std::size_t n) { ... }".
+ *      Their helpers need the same attribute, or "[[gnu::flatten]]" on the variant to
+ *      inline a portable body into it.
+ *   2. List them, the scalar one at least:
+ *      "const simd::KernelVariants<float(const float*, std::size_t)> sums{
+ *           .scalar = sumScalar, .avx2 = sumAvx2, .avx512 = sumAvx512};"
+ *   3. Select the variant once, when the object running the kernel is built:
+ *      "_sum = sums.select();", then call it through the pointer.
+ *
+ * The scalar variants are plain C++: they run on any machine and are the reference of
+ * the tests of the other variants (see limitLevel). The sources of the kernels are
+ * therefore compiled for the baseline of the architecture, without -mavx2 or -march:
+ * only the target attributes enable the wider instruction sets.
+ */
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MEDSIMD_X86 1
+#define MEDSIMD_TARGET_AVX2 [[gnu::target("avx2,fma,f16c")]]
+#define MEDSIMD_TARGET_AVX512 \
+	[[gnu::target("avx512f,avx512bw,avx512dq,avx512vl,avx2,fma,f16c")]]
+#else
+#define MEDSIMD_X86 0
+#define MEDSIMD_TARGET_AVX2
+#define MEDSIMD_TARGET_AVX512
+#endif
+
+namespace simd
+{
+
+/**
+ * @brief Highest level supported by the CPU and the OS, detected once.
+ */
+[[nodiscard]] SimdLevel detectedLevel() noexcept;
+
+/**
+ * @brief Level of the variants selected from now on: the detected level, at most the
+ * limit set by limitLevel.
+ */
+[[nodiscard]] SimdLevel activeLevel() noexcept;
+
+/**
+ * @brief Caps the level of the variants selected from now on, the kernels already built
+ * keep theirs. Set from the configuration at startup, or by the tests to run the scalar
+ * reference.
+ */
+void limitLevel(SimdLevel level) noexcept;
+
+/**
+ * \struct KernelVariants
+ *
+ * @brief Variants of a kernel compiled for each level. A missing variant falls back on
+ * the next level below it.
+ */
+template <typename Function>
+struct KernelVariants
+{
+	Function* scalar = nullptr;
+	Function* avx2 = nullptr;
+	Function* avx512 = nullptr;
+
+	/**
+	 * @brief Highest level of the variants up to the given level.
+	 */
+	[[nodiscard]] SimdLevel levelFor(SimdLevel level = activeLevel()) const noexcept
+	{
+		if (level >= SimdLevel::Avx512 && avx512 != nullptr)
+		{
+			return SimdLevel::Avx512;
+		}
+		if (level >= SimdLevel::Avx2 && avx2 != nullptr)
+		{
+			return SimdLevel::Avx2;
+		}
+		return SimdLevel::Scalar;
+	}
+
+	/**
+	 * @brief Variant of the highest level up to the given level.
+	 */
+	[[nodiscard]] Function* select(SimdLevel level = activeLevel()) const noexcept
+	{
+		switch (levelFor(level))
+		{
+		case SimdLevel::Avx512:
+			return avx512;
+		case SimdLevel::Avx2:
+			return avx2;
+		case SimdLevel::Scalar:
+			break;
+		}
+		return scalar;
+	}
+};
+
+}  // namespace simd
+
+#endif  // SIMD_DISPATCH_HPP
@@ -0,0 +1,134 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef SIMD_SIMDLEVEL_HPP
+#define SIMD_SIMDLEVEL_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace simd
+{
+
+/**
+ * @enum SimdLevel
+ * @brief Instruction sets the kernels are compiled for, in increasing order.
+ */
+enum class SimdLevel : uint8_t
+{
+	Scalar,  // Portable C++, the reference of the other variants
+	Avx2,    // AVX2, FMA and F16C
+	Avx512   // AVX-512 F, BW, DQ and VL
+};
+
+/**
+ * @brief Converts a SimdLevel enum value to its string representation.
+ * @param level The SimdLevel enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(SimdLevel level)
+{
+	using namespace std::string_literals;
+
+	switch (level)
+	{
+	case SimdLevel::Scalar:
+		return "scalar"s;
+	case SimdLevel::Avx2:
+		return "avx2"s;
+	case SimdLevel::Avx512:
+		return "avx512"s;
+	}
+
+	throw std::domain_error("Invalid value for SimdLevel: " +
+	                        std::to_string(std::to_underlying(level)));
+}
+
+/**
+ * @brief Attempts to convert a string to a SimdLevel enum value.
+ * @param str The string to convert.
+ * @param level Reference to the SimdLevel enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, SimdLevel& level)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "scalar"sv)
+	{
+		level = SimdLevel::Scalar;
+		status = true;
+	}
+	else if (str == "avx2"sv)
+	{
+		level = SimdLevel::Avx2;
+		status = true;
+	}
+	else if (str == "avx512"sv)
+	{
+		level = SimdLevel::Avx512;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a SimdLevel enum value.
+ * @param value The integer value to convert.
+ * @param level Reference to the SimdLevel enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<SimdLevel> value,
+                                          SimdLevel& level)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(SimdLevel::Scalar):
+		level = SimdLevel::Scalar;
+		status = true;
+		break;
+	case std::to_underlying(SimdLevel::Avx2):
+		level = SimdLevel::Avx2;
+		status = true;
+		break;
+	case std::to_underlying(SimdLevel::Avx512):
+		level = SimdLevel::Avx512;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace simd
+
+/**
+ * @brief Specialization of the std::format for SimdLevel. Needed for logging
+ */
+template <>
+struct std::formatter<simd::SimdLevel>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const simd::SimdLevel& level, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", simd::to_string(level));
+	}
+};
+
+#endif  // SIMD_SIMDLEVEL_HPP
@@ -0,0 +1,64 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <atomic>
+
+#include "Simd/Dispatch.hpp"
+
+namespace simd
+{
+
+namespace
+{
+// Capped by the configuration or the tests, none by default
+std::atomic<SimdLevel> level_limit{SimdLevel::Avx512};
+
+// --------------------------------------------------------------------
+SimdLevel detect() noexcept
+{
+#if MEDSIMD_X86
+	// The checks include the support of the vector registers by the OS (XCR0)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+	    __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+	{
+		return SimdLevel::Avx512;
+	}
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+	    __builtin_cpu_supports("f16c"))
+	{
+		return SimdLevel::Avx2;
+	}
+#endif
+	return SimdLevel::Scalar;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+SimdLevel detectedLevel() noexcept
+{
+	static const SimdLevel detected = detect();
+	return detected;
+}
+
+// --------------------------------------------------------------------
+SimdLevel activeLevel() noexcept
+{
+	return std::min(detectedLevel(), level_limit.load(std::memory_order_relaxed));
+}
+
+// --------------------------------------------------------------------
+void limitLevel(SimdLevel level) noexcept
+{
+	level_limit.store(level, std::memory_order_relaxed);
+}
+
+}  // namespace simd
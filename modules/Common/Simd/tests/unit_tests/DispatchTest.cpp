@@ -0,0 +1,64 @@
+#include <catch2/catch_all.hpp>
+
+#include "Simd/Dispatch.hpp"
+
+using namespace simd;
+
+namespace
+{
+int scalarVariant()
+{
+	return 0;
+}
+
+int avx512Variant()
+{
+	return 2;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST_CASE("The levels convert to and from their names")
+{
+	for (const SimdLevel level : {SimdLevel::Scalar, SimdLevel::Avx2, SimdLevel::Avx512})
+	{
+		SimdLevel parsed{SimdLevel::Scalar};
+		CHECK(from_string(to_string(level), parsed));
+		CHECK(parsed == level);
+	}
+
+	SimdLevel parsed{SimdLevel::Scalar};
+	CHECK_FALSE(from_string("sse2", parsed));
+	CHECK_FALSE(from_integer(3, parsed));
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("A missing variant falls back on the level below it")
+{
+	const KernelVariants<int()> variants{.scalar = scalarVariant,
+	                                     .avx512 = avx512Variant};
+
+	CHECK(variants.levelFor(SimdLevel::Scalar) == SimdLevel::Scalar);
+	CHECK(variants.levelFor(SimdLevel::Avx2) == SimdLevel::Scalar);
+	CHECK(variants.levelFor(SimdLevel::Avx512) == SimdLevel::Avx512);
+	CHECK(variants.select(SimdLevel::Avx2)() == 0);
+	CHECK(variants.select(SimdLevel::Avx512)() == 2);
+}
+
+// --------------------------------------------------------------------
+
+TEST_CASE("The limit caps the detected level")
+{
+	const SimdLevel detected = detectedLevel();
+	CHECK(activeLevel() == detected);
+
+	limitLevel(SimdLevel::Scalar);
+	CHECK(activeLevel() == SimdLevel::Scalar);
+
+	limitLevel(SimdLevel::Avx512);
+	CHECK(activeLevel() == detected);
+}
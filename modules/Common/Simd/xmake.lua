@@ -0,0 +1,13 @@
+target("common_simd")
+    set_kind("shared")
+    add_includedirs("include", {public = true})
+    add_files("src/*.cpp")
+
+
+-- Unit test target
+target("common_simd_tests")
+    set_kind("binary")  
+    add_files("tests/unit_tests/*.cpp")
+    add_deps("common_simd") 
+    add_packages("catch2")
+    add_tests("default")
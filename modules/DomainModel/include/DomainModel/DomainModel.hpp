@@ -11,18 +11,38 @@
 #ifndef DOMAINMODEL_DOMAINMODEL_HPP
 #define DOMAINMODEL_DOMAINMODEL_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/FrameCache.hpp"
+#include "Frame/FrameStream.hpp"
+#include "Frame/PackedFrame.hpp"
+#include "Frame/SampleConverter.hpp"
+#include "Frame/StimulusAligner.hpp"
+#include "Frame/StimulusEvent.hpp"
+
+#include "DomainModelConfig.hpp"
+
 namespace domain_model
 {
 
 /**
  * \class DomainModel
  *
- * @brief To be filled once really implemented
+ * @brief Frames and events of the session. The most recent frames are cached in memory at
+ * the precision of their stream (see DomainModelConfig).
  */
 class DomainModel
 {
 public:
-	DomainModel() = default;
+	/**
+	 * @brief: Ctor
+	 * @throws std::invalid_argument if a stream or a precision is unknown
+	 */
+	explicit DomainModel(const DomainModelConfig& config);
 	~DomainModel() = default;
 
 	// Copy operations not allowed
@@ -32,7 +52,55 @@ public:
 	DomainModel(DomainModel&&) = default;
 	DomainModel& operator=(DomainModel&&) = default;
 
-	void storeData(int x);
+	/**
+	 * @brief Copy of the frame at the precision of its stream, as stored.
+	 */
+	[[nodiscard]] frame::PackedFrame pack(const frame::AcquisitionFrame& frame) const;
+
+	// Stores a frame packed by pack(), or recorded so
+	void storeData(frame::PackedFrame frame);
+
+	/**
+	 * @brief Frame of the cache, unpacked.
+	 * @return the frame, std::nullopt if it is not cached (anymore)
+	 */
+	[[nodiscard]] std::optional<frame::AcquisitionFrame> frame(frame::FrameStream stream,
+	                                                           uint64_t sequence) const;
+
+	// Precision of the stored frames of a stream
+	[[nodiscard]] frame::SamplePrecision precision(frame::FrameStream stream) const;
+
+	// Frames kept in memory
+	[[nodiscard]] const frame::FrameCache& cache() const { return _cache; }
+
+	// Stores the event next to the Doppler frame nearest to it, once that frame is known
+	void storeStimulus(const frame::StimulusEvent& event);
+
+	/**
+	 * @brief Stores the events still waiting for a later frame next to the last frame,
+	 * at the end of an acquisition. Events without any frame are kept.
+	 */
+	void endAcquisition();
+
+	// Events stored so far, in the order of their timestamps
+	[[nodiscard]] const std::vector<frame::AlignedStimulus>& stimuli() const
+	{
+		return _stimuli;
+	}
+
+private:
+	// Stores the events aligned by the last frame or event
+	void storeAligned();
+
+	// Logs the events stored from `first`
+	void logStored(std::size_t first) const;
+
+	// Converters of each stream, to its precision
+	std::vector<frame::SampleConverter> _converters;
+	frame::FrameCache _cache;
+
+	frame::StimulusAligner _aligner;
+	std::vector<frame::AlignedStimulus> _stimuli;
 };
 
 }  // namespace domain_model
@@ -16,7 +16,11 @@
 #include <caf/typed_actor.hpp>
 #include <caf/typed_actor_pointer.hpp>
 
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/FrameTypeIds.hpp"
+
 #include "DomainModel.hpp"
+#include "DomainModelConfig.hpp"
 
 namespace domain_model
 {
@@ -26,7 +30,11 @@ namespace domain_model
 // /!\ CAF requires the argument to be written without the cv qualifiers.
 struct domain_model_trait
 {
-	using signatures = caf::type_list<caf::result<void>(caf::publish_atom, int)>;
+	using signatures =
+	    caf::type_list<caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	                   caf::result<void>(caf::publish_atom, frame::PackedFrame),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent),
+	                   caf::result<void>(acq_stop)>;
 };
 
 // Definition of the statically typed actor
@@ -37,6 +45,13 @@ using domain_model_actor = caf::typed_actor<domain_model_trait>;
  *
  * @brief State class of the actor. Initialize the state of the actor and
  * provides the messaging behavior.
+ *
+ * Messages:
+ * - publish_atom + AcquisitionFrame: stores a frame, packed.
+ * - publish_atom + PackedFrame: stores a frame packed, e.g. replayed from a capture.
+ * - publish_atom + StimulusEvent: stores an event next to its nearest Doppler frame.
+ * - acq_stop: end of an acquisition, from the acquisition session. The events after
+ *   the last frame are stored next to it.
  */
 class domain_model_actor_state
 {
@@ -44,8 +59,11 @@ public:
 	/**
 	 * @brief: Ctor
 	 * @param: pointer to current actor
+	 * @param config storage of the frames
+	 * @throws std::invalid_argument if the configuration is invalid
 	 */
-	explicit domain_model_actor_state(domain_model_actor::pointer_view self);
+	domain_model_actor_state(domain_model_actor::pointer_view self,
+	                         const DomainModelConfig& config);
 
 	/**
 	 * @brief: Defines the callbacks upon message reception
@@ -0,0 +1,42 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef DOMAINMODEL_DOMAINMODELCONFIG_HPP
+#define DOMAINMODEL_DOMAINMODELCONFIG_HPP
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+namespace domain_model
+{
+
+/**
+ * \struct DomainModelConfig
+ *
+ * @brief Configuration of the storage of the frames, as read from the
+ * "icograph.domain-model" section of the CAF configuration file.
+ *
+ * - cache_megabytes: samples of the most recent frames kept in memory (0: none).
+ * - precisions: precision of the stored frames by stream name (see
+ *   frame::to_string(FrameStream)), one of "float32", "float16", "bfloat16", "int16"
+ *   (see frame::SamplePrecision). The frames are cached and recorded at this precision,
+ *   float32 for the streams not listed. The reduced precisions are lossy, opt-in only:
+ *   by default every stream is stored losslessly.
+ */
+struct DomainModelConfig
+{
+	uint32_t cache_megabytes = 1024;
+	std::map<std::string, std::string> precisions;
+};
+
+}  // namespace domain_model
+
+#endif  // DOMAINMODEL_DOMAINMODELCONFIG_HPP
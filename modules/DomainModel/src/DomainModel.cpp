@@ -9,6 +9,8 @@
  */
 
 #include <iostream>
+#include <stdexcept>
+#include <utility>
 
 #include "Logger/Logger.hpp"
 
@@ -17,9 +19,125 @@
 namespace domain_model
 {
 
-void DomainModel::storeData(int x)
+namespace
 {
-	MEDLOG_INFO("Storing frame {}", x);
+/**
+ * @brief Converters of each stream, in the order of frame::frame_streams.
+ * @throws std::invalid_argument if a stream or a precision is unknown
+ */
+std::vector<frame::SampleConverter> makeConverters(const DomainModelConfig& config)
+{
+	for (const auto& [name, precision] : config.precisions)
+	{
+		frame::FrameStream stream{frame::FrameStream::Doppler};
+		if (!from_string(name, stream))
+		{
+			throw std::invalid_argument("Invalid stream '" + name + "' of the storage");
+		}
+	}
+
+	std::vector<frame::SampleConverter> converters;
+	for (const frame::FrameStream stream : frame::frame_streams)
+	{
+		frame::SamplePrecision precision{frame::SamplePrecision::Float32};
+		const auto found = config.precisions.find(to_string(stream));
+		if (found != config.precisions.end() && !from_string(found->second, precision))
+		{
+			throw std::invalid_argument("Invalid storage precision '" + found->second +
+			                            "' of the " + to_string(stream) + " frames");
+		}
+		converters.emplace_back(precision);
+	}
+	return converters;
+}
+}  // namespace
+
+DomainModel::DomainModel(const DomainModelConfig& config)
+    : _converters(makeConverters(config)),
+      _cache(std::size_t{config.cache_megabytes} * 1024 * 1024)
+{
+}
+
+frame::PackedFrame DomainModel::pack(const frame::AcquisitionFrame& frame) const
+{
+	return _converters[std::to_underlying(frame.stream)].pack(frame);
+}
+
+void DomainModel::storeData(frame::PackedFrame frame)
+{
+	// Debug level: frames arrive at the acquisition rate
+	MEDLOG_DEBUG("Storing {} frame {}", frame.stream, frame.sequence);
+	bool aligned = false;
+	try
+	{
+		aligned = _aligner.addFrame(frame);
+	}
+	catch (const std::invalid_argument& e)
+	{
+		// Stored all the same, the events are aligned on the frames in order
+		MEDLOG_WARN("{} frame {} not indexed for the stimuli: {}", frame.stream,
+		            frame.sequence, e.what());
+	}
+	_cache.add(std::move(frame));
+	if (aligned)
+	{
+		storeAligned();
+	}
+}
+
+std::optional<frame::AcquisitionFrame> DomainModel::frame(frame::FrameStream stream,
+                                                          uint64_t sequence) const
+{
+	const frame::PackedFrame* cached = _cache.find(stream, sequence);
+	if (cached == nullptr)
+	{
+		return std::nullopt;
+	}
+	// Recorded frames keep the precision of their capture
+	return frame::SampleConverter(cached->precision).unpack(*cached);
+}
+
+frame::SamplePrecision DomainModel::precision(frame::FrameStream stream) const
+{
+	return _converters[std::to_underlying(stream)].precision();
+}
+
+void DomainModel::storeStimulus(const frame::StimulusEvent& event)
+{
+	if (_aligner.addEvent(event))
+	{
+		storeAligned();
+	}
+}
+
+void DomainModel::endAcquisition()
+{
+	const std::size_t first = _stimuli.size();
+	_aligner.flush(_stimuli);
+	logStored(first);
+	if (_aligner.pendingCount() > 0)
+	{
+		MEDLOG_WARN("{} stimulus events without any frame to align on",
+		            _aligner.pendingCount());
+	}
+}
+
+void DomainModel::storeAligned()
+{
+	const std::size_t first = _stimuli.size();
+	_aligner.takeAligned(_stimuli);
+	logStored(first);
+}
+
+void DomainModel::logStored(std::size_t first) const
+{
+	for (std::size_t i = first; i < _stimuli.size(); ++i)
+	{
+		const frame::AlignedStimulus& stimulus = _stimuli[i];
+		MEDLOG_INFO("Storing {} event {} on frame {} ({:+} us)", stimulus.event.source,
+		            stimulus.event.code, stimulus.frame_sequence,
+		            stimulus.offset() / 1000);
+	}
 }
 
 }  // namespace domain_model
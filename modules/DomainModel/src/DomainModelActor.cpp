@@ -8,19 +8,59 @@
  * Author: Alyson Roger <alyson.roger@iconeus.com>
  */
 
+#include <utility>
+
+#include "CAF/CustomActorIdentifier.hpp"
+#include "Frame/FrameStatistics.hpp"
+#include "Probe/Probe.hpp"
+#include "Recorder/MessageRecorder.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
 #include "DomainModel/DomainModelActor.hpp"
 
+MEDPROBE_SEMAPHORE(frame_stored);
+
 namespace domain_model
 {
 
-domain_model_actor_state::domain_model_actor_state(domain_model_actor::pointer_view self)
-    : _self(self), _model(std::make_unique<domain_model::DomainModel>()){};
+domain_model_actor_state::domain_model_actor_state(domain_model_actor::pointer_view self,
+                                                   const DomainModelConfig& config)
+    : _self(self), _model(std::make_unique<domain_model::DomainModel>(config)){};
 
 // --------------------------------------------------------------------
 
 domain_model_actor::behavior_type domain_model_actor_state::make_behavior()
 {
-	return {[this](caf::publish_atom, int x) { _model->storeData(x); }};
+	return {[this](caf::publish_atom, const frame::AcquisitionFrame& x)
+	        {
+		        MEDPROBE(frame_stored, x.sequence, medprobe::timestamp());
+		        frame::recordFrameArrival(frame::FrameStage::Stored, x);
+		        scheduler::HandlerTimer timer(_self->mailbox().size());
+		        // Recorded as stored: the capture holds as many frames per gigabyte as
+		        // the cache. Replayed by the handler below.
+		        frame::PackedFrame packed = _model->pack(x);
+		        recorder::capture(common_caf::custom_domain_model_actor_id,
+		                          _self->current_sender(), caf::publish_atom_v, packed);
+		        _model->storeData(std::move(packed));
+	        },
+	        [this](caf::publish_atom, frame::PackedFrame x)
+	        {
+		        recorder::capture(common_caf::custom_domain_model_actor_id,
+		                          _self->current_sender(), caf::publish_atom_v, x);
+		        _model->storeData(std::move(x));
+	        },
+	        [this](caf::publish_atom, const frame::StimulusEvent& x)
+	        {
+		        recorder::capture(common_caf::custom_domain_model_actor_id,
+		                          _self->current_sender(), caf::publish_atom_v, x);
+		        _model->storeStimulus(x);
+	        },
+	        [this](acq_stop)
+	        {
+		        recorder::capture(common_caf::custom_domain_model_actor_id,
+		                          _self->current_sender(), acq_stop_v);
+		        _model->endAcquisition();
+	        }};
 };
 
 }  // namespace domain_model
@@ -11,6 +11,9 @@
 #ifndef ECHOVIEWMODEL_ECHOVIEWER_HPP
 #define ECHOVIEWMODEL_ECHOVIEWER_HPP
 
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/StimulusEvent.hpp"
+
 namespace echo_view_model
 {
 
@@ -32,7 +35,10 @@ public:
 	EchoViewer(EchoViewer&&) = default;
 	EchoViewer& operator=(EchoViewer&&) = default;
 
-	void displayFrame(int x);
+	void displayFrame(const frame::AcquisitionFrame& frame);
+
+	// Marks the stimulus on the displayed timeline
+	void displayStimulus(const frame::StimulusEvent& event);
 };
 
 }  // namespace echo_view_model
@@ -16,6 +16,9 @@
 #include <caf/typed_actor.hpp>
 #include <caf/typed_actor_pointer.hpp>
 
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/FrameTypeIds.hpp"
+
 #include "EchoViewer.hpp"
 
 namespace echo_view_model
@@ -26,7 +29,10 @@ namespace echo_view_model
 // /!\ CAF requires the argument to be written without the cv qualifiers.
 struct echo_viewer_trait
 {
-	using signatures = caf::type_list<caf::result<void>(caf::publish_atom, int)>;
+	using signatures =
+	    caf::type_list<caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent),
+	                   caf::result<void>(acq_stop)>;
 };
 
 // Definition of the statically typed actor
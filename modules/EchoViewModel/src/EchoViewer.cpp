@@ -17,9 +17,16 @@
 namespace echo_view_model
 {
 
-void EchoViewer::displayFrame(int x)
+void EchoViewer::displayFrame(const frame::AcquisitionFrame& frame)
 {
-	MEDLOG_INFO("Display frame {}", x);
+	// Debug level: frames arrive at the acquisition rate
+	MEDLOG_DEBUG("Display {} frame {}", frame.stream, frame.sequence);
+}
+
+void EchoViewer::displayStimulus(const frame::StimulusEvent& event)
+{
+	MEDLOG_DEBUG("Display {} marker {} at {} ns", event.source, event.code,
+	             event.timestamp);
 }
 
 }  // namespace echo_view_model
@@ -8,8 +8,16 @@
  * Author: Alyson Roger <alyson.roger@iconeus.com>
  */
 
+#include "CAF/CustomActorIdentifier.hpp"
+#include "Frame/FrameStatistics.hpp"
+#include "Probe/Probe.hpp"
+#include "Recorder/MessageRecorder.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
 #include "EchoViewModel/EchoViewerActor.hpp"
 
+MEDPROBE_SEMAPHORE(frame_displayed);
+
 namespace echo_view_model
 {
 
@@ -20,7 +28,26 @@ echo_viewer_actor_state::echo_viewer_actor_state(echo_viewer_actor::pointer_view
 
 echo_viewer_actor::behavior_type echo_viewer_actor_state::make_behavior()
 {
-	return {[this](caf::publish_atom, int x) { _viewer->displayFrame(x); }};
+	return {[this](caf::publish_atom, const frame::AcquisitionFrame& x)
+	        {
+		        recorder::capture(common_caf::custom_echo_viewer_actor_id,
+		                          _self->current_sender(), caf::publish_atom_v, x);
+		        MEDPROBE(frame_displayed, x.sequence, medprobe::timestamp());
+		        frame::recordFrameArrival(frame::FrameStage::Displayed, x);
+		        scheduler::HandlerTimer timer(_self->mailbox().size());
+		        _viewer->displayFrame(x);
+	        },
+	        [this](caf::publish_atom, const frame::StimulusEvent& x)
+	        {
+		        recorder::capture(common_caf::custom_echo_viewer_actor_id,
+		                          _self->current_sender(), caf::publish_atom_v, x);
+		        _viewer->displayStimulus(x);
+	        },
+	        [](acq_stop)
+	        {
+		        // The stimuli are displayed as they come: nothing is left at the end of
+		        // an acquisition
+	        }};
 };
 
 }  // namespace echo_view_model
@@ -2,6 +2,11 @@ target("echo_view_model")
     set_kind("shared")
     add_files("src/*.cpp")
     add_includedirs("include", {public = true})
+    add_deps("acquisition_module")
     add_deps("common_caf")
+    add_deps("common_frame")
     add_deps("common_logger")
+    add_deps("common_scheduler")
+    add_deps("common_recorder")
+    add_deps("common_probe")
 
@@ -0,0 +1,223 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_ACTIVATIONMAP_HPP
+#define PROCESSINGMODULE_ACTIVATIONMAP_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Frame/Frame.hpp"
+#include "Frame/StimulusEvent.hpp"
+#include "Simd/SimdLevel.hpp"
+
+namespace processing
+{
+
+using namespace std::chrono_literals;
+
+/**
+ * \struct ActivationMapConfig
+ *
+ * @brief Activation maps of the power Doppler images against the stimuli of the
+ * paradigm. Read from the "icograph.processing.activation-map" section of the CAF
+ * configuration file.
+ */
+struct ActivationMapConfig
+{
+	bool enabled = false;
+
+	// Events of the stimuli: "paradigm" or "trigger" (see frame::StimulusSource)
+	std::string source = "paradigm";
+	// Duration of a stimulus from its event, 0 for a stimulus lasting until the next
+	// event of code 0
+	std::chrono::nanoseconds stimulus_duration = 0ns;
+	// Peak of the hemodynamic response to a stimulus, 0 for the stimuli as they are
+	std::chrono::nanoseconds response_peak = 2s;
+	// Linear drift of the pixels fitted along with the response
+	bool detrend = true;
+	// Images between two maps published
+	uint32_t period = 10;
+};
+
+/**
+ * \class StimulusRegressor
+ *
+ * @brief Expected response of the pixels to the stimuli of a paradigm, the regressor of
+ * the activation maps: the stimuli (1 while on, 0 while off) convolved with a gamma
+ * hemodynamic response of unit area, so that the response to a long stimulus reaches 1.
+ *
+ * A stimulus starts at an event of the source of a non-zero code and stops at the next
+ * event of code 0, or after its duration if set. The response at an instant is the sum,
+ * over the stimuli, of the integral of the hemodynamic response from the start to the
+ * stop of the stimulus: closed form, whatever the rate of the images. The stimuli whose
+ * response has ended are forgotten.
+ */
+class StimulusRegressor
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param source events of the stimuli, the others are ignored
+	 * @param duration of a stimulus from its event, 0 until the next event of code 0
+	 * @param peak of the hemodynamic response, 0 for the stimuli as they are
+	 * @throws std::invalid_argument if the duration or the peak is negative
+	 */
+	StimulusRegressor(frame::StimulusSource source,
+	                  std::chrono::nanoseconds duration,
+	                  std::chrono::nanoseconds peak);
+
+	// Adds an event: starts or stops a stimulus if of the source
+	void addEvent(const frame::StimulusEvent& event);
+
+	/**
+	 * @brief Expected response at an instant, on the clock of the events. The instants
+	 * must not decrease: the stimuli whose response has ended before are forgotten.
+	 */
+	[[nodiscard]] double valueAt(int64_t timestamp);
+
+private:
+	// Stimulus from its start to its stop, in ns
+	struct Stimulus
+	{
+		int64_t start = 0;
+		int64_t stop = 0;
+	};
+
+	// Integral of the hemodynamic response over [0, elapsed] ns
+	[[nodiscard]] double responseIntegral(int64_t elapsed) const;
+
+	frame::StimulusSource _source;
+	int64_t _duration;
+	// Scale of the gamma response in ns, 0 for none
+	double _scale;
+	// Elapsed time after which the response to a stimulus has ended
+	int64_t _support;
+
+	std::vector<Stimulus> _stimuli;
+	// Whether the last stimulus lasts until an event of code 0
+	bool _open{false};
+};
+
+/**
+ * \class ActivationMap
+ *
+ * @brief General linear model of each pixel of a series of images (one float per pixel,
+ * depth first) on a stimulus regressor, with an intercept and, if detrended, a linear
+ * drift. The images update the sufficient statistics of the model in place, the cross
+ * products of the pixels with the regressors and their sums of squares, in double
+ * precision and relative to the first image. The map of the series is solved from them
+ * at any time, for the same cost whatever the length of the series.
+ *
+ * Each pixel of a map holds the t statistic of the stimulus regressor (images - number
+ * of regressors degrees of freedom), the partial correlation of the pixel with it, and
+ * the relative change of the pixel for a regressor of 1 (slope / mean of the pixel). A
+ * map is all zeros while the regressors do not determine the model: fewer images than
+ * regressors, no stimulus yet.
+ *
+ * The updates run on chunks of pixels, in parallel on the shared task pool, and are
+ * vectorized along the pixels; the kernel of the chunks is compiled for AVX2 and AVX-512
+ * too, the variant of the machine is selected when the map is built.
+ */
+class ActivationMap
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param depth pixels of a column
+	 * @param lateral columns of an image
+	 * @param detrend whether a linear drift is fitted along with the stimulus
+	 * @throws std::invalid_argument if the images are empty
+	 */
+	ActivationMap(uint32_t depth, uint32_t lateral, bool detrend);
+
+	/**
+	 * @brief Adds an image to the series.
+	 * @param image pixels of the image
+	 * @param stimulus value of the stimulus regressor for the image
+	 * @param time of the image in seconds, the drift regressor
+	 * @throws std::invalid_argument if the image does not have the pixels of the series
+	 */
+	void add(const frame::Frame<const float, frame::Interleaved<1>>& image,
+	         double stimulus,
+	         double time);
+
+	/**
+	 * @brief Writes the t statistic, the partial correlation and the relative change of
+	 * each pixel with the stimulus, over the series.
+	 * @throws std::invalid_argument if the frame does not have the pixels of the series
+	 */
+	void map(const frame::Frame<float, frame::Interleaved<3>>& out) const;
+
+	// Forgets the images added so far
+	void reset();
+
+	// Images of the series
+	[[nodiscard]] uint64_t count() const { return _count; }
+
+	// Instruction set of the kernel of the chunks
+	[[nodiscard]] simd::SimdLevel simdLevel() const { return _simdLevel; }
+
+	/**
+	 * \struct Update
+	 *
+	 * @brief Arguments of the kernel of the chunks (see ActivationMap.cpp): the image
+	 * added, its regressors and the statistics of the pixels.
+	 */
+	struct Update
+	{
+		const float* image = nullptr;
+		const float* reference = nullptr;
+		double stimulus = 0.0;
+		double time = 0.0;
+		// Sums of the pixels, and of their products with the stimulus and the drift
+		// (none if not detrended)
+		double* sums = nullptr;
+		double* stimulusProducts = nullptr;
+		double* timeProducts = nullptr;
+		double* squares = nullptr;
+	};
+
+	// Kernel of the chunks: statistics, first pixel and pixels of the chunk
+	using UpdateChunk = void(const Update&, std::size_t, std::size_t);
+
+	// Intercept, stimulus and drift
+	static constexpr std::size_t max_regressors = 3;
+
+private:
+	// Checks the dimensions of an image or of a map
+	void checkShape(uint32_t depth, uint32_t lateral) const;
+
+	uint32_t _depth;
+	uint32_t _lateral;
+	std::size_t _pixels;
+	std::size_t _regressors;
+
+	simd::SimdLevel _simdLevel;
+	UpdateChunk* _updateChunk;
+
+	uint64_t _count{0};
+	// Cross products of the regressors [row][column]
+	double _gram[max_regressors][max_regressors]{};
+
+	// First image of the series, the pixels are accumulated relative to it
+	std::vector<float> _reference;
+	std::vector<double> _sums;
+	std::vector<double> _stimulusProducts;
+	std::vector<double> _timeProducts;
+	std::vector<double> _squares;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_ACTIVATIONMAP_HPP
@@ -0,0 +1,137 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_ACTIVATIONMAPACTOR_HPP
+#define PROCESSINGMODULE_ACTIVATIONMAPACTOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <caf/actor.hpp>
+#include <caf/result.hpp>
+#include <caf/type_list.hpp>
+#include <caf/typed_actor.hpp>
+#include <caf/typed_actor_pointer.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/SampleBufferPool.hpp"
+#include "Frame/StimulusEvent.hpp"
+
+#include "ActivationMap.hpp"
+
+namespace processing
+{
+
+// Definition of the messaging interface of the activation map stage necessary to create
+// the statically typed actor. The subscriptions are those of the acquisition session.
+// /!\ CAF requires the argument to be written without the cv qualifiers.
+struct activation_map_trait
+{
+	using signatures =
+	    caf::type_list<caf::result<void>(acq_start, acq_module::AcquisitionParameters),
+	                   caf::result<void>(acq_subscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(acq_unsubscribe, frame::FrameStream, caf::actor),
+	                   caf::result<frame::AcquisitionFrame>(caf::get_atom),
+	                   caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent)>;
+};
+
+// Definition of the statically typed actor
+using activation_map_actor = caf::typed_actor<activation_map_trait>;
+
+/**
+ * \class activation_map_state
+ *
+ * @brief State of the stage computing the activation maps of the power Doppler images
+ * against the stimuli of the paradigm (see ActivationMap and StimulusRegressor). The
+ * stage subscribes to the denoising stage for the images, and to the Doppler stream of
+ * the power Doppler stage for the stimulus events, which carries the events of its
+ * source without the frames. Each image updates the statistics of the maps; a map is
+ * solved from them every `period` images for the consumers of the Activation stream, or
+ * when requested.
+ *
+ * The regressor of an image is computed from the events received before it: the events
+ * reach the stage before the images computed from the frames around them, which go
+ * through the denoising stage.
+ *
+ * The maps restart with each acquisition, and when the geometry of the images changes.
+ * The stimuli of the paradigm carry over from one acquisition to the next. The images
+ * are skipped while the processing falls behind (see stageQuality()).
+ *
+ * Messages:
+ * - acq_start: restarts the maps for the next acquisition.
+ * - acq_subscribe: publishes the maps to an actor.
+ * - acq_unsubscribe: stops publishing the maps to an actor.
+ * - get_atom: returns the map of the images so far, numbered as the last map published.
+ *   Fails before the first image.
+ * - publish_atom + AcquisitionFrame: power Doppler image, from the source.
+ * - publish_atom + StimulusEvent: event of the paradigm, from the power Doppler stage.
+ */
+class activation_map_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: stage providing the power Doppler images, the denoising stage
+	 * @param: power Doppler stage forwarding the stimulus events of its Doppler frames
+	 * @param: paradigm and model of the maps
+	 * @throws std::invalid_argument if the source of the stimuli is unknown
+	 */
+	activation_map_state(activation_map_actor::pointer_view self,
+	                     caf::actor source,
+	                     caf::actor events,
+	                     ActivationMapConfig cfg);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	activation_map_actor::behavior_type make_behavior();
+
+private:
+	void subscribe(frame::FrameStream stream, caf::actor subscriber);
+	void unsubscribe(frame::FrameStream stream, const caf::actor& subscriber);
+
+	// Adds an image to the maps, then publishes a map if due
+	void process(const frame::AcquisitionFrame& image);
+
+	// Solves the map of the images so far into a frame, none if all the buffers are in
+	// use
+	[[nodiscard]] std::optional<frame::AcquisitionFrame> solve(uint64_t sequence);
+
+	// Ptr to current actor
+	activation_map_actor::pointer_view _self;
+
+	caf::actor _source;
+	caf::actor _events;
+	ActivationMapConfig _cfg;
+	StimulusRegressor _regressor;
+
+	// Consumers of the maps
+	std::vector<caf::actor> _subscribers;
+
+	// Maps of the current geometry, none before the first image
+	std::optional<ActivationMap> _activation;
+	frame::FrameGeometry _geometry;
+	int64_t _firstTimestamp{0};
+	int64_t _lastTimestamp{0};
+	std::unique_ptr<frame::SampleBufferPool> _pool;
+
+	// Images since the last map published, and maps published
+	uint32_t _sinceMap{0};
+	uint64_t _published{0};
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_ACTIVATIONMAPACTOR_HPP
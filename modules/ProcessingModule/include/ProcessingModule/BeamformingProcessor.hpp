@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_BEAMFORMINGPROCESSOR_HPP
+#define PROCESSINGMODULE_BEAMFORMINGPROCESSOR_HPP
+
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "AcquisitionModule/AcquisitionParameters.hpp"
+#include "AcquisitionModule/SequenceCache.hpp"
+#include "Frame/SampleBufferPool.hpp"
+
+#include "DelayAndSumBeamformer.hpp"
+#include "FrameProcessor.hpp"
+
+namespace processing
+{
+
+/**
+ * \class BeamformerCache
+ *
+ * @brief Beamformers of the sequences met so far, by hash of their parameters: the tables
+ * of a sequence are computed once and shared by the workers of the farm. The compiled
+ * sequences come from a SequenceCache, on the directory of the acquisition session to
+ * reuse the sequences it has compiled. Thread-safe.
+ */
+class BeamformerCache
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param directory of the compiled sequences (see SequenceCache), empty for a cache
+	 * in memory only
+	 */
+	explicit BeamformerCache(std::filesystem::path directory = {});
+
+	/**
+	 * @brief Returns the beamformer of the sequence, computed if it is not cached.
+	 * @throws std::invalid_argument if the parameters cannot describe a sequence
+	 */
+	std::shared_ptr<const DelayAndSumBeamformer> get(
+	    const acq_module::AcquisitionParameters& parameters);
+
+private:
+	// Beamformer of a sequence, with the parameters to tell a hash collision
+	struct Entry
+	{
+		acq_module::AcquisitionParameters parameters;
+		std::shared_ptr<const DelayAndSumBeamformer> beamformer;
+	};
+
+	std::mutex _mutex;
+	acq_module::SequenceCache _sequences;
+	// Keyed by hash: a collision replaces the beamformer, as in the SequenceCache
+	std::unordered_map<uint64_t, Entry> _beamformers;
+};
+
+/**
+ * \class BeamformingProcessor
+ *
+ * @brief Beamforms the raw RF frames into IQ images with the beamformer of the current
+ * sequence. The n-th frame of a stream is the plane wave n modulo the angles of the
+ * sequence; its image keeps the sequence of the frame, the images of an ensemble are
+ * compounded afterwards (see PlaneWaveCompounder). The frames already beamformed are
+ * published as they are.
+ */
+class BeamformingProcessor : public FrameProcessor
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param cache beamformers shared with the other workers
+	 */
+	explicit BeamformingProcessor(std::shared_ptr<BeamformerCache> cache);
+
+	/**
+	 * @throws std::runtime_error if an RF frame arrives before the sequence, or if all
+	 * the image buffers are held downstream
+	 * @throws std::invalid_argument if an RF frame does not match the sequence
+	 */
+	[[nodiscard]] frame::AcquisitionFrame process(
+	    const frame::AcquisitionFrame& frame) override;
+
+	void setSequence(const acq_module::AcquisitionParameters& parameters) override;
+
+private:
+	std::shared_ptr<BeamformerCache> _cache;
+	std::shared_ptr<const DelayAndSumBeamformer> _beamformer;
+
+	// Buffers of the IQ images, sized for the current sequence
+	std::unique_ptr<frame::SampleBufferPool> _pool;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_BEAMFORMINGPROCESSOR_HPP
@@ -0,0 +1,105 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_COMPOUNDINGACTOR_HPP
+#define PROCESSINGMODULE_COMPOUNDINGACTOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <caf/actor.hpp>
+#include <caf/result.hpp>
+#include <caf/type_list.hpp>
+#include <caf/typed_actor.hpp>
+#include <caf/typed_actor_pointer.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameStream.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/StimulusEvent.hpp"
+
+#include "PlaneWaveCompounder.hpp"
+#include "ProcessingFarmActor.hpp"
+
+namespace processing
+{
+
+// Definition of the messaging interface of the compounding stage necessary to create the
+// statically typed actor. The subscriptions are those of the acquisition session.
+// /!\ CAF requires the argument to be written without the cv qualifiers.
+struct compounding_trait
+{
+	using signatures =
+	    caf::type_list<caf::result<void>(acq_start, acq_module::AcquisitionParameters),
+	                   caf::result<void>(acq_subscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(acq_unsubscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent)>;
+};
+
+// Definition of the statically typed actor
+using compounding_actor = caf::typed_actor<compounding_trait>;
+
+/**
+ * \class compounding_state
+ *
+ * @brief State of the compounding stage, between the processing farm and the consumers
+ * of the frames. The consumers subscribe to the stage as they would to the session; the
+ * stage subscribes to the farm for the streams which have consumers.
+ *
+ * The images of the plane waves beamformed by the farm are compounded per ensemble of
+ * the sequence (see PlaneWaveCompounder) and published as compounded IQ frames, one per
+ * ensemble. The other frames, and the stimulus events, are forwarded as they are.
+ *
+ * Messages:
+ * - acq_start: takes the angles of the sequence, then passes it on to the farm.
+ * - acq_subscribe: publishes the frames of a stream to an actor.
+ * - acq_unsubscribe: stops publishing the frames of a stream to an actor.
+ * - publish_atom + AcquisitionFrame: frame processed by the farm.
+ * - publish_atom + StimulusEvent: event forwarded by the farm.
+ */
+class compounding_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: processing farm beamforming the plane waves
+	 */
+	compounding_state(compounding_actor::pointer_view self, processing_farm_actor source);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	compounding_actor::behavior_type make_behavior();
+
+private:
+	void subscribe(frame::FrameStream stream, caf::actor subscriber);
+	void unsubscribe(frame::FrameStream stream, const caf::actor& subscriber);
+
+	// Publishes a frame to the consumers of its stream
+	void publish(const frame::AcquisitionFrame& frame);
+
+	// Ptr to current actor
+	compounding_actor::pointer_view _self;
+
+	processing_farm_actor _source;
+
+	PlaneWaveCompounder _compounder;
+	std::vector<frame::AcquisitionFrame> _compounded;
+
+	// Consumers of the frames of each stream
+	std::array<std::vector<caf::actor>, frame::frame_stream_count> _subscribers;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_COMPOUNDINGACTOR_HPP
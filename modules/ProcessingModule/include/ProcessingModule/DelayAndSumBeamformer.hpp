@@ -0,0 +1,131 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_DELAYANDSUMBEAMFORMER_HPP
+#define PROCESSINGMODULE_DELAYANDSUMBEAMFORMER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "AcquisitionModule/SequenceCache.hpp"
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/Frame.hpp"
+#include "Simd/SimdLevel.hpp"
+
+namespace processing
+{
+
+/**
+ * \class DelayAndSumBeamformer
+ *
+ * @brief Delay-and-sum beamforming of the plane waves of a sequence: one image line under
+ * each element, one pixel per depth sample. A pixel sums the RF samples of the elements
+ * of its aperture (F-number) at their round trip delay, weighted by the apodization of
+ * the sequence.
+ *
+ * The delay and apodization tables are computed once, from the compiled sequence, and
+ * shared by the frames: transmit delays per angle, line and depth, receive delays per
+ * depth and offset to the line. The beamformer is immutable and can be shared between
+ * threads.
+ *
+ * The RF carrier is expected at fs / 4: the sample after the delay is in quadrature, the
+ * pair gives the IQ of the pixel without demodulation. The pixels keep the phase of the
+ * carrier at their delay, the same from one frame to the next.
+ *
+ * Vectorized across the elements (AVX2 or AVX-512 gathers, the best the CPU supports,
+ * selected when the beamformer is built), parallel across the lines on the shared task
+ * pool.
+ */
+class DelayAndSumBeamformer
+{
+public:
+	/**
+	 * @brief: Ctor. Computes the tables.
+	 * @param sequence compiled sequence of the acquisition
+	 * @param fNumber depth over width of the receive aperture
+	 */
+	explicit DelayAndSumBeamformer(const acq_module::CompiledSequence& sequence,
+	                               float fNumber = 1.0f);
+
+	/**
+	 * @brief Beamforms the RF samples of one plane wave.
+	 * @param rf samples of the elements, a column per element (see inputGeometry())
+	 * @param angle index of the plane wave in the sequence
+	 * @param iq receives the pixels (see outputGeometry())
+	 * @throws std::invalid_argument if a dimension or the angle does not match the
+	 * sequence
+	 */
+	void beamform(const frame::Frame<const float, frame::Interleaved<1>>& rf,
+	              uint32_t angle,
+	              const frame::Frame<float, frame::Interleaved<2>>& iq) const;
+
+	// RF frames accepted, and IQ images produced
+	[[nodiscard]] frame::FrameGeometry inputGeometry() const;
+	[[nodiscard]] frame::FrameGeometry outputGeometry() const;
+
+	[[nodiscard]] uint32_t angleCount() const { return _angles; }
+
+	// Instruction set of the sums of the pixels
+	[[nodiscard]] simd::SimdLevel simdLevel() const { return _simdLevel; }
+
+	/**
+	 * @brief Weighted sums of the samples of the elements at the delays of a pixel, and
+	 * of the samples following them (in quadrature).
+	 */
+	struct PixelSums
+	{
+		float sum = 0.0f;
+		float quadrature = 0.0f;
+	};
+
+	// Sums of a pixel over the elements [first, last): RF frame, receive delays,
+	// apodization and channel offsets by element, transmit delay, last sample, first and
+	// last elements
+	using PixelSumFunction = PixelSums(const float*,
+	                                   const float*,
+	                                   const float*,
+	                                   const int32_t*,
+	                                   float,
+	                                   int32_t,
+	                                   std::size_t,
+	                                   std::size_t);
+
+private:
+	// Beamforms the lines [first, last)
+	void beamformLines(const float* rf,
+	                   uint32_t angle,
+	                   std::size_t first,
+	                   std::size_t last,
+	                   float* iq) const;
+
+	uint32_t _angles;
+	uint32_t _elements;
+	uint32_t _depth;
+
+	simd::SimdLevel _simdLevel;
+	PixelSumFunction* _sumPixel;
+
+	// Transmit delay of the pixels, in samples [angle][line][depth]
+	std::vector<float> _transmitDelays;
+	// Receive delay of the pixels, in samples [depth][offset + elements - 1], the offset
+	// from the line to the element going from -(elements - 1) to elements - 1
+	std::vector<float> _receiveDelays;
+	// Elements on each side of the line in the aperture [depth]
+	std::vector<uint32_t> _halfApertures;
+	// Receive weight [element]
+	std::vector<float> _apodization;
+	// Index of the first sample of each element in the RF frame [element]
+	std::vector<int32_t> _channelOffsets;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_DELAYANDSUMBEAMFORMER_HPP
@@ -0,0 +1,82 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_FRAMEPROCESSOR_HPP
+#define PROCESSINGMODULE_FRAMEPROCESSOR_HPP
+
+#include <functional>
+#include <memory>
+
+#include "AcquisitionModule/AcquisitionParameters.hpp"
+#include "Frame/AcquisitionFrame.hpp"
+
+namespace processing
+{
+
+/**
+ * \class FrameProcessor
+ *
+ * @brief Processing applied to each frame by a worker of the farm. Each worker owns its
+ * processor: the scratch buffers of an implementation are not shared, but consecutive
+ * frames of a stream may be processed by different workers.
+ */
+class FrameProcessor
+{
+public:
+	// Ctor
+	FrameProcessor() = default;
+
+	// Dtor
+	virtual ~FrameProcessor() = default;
+
+	// Do not allow other types of ctor/assignment operators
+	FrameProcessor(const FrameProcessor&) = delete;
+	FrameProcessor& operator=(const FrameProcessor&) = delete;
+	FrameProcessor(FrameProcessor&&) = delete;
+	FrameProcessor& operator=(FrameProcessor&&) = delete;
+
+	/**
+	 * @brief Processes a frame. The samples of the input are shared with the other
+	 * consumers and must not be modified.
+	 * @return the processed frame, with the sequence, timestamp and stream of the input
+	 * @throws std::exception if the frame cannot be processed, the frame is dropped
+	 */
+	[[nodiscard]] virtual frame::AcquisitionFrame process(
+	    const frame::AcquisitionFrame& frame) = 0;
+
+	/**
+	 * @brief Sequence of the frames of the next acquisition, received before its first
+	 * frame.
+	 * @throws std::exception if the processor cannot handle the sequence
+	 */
+	virtual void setSequence(const acq_module::AcquisitionParameters& /*parameters*/) {}
+};
+
+/**
+ * \class PassThroughProcessor
+ *
+ * @brief Publishes the frames as acquired.
+ */
+class PassThroughProcessor : public FrameProcessor
+{
+public:
+	[[nodiscard]] frame::AcquisitionFrame process(
+	    const frame::AcquisitionFrame& frame) override
+	{
+		return frame;
+	}
+};
+
+// Creates the processor of a worker
+using ProcessorFactory = std::function<std::unique_ptr<FrameProcessor>()>;
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_FRAMEPROCESSOR_HPP
@@ -0,0 +1,140 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_LOADSHEDDING_HPP
+#define PROCESSINGMODULE_LOADSHEDDING_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "Frame/AcquisitionFrame.hpp"
+
+#include "QualityLevel.hpp"
+
+namespace processing
+{
+
+using namespace std::chrono_literals;
+
+/**
+ * \struct LoadSheddingConfig
+ *
+ * @brief Thresholds and degradations of the load shedding of the processing farm. Read
+ * from the "icograph.processing.load-shedding" section of the CAF configuration file.
+ */
+struct LoadSheddingConfig
+{
+	bool enabled = false;
+
+	// Sampling period of the backlog and of the latency
+	std::chrono::nanoseconds period = 200ms;
+
+	// Deepest degradation used, see QualityLevel
+	std::string max_level = "reduced-rate";
+
+	// Frames waiting or in flight in the farm, or waiting for one of the stages after
+	// it, above which the processing falls behind
+	uint32_t max_backlog = 32;
+
+	// Acquisition to publication latency above which the farm falls behind
+	std::chrono::nanoseconds max_latency = 100ms;
+
+	// Consecutive quiet samples before stepping back up
+	uint32_t recovery_samples = 5;
+
+	// Decimation of the power Doppler images from QualityLevel::ReducedResolution
+	uint32_t resolution_step = 2;
+
+	// One ensemble in `rate_step` is processed from QualityLevel::ReducedRate
+	uint32_t rate_step = 2;
+};
+
+/**
+ * \class LoadSheddingPolicy
+ *
+ * @brief Decides the quality level of the farm from its load. Steps down one level as
+ * soon as the backlog or the latency exceeds its threshold, steps back up one level
+ * after `recovery_samples` consecutive samples well below both (a quarter of the
+ * backlog, half of the latency) so that the level does not oscillate around them.
+ */
+class LoadSheddingPolicy
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param cfg thresholds of the load shedding
+	 * @param maxLevel deepest degradation used
+	 */
+	LoadSheddingPolicy(const LoadSheddingConfig& cfg, QualityLevel maxLevel);
+
+	/**
+	 * @brief Computes the next level.
+	 * @param backlog frames waiting or in flight
+	 * @param latency highest acquisition to publication latency of the last period
+	 * @return the level to apply, unchanged if no decision is taken
+	 */
+	QualityLevel update(std::size_t backlog, std::chrono::nanoseconds latency);
+
+	[[nodiscard]] QualityLevel level() const { return _level; }
+
+private:
+	LoadSheddingConfig _cfg;
+	QualityLevel _maxLevel;
+	QualityLevel _level{QualityLevel::Full};
+	uint32_t _quietCount{0};
+};
+
+/**
+ * \struct StageQuality
+ *
+ * @brief Quality applied by the stages after the processing farm: the power Doppler,
+ * the spatial filter, the pixel statistics and the activation maps.
+ */
+struct StageQuality
+{
+	QualityLevel level = QualityLevel::Full;
+	// Decimation of the power Doppler images, 1 for the full resolution
+	uint32_t resolution_step = 1;
+};
+
+/**
+ * @brief Sets the quality of the stages after the farm, from their next frame on. Set
+ * by the load shedding of the farm, lock-free.
+ */
+void setStageQuality(StageQuality quality);
+
+// Quality of the stages after the farm, full until set. Lock-free.
+[[nodiscard]] StageQuality stageQuality();
+
+/**
+ * @brief Records the frames waiting in the mailbox of a stage after the farm when it
+ * receives a frame. Lock-free, callable from any actor.
+ */
+void recordStageBacklog(std::size_t depth);
+
+/**
+ * @brief Returns the most frames seen waiting for a stage after the farm since the
+ * previous call, and starts a new window.
+ */
+[[nodiscard]] std::size_t takeStageBacklog();
+
+/**
+ * @brief Decimates a frame by `step` in depth and, except for the RF frames, laterally.
+ * The sequence, timestamp, stream and kind are kept.
+ * @return the decimated frame in a new buffer, the frame itself if `step` is below 2
+ */
+[[nodiscard]] frame::AcquisitionFrame reduceResolution(
+    const frame::AcquisitionFrame& frame, uint32_t step);
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_LOADSHEDDING_HPP
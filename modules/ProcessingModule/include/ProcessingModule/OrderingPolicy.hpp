@@ -0,0 +1,122 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_ORDERINGPOLICY_HPP
+#define PROCESSINGMODULE_ORDERINGPOLICY_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace processing
+{
+
+/**
+ * @enum OrderingPolicy
+ * @brief Order of delivery of the frames processed in parallel.
+ */
+enum class OrderingPolicy : uint8_t
+{
+	Strict,     // Every frame, in the order of the acquisition
+	LatestWins  // As soon as processed, the frames overtaken by a newer one are dropped
+};
+
+/**
+ * @brief Converts an OrderingPolicy enum value to its string representation.
+ * @param policy The OrderingPolicy enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(OrderingPolicy policy)
+{
+	using namespace std::string_literals;
+
+	switch (policy)
+	{
+	case OrderingPolicy::Strict:
+		return "strict"s;
+	case OrderingPolicy::LatestWins:
+		return "latest-wins"s;
+	}
+
+	throw std::domain_error("Invalid value for OrderingPolicy: " +
+	                        std::to_string(std::to_underlying(policy)));
+}
+
+/**
+ * @brief Attempts to convert a string to an OrderingPolicy enum value.
+ * @param str The string to convert.
+ * @param policy Reference to the OrderingPolicy enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, OrderingPolicy& policy)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "strict"sv)
+	{
+		policy = OrderingPolicy::Strict;
+		status = true;
+	}
+	else if (str == "latest-wins"sv)
+	{
+		policy = OrderingPolicy::LatestWins;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to an OrderingPolicy enum value.
+ * @param value The integer value to convert.
+ * @param policy Reference to the OrderingPolicy enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<OrderingPolicy> value,
+                                          OrderingPolicy& policy)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(OrderingPolicy::Strict):
+		policy = OrderingPolicy::Strict;
+		status = true;
+		break;
+	case std::to_underlying(OrderingPolicy::LatestWins):
+		policy = OrderingPolicy::LatestWins;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace processing
+
+/**
+ * @brief Specialization of the std::format for OrderingPolicy. Needed for logging
+ */
+template <>
+struct std::formatter<processing::OrderingPolicy>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const processing::OrderingPolicy& policy, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", processing::to_string(policy));
+	}
+};
+
+#endif  // PROCESSINGMODULE_ORDERINGPOLICY_HPP
@@ -0,0 +1,168 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_PIXELSTATISTICS_HPP
+#define PROCESSINGMODULE_PIXELSTATISTICS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Frame/Frame.hpp"
+#include "Simd/SimdLevel.hpp"
+
+namespace processing
+{
+
+/**
+ * \struct PixelStatisticsConfig
+ *
+ * @brief Statistics of the pixels of the power Doppler images. Read from the
+ * "icograph.processing.pixel-statistics" section of the CAF configuration file.
+ */
+struct PixelStatisticsConfig
+{
+	bool enabled = false;
+
+	// Images of the sliding window, the baseline of the relative maps and z-scores
+	uint32_t window = 100;
+};
+
+/**
+ * \class PixelStatistics
+ *
+ * @brief Mean, variance, min and max of each pixel of a series of images of a geometry
+ * (one float per pixel, depth first), over the whole series and over a sliding window of
+ * the last images. Adding an image costs the same whatever the length of the series: the
+ * statistics are updated in place, never recomputed from the history.
+ *
+ * - Mean and variance: Welford's updates in double precision, the window replacing its
+ *   oldest image by the new one in a single update once full.
+ * - Min and max of the window: the window is split in two stacks. The newest images are
+ *   folded into a running min and max; the oldest ones keep the min and max of each
+ *   suffix, computed when the older stack runs out, once every `window` images.
+ *
+ * The window holds its images and their suffix min and max: 3 x window x pixels floats.
+ * The updates run on chunks of pixels, in parallel on the shared task pool, and are
+ * vectorized along the pixels; the kernel of the chunks is compiled for AVX2 and AVX-512
+ * too, the variant of the machine is selected when the statistics are built.
+ */
+class PixelStatistics
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param window images of the sliding window
+	 * @param depth pixels of a column
+	 * @param lateral columns of an image
+	 * @throws std::invalid_argument if the window or the images are empty
+	 */
+	PixelStatistics(uint32_t window, uint32_t depth, uint32_t lateral);
+
+	/**
+	 * @brief Adds an image to the series.
+	 * @throws std::invalid_argument if the image does not have the pixels of the series
+	 */
+	void add(const frame::Frame<const float, frame::Interleaved<1>>& image);
+
+	/**
+	 * @brief Writes the mean, the variance (unbiased, 0 below 2 images), the min and the
+	 * max of each pixel over the whole series, or over the window.
+	 * @throws std::invalid_argument if the frame does not have the pixels of the series
+	 */
+	void sessionSnapshot(const frame::Frame<float, frame::Interleaved<4>>& out) const;
+	void windowSnapshot(const frame::Frame<float, frame::Interleaved<4>>& out) const;
+
+	// Forgets the images added so far
+	void reset();
+
+	// Images of the series, and of the window
+	[[nodiscard]] uint64_t sessionCount() const { return _sessionCount; }
+	[[nodiscard]] std::size_t windowCount() const { return _windowCount; }
+
+	// Instruction set of the kernel of the chunks
+	[[nodiscard]] simd::SimdLevel simdLevel() const { return _simdLevel; }
+
+	/**
+	 * \struct Update
+	 *
+	 * @brief Arguments of the kernel of the chunks (see PixelStatistics.cpp): the image
+	 * added, the image leaving the window if full, and the statistics of the pixels.
+	 */
+	struct Update
+	{
+		const float* image = nullptr;
+		const float* oldest = nullptr;
+		// 1 / images of the series, and of the window, the image added
+		double sessionWeight = 0.0;
+		double windowWeight = 0.0;
+		double* sessionMean = nullptr;
+		double* sessionM2 = nullptr;
+		float* sessionMin = nullptr;
+		float* sessionMax = nullptr;
+		double* windowMean = nullptr;
+		double* windowM2 = nullptr;
+		// Min and max of the newest images of the window
+		float* newestMin = nullptr;
+		float* newestMax = nullptr;
+	};
+
+	// Kernel of the chunks: statistics, first pixel and pixels of the chunk
+	using UpdateChunk = void(const Update&, std::size_t, std::size_t);
+
+private:
+	// Checks the dimensions of an image or of a snapshot
+	void checkShape(uint32_t depth, uint32_t lateral) const;
+
+	// Suffix min and max of the images of the window over the pixels [first, last): the
+	// window becomes the oldest stack
+	void foldWindow(std::size_t first, std::size_t last);
+
+	// Writes the statistics of the pixels into a snapshot
+	void snapshot(const double* mean,
+	              const double* m2,
+	              std::size_t count,
+	              bool window,
+	              const frame::Frame<float, frame::Interleaved<4>>& out) const;
+
+	std::size_t _window;
+	uint32_t _depth;
+	uint32_t _lateral;
+	std::size_t _pixels;
+
+	simd::SimdLevel _simdLevel;
+	UpdateChunk* _updateChunk;
+
+	uint64_t _sessionCount{0};
+	std::vector<double> _sessionMean;
+	std::vector<double> _sessionM2;
+	std::vector<float> _sessionMin;
+	std::vector<float> _sessionMax;
+
+	// Images of the window [slot][pixel], the next slot is that of the oldest image once
+	// the window is full
+	std::vector<float> _images;
+	std::size_t _nextSlot{0};
+	std::size_t _windowCount{0};
+	std::vector<double> _windowMean;
+	std::vector<double> _windowM2;
+
+	// Oldest stack: suffix min and max [slot][pixel] of its images, up to the newest one
+	std::vector<float> _suffixMin;
+	std::vector<float> _suffixMax;
+	std::size_t _oldestCount{0};
+	// Newest stack: min and max of its images
+	std::vector<float> _newestMin;
+	std::vector<float> _newestMax;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_PIXELSTATISTICS_HPP
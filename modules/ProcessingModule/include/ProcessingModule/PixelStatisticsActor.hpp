@@ -0,0 +1,111 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_PIXELSTATISTICSACTOR_HPP
+#define PROCESSINGMODULE_PIXELSTATISTICSACTOR_HPP
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+
+#include <caf/actor.hpp>
+#include <caf/result.hpp>
+#include <caf/type_list.hpp>
+#include <caf/typed_actor.hpp>
+#include <caf/typed_actor_pointer.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/SampleBufferPool.hpp"
+#include "Frame/StimulusEvent.hpp"
+
+#include "PixelStatistics.hpp"
+
+namespace processing
+{
+
+// Definition of the messaging interface of the pixel statistics stage necessary to create
+// the statically typed actor.
+// /!\ CAF requires the argument to be written without the cv qualifiers.
+struct pixel_statistics_trait
+{
+	using signatures = caf::type_list<
+	    caf::result<void>(acq_start, acq_module::AcquisitionParameters),
+	    caf::result<frame::AcquisitionFrame, frame::AcquisitionFrame>(caf::get_atom),
+	    caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	    caf::result<void>(caf::publish_atom, frame::StimulusEvent)>;
+};
+
+// Definition of the statically typed actor
+using pixel_statistics_actor = caf::typed_actor<pixel_statistics_trait>;
+
+/**
+ * \class pixel_statistics_state
+ *
+ * @brief State of the stage keeping the statistics of the pixels of the power Doppler
+ * images (see PixelStatistics), the baseline of the relative maps and z-scores. The stage
+ * subscribes to its source, the denoising stage, for the whole session: the statistics
+ * are updated with each image, and only copied out when requested.
+ *
+ * The statistics restart with each acquisition, and when the geometry of the images
+ * changes. The images are skipped while the processing falls behind (see
+ * stageQuality()).
+ *
+ * Messages:
+ * - acq_start: restarts the statistics for the next acquisition.
+ * - get_atom: returns the statistics of the session and of the sliding window, as two
+ *   PixelStatistics frames of the PowerDoppler stream. Fails before the first image.
+ * - publish_atom + AcquisitionFrame: power Doppler image, from the source.
+ * - publish_atom + StimulusEvent: ignored.
+ */
+class pixel_statistics_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: stage providing the power Doppler images, the denoising stage
+	 * @param: sliding window of the statistics
+	 */
+	pixel_statistics_state(pixel_statistics_actor::pointer_view self,
+	                       caf::actor source,
+	                       PixelStatisticsConfig cfg);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	pixel_statistics_actor::behavior_type make_behavior();
+
+private:
+	// Adds an image to the statistics
+	void process(const frame::AcquisitionFrame& image);
+
+	// Copies the statistics of the session or of the window into a frame, none if all
+	// the buffers are in use
+	[[nodiscard]] std::optional<frame::AcquisitionFrame> snapshot(bool window);
+
+	// Ptr to current actor
+	pixel_statistics_actor::pointer_view _self;
+
+	caf::actor _source;
+	PixelStatisticsConfig _cfg;
+
+	// Statistics of the current geometry, none before the first image
+	std::optional<PixelStatistics> _statistics;
+	frame::FrameGeometry _geometry;
+	int64_t _lastTimestamp{0};
+	std::unique_ptr<frame::SampleBufferPool> _pool;
+
+	uint64_t _nextSequence{0};
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_PIXELSTATISTICSACTOR_HPP
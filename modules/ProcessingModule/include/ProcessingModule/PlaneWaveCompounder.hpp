@@ -0,0 +1,101 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_PLANEWAVECOMPOUNDER_HPP
+#define PROCESSINGMODULE_PLANEWAVECOMPOUNDER_HPP
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/Frame.hpp"
+#include "Frame/SampleBufferPool.hpp"
+
+namespace processing
+{
+
+/// @brief Image of a plane wave or of an ensemble, I and Q interleaved
+using IqImage = frame::Frame<float, frame::Interleaved<2>>;
+using ConstIqImage = frame::Frame<const float, frame::Interleaved<2>>;
+
+/**
+ * @brief Coherent compounding kernel: out = gain * sum of the images. The output is
+ * computed by tiles, in parallel on the shared task pool: a tile stays in cache while
+ * the images are added to it, each image is read once.
+ * @throws std::invalid_argument if there is no image or if its dimensions differ from
+ * the ones of `out`
+ */
+void compoundImages(std::span<const ConstIqImage> images,
+                    float gain,
+                    const IqImage& out);
+
+/**
+ * \class PlaneWaveCompounder
+ *
+ * @brief Gathers the images of the plane waves of each ensemble, per stream, and
+ * compounds them into one frame. The n-th image of a stream is the plane wave n modulo
+ * the angles, of the ensemble n / angles: the compounded frame takes the index of the
+ * ensemble as sequence and the timestamp of its last plane wave.
+ *
+ * An ensemble is compounded when its last angle arrives, or when an image of a later
+ * ensemble arrives first (plane waves dropped by the farm). An incomplete ensemble is
+ * scaled to the level of a complete one. The images are held until their ensemble is
+ * compounded, nothing is copied before. An ensemble is dropped when all the buffers of
+ * the compounded frames are held downstream.
+ */
+class PlaneWaveCompounder
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param angles plane waves of an ensemble, at least 1
+	 */
+	explicit PlaneWaveCompounder(uint32_t angles = 1);
+
+	/**
+	 * @brief Adds the image of a plane wave.
+	 * @param compounded receives the frames of the ensembles compounded
+	 * @throws std::invalid_argument if the image is not a PlaneWaveIq frame or if its
+	 * samples do not match its geometry
+	 */
+	void add(frame::AcquisitionFrame planeWave,
+	         std::vector<frame::AcquisitionFrame>& compounded);
+
+	[[nodiscard]] uint32_t angles() const { return _angles; }
+
+	// Ensembles compounded without all of their plane waves
+	[[nodiscard]] uint64_t incompleteCount() const { return _incomplete; }
+
+	// Ensembles dropped because all the buffers were in use
+	[[nodiscard]] uint64_t droppedCount() const { return _dropped; }
+
+private:
+	// Compounds the pending images of a stream into `compounded`
+	void compoundPending(std::size_t stream,
+	                     std::vector<frame::AcquisitionFrame>& compounded);
+
+	uint32_t _angles;
+
+	// Images of the current ensemble of each stream
+	std::array<std::vector<frame::AcquisitionFrame>, frame::frame_stream_count> _pending;
+
+	// Buffers of the compounded frames, sized for the last geometry
+	std::unique_ptr<frame::SampleBufferPool> _pool;
+
+	uint64_t _incomplete{0};
+	uint64_t _dropped{0};
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_PLANEWAVECOMPOUNDER_HPP
@@ -0,0 +1,157 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_POWERDOPPLERACTOR_HPP
+#define PROCESSINGMODULE_POWERDOPPLERACTOR_HPP
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include <caf/actor.hpp>
+#include <caf/result.hpp>
+#include <caf/type_list.hpp>
+#include <caf/typed_actor.hpp>
+#include <caf/typed_actor_pointer.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameStream.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/SampleBufferPool.hpp"
+#include "Frame/StimulusEvent.hpp"
+
+#include "SvdClutterFilter.hpp"
+
+namespace processing
+{
+
+// Definition of the messaging interface of the power Doppler stage necessary to create
+// the statically typed actor. The subscriptions are those of the acquisition session.
+// /!\ CAF requires the argument to be written without the cv qualifiers.
+struct power_doppler_trait
+{
+	using signatures =
+	    caf::type_list<caf::result<void>(acq_start, acq_module::AcquisitionParameters),
+	                   caf::result<void>(acq_subscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(acq_unsubscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent)>;
+};
+
+// Definition of the statically typed actor
+using power_doppler_actor = caf::typed_actor<power_doppler_trait>;
+
+/**
+ * \class power_doppler_state
+ *
+ * @brief State of the Doppler stage, between a source of IQ frames (the acquisition
+ * session or the processing farm) and the consumers of the power Doppler images and of
+ * the color Doppler maps. The consumers subscribe to the stage for the PowerDoppler and
+ * ColorDoppler streams as they would to the session; the stage subscribes to its source
+ * for the Doppler stream while it has consumers.
+ *
+ * The compounded IQ frames of the Doppler stream fill the sliding window of an
+ * SvdClutterFilter: an image is published every `step` frames once the window holds an
+ * ensemble, with the color Doppler maps of the same window if they have consumers. The
+ * window restarts when the geometry of the frames changes. The frames of other kinds
+ * (raw RF without beamforming) are ignored.
+ *
+ * While the processing falls behind (see stageQuality()), the color Doppler maps are
+ * skipped and then the power Doppler images decimated once computed, so that the
+ * window is kept across the quality levels.
+ *
+ * The velocities are scaled with the center frequency and the speed of sound of the
+ * sequence, and with the frame rate measured on the timestamps of the window.
+ *
+ * The filter runs on the thread of the actor and on the shared task pool.
+ *
+ * The stimulus events of the source are forwarded to the consumers of the Doppler
+ * stream of the stage, without the frames: the stages after it receive the events
+ * without the Doppler frames they do not process. The consumers of the images receive
+ * the events with the Doppler stream of the source.
+ *
+ * Messages:
+ * - acq_start: sequence of the next acquisition, for the velocities.
+ * - acq_subscribe: publishes the images of a stream, or the events for the Doppler
+ *   stream, to an actor.
+ * - acq_unsubscribe: stops publishing the images or the events of a stream to an actor.
+ * - publish_atom + AcquisitionFrame: Doppler frame, from the source.
+ * - publish_atom + StimulusEvent: event forwarded by the source.
+ */
+class power_doppler_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: acquisition session or processing farm providing the IQ frames
+	 * @param: ensembles and clutter filter
+	 */
+	power_doppler_state(power_doppler_actor::pointer_view self,
+	                    caf::actor source,
+	                    PowerDopplerConfig cfg);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	power_doppler_actor::behavior_type make_behavior();
+
+private:
+	void subscribe(frame::FrameStream stream, caf::actor subscriber);
+	void unsubscribe(frame::FrameStream stream, const caf::actor& subscriber);
+
+	// Consumers of all the streams: the stage receives the Doppler frames while it has
+	// any
+	[[nodiscard]] std::size_t subscriberCount() const;
+
+	// Adds a Doppler frame to the window, then publishes the images if they are due
+	void process(const frame::AcquisitionFrame& frame);
+
+	// Publishes an image to the consumers of its stream
+	void publish(const frame::AcquisitionFrame& image);
+
+	// Velocity per radian of phase, for the frame rate of the window
+	[[nodiscard]] float velocityScale() const;
+
+	// Restarts the window for the frames of a geometry
+	void restart(const frame::FrameGeometry& geometry);
+
+	// Ptr to current actor
+	power_doppler_actor::pointer_view _self;
+
+	caf::actor _source;
+	PowerDopplerConfig _cfg;
+
+	acq_module::AcquisitionParameters _parameters;
+
+	// Consumers of the power Doppler images [0], of the color Doppler maps [1] and of the
+	// stimulus events [2]
+	std::array<std::vector<caf::actor>, 3> _subscribers;
+
+	// Window of the current geometry, none before the first frame
+	std::optional<SvdClutterFilter> _filter;
+	frame::FrameGeometry _geometry;
+	// Timestamps of the frames of the window, oldest first
+	std::deque<int64_t> _timestamps;
+	std::unique_ptr<frame::SampleBufferPool> _powerPool;
+	std::unique_ptr<frame::SampleBufferPool> _colorPool;
+
+	uint64_t _nextPowerSequence{0};
+	uint64_t _nextColorSequence{0};
+	// Frames of another kind than compounded IQ
+	uint64_t _ignored{0};
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_POWERDOPPLERACTOR_HPP
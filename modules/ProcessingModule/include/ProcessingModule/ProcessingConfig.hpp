@@ -0,0 +1,62 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_PROCESSINGCONFIG_HPP
+#define PROCESSINGMODULE_PROCESSINGCONFIG_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include "ActivationMap.hpp"
+#include "LoadShedding.hpp"
+#include "PixelStatistics.hpp"
+#include "SpatialFilter.hpp"
+#include "SvdClutterFilter.hpp"
+
+namespace processing
+{
+
+using namespace std::chrono_literals;
+
+/**
+ * \struct ProcessingConfig
+ *
+ * @brief Configuration of the processing farm, as read from the "icograph.processing"
+ * section of the CAF configuration file.
+ */
+struct ProcessingConfig
+{
+	// Worker actors processing the frames in parallel, 0 to publish the frames
+	// unprocessed
+	uint32_t workers = 0;
+	// Frames processed at once by the workers, the next ones wait in the farm
+	uint32_t max_in_flight = 16;
+	// Time after which a frame sent to a worker is given up
+	std::chrono::nanoseconds worker_timeout = 1s;
+	// "strict" or "latest-wins" (see OrderingPolicy)
+	std::string ordering = "strict";
+	// Degradation of the processed frames while the farm falls behind
+	LoadSheddingConfig load_shedding;
+	// Power Doppler images of the Doppler frames
+	PowerDopplerConfig power_doppler;
+	// Denoising of the power Doppler images, displayed and analysed, by workflow (see
+	// workflow::to_string)
+	std::map<std::string, SpatialFilterConfig> spatial_filters;
+	// Statistics of the pixels of the power Doppler images
+	PixelStatisticsConfig pixel_statistics;
+	// Activation maps of the power Doppler images against the paradigm
+	ActivationMapConfig activation_map;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_PROCESSINGCONFIG_HPP
@@ -0,0 +1,230 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_PROCESSINGFARMACTOR_HPP
+#define PROCESSINGMODULE_PROCESSINGFARMACTOR_HPP
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <caf/actor.hpp>
+#include <caf/disposable.hpp>
+#include <caf/result.hpp>
+#include <caf/type_list.hpp>
+#include <caf/typed_actor.hpp>
+#include <caf/typed_actor_pointer.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameStream.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/StimulusEvent.hpp"
+
+#include "FrameProcessor.hpp"
+#include "LoadShedding.hpp"
+#include "OrderingPolicy.hpp"
+#include "ProcessingConfig.hpp"
+#include "ReorderBuffer.hpp"
+
+namespace processing
+{
+
+// Definition of the messaging interface of a worker of the farm.
+// /!\ CAF requires the argument to be written without the cv qualifiers.
+struct processing_worker_trait
+{
+	using signatures = caf::type_list<
+	    caf::result<frame::AcquisitionFrame>(caf::publish_atom, frame::AcquisitionFrame),
+	    caf::result<void>(acq_start, acq_module::AcquisitionParameters)>;
+};
+
+// Definition of the statically typed actor
+using processing_worker_actor = caf::typed_actor<processing_worker_trait>;
+
+/**
+ * \class processing_worker_state
+ *
+ * @brief State of a worker of the farm: processes the frames it receives with its own
+ * processor and returns them. A frame whose processing throws is answered with an
+ * error.
+ *
+ * Messages:
+ * - publish_atom + AcquisitionFrame: frame to process, answered with the processed
+ *   frame.
+ * - acq_start + AcquisitionParameters: sequence of the next frames, see
+ *   FrameProcessor::setSequence().
+ */
+class processing_worker_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: processor of the worker
+	 */
+	processing_worker_state(processing_worker_actor::pointer_view self,
+	                        std::shared_ptr<FrameProcessor> processor);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	processing_worker_actor::behavior_type make_behavior();
+
+private:
+	// Ptr to current actor
+	processing_worker_actor::pointer_view _self;
+
+	std::shared_ptr<FrameProcessor> _processor;
+};
+
+// Definition of the messaging interface of the processing farm necessary to create the
+// statically typed actor. The subscriptions are those of the acquisition session.
+// /!\ CAF requires the argument to be written without the cv qualifiers.
+struct processing_farm_trait
+{
+	using signatures =
+	    caf::type_list<caf::result<void>(acq_start, acq_module::AcquisitionParameters),
+	                   caf::result<void>(acq_subscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(acq_unsubscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent),
+	                   caf::result<void>(acq_stop)>;
+};
+
+// Definition of the statically typed actor
+using processing_farm_actor = caf::typed_actor<processing_farm_trait>;
+
+/**
+ * \class processing_farm_state
+ *
+ * @brief State of the processing farm, a stage between the acquisition session and the
+ * consumers of the frames. The consumers subscribe to the farm as they would to the
+ * session; the farm subscribes to the session for the streams which have consumers.
+ *
+ * The frames received from the session are spread over a pool of worker actors, the
+ * least loaded first, and reassembled by a ReorderBuffer before they are published.
+ * At most `max_in_flight` frames are processed at once: the next ones wait in the
+ * farm, all of them with the strict ordering, only the latest of each stream with the
+ * latest-wins ordering. A frame not processed within `worker_timeout` is skipped so
+ * that the next ones are published, its worker counting as loaded until it answers.
+ * The workers run on the threads of the CAF scheduler, the throughput grows with its
+ * threads up to the number of workers (see the benchmarks).
+ *
+ * With the load shedding enabled, the backlog of the farm and of the stages after it
+ * (see recordStageBacklog()) and the latency of the published frames are sampled
+ * periodically: while the processing falls behind, the farm steps down through the
+ * quality levels (see QualityLevel, LoadSheddingPolicy) and back up once it has
+ * recovered. The farm sheds whole ensembles of RF frames, the plane waves compounded
+ * into one image, and leaves the other degradations to the stages after it (see
+ * stageQuality()). Every change is logged as a user event. The frames shed are only
+ * those of the consumers of the farm: raw storage subscribes to the session.
+ *
+ * Stimulus events are forwarded at once to the consumers of the Doppler stream.
+ *
+ * Messages:
+ * - acq_start: passes the sequence of the acquisition to the workers, then starts the
+ *   acquisition session.
+ * - acq_subscribe: publishes the processed frames of a stream to an actor.
+ * - acq_unsubscribe: stops publishing the frames of a stream to an actor.
+ * - publish_atom + AcquisitionFrame: frame to process, from the acquisition session.
+ * - publish_atom + StimulusEvent: event forwarded by the acquisition session.
+ * - acq_stop: end of an acquisition, from the acquisition session. Ignored: the farm
+ *   keeps no events, and its frames in flight would be published after the end.
+ */
+class processing_farm_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: acquisition session providing the frames
+	 * @param: configuration of the farm, with at least one worker
+	 * @param: creates the processor of each worker
+	 */
+	processing_farm_state(processing_farm_actor::pointer_view self,
+	                      acq_module::acq_module_actor source,
+	                      ProcessingConfig cfg,
+	                      ProcessorFactory factory);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	processing_farm_actor::behavior_type make_behavior();
+
+private:
+	void subscribe(frame::FrameStream stream, caf::actor subscriber);
+	void unsubscribe(frame::FrameStream stream, const caf::actor& subscriber);
+
+	// Queues a frame received from the session, then dispatches
+	void enqueue(frame::AcquisitionFrame frame);
+
+	// Sends the waiting frames to the workers, up to the in-flight limit
+	void dispatch();
+
+	// Handles the answer of a worker, then publishes the frames released in order
+	void completed(std::size_t worker, uint64_t ticket, frame::AcquisitionFrame frame);
+	void failed(std::size_t worker, uint64_t ticket, const caf::error& error);
+	void publishReleased();
+
+	// Gives up a frame not answered in time by its worker
+	void timedOut(std::size_t worker, uint64_t ticket);
+
+	// Cancels the deadline of an answered frame, false if the frame was given up
+	bool settle(uint64_t ticket);
+
+	// Samples the load, then applies the quality level decided by the load shedding
+	void sampleLoad();
+	void applyQuality(QualityLevel level);
+
+	// Ptr to current actor
+	processing_farm_actor::pointer_view _self;
+
+	acq_module::acq_module_actor _source;
+	ProcessingConfig _cfg;
+	ProcessorFactory _factory;
+
+	std::vector<processing_worker_actor> _workers;
+	// Frames in flight per worker, until the worker answers even if given up
+	std::vector<uint32_t> _workerLoads;
+	uint32_t _inFlight{0};
+	// Deadlines of the frames in flight not given up yet, by ticket
+	std::unordered_map<uint64_t, caf::disposable> _deadlines;
+
+	std::deque<frame::AcquisitionFrame> _waiting;
+	uint64_t _nextTicket{0};
+	ReorderBuffer _reorder;
+	std::vector<frame::AcquisitionFrame> _released;
+
+	// Consumers of the processed frames of each stream
+	std::array<std::vector<caf::actor>, frame::frame_stream_count> _subscribers;
+
+	// Frames given up: replaced by a newer frame while waiting, or failed
+	uint64_t _skipped{0};
+
+	// Load shedding, if enabled
+	std::optional<LoadSheddingPolicy> _shedding;
+	caf::disposable _nextSample;
+	// Highest acquisition to publication latency since the previous sample
+	std::chrono::nanoseconds _maxLatency{0};
+	// Frames not processed because of the reduced rate
+	uint64_t _shed{0};
+	// Plane waves of an ensemble, shed together
+	uint32_t _angleCount{1};
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_PROCESSINGFARMACTOR_HPP
@@ -0,0 +1,148 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_QUALITYLEVEL_HPP
+#define PROCESSINGMODULE_QUALITYLEVEL_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace processing
+{
+
+/**
+ * @enum QualityLevel
+ * @brief Degradation of the processed frames when the processing falls behind. Each
+ * level includes the degradations of the previous ones.
+ */
+enum class QualityLevel : uint8_t
+{
+	Full,               // Every frame, every map, at full resolution
+	EssentialMaps,      // Only the power Doppler images: no color Doppler, denoising,
+	                    // pixel statistics or activation map
+	ReducedResolution,  // The power Doppler images are decimated
+	ReducedRate         // Only one ensemble in `rate_step` is processed
+};
+
+/**
+ * @brief Converts a QualityLevel enum value to its string representation.
+ * @param level The QualityLevel enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(QualityLevel level)
+{
+	using namespace std::string_literals;
+
+	switch (level)
+	{
+	case QualityLevel::Full:
+		return "full"s;
+	case QualityLevel::EssentialMaps:
+		return "essential-maps"s;
+	case QualityLevel::ReducedResolution:
+		return "reduced-resolution"s;
+	case QualityLevel::ReducedRate:
+		return "reduced-rate"s;
+	}
+
+	throw std::domain_error("Invalid value for QualityLevel: " +
+	                        std::to_string(std::to_underlying(level)));
+}
+
+/**
+ * @brief Attempts to convert a string to a QualityLevel enum value.
+ * @param str The string to convert.
+ * @param level Reference to the QualityLevel enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, QualityLevel& level)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "full"sv)
+	{
+		level = QualityLevel::Full;
+		status = true;
+	}
+	else if (str == "essential-maps"sv)
+	{
+		level = QualityLevel::EssentialMaps;
+		status = true;
+	}
+	else if (str == "reduced-resolution"sv)
+	{
+		level = QualityLevel::ReducedResolution;
+		status = true;
+	}
+	else if (str == "reduced-rate"sv)
+	{
+		level = QualityLevel::ReducedRate;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a QualityLevel enum value.
+ * @param value The integer value to convert.
+ * @param level Reference to the QualityLevel enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<QualityLevel> value,
+                                          QualityLevel& level)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(QualityLevel::Full):
+		level = QualityLevel::Full;
+		status = true;
+		break;
+	case std::to_underlying(QualityLevel::EssentialMaps):
+		level = QualityLevel::EssentialMaps;
+		status = true;
+		break;
+	case std::to_underlying(QualityLevel::ReducedResolution):
+		level = QualityLevel::ReducedResolution;
+		status = true;
+		break;
+	case std::to_underlying(QualityLevel::ReducedRate):
+		level = QualityLevel::ReducedRate;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace processing
+
+/**
+ * @brief Specialization of the std::format for QualityLevel. Needed for logging
+ */
+template <>
+struct std::formatter<processing::QualityLevel>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const processing::QualityLevel& level, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", processing::to_string(level));
+	}
+};
+
+#endif  // PROCESSINGMODULE_QUALITYLEVEL_HPP
@@ -0,0 +1,90 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_REORDERBUFFER_HPP
+#define PROCESSINGMODULE_REORDERBUFFER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <vector>
+
+#include "Frame/AcquisitionFrame.hpp"
+#include "Frame/FrameStream.hpp"
+
+#include "OrderingPolicy.hpp"
+
+namespace processing
+{
+
+/**
+ * \class ReorderBuffer
+ *
+ * @brief Restores the order of the frames processed in parallel. The farm numbers the
+ * frames with a ticket when it dispatches them, in the order of the acquisition; the
+ * workers complete them in any order.
+ *
+ * - Strict: a frame is released once the frames of all the previous tickets are
+ *   released or skipped.
+ * - LatestWins: a frame is released as soon as it completes, unless a frame of a later
+ *   ticket of the same stream was released before: it is then dropped.
+ */
+class ReorderBuffer
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param policy order of the released frames
+	 */
+	explicit ReorderBuffer(OrderingPolicy policy) : _policy(policy) {}
+
+	/**
+	 * @brief Adds a processed frame, and appends to `released` the frames which can be
+	 * delivered, in order.
+	 */
+	void complete(uint64_t ticket,
+	              frame::AcquisitionFrame frame,
+	              std::vector<frame::AcquisitionFrame>& released);
+
+	/**
+	 * @brief Gives up the frame of a ticket (processing failed), and appends to
+	 * `released` the frames it was holding back.
+	 */
+	void skip(uint64_t ticket, std::vector<frame::AcquisitionFrame>& released);
+
+	[[nodiscard]] OrderingPolicy policy() const { return _policy; }
+
+	// Frames held back by a missing ticket
+	[[nodiscard]] std::size_t heldCount() const;
+
+	// Frames dropped because a later frame of their stream was released first
+	[[nodiscard]] uint64_t droppedCount() const { return _dropped; }
+
+private:
+	// Releases the frames following the last ticket released
+	void releaseReady(std::vector<frame::AcquisitionFrame>& released);
+
+	OrderingPolicy _policy;
+
+	// Strict: next ticket to release, and completed tickets after it (nullopt if
+	// skipped)
+	uint64_t _nextTicket{0};
+	std::map<uint64_t, std::optional<frame::AcquisitionFrame>> _held;
+
+	// LatestWins: last ticket released per stream
+	std::array<std::optional<uint64_t>, frame::frame_stream_count> _lastReleased{};
+	uint64_t _dropped{0};
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_REORDERBUFFER_HPP
@@ -0,0 +1,152 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_SPATIALFILTER_HPP
+#define PROCESSINGMODULE_SPATIALFILTER_HPP
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Frame/Frame.hpp"
+#include "Simd/SimdLevel.hpp"
+
+#include "SpatialFilterKind.hpp"
+
+namespace processing
+{
+
+/**
+ * \struct SpatialFilterConfig
+ *
+ * @brief Denoising filter of the Doppler images of a workflow. Read from the
+ * "icograph.processing.spatial-filter.<workflow>" sections of the CAF configuration file.
+ */
+struct SpatialFilterConfig
+{
+	// "none", "gaussian", "median" or "bilateral" (see SpatialFilterKind)
+	std::string kind = "none";
+
+	// Half-width of the window in pixels (see SpatialFilter::max_radius)
+	uint32_t radius = 2;
+
+	// Standard deviation of the spatial weights, in pixels
+	float sigma = 1.0f;
+
+	// Bilateral: standard deviation of the range weights, relative to the level of the
+	// pixels
+	float range_sigma = 0.5f;
+};
+
+/**
+ * \class SpatialFilter
+ *
+ * @brief Denoising filter of the images of a geometry (one float per pixel, depth first),
+ * applied in place. The buffers are allocated once by the constructor: filtering an
+ * image allocates nothing.
+ *
+ * The kernels run on tiles of columns, in parallel on the shared task pool, and are
+ * vectorized along the depth: the samples of a column are contiguous. Within a column,
+ * the pixels are processed by chunks whose window, borders replicated, is copied on the
+ * stack.
+ * - Gaussian and bilateral: separable, a pass along the depth into the scratch image,
+ *   then a pass along the lateral axis back into the image. The separable bilateral
+ *   filter approximates the 2D one, its range weights are relative to the level of the
+ *   pixels (the power spans decades).
+ * - Median: the samples of the windows of a chunk go through a sorting network reduced
+ *   to the comparators the median depends on, as vector min and max.
+ *
+ * The kernels of the chunks are compiled for AVX2 and AVX-512 too, the variant of the
+ * machine is selected when the filter is built.
+ */
+class SpatialFilter
+{
+public:
+	// Largest half-width of the windows, and of the window of the median (7x7 pixels)
+	static constexpr uint32_t max_radius = 8;
+	static constexpr uint32_t max_median_radius = 3;
+
+	/**
+	 * @brief: Ctor
+	 * @param cfg kind and parameters of the filter
+	 * @param depth pixels of a column
+	 * @param lateral columns of an image
+	 * @throws std::invalid_argument if the kind is unknown or the parameters are invalid
+	 */
+	SpatialFilter(const SpatialFilterConfig& cfg, uint32_t depth, uint32_t lateral);
+
+	/**
+	 * @brief Filters an image in place.
+	 * @throws std::invalid_argument if the image does not have the pixels of the filter
+	 */
+	void apply(const frame::Frame<float, frame::Interleaved<1>>& image);
+
+	[[nodiscard]] SpatialFilterKind kind() const { return _kind; }
+
+	// Instruction set of the kernels of the chunks
+	[[nodiscard]] simd::SimdLevel simdLevel() const { return _simdLevel; }
+
+	// First sample of each tap of the window of a chunk
+	using Taps = std::array<const float*, 2 * max_radius + 1>;
+
+	// Kernels of the chunks (see SpatialFilter.cpp): taps, weights, range scale of the
+	// bilateral filter, pixels of the chunk and output; median network and samples of
+	// the windows of the chunk
+	using GaussianChunk = void(const Taps&, std::span<const float>, std::size_t, float*);
+	using BilateralChunk =
+	    void(const Taps&, std::span<const float>, float, std::size_t, float*);
+	using MedianChunk = void(std::span<const std::pair<uint16_t, uint16_t>>, float*);
+
+private:
+	// Passes of the separable filters on the columns [first, last), along the depth and
+	// along the lateral axis
+	void depthPass(const float* in,
+	               float* out,
+	               std::size_t first,
+	               std::size_t last) const;
+	void lateralPass(const float* in,
+	                 float* out,
+	                 std::size_t first,
+	                 std::size_t last) const;
+
+	// Medians of the columns [first, last)
+	void medianPass(const float* in,
+	                float* out,
+	                std::size_t first,
+	                std::size_t last) const;
+
+	SpatialFilterKind _kind;
+	uint32_t _radius;
+	float _rangeScale;
+	std::size_t _depth;
+	std::size_t _lateral;
+
+	simd::SimdLevel _simdLevel;
+	GaussianChunk* _gaussianChunk;
+	BilateralChunk* _bilateralChunk;
+	MedianChunk* _medianChunk;
+
+	// Spatial weights of the window, 2 * radius + 1, summing to 1
+	std::vector<float> _weights;
+
+	// Comparators of the median network, by pairs of samples of the window
+	std::vector<std::pair<uint16_t, uint16_t>> _network;
+	uint16_t _medianIndex{0};
+
+	// Image between two passes
+	std::vector<float> _scratch;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_SPATIALFILTER_HPP
@@ -0,0 +1,122 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_SPATIALFILTERACTOR_HPP
+#define PROCESSINGMODULE_SPATIALFILTERACTOR_HPP
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <caf/actor.hpp>
+#include <caf/result.hpp>
+#include <caf/type_list.hpp>
+#include <caf/typed_actor.hpp>
+#include <caf/typed_actor_pointer.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameStream.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "Frame/SampleBufferPool.hpp"
+#include "Frame/StimulusEvent.hpp"
+
+#include "SpatialFilter.hpp"
+
+namespace processing
+{
+
+// Definition of the messaging interface of the spatial filter stage necessary to create
+// the statically typed actor. The subscriptions are those of the acquisition session.
+// /!\ CAF requires the argument to be written without the cv qualifiers.
+struct spatial_filter_trait
+{
+	using signatures =
+	    caf::type_list<caf::result<void>(caf::update_atom, std::string),
+	                   caf::result<void>(acq_subscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(acq_unsubscribe, frame::FrameStream, caf::actor),
+	                   caf::result<void>(caf::publish_atom, frame::AcquisitionFrame),
+	                   caf::result<void>(caf::publish_atom, frame::StimulusEvent)>;
+};
+
+// Definition of the statically typed actor
+using spatial_filter_actor = caf::typed_actor<spatial_filter_trait>;
+
+/**
+ * \class spatial_filter_state
+ *
+ * @brief State of the denoising stage, between the power Doppler stage and the consumers
+ * of the denoised images (the display and the analysis stages). The consumers subscribe
+ * to the stage for the PowerDoppler stream as they would to the power Doppler stage; the
+ * stage subscribes to its source while it has consumers.
+ *
+ * Each image is copied into a buffer of the stage and filtered there, with the filter of
+ * the current workflow (see SpatialFilter). The filter is built again when the workflow
+ * or the geometry of the images changes. Without a filter for the workflow, or while the
+ * processing falls behind (see stageQuality()), the images are forwarded as they are.
+ *
+ * Messages:
+ * - update_atom + workflow name: selects the filter of the workflow.
+ * - acq_subscribe: publishes the denoised images to an actor.
+ * - acq_unsubscribe: stops publishing the denoised images to an actor.
+ * - publish_atom + AcquisitionFrame: power Doppler image, from the source.
+ * - publish_atom + StimulusEvent: ignored, the consumers receive the events with the
+ *   Doppler stream.
+ */
+class spatial_filter_state
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param: pointer to current actor
+	 * @param: power Doppler stage providing the images
+	 * @param: filter of each workflow, by name of the workflow
+	 */
+	spatial_filter_state(spatial_filter_actor::pointer_view self,
+	                     caf::actor source,
+	                     std::map<std::string, SpatialFilterConfig> filters);
+
+	/**
+	 * @brief: Defines the callbacks upon message reception
+	 */
+	spatial_filter_actor::behavior_type make_behavior();
+
+private:
+	void subscribe(frame::FrameStream stream, caf::actor subscriber);
+	void unsubscribe(frame::FrameStream stream, const caf::actor& subscriber);
+
+	// Filters an image, then publishes it to the consumers
+	void process(const frame::AcquisitionFrame& image);
+
+	// Builds the filter of the current workflow for the images of a geometry
+	void restart(const frame::FrameGeometry& geometry);
+
+	// Ptr to current actor
+	spatial_filter_actor::pointer_view _self;
+
+	caf::actor _source;
+	std::map<std::string, SpatialFilterConfig> _filters;
+	std::string _workflow;
+
+	// Consumers of the denoised images
+	std::vector<caf::actor> _subscribers;
+
+	// Filter of the current workflow and geometry, none before the first image or after a
+	// change of workflow
+	std::optional<SpatialFilter> _filter;
+	frame::FrameGeometry _geometry;
+	std::unique_ptr<frame::SampleBufferPool> _pool;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_SPATIALFILTERACTOR_HPP
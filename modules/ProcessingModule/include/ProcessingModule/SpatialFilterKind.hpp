@@ -0,0 +1,146 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_SPATIALFILTERKIND_HPP
+#define PROCESSINGMODULE_SPATIALFILTERKIND_HPP
+
+#include <cstdint>
+#include <exception>
+#include <format>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace processing
+{
+
+/**
+ * @enum SpatialFilterKind
+ * @brief Denoising filter of the Doppler images before their display and analysis.
+ */
+enum class SpatialFilterKind : uint8_t
+{
+	None,      // Images published as they are
+	Gaussian,  // Separable Gaussian blur
+	Median,    // Median of the square window, removes the speckle spikes
+	Bilateral  // Separable bilateral filter, keeps the edges of the vessels
+};
+
+/**
+ * @brief Converts a SpatialFilterKind enum value to its string representation.
+ * @param kind The SpatialFilterKind enum value to convert.
+ * @return std::string The string representation of the enum value.
+ */
+constexpr std::string to_string(SpatialFilterKind kind)
+{
+	using namespace std::string_literals;
+
+	switch (kind)
+	{
+	case SpatialFilterKind::None:
+		return "none"s;
+	case SpatialFilterKind::Gaussian:
+		return "gaussian"s;
+	case SpatialFilterKind::Median:
+		return "median"s;
+	case SpatialFilterKind::Bilateral:
+		return "bilateral"s;
+	}
+
+	throw std::domain_error("Invalid value for SpatialFilterKind: " +
+	                        std::to_string(std::to_underlying(kind)));
+}
+
+/**
+ * @brief Attempts to convert a string to a SpatialFilterKind enum value.
+ * @param str The string to convert.
+ * @param kind Reference to the SpatialFilterKind enum value to populate.
+ * @return bool True if the conversion was successful, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_string(std::string_view str, SpatialFilterKind& kind)
+{
+	using namespace std::string_view_literals;
+
+	bool status{false};
+	if (str == "none"sv)
+	{
+		kind = SpatialFilterKind::None;
+		status = true;
+	}
+	else if (str == "gaussian"sv)
+	{
+		kind = SpatialFilterKind::Gaussian;
+		status = true;
+	}
+	else if (str == "median"sv)
+	{
+		kind = SpatialFilterKind::Median;
+		status = true;
+	}
+	else if (str == "bilateral"sv)
+	{
+		kind = SpatialFilterKind::Bilateral;
+		status = true;
+	}
+	return status;
+}
+
+/**
+ * @brief Attempts to convert an integer to a SpatialFilterKind enum value.
+ * @param value The integer value to convert.
+ * @param kind Reference to the SpatialFilterKind enum value to populate.
+ * @return bool True if the integer matches a valid enum value, false otherwise.
+ */
+[[nodiscard]] constexpr bool from_integer(std::underlying_type_t<SpatialFilterKind> value,
+                                          SpatialFilterKind& kind)
+{
+	bool status{false};
+
+	switch (value)
+	{
+	case std::to_underlying(SpatialFilterKind::None):
+		kind = SpatialFilterKind::None;
+		status = true;
+		break;
+	case std::to_underlying(SpatialFilterKind::Gaussian):
+		kind = SpatialFilterKind::Gaussian;
+		status = true;
+		break;
+	case std::to_underlying(SpatialFilterKind::Median):
+		kind = SpatialFilterKind::Median;
+		status = true;
+		break;
+	case std::to_underlying(SpatialFilterKind::Bilateral):
+		kind = SpatialFilterKind::Bilateral;
+		status = true;
+		break;
+	}
+
+	return status;
+}
+
+}  // namespace processing
+
+/**
+ * @brief Specialization of the std::format for SpatialFilterKind. Needed for logging
+ */
+template <>
+struct std::formatter<processing::SpatialFilterKind>
+{
+	constexpr auto parse(std::format_parse_context& ctx) { return ctx.begin(); }
+
+	auto format(const processing::SpatialFilterKind& kind, std::format_context& ctx) const
+	{
+		return std::format_to(ctx.out(), "{}", processing::to_string(kind));
+	}
+};
+
+#endif  // PROCESSINGMODULE_SPATIALFILTERKIND_HPP
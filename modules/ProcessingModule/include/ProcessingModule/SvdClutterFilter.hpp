@@ -0,0 +1,199 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#ifndef PROCESSINGMODULE_SVDCLUTTERFILTER_HPP
+#define PROCESSINGMODULE_SVDCLUTTERFILTER_HPP
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include <vector>
+
+#include "Frame/Frame.hpp"
+
+namespace processing
+{
+
+/**
+ * \struct PowerDopplerConfig
+ *
+ * @brief Ensembles and clutter filter of the power Doppler images. Read from the
+ * "icograph.processing.power-doppler" section of the CAF configuration file.
+ */
+struct PowerDopplerConfig
+{
+	bool enabled = false;
+
+	// Doppler frames of an image
+	uint32_t ensemble = 200;
+
+	// Frames between two images: the window slides by `step` frames
+	uint32_t step = 50;
+
+	// Largest singular components removed as tissue
+	uint32_t tissue_components = 20;
+
+	// Extra vectors of the randomized subspace, for the accuracy of the tissue ones
+	uint32_t oversampling = 10;
+
+	// Power iterations of the randomized subspace
+	uint32_t power_iterations = 2;
+};
+
+/**
+ * @brief Velocity per radian of the lag-one phase of the Kasai estimator, in m/s:
+ * c PRF / (4 pi f0), the axial velocity aliasing at +/- pi.
+ * @param soundSpeed speed of sound, in m/s
+ * @param centerFrequency center frequency of the probe, in Hz
+ * @param frameRate pulse repetition frequency of the Doppler frames, in Hz
+ */
+constexpr float kasaiVelocityScale(float soundSpeed,
+                                   float centerFrequency,
+                                   double frameRate)
+{
+	const double wavelength = static_cast<double>(soundSpeed) / centerFrequency;
+	return static_cast<float>(wavelength * frameRate / (4.0 * std::numbers::pi));
+}
+
+/**
+ * \class SvdClutterFilter
+ *
+ * @brief Spatiotemporal SVD clutter filter of the ensembles of IQ frames, computing the
+ * power Doppler images of a sliding window.
+ *
+ * The window is a Casorati matrix C (pixels x frames): one slot per frame, its real and
+ * imaginary planes contiguous, the oldest slot replaced by the next frame. The frames are
+ * deinterleaved once, when they are added. The right singular vectors of
+ * C are the eigenvectors of its Gram matrix C^H C (frames x frames), which is updated
+ * incrementally: only the rows of the slots replaced since the previous image are
+ * computed, by blocks of pixels, in parallel on the shared task pool.
+ *
+ * The tissue components are found by a randomized subspace iteration on the Gram matrix
+ * followed by a Rayleigh-Ritz projection (Jacobi eigensolver), the order of the slots
+ * being irrelevant to the decomposition. The power of a pixel is the energy of its
+ * samples outside of the tissue subspace, averaged over the frames:
+ *   P(p) = (|c_p|^2 - sum_k |c_p v_k|^2) / frames
+ * accumulated in double precision, the tissue being 40 to 60 dB above the blood.
+ *
+ * The color Doppler maps come from the same window and the same tiles: the samples of a
+ * pixel filtered of the tissue are taken in the order of the frames, and the lag-one
+ * autocorrelation R(1) of the Kasai estimator gives its axial velocity, scale * arg R(1),
+ * and its normalized variance, 1 - |R(1)| / R(0).
+ */
+class SvdClutterFilter
+{
+public:
+	/**
+	 * @brief: Ctor
+	 * @param cfg ensembles and clutter filter
+	 * @param pixels pixels of the IQ frames
+	 * @throws std::invalid_argument if the window is empty or holds fewer frames than
+	 * tissue components
+	 */
+	SvdClutterFilter(const PowerDopplerConfig& cfg, std::size_t pixels);
+
+	/**
+	 * @brief Adds an IQ frame to the window, in place of the oldest one once the window
+	 * is full.
+	 * @param iq pixels of the frame
+	 * @return true if an image is due, see powerDoppler()
+	 * @throws std::invalid_argument if the frame does not have the pixels of the filter
+	 */
+	bool add(const frame::Frame<const float, frame::Interleaved<2>>& iq);
+
+	/**
+	 * @brief Computes the power Doppler image of the frames of the window.
+	 * @param power receives the power of each pixel
+	 * @throws std::invalid_argument if `power` does not have the pixels of the filter
+	 */
+	void powerDoppler(const frame::Frame<float, frame::Interleaved<1>>& power);
+
+	/**
+	 * @brief Computes the power Doppler image and the color Doppler maps of the frames of
+	 * the window, in one pass over the samples.
+	 * @param power receives the power of each pixel
+	 * @param color receives the velocity (m/s, positive towards the probe) and the
+	 * variance (0 to 1) of each pixel; an empty frame if they are not needed
+	 * @param velocityScale velocity per radian of phase, see kasaiVelocityScale()
+	 * @throws std::invalid_argument if the maps do not have the pixels of the filter
+	 */
+	void dopplerMaps(const frame::Frame<float, frame::Interleaved<1>>& power,
+	                 const frame::Frame<float, frame::Interleaved<2>>& color,
+	                 float velocityScale);
+
+	[[nodiscard]] std::size_t pixelCount() const { return _pixels; }
+
+	// Frames in the window, up to the ensemble
+	[[nodiscard]] std::size_t frameCount() const { return _frameCount; }
+
+	// Singular values of the tissue components removed from the last image, decreasing
+	[[nodiscard]] const std::vector<double>& tissueSingularValues() const
+	{
+		return _singularValues;
+	}
+
+private:
+	// Computes the rows of the Gram matrix of the slots replaced since the last update
+	void updateGram();
+
+	// Computes the tissue singular vectors from the Gram matrix
+	void findTissue();
+
+	// Powers and, if `color` is not null, color Doppler of the pixels [first, last)
+	void mapsOfPixels(std::size_t first,
+	                  std::size_t last,
+	                  float* power,
+	                  float* color,
+	                  float velocityScale) const;
+
+	// Color Doppler of a group of pixels of a tile, from their samples [slot][pixel] and
+	// their projections on the tissue [component][lane]
+	void colorOfGroup(const double* re,
+	                  const double* im,
+	                  const double* projectionsRe,
+	                  const double* projectionsIm,
+	                  float velocityScale,
+	                  std::span<float> color) const;
+
+	uint32_t _ensemble;
+	uint32_t _step;
+	uint32_t _tissueComponents;
+	uint32_t _oversampling;
+	uint32_t _powerIterations;
+	std::size_t _pixels;
+
+	// Sum of conj(a) b over pixels of two slots, for the instruction set of the machine
+	std::complex<double> (*_dotConj)(const float*,
+	                                 const float*,
+	                                 std::size_t,
+	                                 std::size_t);
+
+	// Casorati matrix [slot][real, imaginary][pixel]
+	std::vector<float> _casorati;
+	std::size_t _nextSlot{0};
+	std::size_t _frameCount{0};
+	// Frames added since the last image
+	uint32_t _sinceImage{0};
+	// Slots whose rows of the Gram matrix are out of date
+	std::vector<std::size_t> _staleSlots;
+
+	// Gram matrix C^H C [slot][slot]
+	std::vector<std::complex<double>> _gram;
+
+	// Tissue singular vectors [component][slot]
+	std::vector<std::complex<double>> _tissue;
+	std::vector<double> _singularValues;
+};
+
+}  // namespace processing
+
+#endif  // PROCESSINGMODULE_SVDCLUTTERFILTER_HPP
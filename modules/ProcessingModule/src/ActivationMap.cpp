@@ -0,0 +1,409 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#include "ProcessingModule/ActivationMap.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Pixels of a job of the task pool
+constexpr std::size_t tile_pixels = 4096;
+
+/// @brief Pixels updated together: the chunk of the image stays in L1 from one pass of
+/// the kernel to the next
+constexpr std::size_t chunk_pixels = 512;
+
+/// @brief Shape of the gamma hemodynamic response, its peak is at (shape - 1) x scale
+constexpr int response_shape = 6;
+
+/// @brief Elapsed time, in scales, after which the response has ended (its integral
+/// is 1 within 1e-11)
+constexpr double response_scales = 40.0;
+
+/// @brief Pivot of the cross products of the regressors, relative to its diagonal term,
+/// below which the regressors do not determine the model
+constexpr double min_relative_pivot = 1e-9;
+
+constexpr int64_t never = std::numeric_limits<int64_t>::max();
+
+using Update = ActivationMap::Update;
+using Gram = double[ActivationMap::max_regressors][ActivationMap::max_regressors];
+
+// --------------------------------------------------------------------
+/**
+ * @brief Adds the pixels [first, first + count) of an image, relative to the reference,
+ * to their sums, their products with the regressors and their squares.
+ */
+inline void updateChunk(const Update& u, std::size_t first, std::size_t count)
+{
+	const float* image = u.image + first;
+	const float* reference = u.reference + first;
+	double* sums = u.sums + first;
+	double* stimulusProducts = u.stimulusProducts + first;
+	double* squares = u.squares + first;
+	if (u.timeProducts == nullptr)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			const double y = static_cast<double>(image[i]) - reference[i];
+			sums[i] += y;
+			stimulusProducts[i] += u.stimulus * y;
+			squares[i] += y * y;
+		}
+		return;
+	}
+
+	double* timeProducts = u.timeProducts + first;
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const double y = static_cast<double>(image[i]) - reference[i];
+		sums[i] += y;
+		stimulusProducts[i] += u.stimulus * y;
+		timeProducts[i] += u.time * y;
+		squares[i] += y * y;
+	}
+}
+
+// --------------------------------------------------------------------
+// The kernel is plain C++ vectorized by the compiler. The AVX2 and AVX-512 variants
+// inline it (flatten) to vectorize it for the wider registers.
+void updateScalar(const Update& u, std::size_t first, std::size_t count)
+{
+	updateChunk(u, first, count);
+}
+
+#if MEDSIMD_X86
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+void updateAvx2(const Update& u, std::size_t first, std::size_t count)
+{
+	updateChunk(u, first, count);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+void updateAvx512(const Update& u, std::size_t first, std::size_t count)
+{
+	updateChunk(u, first, count);
+}
+#endif
+
+/// @brief Kernel of the chunks for each instruction set
+constexpr simd::KernelVariants<ActivationMap::UpdateChunk> update_chunks{
+    .scalar = updateScalar,
+#if MEDSIMD_X86
+    .avx2 = updateAvx2,
+    .avx512 = updateAvx512,
+#endif
+};
+
+// --------------------------------------------------------------------
+/**
+ * @brief Inverts the cross products of `size` regressors by Gauss-Jordan elimination,
+ * without pivoting: the matrix is symmetric positive semi-definite.
+ * @return false if the regressors do not determine the model (singular matrix)
+ */
+bool invert(const Gram& gram, std::size_t size, Gram& inverse)
+{
+	Gram reduced{};
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		for (std::size_t j = 0; j < size; ++j)
+		{
+			reduced[i][j] = gram[i][j];
+			inverse[i][j] = i == j ? 1.0 : 0.0;
+		}
+	}
+
+	for (std::size_t k = 0; k < size; ++k)
+	{
+		const double pivot = reduced[k][k];
+		if (!(pivot > min_relative_pivot * gram[k][k]))
+		{
+			return false;
+		}
+		for (std::size_t j = 0; j < size; ++j)
+		{
+			reduced[k][j] /= pivot;
+			inverse[k][j] /= pivot;
+		}
+		for (std::size_t i = 0; i < size; ++i)
+		{
+			const double factor = reduced[i][k];
+			if (i == k || factor == 0.0)
+			{
+				continue;
+			}
+			for (std::size_t j = 0; j < size; ++j)
+			{
+				reduced[i][j] -= factor * reduced[k][j];
+				inverse[i][j] -= factor * inverse[k][j];
+			}
+		}
+	}
+	return true;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+StimulusRegressor::StimulusRegressor(frame::StimulusSource source,
+                                     std::chrono::nanoseconds duration,
+                                     std::chrono::nanoseconds peak)
+    : _source(source),
+      _duration(duration.count()),
+      _scale(static_cast<double>(peak.count()) / (response_shape - 1)),
+      _support(static_cast<int64_t>(response_scales * _scale))
+{
+	if (duration < 0ns || peak < 0ns)
+	{
+		throw std::invalid_argument("Stimulus regressor: negative duration or peak");
+	}
+}
+
+// --------------------------------------------------------------------
+void StimulusRegressor::addEvent(const frame::StimulusEvent& event)
+{
+	if (event.source != _source)
+	{
+		return;
+	}
+
+	if (event.code == 0)
+	{
+		// Stops the stimulus, unless its duration has elapsed already
+		if (_open)
+		{
+			Stimulus& last = _stimuli.back();
+			last.stop = std::max(last.start, std::min(last.stop, event.timestamp));
+			_open = false;
+		}
+		return;
+	}
+
+	// A stimulus already on goes on
+	if (_open && (_duration == 0 || event.timestamp < _stimuli.back().stop))
+	{
+		return;
+	}
+	_stimuli.push_back({.start = event.timestamp,
+	                    .stop = _duration > 0 ? event.timestamp + _duration : never});
+	_open = true;
+}
+
+// --------------------------------------------------------------------
+double StimulusRegressor::valueAt(int64_t timestamp)
+{
+	// The response to the stimuli stopped long enough ago has reached its integral on
+	// both ends
+	std::erase_if(_stimuli, [timestamp, this](const Stimulus& stimulus)
+	              { return timestamp - stimulus.stop > _support; });
+	if (_stimuli.empty())
+	{
+		_open = false;
+	}
+
+	double value = 0.0;
+	for (const Stimulus& stimulus : _stimuli)
+	{
+		if (stimulus.start < timestamp)
+		{
+			value += responseIntegral(timestamp - stimulus.start) -
+			         responseIntegral(timestamp - std::min(stimulus.stop, timestamp));
+		}
+	}
+	return value;
+}
+
+// --------------------------------------------------------------------
+double StimulusRegressor::responseIntegral(int64_t elapsed) const
+{
+	if (elapsed <= 0)
+	{
+		return 0.0;
+	}
+	if (_scale == 0.0)
+	{
+		return 1.0;
+	}
+
+	// Regularized lower incomplete gamma function of an integer shape:
+	// 1 - exp(-u) sum_{k < shape} u^k / k!
+	const double u = static_cast<double>(elapsed) / _scale;
+	double term = 1.0;
+	double sum = 1.0;
+	for (int k = 1; k < response_shape; ++k)
+	{
+		term *= u / k;
+		sum += term;
+	}
+	return std::max(0.0, 1.0 - std::exp(-u) * sum);
+}
+
+// --------------------------------------------------------------------
+ActivationMap::ActivationMap(uint32_t depth, uint32_t lateral, bool detrend)
+    : _depth(depth),
+      _lateral(lateral),
+      _pixels(std::size_t{depth} * lateral),
+      _regressors(detrend ? 3 : 2),
+      _simdLevel(update_chunks.levelFor()),
+      _updateChunk(update_chunks.select(_simdLevel)),
+      _reference(_pixels),
+      _sums(_pixels),
+      _stimulusProducts(_pixels),
+      _timeProducts(detrend ? _pixels : 0),
+      _squares(_pixels)
+{
+	if (_pixels == 0)
+	{
+		throw std::invalid_argument("Activation map: empty image");
+	}
+	reset();
+}
+
+// --------------------------------------------------------------------
+void ActivationMap::add(const frame::Frame<const float, frame::Interleaved<1>>& image,
+                        double stimulus,
+                        double time)
+{
+	checkShape(image.depth(), image.lateral());
+
+	const double regressors[max_regressors]{1.0, stimulus, time};
+	for (std::size_t i = 0; i < _regressors; ++i)
+	{
+		for (std::size_t j = 0; j < _regressors; ++j)
+		{
+			_gram[i][j] += regressors[i] * regressors[j];
+		}
+	}
+
+	// The first image is the reference of the pixels: sums of squares of the deviations
+	// from it stay small
+	const bool first = _count == 0;
+	++_count;
+	const Update update{.image = image.data(),
+	                    .reference = _reference.data(),
+	                    .stimulus = stimulus,
+	                    .time = time,
+	                    .sums = _sums.data(),
+	                    .stimulusProducts = _stimulusProducts.data(),
+	                    .timeProducts = _regressors == 3 ? _timeProducts.data() : nullptr,
+	                    .squares = _squares.data()};
+	scheduler::parallelFor(0, _pixels, tile_pixels,
+	                       [this, &update, first](std::size_t begin, std::size_t end)
+	                       {
+		                       if (first)
+		                       {
+			                       std::copy(update.image + begin, update.image + end,
+			                                 _reference.data() + begin);
+		                       }
+		                       for (std::size_t chunk = begin; chunk < end;
+		                            chunk += chunk_pixels)
+		                       {
+			                       _updateChunk(update, chunk,
+			                                    std::min(chunk_pixels, end - chunk));
+		                       }
+	                       });
+}
+
+// --------------------------------------------------------------------
+void ActivationMap::map(const frame::Frame<float, frame::Interleaved<3>>& out) const
+{
+	checkShape(out.depth(), out.lateral());
+
+	Gram inverse{};
+	if (_count <= _regressors || !invert(_gram, _regressors, inverse))
+	{
+		std::ranges::fill(out.samples(), 0.0f);
+		return;
+	}
+
+	// Solved per pixel from the statistics: slopes = inverse x products, residual sum
+	// of squares = squares - slopes . products
+	const std::size_t regressors = _regressors;
+	const auto degrees = static_cast<double>(_count - regressors);
+	const double countWeight = 1.0 / static_cast<double>(_count);
+	const float* reference = _reference.data();
+	const double* sums = _sums.data();
+	const double* stimulusProducts = _stimulusProducts.data();
+	const double* timeProducts = _timeProducts.data();
+	const double* squares = _squares.data();
+	float* samples = out.data();
+	scheduler::parallelFor(
+	    0, _pixels, tile_pixels,
+	    [=, &inverse](std::size_t first, std::size_t last)
+	    {
+		    for (std::size_t i = first; i < last; ++i)
+		    {
+			    const double products[max_regressors]{
+			        sums[i], stimulusProducts[i],
+			        regressors == 3 ? timeProducts[i] : 0.0};
+			    double fitted = 0.0;
+			    double slope = 0.0;
+			    for (std::size_t r = 0; r < regressors; ++r)
+			    {
+				    double coefficient = 0.0;
+				    for (std::size_t c = 0; c < regressors; ++c)
+				    {
+					    coefficient += inverse[r][c] * products[c];
+				    }
+				    fitted += coefficient * products[r];
+				    slope = r == 1 ? coefficient : slope;
+			    }
+
+			    const double residuals = std::max(squares[i] - fitted, 0.0);
+			    const double error = residuals / degrees * inverse[1][1];
+			    const double t = error > 0.0 ? slope / std::sqrt(error) : 0.0;
+			    const double mean = reference[i] + sums[i] * countWeight;
+
+			    float* pixel = samples + 3 * i;
+			    pixel[0] = static_cast<float>(t);
+			    pixel[1] = static_cast<float>(t / std::sqrt(t * t + degrees));
+			    pixel[2] = static_cast<float>(mean > 0.0 ? slope / mean : 0.0);
+		    }
+	    });
+}
+
+// --------------------------------------------------------------------
+void ActivationMap::reset()
+{
+	_count = 0;
+	for (auto& row : _gram)
+	{
+		std::ranges::fill(row, 0.0);
+	}
+	std::ranges::fill(_reference, 0.0f);
+	std::ranges::fill(_sums, 0.0);
+	std::ranges::fill(_stimulusProducts, 0.0);
+	std::ranges::fill(_timeProducts, 0.0);
+	std::ranges::fill(_squares, 0.0);
+}
+
+// --------------------------------------------------------------------
+void ActivationMap::checkShape(uint32_t depth, uint32_t lateral) const
+{
+	if (depth != _depth || lateral != _lateral)
+	{
+		throw std::invalid_argument(
+		    "Activation map: image of " + std::to_string(depth) + "x" +
+		    std::to_string(lateral) + " pixels instead of " + std::to_string(_depth) +
+		    "x" + std::to_string(_lateral));
+	}
+}
+
+}  // namespace processing
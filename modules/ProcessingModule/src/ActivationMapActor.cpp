@@ -0,0 +1,215 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <caf/actor_cast.hpp>
+#include <caf/typed_event_based_actor.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/Frame.hpp"
+#include "Logger/Logger.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+#include "ProcessingModule/ActivationMapActor.hpp"
+#include "ProcessingModule/LoadShedding.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Buffers of the maps: the consumers hold a few of them at once
+constexpr std::size_t map_buffers = 4;
+
+// --------------------------------------------------------------------
+frame::StimulusSource sourceOf(const std::string& name)
+{
+	frame::StimulusSource source{frame::StimulusSource::Paradigm};
+	if (!frame::from_string(name, source))
+	{
+		throw std::invalid_argument("Invalid source of the stimuli '" + name + "'");
+	}
+	return source;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+activation_map_state::activation_map_state(activation_map_actor::pointer_view self,
+                                           caf::actor source,
+                                           caf::actor events,
+                                           ActivationMapConfig cfg)
+    : _self(self),
+      _source(std::move(source)),
+      _events(std::move(events)),
+      _cfg(std::move(cfg)),
+      _regressor(sourceOf(_cfg.source), _cfg.stimulus_duration, _cfg.response_peak)
+{
+}
+
+// --------------------------------------------------------------------
+activation_map_actor::behavior_type activation_map_state::make_behavior()
+{
+	MEDLOG_INFO("Activation map: {} stimuli, response peak at {} ms, a map every {} "
+	            "images",
+	            _cfg.source,
+	            std::chrono::duration_cast<std::chrono::milliseconds>(_cfg.response_peak)
+	                .count(),
+	            _cfg.period);
+
+	// The maps follow the whole session
+	const auto self = caf::actor_cast<caf::actor>(_self->ctrl());
+	_self->mail(acq_subscribe_v, frame::FrameStream::PowerDoppler, self).send(_source);
+	_self->mail(acq_subscribe_v, frame::FrameStream::Doppler, self).send(_events);
+
+	return {[this](acq_start, const acq_module::AcquisitionParameters&)
+	        {
+		        // Restarted with the first image of the acquisition
+		        if (_activation)
+		        {
+			        _activation->reset();
+		        }
+		        _sinceMap = 0;
+	        },
+	        [this](acq_subscribe, frame::FrameStream stream, caf::actor subscriber)
+	        { subscribe(stream, std::move(subscriber)); },
+	        [this](acq_unsubscribe, frame::FrameStream stream, caf::actor subscriber)
+	        { unsubscribe(stream, subscriber); },
+	        [this](caf::get_atom) -> caf::result<frame::AcquisitionFrame>
+	        {
+		        if (!_activation || _activation->count() == 0)
+		        {
+			        return caf::make_error(caf::sec::runtime_error,
+			                               "Activation map: no image yet");
+		        }
+		        std::optional<frame::AcquisitionFrame> map =
+		            solve(_published > 0 ? _published - 1 : 0);
+		        if (!map)
+		        {
+			        return caf::make_error(caf::sec::runtime_error,
+			                               "Activation map: all the buffers are in use");
+		        }
+		        return std::move(*map);
+	        },
+	        [this](caf::publish_atom, const frame::AcquisitionFrame& image)
+	        {
+		        scheduler::recordMailboxDepth(_self->mailbox().size());
+		        recordStageBacklog(_self->mailbox().size());
+		        process(image);
+	        },
+	        [this](caf::publish_atom, const frame::StimulusEvent& event)
+	        { _regressor.addEvent(event); }};
+}
+
+// --------------------------------------------------------------------
+void activation_map_state::subscribe(frame::FrameStream stream, caf::actor subscriber)
+{
+	if (stream != frame::FrameStream::Activation)
+	{
+		MEDLOG_WARN("Activation map: no {} stream to subscribe to", stream);
+		return;
+	}
+	if (std::ranges::find(_subscribers, subscriber) == _subscribers.end())
+	{
+		_subscribers.push_back(std::move(subscriber));
+	}
+}
+
+// --------------------------------------------------------------------
+void activation_map_state::unsubscribe(frame::FrameStream stream,
+                                       const caf::actor& subscriber)
+{
+	if (stream == frame::FrameStream::Activation)
+	{
+		std::erase(_subscribers, subscriber);
+	}
+}
+
+// --------------------------------------------------------------------
+void activation_map_state::process(const frame::AcquisitionFrame& image)
+{
+	// The images are skipped while the processing falls behind: the maps are fitted on
+	// fewer of them
+	if (image.kind != frame::FrameKind::PowerDoppler || !image.samples ||
+	    stageQuality().level >= QualityLevel::EssentialMaps)
+	{
+		return;
+	}
+
+	try
+	{
+		if (!_activation || image.geometry != _geometry)
+		{
+			_activation.emplace(image.geometry.depth_samples,
+			                    image.geometry.lateral_samples, _cfg.detrend);
+			_geometry = image.geometry;
+			_pool = std::make_unique<frame::SampleBufferPool>(
+			    image.geometry.sampleCount(frame::FrameKind::ActivationMap), map_buffers);
+			_sinceMap = 0;
+			MEDLOG_INFO("Activation map: {}x{} pixels", image.geometry.depth_samples,
+			            image.geometry.lateral_samples);
+		}
+		if (_activation->count() == 0)
+		{
+			_firstTimestamp = image.timestamp;
+		}
+
+		// The drift in seconds from the first image
+		const double stimulus = _regressor.valueAt(image.timestamp);
+		const double time = static_cast<double>(image.timestamp - _firstTimestamp) * 1e-9;
+		_activation->add(frame::viewOf<1>(image), stimulus, time);
+		_lastTimestamp = image.timestamp;
+
+		if (++_sinceMap < _cfg.period || _subscribers.empty())
+		{
+			return;
+		}
+		_sinceMap = 0;
+		const std::optional<frame::AcquisitionFrame> map = solve(_published++);
+		if (!map)
+		{
+			throw std::runtime_error("all the map buffers are in use");
+		}
+		for (const caf::actor& subscriber : _subscribers)
+		{
+			_self->mail(caf::publish_atom_v, *map).send(subscriber);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		MEDLOG_ERROR("Activation map: image {} dropped: {}", image.sequence, e.what());
+	}
+}
+
+// --------------------------------------------------------------------
+std::optional<frame::AcquisitionFrame> activation_map_state::solve(uint64_t sequence)
+{
+	std::shared_ptr<frame::SampleBuffer> samples = _pool->acquire();
+	if (!samples)
+	{
+		return std::nullopt;
+	}
+	_activation->map(
+	    frame::viewOf<3>(*samples, _geometry, frame::FrameKind::ActivationMap));
+	return {.sequence = sequence,
+	        .timestamp = _lastTimestamp,
+	        .stream = frame::FrameStream::Activation,
+	        .kind = frame::FrameKind::ActivationMap,
+	        .geometry = _geometry,
+	        .samples = std::move(samples)};
+}
+
+}  // namespace processing
@@ -0,0 +1,107 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <stdexcept>
+#include <utility>
+
+#include "AcquisitionModule/SequenceCache.hpp"
+#include "Frame/Frame.hpp"
+
+#include "ProcessingModule/BeamformingProcessor.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief IQ images of a worker in use at once, by the consumers or in its queue
+constexpr std::size_t image_buffers = 8;
+}  // namespace
+
+// --------------------------------------------------------------------
+BeamformerCache::BeamformerCache(std::filesystem::path directory)
+    : _sequences(std::move(directory))
+{
+}
+
+// --------------------------------------------------------------------
+std::shared_ptr<const DelayAndSumBeamformer> BeamformerCache::get(
+    const acq_module::AcquisitionParameters& parameters)
+{
+	const uint64_t hash = acq_module::hashOf(parameters);
+
+	std::lock_guard lock(_mutex);
+	Entry& entry = _beamformers[hash];
+	if (!entry.beamformer || entry.parameters != parameters)
+	{
+		entry.beamformer =
+		    std::make_shared<const DelayAndSumBeamformer>(*_sequences.get(parameters));
+		entry.parameters = parameters;
+	}
+	return entry.beamformer;
+}
+
+// --------------------------------------------------------------------
+BeamformingProcessor::BeamformingProcessor(std::shared_ptr<BeamformerCache> cache)
+    : _cache(std::move(cache))
+{
+}
+
+// --------------------------------------------------------------------
+frame::AcquisitionFrame BeamformingProcessor::process(
+    const frame::AcquisitionFrame& frame)
+{
+	if (frame.kind != frame::FrameKind::RawRf)
+	{
+		return frame;
+	}
+	if (!_beamformer)
+	{
+		throw std::runtime_error("Beamforming: no sequence before the RF frames");
+	}
+
+	const auto angle = static_cast<uint32_t>(frame.sequence % _beamformer->angleCount());
+	std::shared_ptr<frame::SampleBuffer> samples = _pool->acquire();
+	if (!samples)
+	{
+		throw std::runtime_error("Beamforming: all the image buffers are in use");
+	}
+	_beamformer->beamform(frame::viewOf<1>(frame), angle,
+	                      frame::viewOf<2>(*samples, _beamformer->outputGeometry(),
+	                                       frame::FrameKind::PlaneWaveIq));
+
+	return frame::AcquisitionFrame{.sequence = frame.sequence,
+	                               .timestamp = frame.timestamp,
+	                               .stream = frame.stream,
+	                               .kind = frame::FrameKind::PlaneWaveIq,
+	                               .geometry = _beamformer->outputGeometry(),
+	                               .samples = std::move(samples)};
+}
+
+// --------------------------------------------------------------------
+void BeamformingProcessor::setSequence(
+    const acq_module::AcquisitionParameters& parameters)
+{
+	std::shared_ptr<const DelayAndSumBeamformer> beamformer = _cache->get(parameters);
+	if (beamformer == _beamformer)
+	{
+		return;
+	}
+
+	const std::size_t imageSize =
+	    beamformer->outputGeometry().sampleCount(frame::FrameKind::CompoundedIq);
+	if (!_pool || _pool->bufferSize() != imageSize)
+	{
+		_pool = std::make_unique<frame::SampleBufferPool>(imageSize, image_buffers);
+	}
+	_beamformer = std::move(beamformer);
+}
+
+}  // namespace processing
@@ -0,0 +1,126 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <exception>
+#include <utility>
+
+#include <caf/actor_cast.hpp>
+#include <caf/typed_event_based_actor.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Logger/Logger.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+#include "ProcessingModule/CompoundingActor.hpp"
+
+namespace processing
+{
+
+// --------------------------------------------------------------------
+compounding_state::compounding_state(compounding_actor::pointer_view self,
+                                     processing_farm_actor source)
+    : _self(self), _source(std::move(source))
+{
+}
+
+// --------------------------------------------------------------------
+compounding_actor::behavior_type compounding_state::make_behavior()
+{
+	return {
+	    [this](acq_start, acq_module::AcquisitionParameters parameters)
+	    {
+		    if (_compounder.incompleteCount() > 0)
+		    {
+			    MEDLOG_WARN("Compounding: {} ensembles missed plane waves",
+			                _compounder.incompleteCount());
+		    }
+		    _compounder = PlaneWaveCompounder(parameters.angle_count);
+		    _self->mail(acq_start_v, std::move(parameters)).send(_source);
+	    },
+	    [this](acq_subscribe, frame::FrameStream stream, caf::actor subscriber)
+	    { subscribe(stream, std::move(subscriber)); },
+	    [this](acq_unsubscribe, frame::FrameStream stream, caf::actor subscriber)
+	    { unsubscribe(stream, subscriber); },
+	    [this](caf::publish_atom, frame::AcquisitionFrame frame)
+	    {
+		    scheduler::recordMailboxDepth(_self->mailbox().size());
+		    if (frame.kind != frame::FrameKind::PlaneWaveIq)
+		    {
+			    publish(frame);
+			    return;
+		    }
+
+		    try
+		    {
+			    _compounder.add(std::move(frame), _compounded);
+		    }
+		    catch (const std::exception& e)
+		    {
+			    MEDLOG_ERROR("Compounding: plane wave dropped: {}", e.what());
+		    }
+		    for (const frame::AcquisitionFrame& compounded : _compounded)
+		    {
+			    publish(compounded);
+		    }
+		    _compounded.clear();
+	    },
+	    [this](caf::publish_atom, const frame::StimulusEvent& event)
+	    {
+		    for (const caf::actor& subscriber :
+		         _subscribers[std::to_underlying(frame::FrameStream::Doppler)])
+		    {
+			    _self->mail(caf::publish_atom_v, event).send(subscriber);
+		    }
+	    }};
+}
+
+// --------------------------------------------------------------------
+void compounding_state::subscribe(frame::FrameStream stream, caf::actor subscriber)
+{
+	std::vector<caf::actor>& subscribers = _subscribers[std::to_underlying(stream)];
+	if (std::ranges::find(subscribers, subscriber) != subscribers.end())
+	{
+		return;
+	}
+
+	// The stage receives the stream from the farm while it has consumers
+	subscribers.push_back(std::move(subscriber));
+	if (subscribers.size() == 1)
+	{
+		_self->mail(acq_subscribe_v, stream, caf::actor_cast<caf::actor>(_self->ctrl()))
+		    .send(_source);
+	}
+}
+
+// --------------------------------------------------------------------
+void compounding_state::unsubscribe(frame::FrameStream stream,
+                                    const caf::actor& subscriber)
+{
+	std::vector<caf::actor>& subscribers = _subscribers[std::to_underlying(stream)];
+	if (std::erase(subscribers, subscriber) == 0 || !subscribers.empty())
+	{
+		return;
+	}
+
+	_self->mail(acq_unsubscribe_v, stream, caf::actor_cast<caf::actor>(_self->ctrl()))
+	    .send(_source);
+}
+
+// --------------------------------------------------------------------
+void compounding_state::publish(const frame::AcquisitionFrame& frame)
+{
+	for (const caf::actor& subscriber : _subscribers[std::to_underlying(frame.stream)])
+	{
+		_self->mail(caf::publish_atom_v, frame).send(subscriber);
+	}
+}
+
+}  // namespace processing
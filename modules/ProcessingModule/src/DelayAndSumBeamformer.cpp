@@ -0,0 +1,302 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#if MEDSIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "ProcessingModule/DelayAndSumBeamformer.hpp"
+
+namespace processing
+{
+
+namespace
+{
+using PixelSums = DelayAndSumBeamformer::PixelSums;
+
+/// @brief Lines beamformed by a job of the task pool
+constexpr std::size_t lines_per_job = 8;
+
+// --------------------------------------------------------------------
+/**
+ * @brief Sums the samples of the elements [first, last) at the delays of a pixel.
+ */
+PixelSums sumScalar(const float* rf,
+                    const float* receiveDelays,
+                    const float* apodization,
+                    const int32_t* channelOffsets,
+                    float transmitDelay,
+                    int32_t lastSample,
+                    std::size_t first,
+                    std::size_t last)
+{
+	PixelSums sums;
+	for (std::size_t e = first; e < last; ++e)
+	{
+		// Delays are positive: truncating rounds to the nearest sample
+		const auto sample = static_cast<int32_t>(transmitDelay + receiveDelays[e] + 0.5f);
+		if (sample < lastSample)
+		{
+			const float* at = rf + channelOffsets[e] + sample;
+			sums.sum += apodization[e] * at[0];
+			sums.quadrature += apodization[e] * at[1];
+		}
+	}
+	return sums;
+}
+
+#if MEDSIMD_X86
+// --------------------------------------------------------------------
+MEDSIMD_TARGET_AVX2 float reduceAdd(__m256 values)
+{
+	const __m128 half =
+	    _mm_add_ps(_mm256_castps256_ps128(values), _mm256_extractf128_ps(values, 1));
+	const __m128 quarter = _mm_add_ps(half, _mm_movehl_ps(half, half));
+	return _mm_cvtss_f32(_mm_add_ss(quarter, _mm_shuffle_ps(quarter, quarter, 1)));
+}
+
+// --------------------------------------------------------------------
+// The masked forms of the intrinsics avoid undefined source registers, which GCC 12
+// reports as uninitialized
+MEDSIMD_TARGET_AVX512 float reduceAdd(__m512 values)
+{
+	const __m512d both = _mm512_castps_pd(values);
+	const __m256d low = _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xF, both, 0);
+	const __m256d high = _mm512_mask_extractf64x4_pd(_mm256_setzero_pd(), 0xF, both, 1);
+	return reduceAdd(_mm256_add_ps(_mm256_castpd_ps(low), _mm256_castpd_ps(high)));
+}
+
+// --------------------------------------------------------------------
+MEDSIMD_TARGET_AVX512 PixelSums sumAvx512(const float* rf,
+                                          const float* receiveDelays,
+                                          const float* apodization,
+                                          const int32_t* channelOffsets,
+                                          float transmitDelay,
+                                          int32_t lastSample,
+                                          std::size_t first,
+                                          std::size_t last)
+{
+	constexpr std::size_t lanes = 16;
+	const __m512 delay = _mm512_set1_ps(transmitDelay + 0.5f);
+	const __m512i limit = _mm512_set1_epi32(lastSample);
+	const __m512 zero = _mm512_setzero_ps();
+	__m512 sum = zero;
+	__m512 quadrature = zero;
+
+	std::size_t e = first;
+	for (; e + lanes <= last; e += lanes)
+	{
+		const __m512i sample = _mm512_maskz_cvttps_epi32(
+		    0xFFFF, _mm512_add_ps(delay, _mm512_loadu_ps(receiveDelays + e)));
+		const __mmask16 valid = _mm512_cmplt_epi32_mask(sample, limit);
+		const __m512i index =
+		    _mm512_add_epi32(sample, _mm512_loadu_si512(channelOffsets + e));
+		const __m512 weight = _mm512_loadu_ps(apodization + e);
+		const __m512 samples = _mm512_mask_i32gather_ps(zero, valid, index, rf, 4);
+		const __m512 next = _mm512_mask_i32gather_ps(zero, valid, index, rf + 1, 4);
+		sum = _mm512_add_ps(sum, _mm512_mul_ps(weight, samples));
+		quadrature = _mm512_add_ps(quadrature, _mm512_mul_ps(weight, next));
+	}
+
+	PixelSums tail = sumScalar(rf, receiveDelays, apodization, channelOffsets,
+	                           transmitDelay, lastSample, e, last);
+	tail.sum += reduceAdd(sum);
+	tail.quadrature += reduceAdd(quadrature);
+	return tail;
+}
+
+// --------------------------------------------------------------------
+MEDSIMD_TARGET_AVX2 PixelSums sumAvx2(const float* rf,
+                                      const float* receiveDelays,
+                                      const float* apodization,
+                                      const int32_t* channelOffsets,
+                                      float transmitDelay,
+                                      int32_t lastSample,
+                                      std::size_t first,
+                                      std::size_t last)
+{
+	constexpr std::size_t lanes = 8;
+	const __m256 delay = _mm256_set1_ps(transmitDelay + 0.5f);
+	const __m256i limit = _mm256_set1_epi32(lastSample);
+	const __m256 zero = _mm256_setzero_ps();
+	__m256 sum = zero;
+	__m256 quadrature = zero;
+
+	std::size_t e = first;
+	for (; e + lanes <= last; e += lanes)
+	{
+		const __m256i sample =
+		    _mm256_cvttps_epi32(_mm256_add_ps(delay, _mm256_loadu_ps(receiveDelays + e)));
+		const __m256 valid = _mm256_castsi256_ps(_mm256_cmpgt_epi32(limit, sample));
+		const __m256i index = _mm256_add_epi32(
+		    sample,
+		    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(channelOffsets + e)));
+		const __m256 weight = _mm256_loadu_ps(apodization + e);
+		const __m256 samples = _mm256_mask_i32gather_ps(zero, rf, index, valid, 4);
+		const __m256 next = _mm256_mask_i32gather_ps(zero, rf + 1, index, valid, 4);
+		sum = _mm256_add_ps(sum, _mm256_mul_ps(weight, samples));
+		quadrature = _mm256_add_ps(quadrature, _mm256_mul_ps(weight, next));
+	}
+
+	PixelSums tail = sumScalar(rf, receiveDelays, apodization, channelOffsets,
+	                           transmitDelay, lastSample, e, last);
+	tail.sum += reduceAdd(sum);
+	tail.quadrature += reduceAdd(quadrature);
+	return tail;
+}
+#endif
+
+/// @brief Sums of a pixel for each instruction set
+constexpr simd::KernelVariants<DelayAndSumBeamformer::PixelSumFunction> pixel_sums{
+    .scalar = sumScalar,
+#if MEDSIMD_X86
+    .avx2 = sumAvx2,
+    .avx512 = sumAvx512,
+#endif
+};
+}  // namespace
+
+// --------------------------------------------------------------------
+DelayAndSumBeamformer::DelayAndSumBeamformer(const acq_module::CompiledSequence& sequence,
+                                             float fNumber)
+    : _angles(sequence.parameters.angle_count),
+      _elements(sequence.parameters.element_count),
+      _depth(sequence.parameters.depth_samples),
+      _simdLevel(pixel_sums.levelFor()),
+      _sumPixel(pixel_sums.select(_simdLevel))
+{
+	if (!(fNumber > 0.0f))
+	{
+		throw std::invalid_argument("Invalid beamforming F-number: must be positive");
+	}
+
+	const acq_module::AcquisitionParameters& parameters = sequence.parameters;
+	const std::size_t span = 2 * std::size_t{_elements} - 1;
+	const float fs = parameters.sampling_frequency;
+
+	// Plane wave reaching the pixel: emitted by the element of the line, then straight
+	// down at the steering angle. Depth sample i is at z = i c / (2 fs).
+	_transmitDelays.resize(std::size_t{_angles} * _elements * _depth);
+	for (std::size_t a = 0; a < _angles; ++a)
+	{
+		const float halfCos = std::cos(acq_module::steeringAngle(parameters, a)) / 2.0f;
+		for (std::size_t line = 0; line < _elements; ++line)
+		{
+			const float emission = sequence.transmit_delays[a * _elements + line] * fs;
+			float* delays = _transmitDelays.data() + (a * _elements + line) * _depth;
+			for (std::size_t i = 0; i < _depth; ++i)
+			{
+				delays[i] = emission + static_cast<float>(i) * halfCos;
+			}
+		}
+	}
+
+	// Receive delays are symmetric around the line
+	_receiveDelays.resize(std::size_t{_depth} * span);
+	_halfApertures.resize(_depth);
+	for (std::size_t i = 0; i < _depth; ++i)
+	{
+		const float* delays = sequence.receive_delays.data() + i * _elements;
+		float* mirrored = _receiveDelays.data() + i * span + (_elements - 1);
+		for (std::size_t offset = 0; offset < _elements; ++offset)
+		{
+			mirrored[offset] = delays[offset];
+			*(mirrored - offset) = delays[offset];
+		}
+
+		const float z = static_cast<float>(i) * parameters.sound_speed / (2.0f * fs);
+		const float halfWidth = z / (2.0f * fNumber);
+		_halfApertures[i] = std::min(static_cast<uint32_t>(halfWidth / parameters.pitch),
+		                             _elements - 1);
+	}
+
+	_apodization = sequence.apodization;
+	_channelOffsets.resize(_elements);
+	for (std::size_t e = 0; e < _elements; ++e)
+	{
+		_channelOffsets[e] = static_cast<int32_t>(e * _depth);
+	}
+}
+
+// --------------------------------------------------------------------
+void DelayAndSumBeamformer::beamform(
+    const frame::Frame<const float, frame::Interleaved<1>>& rf,
+    uint32_t angle,
+    const frame::Frame<float, frame::Interleaved<2>>& iq) const
+{
+	if (rf.depth() != _depth || rf.lateral() != _elements || !iq.sameShape(rf) ||
+	    angle >= _angles)
+	{
+		throw std::invalid_argument("Beamforming: frame does not match the sequence");
+	}
+
+	scheduler::parallelFor(0, _elements, lines_per_job,
+	                       [this, &rf, angle, &iq](std::size_t first, std::size_t last)
+	                       { beamformLines(rf.data(), angle, first, last, iq.data()); });
+}
+
+// --------------------------------------------------------------------
+void DelayAndSumBeamformer::beamformLines(const float* rf,
+                                          uint32_t angle,
+                                          std::size_t first,
+                                          std::size_t last,
+                                          float* iq) const
+{
+	const std::size_t span = 2 * std::size_t{_elements} - 1;
+	// The sample in quadrature must be in the frame too
+	const auto lastSample = static_cast<int32_t>(_depth) - 1;
+
+	for (std::size_t line = first; line < last; ++line)
+	{
+		const float* transmitDelays =
+		    _transmitDelays.data() + (std::size_t{angle} * _elements + line) * _depth;
+		float* pixels = iq + 2 * line * _depth;
+
+		for (std::size_t i = 0; i < _depth; ++i)
+		{
+			// Indexed by element
+			const float* receiveDelays =
+			    _receiveDelays.data() + i * span + (_elements - 1) - line;
+			const std::size_t half = _halfApertures[i];
+			const std::size_t begin = line > half ? line - half : 0;
+			const std::size_t end = std::min<std::size_t>(line + half + 1, _elements);
+
+			const PixelSums sums =
+			    _sumPixel(rf, receiveDelays, _apodization.data(), _channelOffsets.data(),
+			              transmitDelays[i], lastSample, begin, end);
+			// Analytic signal: the sample a quarter period later is -sin
+			pixels[2 * i] = sums.sum;
+			pixels[2 * i + 1] = -sums.quadrature;
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+frame::FrameGeometry DelayAndSumBeamformer::inputGeometry() const
+{
+	return frame::FrameGeometry{
+	    .depth_samples = _depth, .lateral_samples = 0, .channels = _elements};
+}
+
+// --------------------------------------------------------------------
+frame::FrameGeometry DelayAndSumBeamformer::outputGeometry() const
+{
+	return frame::FrameGeometry{
+	    .depth_samples = _depth, .lateral_samples = _elements, .channels = 0};
+}
+
+}  // namespace processing
@@ -0,0 +1,143 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <utility>
+
+#include "ProcessingModule/LoadShedding.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Quality of the stages after the farm: level in the high word, decimation in
+/// the low one
+std::atomic<uint64_t> _stageQuality{1};
+
+/// @brief Backlog of the stages after the farm in the current window
+std::atomic<std::size_t> _maxStageBacklog{0};
+}  // namespace
+
+// --------------------------------------------------------------------
+LoadSheddingPolicy::LoadSheddingPolicy(const LoadSheddingConfig& cfg,
+                                       QualityLevel maxLevel)
+    : _cfg(cfg), _maxLevel(maxLevel)
+{
+}
+
+// --------------------------------------------------------------------
+QualityLevel LoadSheddingPolicy::update(std::size_t backlog,
+                                        std::chrono::nanoseconds latency)
+{
+	const bool behind = backlog > _cfg.max_backlog || latency > _cfg.max_latency;
+	const bool quiet = backlog <= _cfg.max_backlog / 4 && latency < _cfg.max_latency / 2;
+
+	if (behind)
+	{
+		_quietCount = 0;
+		if (_level < _maxLevel)
+		{
+			_level = static_cast<QualityLevel>(std::to_underlying(_level) + 1);
+		}
+	}
+	else if (quiet && ++_quietCount >= _cfg.recovery_samples)
+	{
+		_quietCount = 0;
+		if (_level > QualityLevel::Full)
+		{
+			_level = static_cast<QualityLevel>(std::to_underlying(_level) - 1);
+		}
+	}
+	else if (!quiet)
+	{
+		_quietCount = 0;
+	}
+
+	return _level;
+}
+
+// --------------------------------------------------------------------
+void setStageQuality(StageQuality quality)
+{
+	_stageQuality.store(uint64_t{std::to_underlying(quality.level)} << 32 |
+	                         quality.resolution_step,
+	                     std::memory_order_relaxed);
+}
+
+// --------------------------------------------------------------------
+StageQuality stageQuality()
+{
+	const uint64_t packed = _stageQuality.load(std::memory_order_relaxed);
+	return {.level = static_cast<QualityLevel>(packed >> 32),
+	        .resolution_step = static_cast<uint32_t>(packed)};
+}
+
+// --------------------------------------------------------------------
+void recordStageBacklog(std::size_t depth)
+{
+	std::size_t currentMax = _maxStageBacklog.load(std::memory_order_relaxed);
+	while (depth > currentMax &&
+	       !_maxStageBacklog.compare_exchange_weak(currentMax, depth,
+	                                               std::memory_order_relaxed))
+	{
+	}
+}
+
+// --------------------------------------------------------------------
+std::size_t takeStageBacklog()
+{
+	return _maxStageBacklog.exchange(0, std::memory_order_relaxed);
+}
+
+// --------------------------------------------------------------------
+frame::AcquisitionFrame reduceResolution(const frame::AcquisitionFrame& frame,
+                                         uint32_t step)
+{
+	if (step < 2 || !frame.samples)
+	{
+		return frame;
+	}
+
+	const frame::FrameGeometry& in = frame.geometry;
+	frame::AcquisitionFrame reduced = frame;
+	reduced.geometry.depth_samples = (in.depth_samples + step - 1) / step;
+
+	// Columns of the frame: lines of pixels or channels, stored depth first
+	const uint32_t columns = in.columnCount(frame.kind);
+	const std::size_t floatsPerSample = frame::componentCount(frame.kind);
+	uint32_t columnStep = 1;
+	if (frame.kind != frame::FrameKind::RawRf)
+	{
+		reduced.geometry.lateral_samples = (in.lateral_samples + step - 1) / step;
+		columnStep = step;
+	}
+
+	const frame::SampleBuffer& source = *frame.samples;
+	auto samples = std::make_shared<frame::SampleBuffer>();
+	samples->reserve(reduced.geometry.sampleCount(frame.kind));
+	for (uint32_t x = 0; x < columns; x += columnStep)
+	{
+		const std::size_t column = std::size_t{x} * in.depth_samples;
+		for (uint32_t z = 0; z < in.depth_samples; z += step)
+		{
+			const auto offset = (column + z) * floatsPerSample;
+			const auto first = source.begin() + static_cast<std::ptrdiff_t>(offset);
+			samples->insert(samples->end(), first,
+			                first + static_cast<std::ptrdiff_t>(floatsPerSample));
+		}
+	}
+	reduced.samples = std::move(samples);
+	return reduced;
+}
+
+}  // namespace processing
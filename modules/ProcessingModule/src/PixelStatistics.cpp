@@ -0,0 +1,344 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#include "ProcessingModule/PixelStatistics.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Pixels of a job of the task pool
+constexpr std::size_t tile_pixels = 4096;
+
+/// @brief Pixels updated together: the chunk of the image stays in L1 from one pass of
+/// the kernel to the next
+constexpr std::size_t chunk_pixels = 512;
+
+constexpr float infinity = std::numeric_limits<float>::infinity();
+
+using Update = PixelStatistics::Update;
+
+// --------------------------------------------------------------------
+/**
+ * @brief Welford's update of the mean and of the sum of squared deviations of `count`
+ * pixels with a new image, `weight` = 1 / images including the new one.
+ */
+inline void addImage(const float* image,
+                     double weight,
+                     double* mean,
+                     double* m2,
+                     std::size_t count)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const double x = image[i];
+		const double delta = x - mean[i];
+		mean[i] += delta * weight;
+		m2[i] += delta * (x - mean[i]);
+	}
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Same as addImage, the image `oldest` leaving the window at the same time:
+ * `weight` = 1 / images of the window.
+ */
+inline void replaceImage(const float* image,
+                         const float* oldest,
+                         double weight,
+                         double* mean,
+                         double* m2,
+                         std::size_t count)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		const double x = image[i];
+		const double y = oldest[i];
+		const double previous = mean[i];
+		mean[i] = previous + (x - y) * weight;
+		m2[i] += (x - y) * (x - mean[i] + y - previous);
+	}
+}
+
+// --------------------------------------------------------------------
+inline void foldMinMax(const float* image, float* low, float* high, std::size_t count)
+{
+	for (std::size_t i = 0; i < count; ++i)
+	{
+		low[i] = image[i] < low[i] ? image[i] : low[i];
+		high[i] = image[i] > high[i] ? image[i] : high[i];
+	}
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Updates the statistics of the pixels [first, first + count) with an image.
+ */
+inline void updateChunk(const Update& u, std::size_t first, std::size_t count)
+{
+	const float* image = u.image + first;
+	addImage(image, u.sessionWeight, u.sessionMean + first, u.sessionM2 + first, count);
+	foldMinMax(image, u.sessionMin + first, u.sessionMax + first, count);
+	if (u.oldest != nullptr)
+	{
+		replaceImage(image, u.oldest + first, u.windowWeight, u.windowMean + first,
+		             u.windowM2 + first, count);
+	}
+	else
+	{
+		addImage(image, u.windowWeight, u.windowMean + first, u.windowM2 + first, count);
+	}
+	foldMinMax(image, u.newestMin + first, u.newestMax + first, count);
+}
+
+// --------------------------------------------------------------------
+// The kernel is plain C++ vectorized by the compiler. The AVX2 and AVX-512 variants
+// inline it (flatten) to vectorize it for the wider registers.
+void updateScalar(const Update& u, std::size_t first, std::size_t count)
+{
+	updateChunk(u, first, count);
+}
+
+#if MEDSIMD_X86
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+void updateAvx2(const Update& u, std::size_t first, std::size_t count)
+{
+	updateChunk(u, first, count);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+void updateAvx512(const Update& u, std::size_t first, std::size_t count)
+{
+	updateChunk(u, first, count);
+}
+#endif
+
+/// @brief Kernel of the chunks for each instruction set
+constexpr simd::KernelVariants<PixelStatistics::UpdateChunk> update_chunks{
+    .scalar = updateScalar,
+#if MEDSIMD_X86
+    .avx2 = updateAvx2,
+    .avx512 = updateAvx512,
+#endif
+};
+}  // namespace
+
+// --------------------------------------------------------------------
+PixelStatistics::PixelStatistics(uint32_t window, uint32_t depth, uint32_t lateral)
+    : _window(window),
+      _depth(depth),
+      _lateral(lateral),
+      _pixels(std::size_t{depth} * lateral),
+      _simdLevel(update_chunks.levelFor()),
+      _updateChunk(update_chunks.select(_simdLevel)),
+      _sessionMean(_pixels),
+      _sessionM2(_pixels),
+      _sessionMin(_pixels),
+      _sessionMax(_pixels),
+      _images(_window * _pixels),
+      _windowMean(_pixels),
+      _windowM2(_pixels),
+      _suffixMin(_window * _pixels),
+      _suffixMax(_window * _pixels),
+      _newestMin(_pixels),
+      _newestMax(_pixels)
+{
+	if (window == 0)
+	{
+		throw std::invalid_argument("Pixel statistics: empty window");
+	}
+	if (_pixels == 0)
+	{
+		throw std::invalid_argument("Pixel statistics: empty image");
+	}
+	reset();
+}
+
+// --------------------------------------------------------------------
+void PixelStatistics::add(const frame::Frame<const float, frame::Interleaved<1>>& image)
+{
+	checkShape(image.depth(), image.lateral());
+
+	// Once full, the window replaces its oldest image. When the oldest stack runs out,
+	// the whole window becomes the oldest stack.
+	const bool full = _windowCount == _window;
+	const bool fold = full && _oldestCount == 0;
+	float* slot = _images.data() + _nextSlot * _pixels;
+
+	++_sessionCount;
+	_windowCount = std::min(_windowCount + 1, _window);
+	const Update update{.image = image.data(),
+	                    .oldest = full ? slot : nullptr,
+	                    .sessionWeight = 1.0 / static_cast<double>(_sessionCount),
+	                    .windowWeight = 1.0 / static_cast<double>(_windowCount),
+	                    .sessionMean = _sessionMean.data(),
+	                    .sessionM2 = _sessionM2.data(),
+	                    .sessionMin = _sessionMin.data(),
+	                    .sessionMax = _sessionMax.data(),
+	                    .windowMean = _windowMean.data(),
+	                    .windowM2 = _windowM2.data(),
+	                    .newestMin = _newestMin.data(),
+	                    .newestMax = _newestMax.data()};
+	scheduler::parallelFor(
+	    0, _pixels, tile_pixels,
+	    [this, &update, fold, slot](std::size_t first, std::size_t last)
+	    {
+		    if (fold)
+		    {
+			    foldWindow(first, last);
+		    }
+		    for (std::size_t chunk = first; chunk < last; chunk += chunk_pixels)
+		    {
+			    _updateChunk(update, chunk, std::min(chunk_pixels, last - chunk));
+		    }
+		    // The oldest image is read by the update before being replaced
+		    std::copy(update.image + first, update.image + last, slot + first);
+	    });
+
+	if (fold)
+	{
+		_oldestCount = _window;
+	}
+	if (full)
+	{
+		--_oldestCount;
+	}
+	_nextSlot = (_nextSlot + 1) % _window;
+}
+
+// --------------------------------------------------------------------
+void PixelStatistics::sessionSnapshot(
+    const frame::Frame<float, frame::Interleaved<4>>& out) const
+{
+	snapshot(_sessionMean.data(), _sessionM2.data(), _sessionCount, false, out);
+}
+
+// --------------------------------------------------------------------
+void PixelStatistics::windowSnapshot(
+    const frame::Frame<float, frame::Interleaved<4>>& out) const
+{
+	snapshot(_windowMean.data(), _windowM2.data(), _windowCount, true, out);
+}
+
+// --------------------------------------------------------------------
+void PixelStatistics::reset()
+{
+	_sessionCount = 0;
+	std::ranges::fill(_sessionMean, 0.0);
+	std::ranges::fill(_sessionM2, 0.0);
+	std::ranges::fill(_sessionMin, infinity);
+	std::ranges::fill(_sessionMax, -infinity);
+
+	_nextSlot = 0;
+	_windowCount = 0;
+	std::ranges::fill(_windowMean, 0.0);
+	std::ranges::fill(_windowM2, 0.0);
+	_oldestCount = 0;
+	std::ranges::fill(_newestMin, infinity);
+	std::ranges::fill(_newestMax, -infinity);
+}
+
+// --------------------------------------------------------------------
+void PixelStatistics::checkShape(uint32_t depth, uint32_t lateral) const
+{
+	if (depth != _depth || lateral != _lateral)
+	{
+		throw std::invalid_argument(
+		    "Pixel statistics: image of " + std::to_string(depth) + "x" +
+		    std::to_string(lateral) + " pixels instead of " + std::to_string(_depth) + "x" +
+		    std::to_string(_lateral));
+	}
+}
+
+// --------------------------------------------------------------------
+void PixelStatistics::foldWindow(std::size_t first, std::size_t last)
+{
+	// From the newest image, the slot before the next one, to the oldest
+	const std::size_t count = last - first;
+	std::size_t slot = (_nextSlot + _window - 1) % _window;
+	const float* image = _images.data() + slot * _pixels + first;
+	std::copy_n(image, count, _suffixMin.data() + slot * _pixels + first);
+	std::copy_n(image, count, _suffixMax.data() + slot * _pixels + first);
+	for (std::size_t k = 1; k < _window; ++k)
+	{
+		const std::size_t newer = slot;
+		slot = (slot + _window - 1) % _window;
+		image = _images.data() + slot * _pixels + first;
+		const float* newerMin = _suffixMin.data() + newer * _pixels + first;
+		const float* newerMax = _suffixMax.data() + newer * _pixels + first;
+		float* low = _suffixMin.data() + slot * _pixels + first;
+		float* high = _suffixMax.data() + slot * _pixels + first;
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			low[i] = image[i] < newerMin[i] ? image[i] : newerMin[i];
+			high[i] = image[i] > newerMax[i] ? image[i] : newerMax[i];
+		}
+	}
+
+	// The newest stack starts empty
+	std::fill_n(_newestMin.data() + first, count, infinity);
+	std::fill_n(_newestMax.data() + first, count, -infinity);
+}
+
+// --------------------------------------------------------------------
+void PixelStatistics::snapshot(
+    const double* mean,
+    const double* m2,
+    std::size_t count,
+    bool window,
+    const frame::Frame<float, frame::Interleaved<4>>& out) const
+{
+	checkShape(out.depth(), out.lateral());
+	if (count == 0)
+	{
+		std::ranges::fill(out.samples(), 0.0f);
+		return;
+	}
+
+	// Min and max of the window: of its oldest stack from the oldest image, and of its
+	// newest stack
+	const float* low = window ? _newestMin.data() : _sessionMin.data();
+	const float* high = window ? _newestMax.data() : _sessionMax.data();
+	const float* oldestLow = nullptr;
+	const float* oldestHigh = nullptr;
+	if (window && _oldestCount > 0)
+	{
+		oldestLow = _suffixMin.data() + _nextSlot * _pixels;
+		oldestHigh = _suffixMax.data() + _nextSlot * _pixels;
+	}
+
+	const double unbiased = count > 1 ? 1.0 / static_cast<double>(count - 1) : 0.0;
+	float* samples = out.data();
+	scheduler::parallelFor(
+	    0, _pixels, tile_pixels,
+	    [=](std::size_t first, std::size_t last)
+	    {
+		    for (std::size_t i = first; i < last; ++i)
+		    {
+			    float* pixel = samples + 4 * i;
+			    pixel[0] = static_cast<float>(mean[i]);
+			    pixel[1] = static_cast<float>(std::max(m2[i], 0.0) * unbiased);
+			    pixel[2] = oldestLow != nullptr ? std::min(oldestLow[i], low[i]) : low[i];
+			    pixel[3] =
+			        oldestHigh != nullptr ? std::max(oldestHigh[i], high[i]) : high[i];
+		    }
+	    });
+}
+
+}  // namespace processing
@@ -0,0 +1,143 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include <caf/actor_cast.hpp>
+#include <caf/typed_event_based_actor.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/Frame.hpp"
+#include "Logger/Logger.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+#include "ProcessingModule/LoadShedding.hpp"
+#include "ProcessingModule/PixelStatisticsActor.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Buffers of the snapshots: the requesters hold a few of them at once
+constexpr std::size_t snapshot_buffers = 4;
+}  // namespace
+
+// --------------------------------------------------------------------
+pixel_statistics_state::pixel_statistics_state(pixel_statistics_actor::pointer_view self,
+                                               caf::actor source,
+                                               PixelStatisticsConfig cfg)
+    : _self(self), _source(std::move(source)), _cfg(std::move(cfg))
+{
+}
+
+// --------------------------------------------------------------------
+pixel_statistics_actor::behavior_type pixel_statistics_state::make_behavior()
+{
+	MEDLOG_INFO("Pixel statistics: sliding window of {} images", _cfg.window);
+
+	// The statistics follow the whole session
+	_self
+	    ->mail(acq_subscribe_v, frame::FrameStream::PowerDoppler,
+	           caf::actor_cast<caf::actor>(_self->ctrl()))
+	    .send(_source);
+
+	return {[this](acq_start, const acq_module::AcquisitionParameters&)
+	        {
+		        // Restarted with the first image of the acquisition
+		        _statistics.reset();
+	        },
+	        [this](caf::get_atom)
+	            -> caf::result<frame::AcquisitionFrame, frame::AcquisitionFrame>
+	        {
+		        if (!_statistics || _statistics->sessionCount() == 0)
+		        {
+			        return caf::make_error(caf::sec::runtime_error,
+			                               "Pixel statistics: no image yet");
+		        }
+		        std::optional<frame::AcquisitionFrame> session = snapshot(false);
+		        std::optional<frame::AcquisitionFrame> window = snapshot(true);
+		        if (!session || !window)
+		        {
+			        return caf::make_error(caf::sec::runtime_error,
+			                               "Pixel statistics: all the buffers are in use");
+		        }
+		        return {std::move(*session), std::move(*window)};
+	        },
+	        [this](caf::publish_atom, const frame::AcquisitionFrame& image)
+	        {
+		        scheduler::recordMailboxDepth(_self->mailbox().size());
+		        recordStageBacklog(_self->mailbox().size());
+		        process(image);
+	        },
+	        [](caf::publish_atom, const frame::StimulusEvent&) {}};
+}
+
+// --------------------------------------------------------------------
+void pixel_statistics_state::process(const frame::AcquisitionFrame& image)
+{
+	// Skipped while the processing falls behind
+	if (image.kind != frame::FrameKind::PowerDoppler || !image.samples ||
+	    stageQuality().level >= QualityLevel::EssentialMaps)
+	{
+		return;
+	}
+
+	try
+	{
+		if (!_statistics || image.geometry != _geometry)
+		{
+			_statistics.emplace(_cfg.window, image.geometry.depth_samples,
+			                    image.geometry.lateral_samples);
+			_geometry = image.geometry;
+			_pool = std::make_unique<frame::SampleBufferPool>(
+			    image.geometry.sampleCount(frame::FrameKind::PixelStatistics),
+			    snapshot_buffers);
+			MEDLOG_INFO("Pixel statistics: {}x{} pixels", image.geometry.depth_samples,
+			            image.geometry.lateral_samples);
+		}
+		_statistics->add(frame::viewOf<1>(image));
+		_lastTimestamp = image.timestamp;
+	}
+	catch (const std::exception& e)
+	{
+		MEDLOG_ERROR("Pixel statistics: image {} dropped: {}", image.sequence, e.what());
+	}
+}
+
+// --------------------------------------------------------------------
+std::optional<frame::AcquisitionFrame> pixel_statistics_state::snapshot(bool window)
+{
+	std::shared_ptr<frame::SampleBuffer> samples = _pool->acquire();
+	if (!samples)
+	{
+		return std::nullopt;
+	}
+	const auto maps =
+	    frame::viewOf<4>(*samples, _geometry, frame::FrameKind::PixelStatistics);
+	if (window)
+	{
+		_statistics->windowSnapshot(maps);
+	}
+	else
+	{
+		_statistics->sessionSnapshot(maps);
+	}
+	return {.sequence = _nextSequence++,
+	        .timestamp = _lastTimestamp,
+	        .stream = frame::FrameStream::PowerDoppler,
+	        .kind = frame::FrameKind::PixelStatistics,
+	        .geometry = _geometry,
+	        .samples = std::move(samples)};
+}
+
+}  // namespace processing
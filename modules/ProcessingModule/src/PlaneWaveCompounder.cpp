@@ -0,0 +1,166 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "Scheduler/TaskPool.hpp"
+
+#include "ProcessingModule/PlaneWaveCompounder.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Floats of a tile of the compounded image: 16 KB, held in the L1 cache while
+/// the images are added to it
+constexpr std::size_t tile_floats = 4096;
+
+/// @brief Compounded frames in use at once by the consumers
+constexpr std::size_t compounded_buffers = 8;
+}  // namespace
+
+// --------------------------------------------------------------------
+void compoundImages(std::span<const ConstIqImage> images,
+                    float gain,
+                    const IqImage& out)
+{
+	if (images.empty())
+	{
+		throw std::invalid_argument("Compounding: no image");
+	}
+	for (const ConstIqImage& image : images)
+	{
+		if (!image.sameShape(out))
+		{
+			throw std::invalid_argument(
+			    "Compounding: image of " + std::to_string(image.depth()) + "x" +
+			    std::to_string(image.lateral()) + " pixels instead of " +
+			    std::to_string(out.depth()) + "x" + std::to_string(out.lateral()));
+		}
+	}
+
+	const std::size_t size = out.samples().size();
+	scheduler::parallelFor(
+	    0, size, tile_floats,
+	    [images, gain, &out](std::size_t first, std::size_t last)
+	    {
+		    for (std::size_t tile = first; tile < last; tile += tile_floats)
+		    {
+			    const std::size_t count = std::min(tile_floats, last - tile);
+			    float* sum = out.data() + tile;
+			    const float* image = images[0].data() + tile;
+			    for (std::size_t i = 0; i < count; ++i)
+			    {
+				    sum[i] = image[i];
+			    }
+			    for (std::size_t k = 1; k < images.size(); ++k)
+			    {
+				    image = images[k].data() + tile;
+				    for (std::size_t i = 0; i < count; ++i)
+				    {
+					    sum[i] += image[i];
+				    }
+			    }
+			    for (std::size_t i = 0; i < count; ++i)
+			    {
+				    sum[i] *= gain;
+			    }
+		    }
+	    });
+}
+
+// --------------------------------------------------------------------
+PlaneWaveCompounder::PlaneWaveCompounder(uint32_t angles)
+    : _angles(std::max(angles, 1U))
+{
+}
+
+// --------------------------------------------------------------------
+void PlaneWaveCompounder::add(frame::AcquisitionFrame planeWave,
+                              std::vector<frame::AcquisitionFrame>& compounded)
+{
+	if (planeWave.kind != frame::FrameKind::PlaneWaveIq || !planeWave.samples)
+	{
+		throw std::invalid_argument("Compounding: " + to_string(planeWave.kind) +
+		                            " frame instead of a plane wave image");
+	}
+	// Samples of another size than the geometry are rejected before being held
+	static_cast<void>(frame::viewOf<2>(planeWave));
+
+	const auto stream = std::to_underlying(planeWave.stream);
+	std::vector<frame::AcquisitionFrame>& pending = _pending[stream];
+	const uint64_t ensemble = planeWave.sequence / _angles;
+	if (!pending.empty() && pending.front().sequence / _angles != ensemble)
+	{
+		compoundPending(stream, compounded);
+	}
+
+	// The plane waves arrive in order: none of the ensemble is expected after the last
+	const bool last = planeWave.sequence % _angles == _angles - 1;
+	pending.push_back(std::move(planeWave));
+	if (last || pending.size() == _angles)
+	{
+		compoundPending(stream, compounded);
+	}
+}
+
+// --------------------------------------------------------------------
+void PlaneWaveCompounder::compoundPending(std::size_t stream,
+                                          std::vector<frame::AcquisitionFrame>& compounded)
+{
+	std::vector<frame::AcquisitionFrame>& pending = _pending[stream];
+	const frame::AcquisitionFrame& last = pending.back();
+	const std::size_t size = last.samples->size();
+	if (!_pool || _pool->bufferSize() != size)
+	{
+		_pool = std::make_unique<frame::SampleBufferPool>(size, compounded_buffers);
+	}
+
+	// The images of another geometry, from a previous sequence, are left out
+	std::vector<ConstIqImage> images;
+	for (const frame::AcquisitionFrame& planeWave : pending)
+	{
+		if (planeWave.geometry == last.geometry)
+		{
+			images.push_back(frame::viewOf<2>(planeWave));
+		}
+	}
+	if (images.size() < _angles)
+	{
+		++_incomplete;
+	}
+
+	std::shared_ptr<frame::SampleBuffer> samples = _pool->acquire();
+	if (!samples)
+	{
+		// All the compounded frames are held downstream: the ensemble is lost
+		++_dropped;
+		pending.clear();
+		return;
+	}
+	const float gain = static_cast<float>(_angles) / static_cast<float>(images.size());
+	const IqImage out =
+	    frame::viewOf<2>(*samples, last.geometry, frame::FrameKind::PlaneWaveIq);
+	compoundImages(images, gain, out);
+
+	compounded.push_back({.sequence = last.sequence / _angles,
+	                      .timestamp = last.timestamp,
+	                      .stream = last.stream,
+	                      .kind = frame::FrameKind::CompoundedIq,
+	                      .geometry = last.geometry,
+	                      .samples = std::move(samples)});
+	pending.clear();
+}
+
+}  // namespace processing
@@ -0,0 +1,272 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <caf/actor_cast.hpp>
+#include <caf/typed_event_based_actor.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/Frame.hpp"
+#include "Logger/Logger.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+#include "ProcessingModule/LoadShedding.hpp"
+#include "ProcessingModule/PowerDopplerActor.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Buffers of the images: the consumers hold a few of them at once
+constexpr std::size_t image_buffers = 4;
+
+// --------------------------------------------------------------------
+/**
+ * @brief Index of a stream of the stage in its subscribers, none for the other streams.
+ * The Doppler stream only carries the stimulus events.
+ */
+std::optional<std::size_t> indexOf(frame::FrameStream stream)
+{
+	switch (stream)
+	{
+	case frame::FrameStream::PowerDoppler:
+		return 0;
+	case frame::FrameStream::ColorDoppler:
+		return 1;
+	case frame::FrameStream::Doppler:
+		return 2;
+	default:
+		return std::nullopt;
+	}
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+power_doppler_state::power_doppler_state(power_doppler_actor::pointer_view self,
+                                         caf::actor source,
+                                         PowerDopplerConfig cfg)
+    : _self(self), _source(std::move(source)), _cfg(std::move(cfg))
+{
+}
+
+// --------------------------------------------------------------------
+power_doppler_actor::behavior_type power_doppler_state::make_behavior()
+{
+	MEDLOG_INFO("Power Doppler: ensembles of {} frames every {} frames, {} tissue "
+	            "components",
+	            _cfg.ensemble, _cfg.step, _cfg.tissue_components);
+
+	return {[this](acq_start, acq_module::AcquisitionParameters parameters)
+	        { _parameters = std::move(parameters); },
+	        [this](acq_subscribe, frame::FrameStream stream, caf::actor subscriber)
+	        { subscribe(stream, std::move(subscriber)); },
+	        [this](acq_unsubscribe, frame::FrameStream stream, caf::actor subscriber)
+	        { unsubscribe(stream, subscriber); },
+	        [this](caf::publish_atom, const frame::AcquisitionFrame& frame)
+	        {
+		        scheduler::recordMailboxDepth(_self->mailbox().size());
+		        recordStageBacklog(_self->mailbox().size());
+		        process(frame);
+	        },
+	        [this](caf::publish_atom, const frame::StimulusEvent& event)
+	        {
+		        for (const caf::actor& subscriber :
+		             _subscribers[*indexOf(frame::FrameStream::Doppler)])
+		        {
+			        _self->mail(caf::publish_atom_v, event).send(subscriber);
+		        }
+	        }};
+}
+
+// --------------------------------------------------------------------
+void power_doppler_state::subscribe(frame::FrameStream stream, caf::actor subscriber)
+{
+	const std::optional<std::size_t> index = indexOf(stream);
+	if (!index)
+	{
+		MEDLOG_WARN("Power Doppler: no {} stream to subscribe to", stream);
+		return;
+	}
+	std::vector<caf::actor>& subscribers = _subscribers[*index];
+	if (std::ranges::find(subscribers, subscriber) != subscribers.end())
+	{
+		return;
+	}
+
+	// The stage receives the Doppler frames while it has consumers
+	subscribers.push_back(std::move(subscriber));
+	if (subscriberCount() == 1)
+	{
+		_self
+		    ->mail(acq_subscribe_v, frame::FrameStream::Doppler,
+		           caf::actor_cast<caf::actor>(_self->ctrl()))
+		    .send(_source);
+	}
+}
+
+// --------------------------------------------------------------------
+void power_doppler_state::unsubscribe(frame::FrameStream stream,
+                                      const caf::actor& subscriber)
+{
+	const std::optional<std::size_t> index = indexOf(stream);
+	if (!index || std::erase(_subscribers[*index], subscriber) == 0 ||
+	    subscriberCount() != 0)
+	{
+		return;
+	}
+
+	_self
+	    ->mail(acq_unsubscribe_v, frame::FrameStream::Doppler,
+	           caf::actor_cast<caf::actor>(_self->ctrl()))
+	    .send(_source);
+}
+
+// --------------------------------------------------------------------
+std::size_t power_doppler_state::subscriberCount() const
+{
+	std::size_t count = 0;
+	for (const std::vector<caf::actor>& subscribers : _subscribers)
+	{
+		count += subscribers.size();
+	}
+	return count;
+}
+
+// --------------------------------------------------------------------
+void power_doppler_state::process(const frame::AcquisitionFrame& frame)
+{
+	if (frame.stream != frame::FrameStream::Doppler ||
+	    frame.kind != frame::FrameKind::CompoundedIq || !frame.samples)
+	{
+		if (_ignored++ == 0)
+		{
+			MEDLOG_WARN("Power Doppler: {} frames of the {} stream ignored, IQ frames "
+			            "expected",
+			            frame.kind, frame.stream);
+		}
+		return;
+	}
+	if (!_filter || frame.geometry != _geometry)
+	{
+		restart(frame.geometry);
+	}
+
+	try
+	{
+		const bool due = _filter->add(frame::viewOf<2>(frame));
+		_timestamps.push_back(frame.timestamp);
+		if (_timestamps.size() > _filter->frameCount())
+		{
+			_timestamps.pop_front();
+		}
+		if (!due)
+		{
+			return;
+		}
+
+		// The color maps come with the power image, from the same pass on the window.
+		// While the processing falls behind, they are skipped and the image is decimated
+		// once computed: the window keeps its geometry.
+		const StageQuality quality = stageQuality();
+		const auto start = std::chrono::steady_clock::now();
+		std::shared_ptr<frame::SampleBuffer> power = _powerPool->acquire();
+		if (!power)
+		{
+			throw std::runtime_error("all the image buffers are in use");
+		}
+		std::shared_ptr<frame::SampleBuffer> color;
+		frame::Frame<float, frame::Interleaved<2>> colorMaps;
+		if (!_subscribers[*indexOf(frame::FrameStream::ColorDoppler)].empty() &&
+		    quality.level < QualityLevel::EssentialMaps)
+		{
+			color = _colorPool->acquire();
+			if (!color)
+			{
+				throw std::runtime_error("all the color buffers are in use");
+			}
+			colorMaps =
+			    frame::viewOf<2>(*color, _geometry, frame::FrameKind::ColorDoppler);
+		}
+		const auto powerMap =
+		    frame::viewOf<1>(*power, _geometry, frame::FrameKind::PowerDoppler);
+		_filter->dopplerMaps(powerMap, colorMaps, velocityScale());
+		MEDLOG_DEBUG("Power Doppler: image {} in {} ms", _nextPowerSequence,
+		             std::chrono::duration_cast<std::chrono::milliseconds>(
+		                 std::chrono::steady_clock::now() - start)
+		                 .count());
+
+		publish(reduceResolution({.sequence = _nextPowerSequence++,
+		                          .timestamp = frame.timestamp,
+		                          .stream = frame::FrameStream::PowerDoppler,
+		                          .kind = frame::FrameKind::PowerDoppler,
+		                          .geometry = _geometry,
+		                          .samples = std::move(power)},
+		                         quality.resolution_step));
+		if (color)
+		{
+			publish({.sequence = _nextColorSequence++,
+			         .timestamp = frame.timestamp,
+			         .stream = frame::FrameStream::ColorDoppler,
+			         .kind = frame::FrameKind::ColorDoppler,
+			         .geometry = _geometry,
+			         .samples = std::move(color)});
+		}
+	}
+	catch (const std::exception& e)
+	{
+		MEDLOG_ERROR("Power Doppler: frame {} dropped: {}", frame.sequence, e.what());
+	}
+}
+
+// --------------------------------------------------------------------
+void power_doppler_state::restart(const frame::FrameGeometry& geometry)
+{
+	const std::size_t pixels = geometry.sampleCount(frame::FrameKind::PowerDoppler);
+	_filter.emplace(_cfg, pixels);
+	_geometry = geometry;
+	_timestamps.clear();
+	_powerPool = std::make_unique<frame::SampleBufferPool>(pixels, image_buffers);
+	_colorPool = std::make_unique<frame::SampleBufferPool>(
+	    geometry.sampleCount(frame::FrameKind::ColorDoppler), image_buffers);
+	MEDLOG_INFO("Power Doppler: window of {}x{} pixels", geometry.depth_samples,
+	            geometry.lateral_samples);
+}
+
+// --------------------------------------------------------------------
+void power_doppler_state::publish(const frame::AcquisitionFrame& image)
+{
+	for (const caf::actor& subscriber : _subscribers[*indexOf(image.stream)])
+	{
+		_self->mail(caf::publish_atom_v, image).send(subscriber);
+	}
+}
+
+// --------------------------------------------------------------------
+float power_doppler_state::velocityScale() const
+{
+	if (_timestamps.size() < 2 || _timestamps.back() <= _timestamps.front())
+	{
+		return 0.0f;
+	}
+	const std::chrono::duration<double> window =
+	    std::chrono::nanoseconds(_timestamps.back() - _timestamps.front());
+	const double frameRate = static_cast<double>(_timestamps.size() - 1) / window.count();
+	return kasaiVelocityScale(_parameters.sound_speed, _parameters.center_frequency,
+	                          frameRate);
+}
+
+}  // namespace processing
@@ -0,0 +1,355 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <utility>
+
+#include <caf/actor_cast.hpp>
+#include <caf/actor_from_state.hpp>
+#include <caf/error.hpp>
+#include <caf/sec.hpp>
+#include <caf/timespan.hpp>
+#include <caf/typed_event_based_actor.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Logger/Logger.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+#include "ProcessingModule/ProcessingFarmActor.hpp"
+
+namespace processing
+{
+
+namespace
+{
+// --------------------------------------------------------------------
+OrderingPolicy policyOf(const ProcessingConfig& cfg)
+{
+	// Checked by the session manager at startup
+	OrderingPolicy policy{OrderingPolicy::Strict};
+	static_cast<void>(from_string(cfg.ordering, policy));
+	return policy;
+}
+
+// --------------------------------------------------------------------
+QualityLevel maxLevelOf(const LoadSheddingConfig& cfg)
+{
+	// Checked by the session manager at startup
+	QualityLevel level{QualityLevel::ReducedRate};
+	static_cast<void>(from_string(cfg.max_level, level));
+	return level;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+processing_worker_state::processing_worker_state(
+    processing_worker_actor::pointer_view self, std::shared_ptr<FrameProcessor> processor)
+    : _self(self), _processor(std::move(processor))
+{
+}
+
+// --------------------------------------------------------------------
+processing_worker_actor::behavior_type processing_worker_state::make_behavior()
+{
+	return {[this](caf::publish_atom, const frame::AcquisitionFrame& frame)
+	            -> caf::result<frame::AcquisitionFrame>
+	        {
+		        try
+		        {
+			        return _processor->process(frame);
+		        }
+		        catch (const std::exception& e)
+		        {
+			        return caf::make_error(caf::sec::runtime_error, e.what());
+		        }
+	        },
+	        [this](acq_start, const acq_module::AcquisitionParameters& parameters)
+	        {
+		        try
+		        {
+			        _processor->setSequence(parameters);
+		        }
+		        catch (const std::exception& e)
+		        {
+			        MEDLOG_ERROR("Processing worker: cannot process the sequence: {}",
+			                     e.what());
+		        }
+	        }};
+}
+
+// --------------------------------------------------------------------
+processing_farm_state::processing_farm_state(processing_farm_actor::pointer_view self,
+                                             acq_module::acq_module_actor source,
+                                             ProcessingConfig cfg,
+                                             ProcessorFactory factory)
+    : _self(self),
+      _source(std::move(source)),
+      _cfg(std::move(cfg)),
+      _factory(std::move(factory)),
+      _reorder(policyOf(_cfg))
+{
+}
+
+// --------------------------------------------------------------------
+processing_farm_actor::behavior_type processing_farm_state::make_behavior()
+{
+	// Linked: the workers end with the farm
+	const uint32_t workerCount = std::max(_cfg.workers, 1U);
+	for (uint32_t i = 0; i < workerCount; ++i)
+	{
+		_workers.push_back(
+		    _self->spawn<caf::linked>(caf::actor_from_state<processing_worker_state>,
+		                              std::shared_ptr<FrameProcessor>(_factory())));
+	}
+	_workerLoads.assign(_workers.size(), 0);
+	MEDLOG_INFO("Processing farm: {} workers, {} frames in flight, {} ordering",
+	            _workers.size(), _cfg.max_in_flight, _reorder.policy());
+
+	const LoadSheddingConfig& shedding = _cfg.load_shedding;
+	if (shedding.enabled)
+	{
+		_shedding.emplace(shedding, maxLevelOf(shedding));
+		setStageQuality({});
+		_nextSample = _self->run_delayed(shedding.period, [this] { sampleLoad(); });
+		MEDLOG_INFO("Processing farm: load shedding down to {} quality",
+		            maxLevelOf(shedding));
+	}
+
+	return {
+	    [this](acq_start, acq_module::AcquisitionParameters parameters)
+	    {
+		    _angleCount = std::max(parameters.angle_count, 1U);
+
+		    // The workers receive the sequence before the first frame
+		    for (const processing_worker_actor& worker : _workers)
+		    {
+			    _self->mail(acq_start_v, parameters).send(worker);
+		    }
+		    _self->mail(acq_start_v, std::move(parameters)).send(_source);
+	    },
+	    [this](acq_subscribe, frame::FrameStream stream, caf::actor subscriber)
+	    { subscribe(stream, std::move(subscriber)); },
+	    [this](acq_unsubscribe, frame::FrameStream stream, caf::actor subscriber)
+	    { unsubscribe(stream, subscriber); },
+	    [this](caf::publish_atom, frame::AcquisitionFrame frame)
+	    {
+		    scheduler::recordMailboxDepth(_self->mailbox().size());
+		    enqueue(std::move(frame));
+	    },
+	    [this](caf::publish_atom, const frame::StimulusEvent& event)
+	    {
+		    for (const caf::actor& subscriber :
+		         _subscribers[std::to_underlying(frame::FrameStream::Doppler)])
+		    {
+			    _self->mail(caf::publish_atom_v, event).send(subscriber);
+		    }
+	    },
+	    [](acq_stop) {}};
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::subscribe(frame::FrameStream stream, caf::actor subscriber)
+{
+	std::vector<caf::actor>& subscribers = _subscribers[std::to_underlying(stream)];
+	if (std::ranges::find(subscribers, subscriber) != subscribers.end())
+	{
+		return;
+	}
+
+	// The farm receives the stream from the session while it has consumers
+	subscribers.push_back(std::move(subscriber));
+	if (subscribers.size() == 1)
+	{
+		_self->mail(acq_subscribe_v, stream, caf::actor_cast<caf::actor>(_self->ctrl()))
+		    .send(_source);
+	}
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::unsubscribe(frame::FrameStream stream,
+                                        const caf::actor& subscriber)
+{
+	std::vector<caf::actor>& subscribers = _subscribers[std::to_underlying(stream)];
+	if (std::erase(subscribers, subscriber) == 0 || !subscribers.empty())
+	{
+		return;
+	}
+
+	_self->mail(acq_unsubscribe_v, stream, caf::actor_cast<caf::actor>(_self->ctrl()))
+	    .send(_source);
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::enqueue(frame::AcquisitionFrame frame)
+{
+	// The plane waves of an ensemble are shed together: the image is compounded from
+	// all of them
+	const uint32_t rateStep = std::max(_cfg.load_shedding.rate_step, 1U);
+	const uint64_t ensemble = frame.kind == frame::FrameKind::RawRf
+	                              ? frame.sequence / _angleCount
+	                              : frame.sequence;
+	if (_shedding && _shedding->level() >= QualityLevel::ReducedRate &&
+	    ensemble % rateStep != 0)
+	{
+		++_shed;
+		return;
+	}
+
+	// Only the latest frame of a stream is worth waiting for
+	if (_reorder.policy() == OrderingPolicy::LatestWins)
+	{
+		_skipped += std::erase_if(_waiting, [&frame](const frame::AcquisitionFrame& x)
+		                          { return x.stream == frame.stream; });
+	}
+	_waiting.push_back(std::move(frame));
+	dispatch();
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::dispatch()
+{
+	while (!_waiting.empty() && _inFlight < std::max(_cfg.max_in_flight, 1U))
+	{
+		const auto least = std::ranges::min_element(_workerLoads);
+		const auto worker = static_cast<std::size_t>(least - _workerLoads.begin());
+		const uint64_t ticket = _nextTicket++;
+		++*least;
+		++_inFlight;
+
+		// The frame is given up at its deadline, but the worker is only free once it
+		// has answered: the request itself does not time out
+		_deadlines.emplace(ticket,
+		                   _self->run_delayed(_cfg.worker_timeout, [this, worker, ticket]
+		                                      { timedOut(worker, ticket); }));
+		_self->mail(caf::publish_atom_v, std::move(_waiting.front()))
+		    .request(_workers[worker], caf::infinite)
+		    .then([this, worker, ticket](frame::AcquisitionFrame processed)
+		          { completed(worker, ticket, std::move(processed)); },
+		          [this, worker, ticket](const caf::error& error)
+		          { failed(worker, ticket, error); });
+		_waiting.pop_front();
+	}
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::completed(std::size_t worker,
+                                      uint64_t ticket,
+                                      frame::AcquisitionFrame frame)
+{
+	--_workerLoads[worker];
+	--_inFlight;
+	if (settle(ticket))
+	{
+		_reorder.complete(ticket, std::move(frame), _released);
+		publishReleased();
+	}
+	dispatch();
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::failed(std::size_t worker,
+                                   uint64_t ticket,
+                                   const caf::error& error)
+{
+	--_workerLoads[worker];
+	--_inFlight;
+	if (settle(ticket))
+	{
+		++_skipped;
+		MEDLOG_WARN("Processing farm: frame dropped by worker {} ({} in total): {}",
+		            worker, _skipped, caf::to_string(error));
+		_reorder.skip(ticket, _released);
+		publishReleased();
+	}
+	dispatch();
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::timedOut(std::size_t worker, uint64_t ticket)
+{
+	// The worker stays loaded with the frame until it answers
+	_deadlines.erase(ticket);
+	++_skipped;
+	MEDLOG_WARN("Processing farm: frame given up after {} ms by worker {} ({} in total)",
+	            std::chrono::duration_cast<std::chrono::milliseconds>(_cfg.worker_timeout)
+	                .count(),
+	            worker, _skipped);
+	_reorder.skip(ticket, _released);
+	publishReleased();
+}
+
+// --------------------------------------------------------------------
+bool processing_farm_state::settle(uint64_t ticket)
+{
+	const auto deadline = _deadlines.find(ticket);
+	if (deadline == _deadlines.end())
+	{
+		return false;
+	}
+	deadline->second.dispose();
+	_deadlines.erase(deadline);
+	return true;
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::publishReleased()
+{
+	const int64_t now = frame::monotonicTimestamp();
+	for (const frame::AcquisitionFrame& frame : _released)
+	{
+		_maxLatency =
+		    std::max(_maxLatency, std::chrono::nanoseconds(now - frame.timestamp));
+		const auto stream = std::to_underlying(frame.stream);
+		for (const caf::actor& subscriber : _subscribers[stream])
+		{
+			_self->mail(caf::publish_atom_v, frame).send(subscriber);
+		}
+	}
+	_released.clear();
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::sampleLoad()
+{
+	// The stages after the farm fall behind too when the farm keeps up with a frame rate
+	// they cannot sustain
+	const std::size_t backlog = std::max(_waiting.size() + _inFlight, takeStageBacklog());
+	const QualityLevel previous = _shedding->level();
+	const QualityLevel next = _shedding->update(backlog, _maxLatency);
+	if (next != previous)
+	{
+		applyQuality(next);
+		MEDLOG_USER_EVENT(
+		    "Processing {}: display quality {} -> {} (backlog {} frames, latency {} ms, "
+		    "{} frames shed so far)",
+		    next > previous ? "falling behind" : "recovered", previous, next, backlog,
+		    std::chrono::duration_cast<std::chrono::milliseconds>(_maxLatency).count(),
+		    _shed);
+	}
+
+	_maxLatency = std::chrono::nanoseconds{0};
+	_nextSample =
+	    _self->run_delayed(_cfg.load_shedding.period, [this] { sampleLoad(); });
+}
+
+// --------------------------------------------------------------------
+void processing_farm_state::applyQuality(QualityLevel level)
+{
+	// The rate is reduced by the farm, the other degradations by the stages after it
+	setStageQuality(
+	    {.level = level,
+	     .resolution_step = level >= QualityLevel::ReducedResolution
+	                            ? std::max(_cfg.load_shedding.resolution_step, 1U)
+	                            : 1});
+}
+
+}  // namespace processing
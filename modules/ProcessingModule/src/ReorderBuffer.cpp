@@ -0,0 +1,73 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <utility>
+
+#include "ProcessingModule/ReorderBuffer.hpp"
+
+namespace processing
+{
+
+// --------------------------------------------------------------------
+void ReorderBuffer::complete(uint64_t ticket,
+                             frame::AcquisitionFrame frame,
+                             std::vector<frame::AcquisitionFrame>& released)
+{
+	if (_policy == OrderingPolicy::LatestWins)
+	{
+		std::optional<uint64_t>& last = _lastReleased[std::to_underlying(frame.stream)];
+		if (last && *last > ticket)
+		{
+			++_dropped;
+			return;
+		}
+		last = ticket;
+		released.push_back(std::move(frame));
+		return;
+	}
+
+	_held.emplace(ticket, std::move(frame));
+	releaseReady(released);
+}
+
+// --------------------------------------------------------------------
+void ReorderBuffer::skip(uint64_t ticket, std::vector<frame::AcquisitionFrame>& released)
+{
+	if (_policy == OrderingPolicy::LatestWins)
+	{
+		return;
+	}
+
+	_held.emplace(ticket, std::nullopt);
+	releaseReady(released);
+}
+
+// --------------------------------------------------------------------
+std::size_t ReorderBuffer::heldCount() const
+{
+	return _held.size();
+}
+
+// --------------------------------------------------------------------
+void ReorderBuffer::releaseReady(std::vector<frame::AcquisitionFrame>& released)
+{
+	auto it = _held.begin();
+	while (it != _held.end() && it->first == _nextTicket)
+	{
+		if (it->second)
+		{
+			released.push_back(std::move(*it->second));
+		}
+		it = _held.erase(it);
+		++_nextTicket;
+	}
+}
+
+}  // namespace processing
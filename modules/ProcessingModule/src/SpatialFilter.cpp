@@ -0,0 +1,554 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#include "ProcessingModule/SpatialFilter.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Pixels of a column filtered together: their windows and sums stay in the
+/// vector registers and on the stack
+constexpr std::size_t chunk_pixels = 64;
+
+/// @brief Pixels of a chunk summed together over the taps, kept in the vector registers
+constexpr std::size_t lane_pixels = 16;
+
+/// @brief Columns of a tile, a job of the task pool
+constexpr std::size_t tile_columns = 4;
+
+/// @brief Samples of the window of a chunk along one axis
+constexpr std::size_t window_pixels = chunk_pixels + 2 * SpatialFilter::max_radius;
+
+/// @brief Samples of the largest window of the median
+constexpr std::size_t median_side = 2 * SpatialFilter::max_median_radius + 1;
+constexpr std::size_t median_samples = median_side * median_side;
+
+using Taps = SpatialFilter::Taps;
+using Comparator = std::pair<uint16_t, uint16_t>;
+
+// --------------------------------------------------------------------
+/**
+ * @brief exp(y) for y <= 0, within 2e-5 of std::exp: a polynomial on the remainder of
+ * y / ln 2. Written without branch nor libm call so that its loops are vectorized.
+ */
+inline float expNegative(float y)
+{
+	constexpr float log2e = 1.44269504f;
+	constexpr float ln2 = 0.69314718f;
+	// max(y, -87), the smallest normal exponent
+	y = 0.5f * (y - 87.0f + std::abs(y + 87.0f));
+	const int32_t n = -static_cast<int32_t>(0.5f - y * log2e);
+	const float r = y - static_cast<float>(n) * ln2;
+	float p = 1.0f / 120.0f;
+	p = p * r + 1.0f / 24.0f;
+	p = p * r + 1.0f / 6.0f;
+	p = p * r + 0.5f;
+	p = p * r + 1.0f;
+	p = p * r + 1.0f;
+	return p * std::bit_cast<float>((n + 127) << 23);
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Index of a sample in [0, size), the borders replicated.
+ */
+inline std::size_t clamped(std::ptrdiff_t index, std::size_t size)
+{
+	return static_cast<std::size_t>(
+	    std::clamp<std::ptrdiff_t>(index, 0, static_cast<std::ptrdiff_t>(size) - 1));
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Copies the samples [first, first + count) of a column to a window, the borders
+ * replicated.
+ */
+inline void fillWindow(const float* column,
+                       std::size_t size,
+                       std::ptrdiff_t first,
+                       std::size_t count,
+                       float* window)
+{
+	if (first >= 0 && static_cast<std::size_t>(first) + count <= size)
+	{
+		std::copy_n(column + first, count, window);
+		return;
+	}
+	for (std::size_t k = 0; k < count; ++k)
+	{
+		window[k] = column[clamped(first + static_cast<std::ptrdiff_t>(k), size)];
+	}
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Weighted sums of a chunk: out[i] = sum_k weights[k] taps[k][i].
+ */
+inline void gaussianChunk(const Taps& taps,
+                          std::span<const float> weights,
+                          std::size_t count,
+                          float* out)
+{
+	// The sums of the chunk through memory at each tap defeat GCC at -O3
+	std::array<float, chunk_pixels> sums{};
+	for (std::size_t i0 = 0; i0 < chunk_pixels; i0 += lane_pixels)
+	{
+		std::array<float, lane_pixels> sum{};
+		for (std::size_t k = 0; k < weights.size(); ++k)
+		{
+			const float* tap = taps[k] + i0;
+			const float weight = weights[k];
+			for (std::size_t i = 0; i < lane_pixels; ++i)
+			{
+				sum[i] += weight * tap[i];
+			}
+		}
+		std::ranges::copy(sum, sums.begin() + i0);
+	}
+	std::copy_n(sums.begin(), count, out);
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Bilateral sums of a chunk. The range weights are Gaussian in the difference of
+ * two pixels relative to their geometric mean: the same for a pixel and its neighbour,
+ * whatever their level.
+ * @param rangeScale 1 / range_sigma^2
+ */
+inline void bilateralChunk(const Taps& taps,
+                           std::span<const float> weights,
+                           float rangeScale,
+                           std::size_t count,
+                           float* out)
+{
+	std::array<float, chunk_pixels> sums{};
+	for (std::size_t i0 = 0; i0 < chunk_pixels; i0 += lane_pixels)
+	{
+		const float* center = taps[weights.size() / 2] + i0;
+		std::array<float, lane_pixels> sum{};
+		std::array<float, lane_pixels> norm{};
+		for (std::size_t k = 0; k < weights.size(); ++k)
+		{
+			const float* tap = taps[k] + i0;
+			const float weight = weights[k];
+			for (std::size_t i = 0; i < lane_pixels; ++i)
+			{
+				const float d = tap[i] - center[i];
+				const float level = std::max(std::abs(tap[i] * center[i]), 1e-30f);
+				const float w = weight * expNegative(-0.5f * rangeScale * d * d / level);
+				sum[i] += w * tap[i];
+				norm[i] += w;
+			}
+		}
+		for (std::size_t i = 0; i < lane_pixels; ++i)
+		{
+			sums[i0 + i] = sum[i] / norm[i];
+		}
+	}
+	std::copy_n(sums.begin(), count, out);
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Applies the comparators of a network to the samples [sample][chunk pixel] of the
+ * windows of a chunk, as min and max of the lanes.
+ */
+inline void medianChunk(std::span<const Comparator> network, float* samples)
+{
+	for (const auto& [a, b] : network)
+	{
+		float* low = samples + a * chunk_pixels;
+		float* high = samples + b * chunk_pixels;
+		for (std::size_t i = 0; i < chunk_pixels; ++i)
+		{
+			const float x0 = low[i];
+			const float x1 = high[i];
+			low[i] = x1 < x0 ? x1 : x0;
+			high[i] = x1 < x0 ? x0 : x1;
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+// The kernels of the chunks are plain C++ vectorized by the compiler. The AVX2 and
+// AVX-512 variants inline them (flatten) to vectorize them for the wider registers.
+void gaussianScalar(const Taps& taps,
+                    std::span<const float> weights,
+                    std::size_t count,
+                    float* out)
+{
+	gaussianChunk(taps, weights, count, out);
+}
+
+void bilateralScalar(const Taps& taps,
+                     std::span<const float> weights,
+                     float rangeScale,
+                     std::size_t count,
+                     float* out)
+{
+	bilateralChunk(taps, weights, rangeScale, count, out);
+}
+
+void medianScalar(std::span<const Comparator> network, float* samples)
+{
+	medianChunk(network, samples);
+}
+
+#if MEDSIMD_X86
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+void gaussianAvx2(const Taps& taps,
+                  std::span<const float> weights,
+                  std::size_t count,
+                  float* out)
+{
+	gaussianChunk(taps, weights, count, out);
+}
+
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+void bilateralAvx2(const Taps& taps,
+                   std::span<const float> weights,
+                   float rangeScale,
+                   std::size_t count,
+                   float* out)
+{
+	bilateralChunk(taps, weights, rangeScale, count, out);
+}
+
+MEDSIMD_TARGET_AVX2 [[gnu::flatten]]
+void medianAvx2(std::span<const Comparator> network, float* samples)
+{
+	medianChunk(network, samples);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+void gaussianAvx512(const Taps& taps,
+                    std::span<const float> weights,
+                    std::size_t count,
+                    float* out)
+{
+	gaussianChunk(taps, weights, count, out);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+void bilateralAvx512(const Taps& taps,
+                     std::span<const float> weights,
+                     float rangeScale,
+                     std::size_t count,
+                     float* out)
+{
+	bilateralChunk(taps, weights, rangeScale, count, out);
+}
+
+MEDSIMD_TARGET_AVX512 [[gnu::flatten]]
+void medianAvx512(std::span<const Comparator> network, float* samples)
+{
+	medianChunk(network, samples);
+}
+#endif
+
+/// @brief Kernels of the chunks for each instruction set
+constexpr simd::KernelVariants<SpatialFilter::GaussianChunk> gaussian_chunks{
+    .scalar = gaussianScalar,
+#if MEDSIMD_X86
+    .avx2 = gaussianAvx2,
+    .avx512 = gaussianAvx512,
+#endif
+};
+constexpr simd::KernelVariants<SpatialFilter::BilateralChunk> bilateral_chunks{
+    .scalar = bilateralScalar,
+#if MEDSIMD_X86
+    .avx2 = bilateralAvx2,
+    .avx512 = bilateralAvx512,
+#endif
+};
+constexpr simd::KernelVariants<SpatialFilter::MedianChunk> median_chunks{
+    .scalar = medianScalar,
+#if MEDSIMD_X86
+    .avx2 = medianAvx2,
+    .avx512 = medianAvx512,
+#endif
+};
+
+// --------------------------------------------------------------------
+/**
+ * @brief Comparators of the median of `samples` values: Batcher's odd-even merge sort,
+ * without the comparators of the padding nor those the median does not depend on.
+ */
+std::vector<Comparator> medianNetwork(std::size_t samples)
+{
+	const std::size_t wires = std::bit_ceil(samples);
+	std::vector<Comparator> sorting;
+	for (std::size_t p = 1; p < wires; p *= 2)
+	{
+		for (std::size_t k = p; k > 0; k /= 2)
+		{
+			for (std::size_t j = k % p; j + k < wires; j += 2 * k)
+			{
+				for (std::size_t i = 0; i < k && i + j + k < wires; ++i)
+				{
+					// The padding holds +inf, its comparators swap nothing
+					const std::size_t a = i + j;
+					const std::size_t b = i + j + k;
+					if (a / (2 * p) == b / (2 * p) && b < samples)
+					{
+						sorting.emplace_back(static_cast<uint16_t>(a),
+						                     static_cast<uint16_t>(b));
+					}
+				}
+			}
+		}
+	}
+
+	// From the median backwards, the comparators feeding it
+	std::vector<bool> needed(samples, false);
+	needed[samples / 2] = true;
+	std::vector<Comparator> network;
+	for (auto comparator = sorting.rbegin(); comparator != sorting.rend(); ++comparator)
+	{
+		if (needed[comparator->first] || needed[comparator->second])
+		{
+			needed[comparator->first] = true;
+			needed[comparator->second] = true;
+			network.push_back(*comparator);
+		}
+	}
+	std::ranges::reverse(network);
+	return network;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+SpatialFilter::SpatialFilter(const SpatialFilterConfig& cfg,
+                             uint32_t depth,
+                             uint32_t lateral)
+    : _kind(SpatialFilterKind::None),
+      _radius(cfg.radius),
+      _rangeScale(1.0f / (cfg.range_sigma * cfg.range_sigma)),
+      _depth(depth),
+      _lateral(lateral),
+      _simdLevel(gaussian_chunks.levelFor()),
+      _gaussianChunk(gaussian_chunks.select(_simdLevel)),
+      _bilateralChunk(bilateral_chunks.select(_simdLevel)),
+      _medianChunk(median_chunks.select(_simdLevel))
+{
+	if (!from_string(cfg.kind, _kind))
+	{
+		throw std::invalid_argument("Invalid spatial filter '" + cfg.kind + "'");
+	}
+	if (depth == 0 || lateral == 0)
+	{
+		throw std::invalid_argument("Spatial filter: empty image");
+	}
+	if (_kind == SpatialFilterKind::None)
+	{
+		return;
+	}
+
+	const uint32_t maxRadius =
+	    _kind == SpatialFilterKind::Median ? max_median_radius : max_radius;
+	if (_radius == 0 || _radius > maxRadius)
+	{
+		throw std::invalid_argument("Invalid " + cfg.kind + " filter radius " +
+		                            std::to_string(_radius) + ", 1 to " +
+		                            std::to_string(maxRadius));
+	}
+	if (!(cfg.sigma > 0.0f) ||
+	    (_kind == SpatialFilterKind::Bilateral && !(cfg.range_sigma > 0.0f)))
+	{
+		throw std::invalid_argument("Invalid " + cfg.kind + " filter sigma");
+	}
+
+	for (uint32_t k = 0; k <= 2 * _radius; ++k)
+	{
+		const float x = static_cast<float>(k) - static_cast<float>(_radius);
+		_weights.push_back(std::exp(-0.5f * x * x / (cfg.sigma * cfg.sigma)));
+	}
+	const float total = std::accumulate(_weights.begin(), _weights.end(), 0.0f);
+	for (float& weight : _weights)
+	{
+		weight /= total;
+	}
+
+	if (_kind == SpatialFilterKind::Median)
+	{
+		const std::size_t samples = _weights.size() * _weights.size();
+		_network = medianNetwork(samples);
+		_medianIndex = static_cast<uint16_t>(samples / 2);
+	}
+	_scratch.resize(_depth * _lateral);
+}
+
+// --------------------------------------------------------------------
+void SpatialFilter::apply(const frame::Frame<float, frame::Interleaved<1>>& image)
+{
+	if (image.depth() != _depth || image.lateral() != _lateral)
+	{
+		throw std::invalid_argument(
+		    "Spatial filter: image of " + std::to_string(image.depth()) + "x" +
+		    std::to_string(image.lateral()) + " pixels instead of " +
+		    std::to_string(_depth) + "x" + std::to_string(_lateral));
+	}
+
+	float* pixels = image.data();
+	float* scratch = _scratch.data();
+	switch (_kind)
+	{
+	case SpatialFilterKind::None:
+		break;
+	case SpatialFilterKind::Gaussian:
+	case SpatialFilterKind::Bilateral:
+		scheduler::parallelFor(
+		    0, _lateral, tile_columns,
+		    [this, pixels, scratch](std::size_t first, std::size_t last)
+		    { depthPass(pixels, scratch, first, last); });
+		scheduler::parallelFor(
+		    0, _lateral, tile_columns,
+		    [this, pixels, scratch](std::size_t first, std::size_t last)
+		    { lateralPass(scratch, pixels, first, last); });
+		break;
+	case SpatialFilterKind::Median:
+		// The windows overlap the neighbouring tiles: the medians go to the scratch image
+		scheduler::parallelFor(
+		    0, _lateral, tile_columns,
+		    [this, pixels, scratch](std::size_t first, std::size_t last)
+		    { medianPass(pixels, scratch, first, last); });
+		std::ranges::copy(_scratch, image.samples().begin());
+		break;
+	}
+}
+
+// --------------------------------------------------------------------
+void SpatialFilter::depthPass(const float* in,
+                              float* out,
+                              std::size_t first,
+                              std::size_t last) const
+{
+	const auto radius = static_cast<std::ptrdiff_t>(_radius);
+	std::array<float, window_pixels> window{};
+	Taps taps{};
+	for (std::size_t k = 0; k < _weights.size(); ++k)
+	{
+		taps[k] = window.data() + k;
+	}
+
+	for (std::size_t x = first; x < last; ++x)
+	{
+		const float* column = in + x * _depth;
+		for (std::size_t z0 = 0; z0 < _depth; z0 += chunk_pixels)
+		{
+			// The window of the chunk, the borders replicated
+			const std::size_t count = std::min(chunk_pixels, _depth - z0);
+			fillWindow(column, _depth, static_cast<std::ptrdiff_t>(z0) - radius,
+			           chunk_pixels + 2 * _radius, window.data());
+
+			if (_kind == SpatialFilterKind::Gaussian)
+			{
+				_gaussianChunk(taps, _weights, count, out + x * _depth + z0);
+			}
+			else
+			{
+				_bilateralChunk(taps, _weights, _rangeScale, count,
+				                out + x * _depth + z0);
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+void SpatialFilter::lateralPass(const float* in,
+                                float* out,
+                                std::size_t first,
+                                std::size_t last) const
+{
+	const auto radius = static_cast<std::ptrdiff_t>(_radius);
+	std::array<std::array<float, chunk_pixels>, 2 * max_radius + 1> tails{};
+	Taps taps{};
+	for (std::size_t x = first; x < last; ++x)
+	{
+		for (std::size_t z0 = 0; z0 < _depth; z0 += chunk_pixels)
+		{
+			// The neighbouring columns; a partial chunk is copied to whole chunks
+			const std::size_t count = std::min(chunk_pixels, _depth - z0);
+			for (std::size_t k = 0; k < _weights.size(); ++k)
+			{
+				const auto neighbour = static_cast<std::ptrdiff_t>(x + k) - radius;
+				taps[k] = in + clamped(neighbour, _lateral) * _depth + z0;
+				if (count < chunk_pixels)
+				{
+					std::copy_n(taps[k], count, tails[k].begin());
+					taps[k] = tails[k].data();
+				}
+			}
+
+			if (_kind == SpatialFilterKind::Gaussian)
+			{
+				_gaussianChunk(taps, _weights, count, out + x * _depth + z0);
+			}
+			else
+			{
+				_bilateralChunk(taps, _weights, _rangeScale, count,
+				                out + x * _depth + z0);
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+void SpatialFilter::medianPass(const float* in,
+                               float* out,
+                               std::size_t first,
+                               std::size_t last) const
+{
+	const auto radius = static_cast<std::ptrdiff_t>(_radius);
+	const std::size_t side = _weights.size();
+	std::array<float, window_pixels> window{};
+	// [sample][chunk pixel]
+	std::array<float, median_samples * chunk_pixels> samples{};
+	for (std::size_t x = first; x < last; ++x)
+	{
+		for (std::size_t z0 = 0; z0 < _depth; z0 += chunk_pixels)
+		{
+			// Sample (dx, dz) of the windows of the chunk, the borders replicated
+			const std::size_t count = std::min(chunk_pixels, _depth - z0);
+			for (std::size_t dx = 0; dx < side; ++dx)
+			{
+				const auto neighbour = static_cast<std::ptrdiff_t>(x + dx) - radius;
+				const float* column = in + clamped(neighbour, _lateral) * _depth;
+				fillWindow(column, _depth, static_cast<std::ptrdiff_t>(z0) - radius,
+				           chunk_pixels + 2 * _radius, window.data());
+				for (std::size_t dz = 0; dz < side; ++dz)
+				{
+					std::copy_n(window.begin() + dz, chunk_pixels,
+					            samples.begin() + (dx * side + dz) * chunk_pixels);
+				}
+			}
+
+			_medianChunk(_network, samples.data());
+			std::copy_n(samples.begin() + _medianIndex * chunk_pixels, count,
+			            out + x * _depth + z0);
+		}
+	}
+}
+
+}  // namespace processing
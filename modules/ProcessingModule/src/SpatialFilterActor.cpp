@@ -0,0 +1,173 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <stdexcept>
+#include <utility>
+
+#include <caf/actor_cast.hpp>
+#include <caf/typed_event_based_actor.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/Frame.hpp"
+#include "Frame/Relayout.hpp"
+#include "Logger/Logger.hpp"
+#include "Scheduler/LoadMonitor.hpp"
+
+#include "ProcessingModule/LoadShedding.hpp"
+#include "ProcessingModule/SpatialFilterActor.hpp"
+
+namespace processing
+{
+
+namespace
+{
+/// @brief Buffers of the images: the consumers hold a few of them at once
+constexpr std::size_t image_buffers = 4;
+}  // namespace
+
+// --------------------------------------------------------------------
+spatial_filter_state::spatial_filter_state(
+    spatial_filter_actor::pointer_view self,
+    caf::actor source,
+    std::map<std::string, SpatialFilterConfig> filters)
+    : _self(self), _source(std::move(source)), _filters(std::move(filters))
+{
+}
+
+// --------------------------------------------------------------------
+spatial_filter_actor::behavior_type spatial_filter_state::make_behavior()
+{
+	return {[this](caf::update_atom, std::string workflow)
+	        {
+		        // Built again for the next image
+		        _workflow = std::move(workflow);
+		        _filter.reset();
+	        },
+	        [this](acq_subscribe, frame::FrameStream stream, caf::actor subscriber)
+	        { subscribe(stream, std::move(subscriber)); },
+	        [this](acq_unsubscribe, frame::FrameStream stream, caf::actor subscriber)
+	        { unsubscribe(stream, subscriber); },
+	        [this](caf::publish_atom, const frame::AcquisitionFrame& image)
+	        {
+		        scheduler::recordMailboxDepth(_self->mailbox().size());
+		        recordStageBacklog(_self->mailbox().size());
+		        process(image);
+	        },
+	        [](caf::publish_atom, const frame::StimulusEvent&) {}};
+}
+
+// --------------------------------------------------------------------
+void spatial_filter_state::subscribe(frame::FrameStream stream, caf::actor subscriber)
+{
+	if (stream != frame::FrameStream::PowerDoppler)
+	{
+		MEDLOG_WARN("Spatial filter: no {} stream to subscribe to", stream);
+		return;
+	}
+	if (std::ranges::find(_subscribers, subscriber) != _subscribers.end())
+	{
+		return;
+	}
+
+	// The stage receives the images while it has consumers
+	_subscribers.push_back(std::move(subscriber));
+	if (_subscribers.size() == 1)
+	{
+		_self
+		    ->mail(acq_subscribe_v, frame::FrameStream::PowerDoppler,
+		           caf::actor_cast<caf::actor>(_self->ctrl()))
+		    .send(_source);
+	}
+}
+
+// --------------------------------------------------------------------
+void spatial_filter_state::unsubscribe(frame::FrameStream stream,
+                                       const caf::actor& subscriber)
+{
+	if (stream != frame::FrameStream::PowerDoppler ||
+	    std::erase(_subscribers, subscriber) == 0 || !_subscribers.empty())
+	{
+		return;
+	}
+
+	_self
+	    ->mail(acq_unsubscribe_v, frame::FrameStream::PowerDoppler,
+	           caf::actor_cast<caf::actor>(_self->ctrl()))
+	    .send(_source);
+}
+
+// --------------------------------------------------------------------
+void spatial_filter_state::process(const frame::AcquisitionFrame& image)
+{
+	if (image.kind != frame::FrameKind::PowerDoppler || !image.samples)
+	{
+		return;
+	}
+
+	try
+	{
+		// Published as computed while the processing falls behind
+		const bool shed = stageQuality().level >= QualityLevel::EssentialMaps;
+		if (!shed && (!_filter || image.geometry != _geometry))
+		{
+			restart(image.geometry);
+		}
+
+		frame::AcquisitionFrame denoised = image;
+		if (!shed && _filter->kind() != SpatialFilterKind::None)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			std::shared_ptr<frame::SampleBuffer> buffer = _pool->acquire();
+			if (!buffer)
+			{
+				throw std::runtime_error("all the image buffers are in use");
+			}
+			const auto pixels = frame::viewOf<1>(*buffer, image.geometry, image.kind);
+			frame::relayout(frame::viewOf<1>(image), pixels);
+			_filter->apply(pixels);
+			denoised.samples = std::move(buffer);
+			MEDLOG_DEBUG("Spatial filter: image {} in {} us", image.sequence,
+			             std::chrono::duration_cast<std::chrono::microseconds>(
+			                 std::chrono::steady_clock::now() - start)
+			                 .count());
+		}
+
+		for (const caf::actor& subscriber : _subscribers)
+		{
+			_self->mail(caf::publish_atom_v, denoised).send(subscriber);
+		}
+	}
+	catch (const std::exception& e)
+	{
+		MEDLOG_ERROR("Spatial filter: image {} dropped: {}", image.sequence, e.what());
+	}
+}
+
+// --------------------------------------------------------------------
+void spatial_filter_state::restart(const frame::FrameGeometry& geometry)
+{
+	const auto found = _filters.find(_workflow);
+	const SpatialFilterConfig cfg =
+	    found != _filters.end() ? found->second : SpatialFilterConfig{};
+	_filter.emplace(cfg, geometry.depth_samples, geometry.lateral_samples);
+	_geometry = geometry;
+	_pool = std::make_unique<frame::SampleBufferPool>(
+	    geometry.sampleCount(frame::FrameKind::PowerDoppler), image_buffers);
+	MEDLOG_INFO("Spatial filter: {} filter of radius {} for the {} workflow, {}x{} "
+	            "pixels",
+	            cfg.kind, cfg.radius, _workflow, geometry.depth_samples,
+	            geometry.lateral_samples);
+}
+
+}  // namespace processing
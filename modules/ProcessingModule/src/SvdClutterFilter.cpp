@@ -0,0 +1,694 @@
+/*
+ * Copyright © 2025 Iconeus. All rights reserved.
+ *
+ * This software is the proprietary and confidential property of Iconeus.
+ * Any use, reproduction, modification or distribution without prior permission
+ * is strictly prohibited.
+ *
+ * Author: Alyson Roger <alyson.roger@iconeus.com>
+ */
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "Frame/Relayout.hpp"
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#if MEDSIMD_X86
+#include <immintrin.h>
+#endif
+
+#include "ProcessingModule/SvdClutterFilter.hpp"
+
+namespace processing
+{
+
+namespace
+{
+using Complex = std::complex<double>;
+
+/// @brief Slots of the Gram matrix computed by a job of the task pool
+constexpr std::size_t slots_per_job = 16;
+
+/// @brief Pixels of a block of the Gram matrix: the blocks of the replaced slots stay in
+/// cache while they are multiplied by the others
+constexpr std::size_t gram_block_pixels = 1024;
+
+/// @brief Pixels of a tile of the power computation, a job of the task pool: the samples
+/// of the tile over the window stay in cache while they are projected on the tissue
+constexpr std::size_t power_tile_pixels = 64;
+
+/// @brief Pixels whose projections are summed together, mapped onto the vector registers
+constexpr std::size_t power_lanes = 8;
+
+/// @brief Sweeps of the Jacobi eigensolver, converging in far fewer
+constexpr int max_jacobi_sweeps = 32;
+
+/// @brief Seed of the random subspace: the same frames give the same image
+constexpr unsigned random_seed = 0x5eed;
+
+// --------------------------------------------------------------------
+/**
+ * @brief Sum of conj(a) b over `count` pixels of two slots, a block at most: the
+ * imaginary parts `plane` floats after the real ones.
+ */
+Complex dotConjScalar(const float* a,
+                      const float* b,
+                      std::size_t count,
+                      std::size_t plane)
+{
+	Complex sum{};
+	for (std::size_t k = 0; k < count; ++k)
+	{
+		sum += std::conj(Complex{a[k], a[plane + k]}) * Complex{b[k], b[plane + k]};
+	}
+	return sum;
+}
+
+#if MEDSIMD_X86
+// --------------------------------------------------------------------
+/**
+ * @brief Sum of the lanes of a register.
+ */
+template <std::size_t Lanes>
+double sumLanes(const std::array<float, Lanes>& lanes)
+{
+	double sum = 0.0;
+	for (const float lane : lanes)
+	{
+		sum += double{lane};
+	}
+	return sum;
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief dotConjScalar vectorized. The vector lanes accumulate in single precision, the
+ * blocks in double precision.
+ */
+MEDSIMD_TARGET_AVX2 Complex dotConjAvx2(const float* a,
+                                        const float* b,
+                                        std::size_t count,
+                                        std::size_t plane)
+{
+	// Real part: aRe bRe + aIm bIm. Imaginary part: aRe bIm - aIm bRe.
+	std::size_t k = 0;
+	__m256 re = _mm256_setzero_ps();
+	__m256 im = _mm256_setzero_ps();
+	for (; k + 8 <= count; k += 8)
+	{
+		const __m256 aRe = _mm256_loadu_ps(a + k);
+		const __m256 aIm = _mm256_loadu_ps(a + plane + k);
+		const __m256 bRe = _mm256_loadu_ps(b + k);
+		const __m256 bIm = _mm256_loadu_ps(b + plane + k);
+		re = _mm256_add_ps(
+		    re, _mm256_add_ps(_mm256_mul_ps(aRe, bRe), _mm256_mul_ps(aIm, bIm)));
+		im = _mm256_add_ps(
+		    im, _mm256_sub_ps(_mm256_mul_ps(aRe, bIm), _mm256_mul_ps(aIm, bRe)));
+	}
+
+	std::array<float, 8> reLanes{};
+	std::array<float, 8> imLanes{};
+	_mm256_storeu_ps(reLanes.data(), re);
+	_mm256_storeu_ps(imLanes.data(), im);
+	return Complex{sumLanes(reLanes), sumLanes(imLanes)} +
+	       dotConjScalar(a + k, b + k, count - k, plane);
+}
+
+// --------------------------------------------------------------------
+MEDSIMD_TARGET_AVX512 Complex dotConjAvx512(const float* a,
+                                            const float* b,
+                                            std::size_t count,
+                                            std::size_t plane)
+{
+	std::size_t k = 0;
+	__m512 re = _mm512_setzero_ps();
+	__m512 im = _mm512_setzero_ps();
+	for (; k + 16 <= count; k += 16)
+	{
+		const __m512 aRe = _mm512_loadu_ps(a + k);
+		const __m512 aIm = _mm512_loadu_ps(a + plane + k);
+		const __m512 bRe = _mm512_loadu_ps(b + k);
+		const __m512 bIm = _mm512_loadu_ps(b + plane + k);
+		re = _mm512_add_ps(
+		    re, _mm512_add_ps(_mm512_mul_ps(aRe, bRe), _mm512_mul_ps(aIm, bIm)));
+		im = _mm512_add_ps(
+		    im, _mm512_sub_ps(_mm512_mul_ps(aRe, bIm), _mm512_mul_ps(aIm, bRe)));
+	}
+
+	std::array<float, 16> reLanes{};
+	std::array<float, 16> imLanes{};
+	_mm512_storeu_ps(reLanes.data(), re);
+	_mm512_storeu_ps(imLanes.data(), im);
+	return Complex{sumLanes(reLanes), sumLanes(imLanes)} +
+	       dotConjScalar(a + k, b + k, count - k, plane);
+}
+#endif
+
+using DotFunction = Complex(const float*, const float*, std::size_t, std::size_t);
+
+/// @brief Products of the Gram matrix for each instruction set
+constexpr simd::KernelVariants<DotFunction> dot_products{
+    .scalar = dotConjScalar,
+#if MEDSIMD_X86
+    .avx2 = dotConjAvx2,
+    .avx512 = dotConjAvx512,
+#endif
+};
+
+// --------------------------------------------------------------------
+/**
+ * @brief Orthonormalizes the vectors [vector][element] by modified Gram-Schmidt, twice
+ * for the orthogonality to hold in finite precision. Dependent vectors are zeroed.
+ */
+void orthonormalize(std::vector<Complex>& vectors, std::size_t count, std::size_t size)
+{
+	for (int pass = 0; pass < 2; ++pass)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			Complex* v = vectors.data() + i * size;
+			for (std::size_t j = 0; j < i; ++j)
+			{
+				const Complex* u = vectors.data() + j * size;
+				Complex projection{};
+				for (std::size_t e = 0; e < size; ++e)
+				{
+					projection += std::conj(u[e]) * v[e];
+				}
+				for (std::size_t e = 0; e < size; ++e)
+				{
+					v[e] -= projection * u[e];
+				}
+			}
+
+			double norm = 0.0;
+			for (std::size_t e = 0; e < size; ++e)
+			{
+				norm += std::norm(v[e]);
+			}
+			norm = std::sqrt(norm);
+			const double scale = norm > 1e-300 ? 1.0 / norm : 0.0;
+			for (std::size_t e = 0; e < size; ++e)
+			{
+				v[e] *= scale;
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+/**
+ * @brief Eigen decomposition of a Hermitian matrix by cyclic Jacobi rotations. The phase
+ * of each off-diagonal element is moved to the vectors first, the rotation is then real.
+ * @param a matrix [row][column], diagonalized in place
+ * @param size rows of the matrix
+ * @param vectors receives the eigenvectors, by column [element][vector]
+ */
+void jacobiEigen(std::vector<Complex>& a, std::size_t size, std::vector<Complex>& vectors)
+{
+	vectors.assign(size * size, Complex{});
+	for (std::size_t i = 0; i < size; ++i)
+	{
+		vectors[i * size + i] = 1.0;
+	}
+
+	for (int sweep = 0; sweep < max_jacobi_sweeps; ++sweep)
+	{
+		double diagonal = 0.0;
+		double offDiagonal = 0.0;
+		for (std::size_t p = 0; p < size; ++p)
+		{
+			diagonal += std::norm(a[p * size + p]);
+			for (std::size_t q = p + 1; q < size; ++q)
+			{
+				offDiagonal += std::norm(a[p * size + q]);
+			}
+		}
+		if (offDiagonal <= 1e-28 * diagonal)
+		{
+			return;
+		}
+
+		for (std::size_t p = 0; p < size; ++p)
+		{
+			for (std::size_t q = p + 1; q < size; ++q)
+			{
+				const double magnitude = std::abs(a[p * size + q]);
+				if (magnitude == 0.0)
+				{
+					continue;
+				}
+
+				// Real a_pq: column q times conj(phase), row q times phase
+				const Complex phase = a[p * size + q] / magnitude;
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					a[i * size + q] *= std::conj(phase);
+					vectors[i * size + q] *= std::conj(phase);
+				}
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					a[q * size + i] *= phase;
+				}
+
+				const double theta =
+				    (a[q * size + q].real() - a[p * size + p].real()) / (2.0 * magnitude);
+				const double t = std::copysign(1.0, theta) /
+				                 (std::abs(theta) + std::sqrt(theta * theta + 1.0));
+				const double c = 1.0 / std::sqrt(t * t + 1.0);
+				const double s = t * c;
+
+				// A R, V R and then R^T A, R = [c s; -s c] in the plane (p, q)
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					const Complex ap = a[i * size + p];
+					const Complex aq = a[i * size + q];
+					a[i * size + p] = c * ap - s * aq;
+					a[i * size + q] = s * ap + c * aq;
+
+					const Complex vp = vectors[i * size + p];
+					const Complex vq = vectors[i * size + q];
+					vectors[i * size + p] = c * vp - s * vq;
+					vectors[i * size + q] = s * vp + c * vq;
+				}
+				for (std::size_t i = 0; i < size; ++i)
+				{
+					const Complex ap = a[p * size + i];
+					const Complex aq = a[q * size + i];
+					a[p * size + i] = c * ap - s * aq;
+					a[q * size + i] = s * ap + c * aq;
+				}
+				a[p * size + q] = 0.0;
+				a[q * size + p] = 0.0;
+			}
+		}
+	}
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+SvdClutterFilter::SvdClutterFilter(const PowerDopplerConfig& cfg, std::size_t pixels)
+    : _ensemble(cfg.ensemble),
+      _step(std::max(cfg.step, 1U)),
+      _tissueComponents(cfg.tissue_components),
+      _oversampling(cfg.oversampling),
+      _powerIterations(cfg.power_iterations),
+      _pixels(pixels),
+      _dotConj(dot_products.select())
+{
+	if (_ensemble == 0 || _pixels == 0)
+	{
+		throw std::invalid_argument("SVD clutter filter: empty ensemble");
+	}
+	if (_tissueComponents >= _ensemble)
+	{
+		throw std::invalid_argument("SVD clutter filter: " +
+		                            std::to_string(_tissueComponents) +
+		                            " tissue components for an ensemble of " +
+		                            std::to_string(_ensemble) + " frames");
+	}
+
+	_casorati.resize(std::size_t{2} * _pixels * _ensemble);
+	_gram.resize(std::size_t{_ensemble} * _ensemble);
+}
+
+// --------------------------------------------------------------------
+bool SvdClutterFilter::add(const frame::Frame<const float, frame::Interleaved<2>>& iq)
+{
+	if (iq.pixelCount() != _pixels)
+	{
+		throw std::invalid_argument("SVD clutter filter: frame of " +
+		                            std::to_string(iq.pixelCount()) +
+		                            " pixels instead of " + std::to_string(_pixels));
+	}
+
+	// Deinterleaved once here rather than by every image of the window
+	const std::span<float> slot(_casorati.data() + _nextSlot * 2 * _pixels, 2 * _pixels);
+	const frame::Frame<float, frame::Planar<2>> planes(slot, iq.depth(), iq.lateral());
+	frame::relayout(iq, planes);
+	if (std::ranges::find(_staleSlots, _nextSlot) == _staleSlots.end())
+	{
+		_staleSlots.push_back(_nextSlot);
+	}
+
+	_nextSlot = (_nextSlot + 1) % _ensemble;
+	_frameCount = std::min<std::size_t>(_frameCount + 1, _ensemble);
+	++_sinceImage;
+	return _frameCount == _ensemble && _sinceImage >= _step;
+}
+
+// --------------------------------------------------------------------
+void SvdClutterFilter::powerDoppler(
+    const frame::Frame<float, frame::Interleaved<1>>& power)
+{
+	dopplerMaps(power, {}, 0.0f);
+}
+
+// --------------------------------------------------------------------
+void SvdClutterFilter::dopplerMaps(
+    const frame::Frame<float, frame::Interleaved<1>>& power,
+    const frame::Frame<float, frame::Interleaved<2>>& color,
+    float velocityScale)
+{
+	if (power.pixelCount() != _pixels)
+	{
+		throw std::invalid_argument("SVD clutter filter: image of " +
+		                            std::to_string(power.pixelCount()) +
+		                            " pixels instead of " + std::to_string(_pixels));
+	}
+	if (!color.samples().empty() && color.pixelCount() != _pixels)
+	{
+		throw std::invalid_argument("SVD clutter filter: color maps of " +
+		                            std::to_string(color.pixelCount()) +
+		                            " pixels instead of " + std::to_string(_pixels));
+	}
+
+	updateGram();
+	findTissue();
+	float* colorMap = color.samples().empty() ? nullptr : color.data();
+	scheduler::parallelFor(
+	    0, _pixels, power_tile_pixels,
+	    [this, powerMap = power.data(), colorMap, velocityScale](std::size_t first,
+	                                                             std::size_t last)
+	    { mapsOfPixels(first, last, powerMap, colorMap, velocityScale); });
+	_sinceImage = 0;
+}
+
+// --------------------------------------------------------------------
+void SvdClutterFilter::updateGram()
+{
+	if (_staleSlots.empty())
+	{
+		return;
+	}
+
+	// Slots are filled in order: the first frames are in [0, frames)
+	const std::size_t frames = _frameCount;
+	const std::size_t floats = 2 * _pixels;
+	std::vector<bool> stale(frames, false);
+	for (const std::size_t slot : _staleSlots)
+	{
+		stale[slot] = true;
+	}
+
+	// A job computes the products of its slots s with the stale slots t: it writes
+	// G(s, t), and G(t, s) unless s is stale too, G(t, s) being then written by the job
+	// of t.
+	scheduler::parallelFor(
+	    0, frames, slots_per_job,
+	    [this, frames, floats, &stale](std::size_t first, std::size_t last)
+	    {
+		    const std::size_t staleCount = _staleSlots.size();
+		    std::vector<Complex> sums((last - first) * staleCount);
+		    for (std::size_t block = 0; block < _pixels; block += gram_block_pixels)
+		    {
+			    const std::size_t count = std::min(gram_block_pixels, _pixels - block);
+			    for (std::size_t s = first; s < last; ++s)
+			    {
+				    const float* a = _casorati.data() + s * floats + block;
+				    for (std::size_t j = 0; j < staleCount; ++j)
+				    {
+					    const float* b =
+					        _casorati.data() + _staleSlots[j] * floats + block;
+					    sums[(s - first) * staleCount + j] +=
+					        _dotConj(a, b, count, _pixels);
+				    }
+			    }
+		    }
+
+		    for (std::size_t s = first; s < last; ++s)
+		    {
+			    for (std::size_t j = 0; j < staleCount; ++j)
+			    {
+				    const std::size_t t = _staleSlots[j];
+				    const Complex sum = sums[(s - first) * staleCount + j];
+				    _gram[s * _ensemble + t] = sum;
+				    if (!stale[s])
+				    {
+					    _gram[t * _ensemble + s] = std::conj(sum);
+				    }
+			    }
+		    }
+	    });
+	_staleSlots.clear();
+}
+
+// --------------------------------------------------------------------
+void SvdClutterFilter::findTissue()
+{
+	const std::size_t frames = _frameCount;
+	const std::size_t components = std::min<std::size_t>(_tissueComponents, frames);
+	const std::size_t rank = std::min<std::size_t>(components + _oversampling, frames);
+	_tissue.clear();
+	_singularValues.clear();
+	if (components == 0)
+	{
+		return;
+	}
+
+	// Applies the Gram matrix to the vectors [vector][slot]
+	auto multiply = [this, frames, rank](const std::vector<Complex>& in,
+	                                     std::vector<Complex>& out)
+	{
+		out.assign(rank * frames, Complex{});
+		for (std::size_t v = 0; v < rank; ++v)
+		{
+			for (std::size_t s = 0; s < frames; ++s)
+			{
+				const Complex* row = _gram.data() + s * _ensemble;
+				Complex sum{};
+				for (std::size_t t = 0; t < frames; ++t)
+				{
+					sum += row[t] * in[v * frames + t];
+				}
+				out[v * frames + s] = sum;
+			}
+		}
+	};
+
+	// Range of the Gram matrix, from random vectors
+	std::mt19937 generator(random_seed);
+	std::normal_distribution<double> normal;
+	std::vector<Complex> random(rank * frames);
+	for (Complex& x : random)
+	{
+		x = Complex{normal(generator), normal(generator)};
+	}
+	std::vector<Complex> basis;
+	multiply(random, basis);
+	orthonormalize(basis, rank, frames);
+	for (uint32_t i = 0; i < _powerIterations; ++i)
+	{
+		multiply(basis, random);
+		std::swap(basis, random);
+		orthonormalize(basis, rank, frames);
+	}
+
+	// Rayleigh-Ritz: eigenvectors of Q^H G Q
+	std::vector<Complex> product;
+	multiply(basis, product);
+	std::vector<Complex> projected(rank * rank);
+	for (std::size_t i = 0; i < rank; ++i)
+	{
+		for (std::size_t j = 0; j < rank; ++j)
+		{
+			Complex sum{};
+			for (std::size_t s = 0; s < frames; ++s)
+			{
+				sum += std::conj(basis[i * frames + s]) * product[j * frames + s];
+			}
+			projected[i * rank + j] = sum;
+		}
+	}
+	std::vector<Complex> vectors;
+	jacobiEigen(projected, rank, vectors);
+
+	std::vector<std::size_t> order(rank);
+	std::iota(order.begin(), order.end(), 0);
+	std::ranges::sort(order, std::greater{},
+	                  [&projected, rank](std::size_t i)
+	                  { return projected[i * rank + i].real(); });
+
+	_tissue.assign(components * _ensemble, Complex{});
+	for (std::size_t c = 0; c < components; ++c)
+	{
+		const std::size_t k = order[c];
+		_singularValues.push_back(
+		    std::sqrt(std::max(projected[k * rank + k].real(), 0.0)));
+		for (std::size_t j = 0; j < rank; ++j)
+		{
+			const Complex weight = vectors[j * rank + k];
+			for (std::size_t s = 0; s < frames; ++s)
+			{
+				_tissue[c * _ensemble + s] += basis[j * frames + s] * weight;
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+void SvdClutterFilter::mapsOfPixels(std::size_t first,
+                                    std::size_t last,
+                                    float* power,
+                                    float* color,
+                                    float velocityScale) const
+{
+	const std::size_t frames = _frameCount;
+	const std::size_t components = _singularValues.size();
+	const std::size_t floats = 2 * _pixels;
+
+	// Samples of a tile [slot][pixel], in double precision and padded to the lanes
+	std::vector<double> re(frames * power_tile_pixels);
+	std::vector<double> im(frames * power_tile_pixels);
+	// Projections of a group of pixels on the tissue [component][lane]
+	std::vector<double> projectionsRe(components * power_lanes);
+	std::vector<double> projectionsIm(components * power_lanes);
+
+	for (std::size_t tile = first; tile < last; tile += power_tile_pixels)
+	{
+		const std::size_t count = std::min(power_tile_pixels, last - tile);
+		for (std::size_t s = 0; s < frames; ++s)
+		{
+			const float* real = _casorati.data() + s * floats + tile;
+			const float* imaginary = real + _pixels;
+			for (std::size_t p = 0; p < power_tile_pixels; ++p)
+			{
+				re[s * power_tile_pixels + p] = p < count ? real[p] : 0.0;
+				im[s * power_tile_pixels + p] = p < count ? imaginary[p] : 0.0;
+			}
+		}
+
+		// The sums of a group of pixels stay in the vector registers over the slots
+		for (std::size_t group = 0; group < count; group += power_lanes)
+		{
+			std::array<double, power_lanes> blood{};
+			for (std::size_t s = 0; s < frames; ++s)
+			{
+				const double* x = re.data() + s * power_tile_pixels + group;
+				const double* y = im.data() + s * power_tile_pixels + group;
+				for (std::size_t lane = 0; lane < power_lanes; ++lane)
+				{
+					blood[lane] += x[lane] * x[lane] + y[lane] * y[lane];
+				}
+			}
+
+			for (std::size_t c = 0; c < components; ++c)
+			{
+				const Complex* tissue = _tissue.data() + c * _ensemble;
+				std::array<double, power_lanes> sumRe{};
+				std::array<double, power_lanes> sumIm{};
+				for (std::size_t s = 0; s < frames; ++s)
+				{
+					const double vRe = tissue[s].real();
+					const double vIm = tissue[s].imag();
+					const double* x = re.data() + s * power_tile_pixels + group;
+					const double* y = im.data() + s * power_tile_pixels + group;
+					for (std::size_t lane = 0; lane < power_lanes; ++lane)
+					{
+						sumRe[lane] += x[lane] * vRe - y[lane] * vIm;
+						sumIm[lane] += x[lane] * vIm + y[lane] * vRe;
+					}
+				}
+				for (std::size_t lane = 0; lane < power_lanes; ++lane)
+				{
+					blood[lane] -= sumRe[lane] * sumRe[lane] + sumIm[lane] * sumIm[lane];
+				}
+				std::ranges::copy(sumRe, projectionsRe.begin() + c * power_lanes);
+				std::ranges::copy(sumIm, projectionsIm.begin() + c * power_lanes);
+			}
+
+			const std::size_t pixels = std::min(power_lanes, count - group);
+			for (std::size_t lane = 0; lane < pixels; ++lane)
+			{
+				power[tile + group + lane] = static_cast<float>(
+				    std::max(blood[lane], 0.0) / static_cast<double>(frames));
+			}
+
+			if (color != nullptr)
+			{
+				colorOfGroup(re.data() + group, im.data() + group, projectionsRe.data(),
+				             projectionsIm.data(), velocityScale,
+				             std::span(color + 2 * (tile + group), 2 * pixels));
+			}
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+void SvdClutterFilter::colorOfGroup(const double* re,
+                                    const double* im,
+                                    const double* projectionsRe,
+                                    const double* projectionsIm,
+                                    float velocityScale,
+                                    std::span<float> color) const
+{
+	const std::size_t frames = _frameCount;
+	const std::size_t components = _singularValues.size();
+	// Slot of the oldest frame, the next ones following it in time
+	const std::size_t oldest = frames == _ensemble ? _nextSlot : 0;
+
+	std::array<double, power_lanes> previousRe{};
+	std::array<double, power_lanes> previousIm{};
+	std::array<double, power_lanes> lagZero{};
+	std::array<double, power_lanes> lagOneRe{};
+	std::array<double, power_lanes> lagOneIm{};
+	for (std::size_t t = 0; t < frames; ++t)
+	{
+		const std::size_t s = (oldest + t) % frames;
+		std::array<double, power_lanes> yRe{};
+		std::array<double, power_lanes> yIm{};
+		std::copy_n(re + s * power_tile_pixels, power_lanes, yRe.begin());
+		std::copy_n(im + s * power_tile_pixels, power_lanes, yIm.begin());
+
+		// Tissue of the sample: sum_k (c_p v_k) conj(v_k[s])
+		for (std::size_t c = 0; c < components; ++c)
+		{
+			const double vRe = _tissue[c * _ensemble + s].real();
+			const double vIm = _tissue[c * _ensemble + s].imag();
+			const double* aRe = projectionsRe + c * power_lanes;
+			const double* aIm = projectionsIm + c * power_lanes;
+			for (std::size_t lane = 0; lane < power_lanes; ++lane)
+			{
+				yRe[lane] -= aRe[lane] * vRe + aIm[lane] * vIm;
+				yIm[lane] -= aIm[lane] * vRe - aRe[lane] * vIm;
+			}
+		}
+
+		for (std::size_t lane = 0; lane < power_lanes; ++lane)
+		{
+			lagZero[lane] += yRe[lane] * yRe[lane] + yIm[lane] * yIm[lane];
+			lagOneRe[lane] += previousRe[lane] * yRe[lane] + previousIm[lane] * yIm[lane];
+			lagOneIm[lane] += previousRe[lane] * yIm[lane] - previousIm[lane] * yRe[lane];
+		}
+		previousRe = yRe;
+		previousIm = yIm;
+	}
+
+	const std::size_t pixels = color.size() / 2;
+	for (std::size_t lane = 0; lane < pixels; ++lane)
+	{
+		float velocity = 0.0f;
+		float variance = 0.0f;
+		if (frames > 1 && lagZero[lane] > 0.0)
+		{
+			const double lags = static_cast<double>(frames - 1);
+			const double correlation = std::hypot(lagOneRe[lane], lagOneIm[lane]) / lags;
+			const double energy = lagZero[lane] / static_cast<double>(frames);
+			velocity = velocityScale *
+			           static_cast<float>(std::atan2(lagOneIm[lane], lagOneRe[lane]));
+			variance =
+			    static_cast<float>(std::clamp(1.0 - correlation / energy, 0.0, 1.0));
+		}
+		color[2 * lane] = velocity;
+		color[2 * lane + 1] = variance;
+	}
+}
+
+}  // namespace processing
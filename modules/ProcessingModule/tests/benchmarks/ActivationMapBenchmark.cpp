@@ -0,0 +1,93 @@
+// Throughput of the updates of the activation maps, in megapixels per second on one core
+// and per core of the shared task pool, and time to solve a map from them.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "ProcessingModule/ActivationMap.hpp"
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#include "Benchmarks.hpp"
+
+namespace
+{
+// Megapixels per second added to the map for `duration`
+double megapixelsPerSecond(processing::ActivationMap& activation,
+                           const frame::Frame<const float, frame::Interleaved<1>>& image,
+                           std::chrono::duration<double> duration)
+{
+	using clock = std::chrono::steady_clock;
+	const clock::time_point start = clock::now();
+	uint64_t images = 0;
+	std::chrono::duration<double> elapsed{0};
+	do
+	{
+		const double stimulus = images % 20 < 10 ? 1.0 : 0.0;
+		activation.add(image, stimulus, 0.1 * static_cast<double>(images));
+		++images;
+		elapsed = clock::now() - start;
+	} while (elapsed < duration);
+	return static_cast<double>(images * image.pixelCount()) / elapsed.count() / 1e6;
+}
+
+// Milliseconds to solve a map
+double mapMilliseconds(const processing::ActivationMap& activation,
+                       const frame::Frame<float, frame::Interleaved<3>>& out)
+{
+	using clock = std::chrono::steady_clock;
+	constexpr int repeats = 20;
+	const clock::time_point start = clock::now();
+	for (int k = 0; k < repeats; ++k)
+	{
+		activation.map(out);
+	}
+	return std::chrono::duration<double, std::milli>(clock::now() - start).count() /
+	       repeats;
+}
+}  // namespace
+
+void runActivationMapBenchmark(std::chrono::duration<double> duration)
+{
+	const std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+	constexpr uint32_t depth = 256;
+	constexpr uint32_t lateral = 128;
+
+	std::printf("%-32s %16s %16s %16s %16s\n", "activation map, 256x128", "MP/s, scalar",
+	            "MP/s, 1 core", "MP/s/core, pool", "ms per map");
+	for (const bool detrend : {false, true})
+	{
+		std::vector<float> pixels(std::size_t{depth} * lateral);
+		std::mt19937 generator(1);
+		std::exponential_distribution<float> power;
+		std::ranges::generate(pixels, [&] { return power(generator); });
+		const frame::Frame<const float, frame::Interleaved<1>> image(pixels, depth,
+		                                                             lateral);
+		std::vector<float> samples(3 * pixels.size());
+		const frame::Frame<float, frame::Interleaved<3>> map(samples, depth, lateral);
+		simd::limitLevel(simd::SimdLevel::Scalar);
+		processing::ActivationMap reference(depth, lateral, detrend);
+		simd::limitLevel(simd::SimdLevel::Avx512);
+		processing::ActivationMap activation(depth, lateral, detrend);
+
+		// Without a shared pool the chunks are updated on the caller
+		const double scalar = megapixelsPerSecond(reference, image, duration);
+		const double single = megapixelsPerSecond(activation, image, duration);
+		double pooled = 0.0;
+		double solve = 0.0;
+		{
+			scheduler::SharedTaskPool pool(threads);
+			pooled = megapixelsPerSecond(activation, image, duration) /
+			         static_cast<double>(threads);
+			solve = mapMilliseconds(activation, map);
+		}
+
+		std::printf("%-32s %16.1f %16.1f %16.1f %16.2f\n",
+		            detrend ? "stimulus and drift" : "stimulus", scalar, single, pooled,
+		            solve);
+	}
+}
@@ -0,0 +1,155 @@
+// Throughput of the delay-and-sum beamforming for standard plane-wave configurations,
+// in frames (one plane wave each) per second and per core, and of the compounding of
+// the plane waves of an ensemble.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "AcquisitionModule/SequenceCache.hpp"
+#include "ProcessingModule/DelayAndSumBeamformer.hpp"
+#include "ProcessingModule/PlaneWaveCompounder.hpp"
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#include "Benchmarks.hpp"
+
+namespace
+{
+struct Configuration
+{
+	std::string_view name;
+	uint32_t elements;
+	uint32_t depth_samples;
+};
+
+// Frames per second beamformed for `duration`
+double framesPerSecond(const processing::DelayAndSumBeamformer& beamformer,
+                       const std::vector<float>& rf,
+                       std::vector<float>& iq,
+                       std::chrono::duration<double> duration)
+{
+	using clock = std::chrono::steady_clock;
+	const auto channels = frame::viewOf<1>(
+	    std::span<const float>(rf), beamformer.inputGeometry(), frame::FrameKind::RawRf);
+	const auto pixels =
+	    frame::viewOf<2>(iq, beamformer.outputGeometry(), frame::FrameKind::PlaneWaveIq);
+	const clock::time_point start = clock::now();
+	uint64_t frames = 0;
+	std::chrono::duration<double> elapsed{0};
+	do
+	{
+		const auto angle = static_cast<uint32_t>(frames % beamformer.angleCount());
+		beamformer.beamform(channels, angle, pixels);
+		++frames;
+		elapsed = clock::now() - start;
+	} while (elapsed < duration);
+	return static_cast<double>(frames) / elapsed.count();
+}
+
+// Ensembles per second compounded for `duration`
+double ensemblesPerSecond(const std::vector<std::vector<float>>& planeWaves,
+                          std::vector<float>& iq,
+                          const Configuration& configuration,
+                          std::chrono::duration<double> duration)
+{
+	using clock = std::chrono::steady_clock;
+	std::vector<processing::ConstIqImage> images;
+	for (const std::vector<float>& planeWave : planeWaves)
+	{
+		images.emplace_back(planeWave, configuration.depth_samples,
+		                    configuration.elements);
+	}
+	const processing::IqImage out(iq, configuration.depth_samples,
+	                              configuration.elements);
+	const clock::time_point start = clock::now();
+	uint64_t ensembles = 0;
+	std::chrono::duration<double> elapsed{0};
+	do
+	{
+		processing::compoundImages(images, 1.0f, out);
+		++ensembles;
+		elapsed = clock::now() - start;
+	} while (elapsed < duration);
+	return static_cast<double>(ensembles) / elapsed.count();
+}
+}  // namespace
+
+void runBeamformingBenchmark(std::chrono::duration<double> duration)
+{
+	const std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+
+	const std::vector<Configuration> configurations{
+	    {"128 elements, 256 samples", 128, 256},
+	    {"128 elements, 1024 samples", 128, 1024},
+	    {"192 elements, 512 samples", 192, 512},
+	};
+
+	std::printf("%-32s %12s %16s %16s %16s\n", "configuration", "tables (ms)",
+	            "fps, scalar", "fps, 1 core", "fps/core, pool");
+	for (const Configuration& configuration : configurations)
+	{
+		acq_module::AcquisitionParameters parameters;
+		parameters.element_count = configuration.elements;
+		parameters.depth_samples = configuration.depth_samples;
+
+		const auto start = std::chrono::steady_clock::now();
+		const processing::DelayAndSumBeamformer beamformer(
+		    acq_module::compileSequence(parameters));
+		const std::chrono::duration<double, std::milli> tables =
+		    std::chrono::steady_clock::now() - start;
+
+		std::vector<float> rf(beamformer.inputGeometry().sampleCount(
+		    frame::FrameKind::RawRf));
+		std::mt19937 generator(1);
+		std::normal_distribution<float> noise;
+		for (float& sample : rf)
+		{
+			sample = noise(generator);
+		}
+		std::vector<float> iq(beamformer.outputGeometry().sampleCount(
+		    frame::FrameKind::CompoundedIq));
+
+		simd::limitLevel(simd::SimdLevel::Scalar);
+		const processing::DelayAndSumBeamformer reference(
+		    acq_module::compileSequence(parameters));
+		simd::limitLevel(simd::SimdLevel::Avx512);
+
+		// Without a shared pool the lines are beamformed on the caller
+		const double scalar = framesPerSecond(reference, rf, iq, duration);
+		const double single = framesPerSecond(beamformer, rf, iq, duration);
+		double pooled = 0.0;
+		{
+			scheduler::SharedTaskPool pool(threads);
+			pooled = framesPerSecond(beamformer, rf, iq, duration) /
+			         static_cast<double>(threads);
+		}
+
+		std::printf("%-32s %12.1f %16.1f %16.1f %16.1f\n", configuration.name.data(),
+		            tables.count(), scalar, single, pooled);
+	}
+
+	std::printf("\n%-32s %12s %16s %16s\n", "compounding, 1 core", "angles",
+	            "ensembles/s", "GB/s read");
+	for (const Configuration& configuration : configurations)
+	{
+		acq_module::AcquisitionParameters parameters;
+		const std::size_t size = std::size_t{2} * configuration.elements *
+		                         configuration.depth_samples;
+		const std::vector<std::vector<float>> planeWaves(parameters.angle_count,
+		                                                 std::vector<float>(size, 1.0f));
+		std::vector<float> iq(size);
+
+		const double ensembles =
+		    ensemblesPerSecond(planeWaves, iq, configuration, duration);
+		const double bytes = ensembles * static_cast<double>(planeWaves.size() * size) *
+		                     sizeof(float);
+		std::printf("%-32s %12u %16.1f %16.2f\n", configuration.name.data(),
+		            parameters.angle_count, ensembles, bytes / 1e9);
+	}
+}
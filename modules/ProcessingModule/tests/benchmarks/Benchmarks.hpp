@@ -0,0 +1,24 @@
+// Benchmarks of the processing kernels, run in turn by main.cpp. Each one prints its
+// table on the standard output.
+
+#ifndef PROCESSINGMODULE_BENCHMARKS_HPP
+#define PROCESSINGMODULE_BENCHMARKS_HPP
+
+#include <chrono>
+
+// Delay-and-sum beamforming and compounding of the plane waves
+void runBeamformingBenchmark(std::chrono::duration<double> duration);
+
+// Denoising filters of the Doppler images
+void runSpatialFilterBenchmark(std::chrono::duration<double> duration);
+
+// Statistics of the pixels of the Doppler images
+void runPixelStatisticsBenchmark(std::chrono::duration<double> duration);
+
+// Activation maps of the Doppler images against a stimulus
+void runActivationMapBenchmark(std::chrono::duration<double> duration);
+
+// Scaling of the processing farm with its workers
+void runProcessingFarmBenchmark(std::chrono::duration<double> duration);
+
+#endif  // PROCESSINGMODULE_BENCHMARKS_HPP
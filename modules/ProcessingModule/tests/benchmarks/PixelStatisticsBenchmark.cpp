@@ -0,0 +1,72 @@
+// Throughput of the updates of the statistics of the pixels, in megapixels per second on
+// one core and per core of the shared task pool, once the window is full.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "ProcessingModule/PixelStatistics.hpp"
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#include "Benchmarks.hpp"
+
+namespace
+{
+// Megapixels per second added to the statistics for `duration`
+double megapixelsPerSecond(processing::PixelStatistics& statistics,
+                           const frame::Frame<const float, frame::Interleaved<1>>& image,
+                           std::chrono::duration<double> duration)
+{
+	using clock = std::chrono::steady_clock;
+	const clock::time_point start = clock::now();
+	uint64_t images = 0;
+	std::chrono::duration<double> elapsed{0};
+	do
+	{
+		statistics.add(image);
+		++images;
+		elapsed = clock::now() - start;
+	} while (elapsed < duration);
+	return static_cast<double>(images * image.pixelCount()) / elapsed.count() / 1e6;
+}
+}  // namespace
+
+void runPixelStatisticsBenchmark(std::chrono::duration<double> duration)
+{
+	const std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+	constexpr uint32_t depth = 256;
+	constexpr uint32_t lateral = 128;
+
+	std::printf("%-32s %16s %16s %16s\n", "pixel statistics, 256x128", "MP/s, scalar",
+	            "MP/s, 1 core", "MP/s/core, pool");
+	for (const uint32_t window : {10U, 100U})
+	{
+		std::vector<float> pixels(std::size_t{depth} * lateral);
+		std::mt19937 generator(1);
+		std::exponential_distribution<float> power;
+		std::ranges::generate(pixels, [&] { return power(generator); });
+		const frame::Frame<const float, frame::Interleaved<1>> image(pixels, depth,
+		                                                             lateral);
+		simd::limitLevel(simd::SimdLevel::Scalar);
+		processing::PixelStatistics reference(window, depth, lateral);
+		simd::limitLevel(simd::SimdLevel::Avx512);
+		processing::PixelStatistics statistics(window, depth, lateral);
+
+		// Without a shared pool the chunks are updated on the caller
+		const double scalar = megapixelsPerSecond(reference, image, duration);
+		const double single = megapixelsPerSecond(statistics, image, duration);
+		double pooled = 0.0;
+		{
+			scheduler::SharedTaskPool pool(threads);
+			pooled = megapixelsPerSecond(statistics, image, duration) /
+			         static_cast<double>(threads);
+		}
+
+		std::printf("window of %-22u %16.1f %16.1f %16.1f\n", window, scalar, single,
+		            pooled);
+	}
+}
@@ -0,0 +1,137 @@
+// Scaling of the processing farm with its workers: frames per second through the farm
+// for a processor of a fixed cost, each worker count on as many CAF threads, and the
+// speedup and efficiency over one worker.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <caf/actor_cast.hpp>
+#include <caf/actor_from_state.hpp>
+#include <caf/actor_system.hpp>
+#include <caf/actor_system_config.hpp>
+#include <caf/event_based_actor.hpp>
+#include <caf/exit_reason.hpp>
+#include <caf/init_global_meta_objects.hpp>
+#include <caf/scoped_actor.hpp>
+
+#include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "ProcessingModule/ProcessingFarmActor.hpp"
+
+#include "Benchmarks.hpp"
+
+namespace
+{
+// Arithmetic of a fixed cost per frame, about a millisecond
+class FixedCostProcessor : public processing::FrameProcessor
+{
+public:
+	[[nodiscard]] frame::AcquisitionFrame process(
+	    const frame::AcquisitionFrame& frame) override
+	{
+		float sum = 0.0f;
+		for (uint32_t i = 0; i < 1'000'000; ++i)
+		{
+			sum += std::sqrt(static_cast<float>(i));
+		}
+		frame::AcquisitionFrame processed = frame;
+		processed.samples = std::make_shared<const frame::SampleBuffer>(1, sum);
+		return processed;
+	}
+};
+
+// Tells the waiting actor once it has received all the frames
+caf::behavior consumerImpl(caf::event_based_actor* self,
+                           uint64_t frames,
+                           caf::actor waiting)
+{
+	auto received = std::make_shared<uint64_t>(0);
+	return {[self, frames, waiting, received](caf::publish_atom,
+	                                          const frame::AcquisitionFrame&)
+	        {
+		        if (++*received == frames)
+		        {
+			        self->mail(caf::ok_atom_v).send(waiting);
+		        }
+	        },
+	        [](caf::publish_atom, const frame::StimulusEvent&) {},
+	        [](acq_module::AcquisitionState) {}};
+}
+
+// Frames per second through a farm of `workers`, `frames` pushed at once
+double framesPerSecond(uint32_t workers, uint64_t frames)
+{
+	caf::actor_system_config cfg;
+	cfg.set("caf.scheduler.max-threads", static_cast<int64_t>(workers));
+	caf::actor_system system{cfg};
+
+	auto session =
+	    system.spawn(caf::actor_from_state<acq_module::acquisition_session_state>,
+	                 acq_module::SimulatorConfig{}, acq_module::AcquisitionConfig{});
+	processing::ProcessingConfig farmCfg;
+	farmCfg.workers = workers;
+	farmCfg.max_in_flight = 2 * workers;
+	const processing::ProcessorFactory factory = []
+	{ return std::make_unique<FixedCostProcessor>(); };
+	auto farm = system.spawn(caf::actor_from_state<processing::processing_farm_state>,
+	                         session, farmCfg, factory);
+
+	caf::scoped_actor self{system};
+	auto consumer = system.spawn(consumerImpl, frames,
+	                             caf::actor_cast<caf::actor>(self));
+	self->mail(acq_subscribe_v, frame::FrameStream::Doppler, consumer).send(farm);
+
+	using clock = std::chrono::steady_clock;
+	const clock::time_point start = clock::now();
+	for (uint64_t i = 0; i < frames; ++i)
+	{
+		frame::AcquisitionFrame frame;
+		frame.sequence = i;
+		frame.timestamp = frame::monotonicTimestamp();
+		self->mail(caf::publish_atom_v, std::move(frame)).send(farm);
+	}
+	self->receive([](caf::ok_atom) {});
+	const std::chrono::duration<double> elapsed = clock::now() - start;
+
+	self->send_exit(farm, caf::exit_reason::user_shutdown);
+	self->send_exit(consumer, caf::exit_reason::user_shutdown);
+	self->send_exit(session, caf::exit_reason::user_shutdown);
+	return static_cast<double>(frames) / elapsed.count();
+}
+}  // namespace
+
+void runProcessingFarmBenchmark(std::chrono::duration<double> duration)
+{
+	caf::init_global_meta_objects<caf::id_block::custom_types_general>();
+	caf::init_global_meta_objects<caf::id_block::custom_types_acq_module>();
+	caf::core::init_global_meta_objects();
+
+	// Frames for about `duration` on one worker
+	FixedCostProcessor processor;
+	const auto start = std::chrono::steady_clock::now();
+	static_cast<void>(processor.process({}));
+	const std::chrono::duration<double> cost = std::chrono::steady_clock::now() - start;
+	const auto frames = static_cast<uint64_t>(std::max(duration / cost, 16.0));
+
+	const uint32_t threads = std::max(1U, std::thread::hardware_concurrency());
+	std::printf("%-32s %16s %16s %16s\n", "processing farm", "frames/s", "speedup",
+	            "efficiency");
+	double single = 0.0;
+	for (const uint32_t workers : {1U, 2U, 4U, 8U})
+	{
+		if (workers > threads)
+		{
+			break;
+		}
+		const double rate = framesPerSecond(workers, frames);
+		single = workers == 1 ? rate : single;
+		std::printf("%-2u workers %21s %16.1f %16.2f %16.2f\n", workers, "", rate,
+		            rate / single, rate / single / workers);
+	}
+}
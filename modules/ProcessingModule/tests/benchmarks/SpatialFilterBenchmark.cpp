@@ -0,0 +1,89 @@
+// Throughput of the denoising filters of the Doppler images, in megapixels per second on
+// one core and per core of the shared task pool.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "ProcessingModule/SpatialFilter.hpp"
+#include "Scheduler/TaskPool.hpp"
+#include "Simd/Dispatch.hpp"
+
+#include "Benchmarks.hpp"
+
+namespace
+{
+struct Configuration
+{
+	std::string_view name;
+	processing::SpatialFilterConfig filter;
+};
+
+// Megapixels per second filtered for `duration`
+double megapixelsPerSecond(processing::SpatialFilter& filter,
+                           const frame::Frame<float, frame::Interleaved<1>>& image,
+                           std::chrono::duration<double> duration)
+{
+	using clock = std::chrono::steady_clock;
+	const clock::time_point start = clock::now();
+	uint64_t images = 0;
+	std::chrono::duration<double> elapsed{0};
+	do
+	{
+		filter.apply(image);
+		++images;
+		elapsed = clock::now() - start;
+	} while (elapsed < duration);
+	return static_cast<double>(images * image.pixelCount()) / elapsed.count() / 1e6;
+}
+}  // namespace
+
+void runSpatialFilterBenchmark(std::chrono::duration<double> duration)
+{
+	const std::size_t threads = std::max(1U, std::thread::hardware_concurrency());
+	constexpr uint32_t depth = 256;
+	constexpr uint32_t lateral = 128;
+
+	const std::vector<Configuration> configurations{
+	    {"gaussian, 5x5", {.kind = "gaussian", .radius = 2}},
+	    {"gaussian, 9x9", {.kind = "gaussian", .radius = 4, .sigma = 2.0f}},
+	    {"median, 3x3", {.kind = "median", .radius = 1}},
+	    {"median, 5x5", {.kind = "median", .radius = 2}},
+	    {"bilateral, 5x5", {.kind = "bilateral", .radius = 2}},
+	};
+
+	std::printf("%-32s %16s %16s %16s\n", "filter, 256x128 pixels", "MP/s, scalar",
+	            "MP/s, 1 core", "MP/s/core, pool");
+	for (const Configuration& configuration : configurations)
+	{
+		std::vector<float> image(std::size_t{depth} * lateral);
+		std::mt19937 generator(1);
+		std::exponential_distribution<float> power;
+		for (float& pixel : image)
+		{
+			pixel = power(generator);
+		}
+		const frame::Frame<float, frame::Interleaved<1>> pixels(image, depth, lateral);
+		simd::limitLevel(simd::SimdLevel::Scalar);
+		processing::SpatialFilter reference(configuration.filter, depth, lateral);
+		simd::limitLevel(simd::SimdLevel::Avx512);
+		processing::SpatialFilter filter(configuration.filter, depth, lateral);
+
+		// Without a shared pool the tiles are filtered on the caller
+		const double scalar = megapixelsPerSecond(reference, pixels, duration);
+		const double single = megapixelsPerSecond(filter, pixels, duration);
+		double pooled = 0.0;
+		{
+			scheduler::SharedTaskPool pool(threads);
+			pooled = megapixelsPerSecond(filter, pixels, duration) /
+			         static_cast<double>(threads);
+		}
+
+		std::printf("%-32s %16.1f %16.1f %16.1f\n", configuration.name.data(), scalar,
+		            single, pooled);
+	}
+}
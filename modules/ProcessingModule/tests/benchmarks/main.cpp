@@ -0,0 +1,29 @@
+// Throughput of the processing kernels and scaling of the processing farm.
+//
+// Usage: processing_module_benchmarks [seconds per configuration]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "Simd/Dispatch.hpp"
+
+#include "Benchmarks.hpp"
+
+int main(int argc, char** argv)
+{
+	const std::chrono::duration<double> duration{argc > 1 ? std::atof(argv[1]) : 2.0};
+
+	// The scalar columns run the reference variants of the kernels
+	std::printf("SIMD level: %s\n\n", simd::to_string(simd::activeLevel()).c_str());
+	runBeamformingBenchmark(duration);
+	std::printf("\n");
+	runSpatialFilterBenchmark(duration);
+	std::printf("\n");
+	runPixelStatisticsBenchmark(duration);
+	std::printf("\n");
+	runActivationMapBenchmark(duration);
+	std::printf("\n");
+	runProcessingFarmBenchmark(duration);
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,294 @@
+#include <caf/test/test.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "ProcessingModule/ActivationMap.hpp"
+#include "Simd/Dispatch.hpp"
+
+using namespace processing;
+using namespace std::chrono_literals;
+
+namespace
+{
+// More pixels than a tile, not a multiple of the chunks
+constexpr uint32_t depth_for_test = 67;
+constexpr uint32_t lateral_for_test = 71;
+constexpr std::size_t pixels_for_test = std::size_t{depth_for_test} * lateral_for_test;
+constexpr std::size_t images_for_test = 120;
+
+// Blocks of 10 images on, 20 off
+double stimulusOf(std::size_t image)
+{
+	return image % 30 >= 10 && image % 30 < 20 ? 1.0 : 0.0;
+}
+
+double timeOf(std::size_t image)
+{
+	return 0.1 * static_cast<double>(image);
+}
+
+// Noisy power around a level; the first columns respond to the stimulus, with a drift
+std::vector<std::vector<float>> randomImages()
+{
+	std::mt19937 generator(11);
+	std::normal_distribution<float> noise(0.0f, 5.0f);
+	std::vector<std::vector<float>> images(images_for_test,
+	                                       std::vector<float>(pixels_for_test));
+	for (std::size_t k = 0; k < images_for_test; ++k)
+	{
+		for (std::size_t p = 0; p < pixels_for_test; ++p)
+		{
+			const bool responding = p < 10 * depth_for_test;
+			const auto response = static_cast<float>(responding ? stimulusOf(k) : 0.0);
+			images[k][p] = 1000.0f + 20.0f * static_cast<float>(timeOf(k)) +
+			               100.0f * response + noise(generator);
+		}
+	}
+	return images;
+}
+
+frame::Frame<const float, frame::Interleaved<1>> imageOf(const std::vector<float>& pixels)
+{
+	return {pixels, depth_for_test, lateral_for_test};
+}
+
+frame::Frame<float, frame::Interleaved<3>> mapOf(std::vector<float>& samples)
+{
+	return {samples, depth_for_test, lateral_for_test};
+}
+
+// t statistic, partial correlation and relative change of a pixel by a direct least
+// squares fit of the images on the regressors
+std::vector<double> fitOf(const std::vector<std::vector<float>>& images,
+                          std::size_t pixel,
+                          bool detrend)
+{
+	const std::size_t regressors = detrend ? 3 : 2;
+	auto regressorOf = [](std::size_t k, std::size_t r)
+	{ return r == 0 ? 1.0 : (r == 1 ? stimulusOf(k) : timeOf(k)); };
+
+	// Normal equations and their inverse, solved by Gauss-Jordan elimination
+	double a[3][7]{};
+	double mean = 0.0;
+	for (std::size_t k = 0; k < images.size(); ++k)
+	{
+		mean += images[k][pixel];
+		for (std::size_t r = 0; r < regressors; ++r)
+		{
+			for (std::size_t c = 0; c < regressors; ++c)
+			{
+				a[r][c] += regressorOf(k, r) * regressorOf(k, c);
+			}
+			a[r][regressors + r] = 1.0;
+			a[r][6] += regressorOf(k, r) * images[k][pixel];
+		}
+	}
+	mean /= static_cast<double>(images.size());
+	for (std::size_t k = 0; k < regressors; ++k)
+	{
+		const double pivot = a[k][k];
+		for (double& term : a[k])
+		{
+			term /= pivot;
+		}
+		for (std::size_t i = 0; i < regressors; ++i)
+		{
+			if (i != k)
+			{
+				const double factor = a[i][k];
+				for (std::size_t j = 0; j < 7; ++j)
+				{
+					a[i][j] -= factor * a[k][j];
+				}
+			}
+		}
+	}
+
+	double residuals = 0.0;
+	for (std::size_t k = 0; k < images.size(); ++k)
+	{
+		double fitted = 0.0;
+		for (std::size_t r = 0; r < regressors; ++r)
+		{
+			fitted += a[r][6] * regressorOf(k, r);
+		}
+		residuals += (images[k][pixel] - fitted) * (images[k][pixel] - fitted);
+	}
+	const auto degrees = static_cast<double>(images.size() - regressors);
+	const double slope = a[1][6];
+	const double t = slope / std::sqrt(residuals / degrees * a[1][regressors + 1]);
+	return {t, t / std::sqrt(t * t + degrees), slope / mean};
+}
+
+// Whether a map holds the fit of each pixel
+bool holdsFit(const std::vector<float>& map,
+              const std::vector<std::vector<float>>& images,
+              bool detrend)
+{
+	for (std::size_t p = 0; p < pixels_for_test; ++p)
+	{
+		const std::vector<double> expected = fitOf(images, p, detrend);
+		for (std::size_t c = 0; c < 3; ++c)
+		{
+			if (std::abs(map[3 * p + c] - expected[c]) >
+			    1e-3 * (std::abs(expected[c]) + 0.01))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+}  // namespace
+
+TEST("the map is the least squares fit of the pixels on the regressors")
+{
+	const std::vector<std::vector<float>> images = randomImages();
+	for (const bool detrend : {true, false})
+	{
+		ActivationMap activation(depth_for_test, lateral_for_test, detrend);
+		for (std::size_t k = 0; k < images.size(); ++k)
+		{
+			activation.add(imageOf(images[k]), stimulusOf(k), timeOf(k));
+		}
+		check_eq(activation.count(), uint64_t{images_for_test});
+
+		std::vector<float> map(3 * pixels_for_test);
+		activation.map(mapOf(map));
+		check(holdsFit(map, images, detrend));
+	}
+}
+
+TEST("the responding pixels stand out of the map")
+{
+	const std::vector<std::vector<float>> images = randomImages();
+	ActivationMap activation(depth_for_test, lateral_for_test, true);
+	for (std::size_t k = 0; k < images.size(); ++k)
+	{
+		activation.add(imageOf(images[k]), stimulusOf(k), timeOf(k));
+	}
+	std::vector<float> map(3 * pixels_for_test);
+	activation.map(mapOf(map));
+
+	// 100 over a mean of about 1150
+	check_gt(map[0], 20.0f);
+	check_gt(map[1], 0.9f);
+	check_lt(std::abs(map[2] - 0.087f), 0.005f);
+	const std::size_t idle = pixels_for_test - 1;
+	check_lt(std::abs(map[3 * idle]), 5.0f);
+	check_lt(std::abs(map[3 * idle + 2]), 0.01f);
+}
+
+TEST("the map is empty until the regressors determine the model")
+{
+	const std::vector<std::vector<float>> images = randomImages();
+	ActivationMap activation(depth_for_test, lateral_for_test, true);
+	std::vector<float> map(3 * pixels_for_test, 1.0f);
+	activation.map(mapOf(map));
+	check(std::ranges::all_of(map, [](float sample) { return sample == 0.0f; }));
+
+	// No stimulus in the first 10 images
+	for (std::size_t k = 0; k < 10; ++k)
+	{
+		activation.add(imageOf(images[k]), stimulusOf(k), timeOf(k));
+	}
+	std::ranges::fill(map, 1.0f);
+	activation.map(mapOf(map));
+	check(std::ranges::all_of(map, [](float sample) { return sample == 0.0f; }));
+
+	activation.reset();
+	check_eq(activation.count(), uint64_t{0});
+}
+
+TEST("the variants of the instruction sets give the same map")
+{
+	const std::vector<std::vector<float>> images = randomImages();
+	simd::limitLevel(simd::SimdLevel::Scalar);
+	ActivationMap reference(depth_for_test, lateral_for_test, true);
+	simd::limitLevel(simd::SimdLevel::Avx512);
+	ActivationMap activation(depth_for_test, lateral_for_test, true);
+	check_eq(reference.simdLevel(), simd::SimdLevel::Scalar);
+
+	for (std::size_t k = 0; k < images.size(); ++k)
+	{
+		reference.add(imageOf(images[k]), stimulusOf(k), timeOf(k));
+		activation.add(imageOf(images[k]), stimulusOf(k), timeOf(k));
+	}
+	std::vector<float> expected(3 * pixels_for_test);
+	std::vector<float> map(3 * pixels_for_test);
+	reference.map(mapOf(expected));
+	activation.map(mapOf(map));
+	for (std::size_t s = 0; s < map.size(); ++s)
+	{
+		check_lt(std::abs(map[s] - expected[s]), 1e-4f * (1.0f + std::abs(expected[s])));
+	}
+}
+
+TEST("the activation map rejects invalid parameters")
+{
+	check_throws<std::invalid_argument>(
+	    [] { ActivationMap activation(0, lateral_for_test, true); });
+
+	ActivationMap activation(depth_for_test, lateral_for_test, true);
+	const std::vector<float> transposed(pixels_for_test);
+	check_throws<std::invalid_argument>(
+	    [&activation, &transposed]
+	    { activation.add({transposed, lateral_for_test, depth_for_test}, 0.0, 0.0); });
+	std::vector<float> map(3 * pixels_for_test);
+	check_throws<std::invalid_argument>(
+	    [&activation, &map]
+	    { activation.map({map, lateral_for_test, depth_for_test}); });
+}
+
+TEST("the regressor follows the stimuli of its source")
+{
+	const auto at = [](std::chrono::nanoseconds time) { return time.count(); };
+	StimulusRegressor regressor(frame::StimulusSource::Paradigm, 0ns, 0ns);
+	regressor.addEvent({.timestamp = at(1s), .source = frame::StimulusSource::Paradigm,
+	                    .code = 2});
+	regressor.addEvent({.timestamp = at(2s), .source = frame::StimulusSource::Trigger,
+	                    .code = 0});
+	regressor.addEvent({.timestamp = at(3s), .source = frame::StimulusSource::Paradigm,
+	                    .code = 0});
+	check_eq(regressor.valueAt(at(500ms)), 0.0);
+	check_eq(regressor.valueAt(at(1500ms)), 1.0);
+	check_eq(regressor.valueAt(at(2500ms)), 1.0);
+	check_eq(regressor.valueAt(at(3500ms)), 0.0);
+
+	// Stimuli of a fixed duration
+	StimulusRegressor triggered(frame::StimulusSource::Trigger, 1s, 0ns);
+	triggered.addEvent({.timestamp = at(1s), .source = frame::StimulusSource::Trigger,
+	                    .code = 1});
+	check_eq(triggered.valueAt(at(1500ms)), 1.0);
+	check_eq(triggered.valueAt(at(2500ms)), 0.0);
+
+	check_throws<std::invalid_argument>(
+	    [] { StimulusRegressor invalid(frame::StimulusSource::Trigger, -1s, 0ns); });
+}
+
+TEST("the hemodynamic response lags the stimuli and reaches their level")
+{
+	const auto at = [](std::chrono::nanoseconds time) { return time.count(); };
+	StimulusRegressor regressor(frame::StimulusSource::Paradigm, 0ns, 2s);
+	regressor.addEvent({.timestamp = 0, .source = frame::StimulusSource::Paradigm,
+	                    .code = 1});
+	regressor.addEvent({.timestamp = at(60s), .source = frame::StimulusSource::Paradigm,
+	                    .code = 0});
+
+	// Rising after the start, at 1 long after it, back to 0 long after the stop
+	const double early = regressor.valueAt(at(1s));
+	const double peak = regressor.valueAt(at(2s));
+	check_gt(early, 0.0);
+	check_gt(peak, early);
+	check_lt(peak, 1.0);
+	check_lt(std::abs(regressor.valueAt(at(40s)) - 1.0), 1e-6);
+	check_gt(regressor.valueAt(at(62s)), 0.0);
+	check_lt(regressor.valueAt(at(62s)), 1.0);
+	check_lt(regressor.valueAt(at(120s)), 1e-6);
+}
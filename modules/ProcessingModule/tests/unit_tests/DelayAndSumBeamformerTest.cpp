@@ -0,0 +1,216 @@
+#include <caf/test/test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "AcquisitionModule/SequenceCache.hpp"
+#include "ProcessingModule/BeamformingProcessor.hpp"
+#include "ProcessingModule/DelayAndSumBeamformer.hpp"
+#include "Simd/Dispatch.hpp"
+
+using namespace processing;
+
+namespace
+{
+acq_module::AcquisitionParameters parametersForTest()
+{
+	acq_module::AcquisitionParameters parameters;
+	parameters.angle_count = 3;
+	parameters.element_count = 32;
+	parameters.depth_samples = 128;
+	return parameters;
+}
+
+// Sample of an element receiving the echo of pixel (line, i), as the beamformer rounds it
+std::size_t echoSample(const acq_module::CompiledSequence& sequence,
+                       std::size_t angle,
+                       std::size_t line,
+                       std::size_t i,
+                       std::size_t element)
+{
+	const acq_module::AcquisitionParameters& parameters = sequence.parameters;
+	const std::size_t elements = parameters.element_count;
+	const float fs = parameters.sampling_frequency;
+	const float transmit =
+	    sequence.transmit_delays[angle * elements + line] * fs +
+	    static_cast<float>(i) * std::cos(acq_module::steeringAngle(parameters, angle)) /
+	        2.0f;
+	const std::size_t offset = element > line ? element - line : line - element;
+	const float receive = sequence.receive_delays[i * elements + offset];
+	return static_cast<std::size_t>(transmit + receive + 0.5f);
+}
+
+// Straightforward beamforming of one pixel, F-number 1
+std::pair<float, float> referencePixel(const acq_module::CompiledSequence& sequence,
+                                       const std::vector<float>& rf,
+                                       std::size_t angle,
+                                       std::size_t line,
+                                       std::size_t i)
+{
+	const acq_module::AcquisitionParameters& parameters = sequence.parameters;
+	const std::size_t depth = parameters.depth_samples;
+	const float z = static_cast<float>(i) * parameters.sound_speed /
+	                (2.0f * parameters.sampling_frequency);
+	const auto half = static_cast<std::size_t>(z / 2.0f / parameters.pitch);
+
+	float sum = 0.0f;
+	float quadrature = 0.0f;
+	for (std::size_t e = 0; e < parameters.element_count; ++e)
+	{
+		const std::size_t offset = e > line ? e - line : line - e;
+		const std::size_t sample = echoSample(sequence, angle, line, i, e);
+		if (offset <= half && sample + 1 < depth)
+		{
+			sum += sequence.apodization[e] * rf[e * depth + sample];
+			quadrature += sequence.apodization[e] * rf[e * depth + sample + 1];
+		}
+	}
+	return {sum, -quadrature};
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST("the echo of a point focuses on its pixel")
+{
+	const acq_module::CompiledSequence sequence = compileSequence(parametersForTest());
+	const DelayAndSumBeamformer beamformer(sequence);
+	const std::size_t depth = 128;
+	const std::size_t elements = 32;
+	const std::size_t line = 20;
+	const std::size_t i = 100;
+
+	std::vector<float> rf(depth * elements, 0.0f);
+	for (std::size_t e = 0; e < elements; ++e)
+	{
+		const std::size_t sample = echoSample(sequence, 1, line, i, e);
+		if (sample < depth)
+		{
+			rf[e * depth + sample] = 1.0f;
+		}
+	}
+
+	std::vector<float> iq(2 * depth * elements);
+	beamformer.beamform({rf, depth, elements}, 1, {iq, depth, elements});
+
+	const auto [sum, quadrature] = referencePixel(sequence, rf, 1, line, i);
+	check_eq(iq[2 * (line * depth + i)], sum);
+	check(sum > 1.0f);
+
+	// The brightest pixel is the one of the point
+	std::size_t brightest = 0;
+	for (std::size_t p = 0; p < depth * elements; ++p)
+	{
+		if (std::abs(iq[2 * p]) > std::abs(iq[2 * brightest]))
+		{
+			brightest = p;
+		}
+	}
+	check_eq(brightest, line * depth + i);
+}
+
+// --------------------------------------------------------------------
+
+TEST("beamforming matches the reference on every pixel, angle and instruction set")
+{
+	const acq_module::CompiledSequence sequence = compileSequence(parametersForTest());
+	const std::size_t depth = 128;
+	const std::size_t elements = 32;
+
+	std::vector<float> rf(depth * elements);
+	std::srand(3);
+	std::ranges::generate(
+	    rf, [] { return static_cast<float>(std::rand() % 2001) / 1000.0f - 1.0f; });
+
+	std::vector<float> iq(2 * depth * elements);
+	for (const simd::SimdLevel level :
+	     {simd::SimdLevel::Scalar, simd::SimdLevel::Avx2, simd::SimdLevel::Avx512})
+	{
+		// The variants the machine supports
+		simd::limitLevel(level);
+		const DelayAndSumBeamformer beamformer(sequence);
+		simd::limitLevel(simd::SimdLevel::Avx512);
+		check(beamformer.simdLevel() <= level);
+		if (beamformer.simdLevel() != std::min(level, simd::detectedLevel()))
+		{
+			continue;
+		}
+
+		for (uint32_t angle = 0; angle < 3; ++angle)
+		{
+			beamformer.beamform({rf, depth, elements}, angle, {iq, depth, elements});
+
+			float maxError = 0.0f;
+			for (std::size_t line = 0; line < elements; ++line)
+			{
+				for (std::size_t i = 0; i < depth; ++i)
+				{
+					const auto [sum, quadrature] =
+					    referencePixel(sequence, rf, angle, line, i);
+					const float* pixel = iq.data() + 2 * (line * depth + i);
+					maxError = std::max({maxError, std::abs(pixel[0] - sum),
+					                     std::abs(pixel[1] - quadrature)});
+				}
+			}
+			// Only the order of the additions differs
+			check_lt(maxError, 1e-4f);
+		}
+	}
+}
+
+// --------------------------------------------------------------------
+
+TEST("beamforming rejects the frames of another sequence")
+{
+	const DelayAndSumBeamformer beamformer(compileSequence(parametersForTest()));
+	std::vector<float> shallow(64 * 32);
+	std::vector<float> rf(128 * 32);
+	std::vector<float> iq(2 * 128 * 32);
+
+	check_throws<std::invalid_argument>(
+	    [&] { beamformer.beamform({shallow, 64, 32}, 0, {iq, 128, 32}); });
+	check_throws<std::invalid_argument>(
+	    [&] { beamformer.beamform({rf, 128, 32}, 3, {iq, 128, 32}); });
+}
+
+// --------------------------------------------------------------------
+
+TEST("the processor beamforms the RF frames with the tables of the sequence")
+{
+	auto cache = std::make_shared<BeamformerCache>();
+	BeamformingProcessor processor(cache);
+
+	frame::AcquisitionFrame rf;
+	rf.sequence = 4;
+	rf.kind = frame::FrameKind::RawRf;
+	rf.geometry = {.depth_samples = 128, .lateral_samples = 0, .channels = 32};
+	rf.samples = std::make_shared<frame::SampleBuffer>(128 * 32, 0.5f);
+	check_throws<std::runtime_error>([&] { static_cast<void>(processor.process(rf)); });
+
+	processor.setSequence(parametersForTest());
+	const frame::AcquisitionFrame image = processor.process(rf);
+	check_eq(image.sequence, 4u);
+	check_eq(image.kind, frame::FrameKind::PlaneWaveIq);
+	check_eq(image.geometry, (frame::FrameGeometry{.depth_samples = 128,
+	                                               .lateral_samples = 32,
+	                                               .channels = 0}));
+	check_eq(image.samples->size(), image.geometry.sampleCount(image.kind));
+
+	// Shared by the processors of the same sequence, told apart from the others
+	check_eq(cache->get(parametersForTest()), cache->get(parametersForTest()));
+	acq_module::AcquisitionParameters other = parametersForTest();
+	other.angle_count = 5;
+	check_ne(cache->get(other), cache->get(parametersForTest()));
+	check_eq(cache->get(other)->angleCount(), 5u);
+
+	// The images are published as they are
+	const frame::AcquisitionFrame same = processor.process(image);
+	check_eq(same.samples, image.samples);
+}
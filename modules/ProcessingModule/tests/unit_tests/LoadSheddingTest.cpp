@@ -0,0 +1,172 @@
+#include <caf/test/test.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ProcessingModule/LoadShedding.hpp"
+
+using namespace processing;
+using namespace std::chrono_literals;
+
+namespace
+{
+LoadSheddingConfig configForTest()
+{
+	LoadSheddingConfig cfg;
+	cfg.enabled = true;
+	cfg.max_backlog = 8;
+	cfg.max_latency = 20ms;
+	cfg.recovery_samples = 3;
+	return cfg;
+}
+
+// IQ frame whose pixel (z, x) holds I = 100 * x + z and Q = -I
+frame::AcquisitionFrame iqFrame(uint32_t depth, uint32_t lateral)
+{
+	frame::AcquisitionFrame frame;
+	frame.sequence = 7;
+	frame.timestamp = 42;
+	frame.kind = frame::FrameKind::CompoundedIq;
+	frame.geometry = {.depth_samples = depth, .lateral_samples = lateral, .channels = 0};
+
+	auto samples = std::make_shared<frame::SampleBuffer>();
+	for (uint32_t x = 0; x < lateral; ++x)
+	{
+		for (uint32_t z = 0; z < depth; ++z)
+		{
+			const auto value = static_cast<float>(100 * x + z);
+			samples->push_back(value);
+			samples->push_back(-value);
+		}
+	}
+	frame.samples = std::move(samples);
+	return frame;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST("the policy steps down one level per sample while behind, down to its maximum")
+{
+	LoadSheddingPolicy policy(configForTest(), QualityLevel::ReducedResolution);
+	check_eq(policy.level(), QualityLevel::Full);
+
+	check_eq(policy.update(9, 0ms), QualityLevel::EssentialMaps);
+	check_eq(policy.update(0, 25ms), QualityLevel::ReducedResolution);
+	check_eq(policy.update(20, 50ms), QualityLevel::ReducedResolution);
+}
+
+// --------------------------------------------------------------------
+
+TEST("the policy steps back up after consecutive quiet samples only")
+{
+	LoadSheddingPolicy policy(configForTest(), QualityLevel::ReducedRate);
+	policy.update(9, 0ms);
+	policy.update(9, 0ms);
+	check_eq(policy.level(), QualityLevel::ReducedResolution);
+
+	// Below the thresholds but not quiet: the level holds
+	check_eq(policy.update(8, 15ms), QualityLevel::ReducedResolution);
+
+	check_eq(policy.update(2, 5ms), QualityLevel::ReducedResolution);
+	check_eq(policy.update(2, 5ms), QualityLevel::ReducedResolution);
+	// An intermediate sample restarts the count
+	check_eq(policy.update(5, 5ms), QualityLevel::ReducedResolution);
+	check_eq(policy.update(0, 1ms), QualityLevel::ReducedResolution);
+	check_eq(policy.update(0, 1ms), QualityLevel::ReducedResolution);
+	check_eq(policy.update(0, 1ms), QualityLevel::EssentialMaps);
+}
+
+// --------------------------------------------------------------------
+
+TEST("reduceResolution decimates an IQ frame in depth and laterally")
+{
+	const frame::AcquisitionFrame frame = iqFrame(5, 4);
+	const frame::AcquisitionFrame reduced = reduceResolution(frame, 2);
+
+	check_eq(reduced.sequence, 7u);
+	check_eq(reduced.timestamp, 42);
+	check_eq(reduced.geometry.depth_samples, 3u);
+	check_eq(reduced.geometry.lateral_samples, 2u);
+	require_eq(reduced.samples->size(), reduced.geometry.sampleCount(reduced.kind));
+
+	const std::vector<float> expected{0,   -0,   2,   -2,   4,   -4,
+	                                  200, -200, 202, -202, 204, -204};
+	check_eq(*reduced.samples, expected);
+
+	// The shared samples of the input are untouched
+	check_eq(frame.samples->size(), frame.geometry.sampleCount(frame.kind));
+}
+
+// --------------------------------------------------------------------
+
+TEST("reduceResolution keeps the channels of an RF frame")
+{
+	frame::AcquisitionFrame frame;
+	frame.kind = frame::FrameKind::RawRf;
+	frame.geometry = {.depth_samples = 4, .lateral_samples = 0, .channels = 2};
+	frame.samples = std::make_shared<frame::SampleBuffer>(
+	    frame::SampleBuffer{0, 1, 2, 3, 10, 11, 12, 13});
+
+	const frame::AcquisitionFrame reduced = reduceResolution(frame, 2);
+	check_eq(reduced.geometry.depth_samples, 2u);
+	check_eq(reduced.geometry.channels, 2u);
+	check_eq(*reduced.samples, (std::vector<float>{0, 2, 10, 12}));
+}
+
+// --------------------------------------------------------------------
+
+TEST("reduceResolution shares the samples at full resolution")
+{
+	const frame::AcquisitionFrame frame = iqFrame(4, 4);
+	check_eq(reduceResolution(frame, 1).samples, frame.samples);
+}
+
+// --------------------------------------------------------------------
+
+TEST("reduceResolution decimates a power Doppler image in depth and laterally")
+{
+	frame::AcquisitionFrame image;
+	image.kind = frame::FrameKind::PowerDoppler;
+	image.geometry = {.depth_samples = 3, .lateral_samples = 3, .channels = 0};
+	image.samples = std::make_shared<frame::SampleBuffer>(
+	    frame::SampleBuffer{0, 1, 2, 10, 11, 12, 20, 21, 22});
+
+	const frame::AcquisitionFrame reduced = reduceResolution(image, 2);
+	check_eq(reduced.geometry.depth_samples, 2u);
+	check_eq(reduced.geometry.lateral_samples, 2u);
+	check_eq(*reduced.samples, (std::vector<float>{0, 2, 20, 22}));
+}
+
+// --------------------------------------------------------------------
+
+TEST("the stages after the farm share their quality and report their backlog")
+{
+	setStageQuality({.level = QualityLevel::ReducedResolution, .resolution_step = 3});
+	check_eq(stageQuality().level, QualityLevel::ReducedResolution);
+	check_eq(stageQuality().resolution_step, 3u);
+	setStageQuality({});
+	check_eq(stageQuality().level, QualityLevel::Full);
+	check_eq(stageQuality().resolution_step, 1u);
+
+	static_cast<void>(takeStageBacklog());
+	recordStageBacklog(4);
+	recordStageBacklog(12);
+	recordStageBacklog(2);
+	check_eq(takeStageBacklog(), std::size_t{12});
+	check_eq(takeStageBacklog(), std::size_t{0});
+}
+
+// --------------------------------------------------------------------
+
+TEST("quality levels convert from and to their configuration strings")
+{
+	QualityLevel level{QualityLevel::Full};
+	check(from_string("reduced-resolution", level));
+	check_eq(level, QualityLevel::ReducedResolution);
+	check_eq(to_string(QualityLevel::EssentialMaps), "essential-maps");
+	check(!from_string("lowest", level));
+}
@@ -0,0 +1,200 @@
+#include <caf/test/test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "ProcessingModule/PixelStatistics.hpp"
+#include "Simd/Dispatch.hpp"
+
+using namespace processing;
+
+namespace
+{
+// More pixels than a tile, not a multiple of the chunks
+constexpr uint32_t depth_for_test = 67;
+constexpr uint32_t lateral_for_test = 71;
+constexpr std::size_t pixels_for_test = std::size_t{depth_for_test} * lateral_for_test;
+constexpr uint32_t window_for_test = 7;
+
+std::vector<std::vector<float>> randomImages(std::size_t count)
+{
+	std::mt19937 generator(5);
+	std::exponential_distribution<float> power;
+	std::vector<std::vector<float>> images(count, std::vector<float>(pixels_for_test));
+	for (std::vector<float>& image : images)
+	{
+		for (float& pixel : image)
+		{
+			pixel = 100.0f * power(generator);
+		}
+	}
+	return images;
+}
+
+frame::Frame<const float, frame::Interleaved<1>> imageOf(const std::vector<float>& pixels)
+{
+	return {pixels, depth_for_test, lateral_for_test};
+}
+
+frame::Frame<float, frame::Interleaved<4>> snapshotOf(std::vector<float>& samples)
+{
+	return {samples, depth_for_test, lateral_for_test};
+}
+
+// Mean, unbiased variance, min and max of a pixel over the images [first, last)
+std::vector<double> statisticsOf(const std::vector<std::vector<float>>& images,
+                                 std::size_t first,
+                                 std::size_t last,
+                                 std::size_t pixel)
+{
+	double mean = 0.0;
+	double low = images[first][pixel];
+	double high = low;
+	for (std::size_t k = first; k < last; ++k)
+	{
+		mean += images[k][pixel];
+		low = std::min<double>(low, images[k][pixel]);
+		high = std::max<double>(high, images[k][pixel]);
+	}
+	const auto count = static_cast<double>(last - first);
+	mean /= count;
+	double variance = 0.0;
+	for (std::size_t k = first; k < last; ++k)
+	{
+		variance += (images[k][pixel] - mean) * (images[k][pixel] - mean);
+	}
+	variance = last - first > 1 ? variance / (count - 1.0) : 0.0;
+	return {mean, variance, low, high};
+}
+
+// Whether a snapshot holds the statistics of the images [first, last)
+bool holdsStatistics(const std::vector<float>& snapshot,
+                     const std::vector<std::vector<float>>& images,
+                     std::size_t first,
+                     std::size_t last)
+{
+	for (std::size_t p = 0; p < pixels_for_test; ++p)
+	{
+		const std::vector<double> expected = statisticsOf(images, first, last, p);
+		for (std::size_t c = 0; c < 4; ++c)
+		{
+			if (std::abs(snapshot[4 * p + c] - expected[c]) > 1e-4 * (1.0 + expected[c]))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+}  // namespace
+
+TEST("the statistics are those of the series and of the last images")
+{
+	// The window is folded three times
+	const std::vector<std::vector<float>> images = randomImages(3 * window_for_test + 2);
+	PixelStatistics statistics(window_for_test, depth_for_test, lateral_for_test);
+	std::vector<float> snapshot(4 * pixels_for_test);
+	for (std::size_t k = 0; k < images.size(); ++k)
+	{
+		statistics.add(imageOf(images[k]));
+		const std::size_t first = k + 1 > window_for_test ? k + 1 - window_for_test : 0;
+		check_eq(statistics.sessionCount(), k + 1);
+		check_eq(statistics.windowCount(), k + 1 - first);
+
+		statistics.sessionSnapshot(snapshotOf(snapshot));
+		check(holdsStatistics(snapshot, images, 0, k + 1));
+		statistics.windowSnapshot(snapshotOf(snapshot));
+		check(holdsStatistics(snapshot, images, first, k + 1));
+	}
+}
+
+TEST("the sliding statistics do not drift over a long series")
+{
+	// Large level, small deviations: the worst case of the updates
+	constexpr std::size_t count = 20000;
+	std::mt19937 generator(7);
+	std::normal_distribution<float> noise(1000.0f, 0.5f);
+	std::vector<std::vector<float>> images;
+	PixelStatistics statistics(window_for_test, depth_for_test, 1);
+	std::vector<float> snapshot(4 * depth_for_test);
+	for (std::size_t k = 0; k < count; ++k)
+	{
+		std::vector<float>& image = images.emplace_back(depth_for_test);
+		for (float& pixel : image)
+		{
+			pixel = noise(generator);
+		}
+		statistics.add({image, depth_for_test, 1});
+	}
+
+	statistics.windowSnapshot({snapshot, depth_for_test, 1});
+	for (std::size_t p = 0; p < depth_for_test; ++p)
+	{
+		const std::vector<double> expected =
+		    statisticsOf(images, count - window_for_test, count, p);
+		check_lt(std::abs(snapshot[4 * p] - expected[0]), 1e-3);
+		check_lt(std::abs(snapshot[4 * p + 1] - expected[1]), 1e-3 * expected[1]);
+	}
+}
+
+TEST("the statistics restart empty")
+{
+	const std::vector<std::vector<float>> images = randomImages(2);
+	PixelStatistics statistics(window_for_test, depth_for_test, lateral_for_test);
+	std::vector<float> snapshot(4 * pixels_for_test, 1.0f);
+	statistics.sessionSnapshot(snapshotOf(snapshot));
+	check(std::ranges::all_of(snapshot, [](float sample) { return sample == 0.0f; }));
+
+	statistics.add(imageOf(images[0]));
+	statistics.reset();
+	check_eq(statistics.sessionCount(), uint64_t{0});
+	statistics.add(imageOf(images[1]));
+	statistics.windowSnapshot(snapshotOf(snapshot));
+	check(holdsStatistics(snapshot, images, 1, 2));
+}
+
+TEST("the variants of the instruction sets give the same statistics")
+{
+	const std::vector<std::vector<float>> images = randomImages(2 * window_for_test);
+	simd::limitLevel(simd::SimdLevel::Scalar);
+	PixelStatistics reference(window_for_test, depth_for_test, lateral_for_test);
+	simd::limitLevel(simd::SimdLevel::Avx512);
+	PixelStatistics statistics(window_for_test, depth_for_test, lateral_for_test);
+	check_eq(reference.simdLevel(), simd::SimdLevel::Scalar);
+
+	for (const std::vector<float>& image : images)
+	{
+		reference.add(imageOf(image));
+		statistics.add(imageOf(image));
+	}
+	std::vector<float> expected(4 * pixels_for_test);
+	std::vector<float> snapshot(4 * pixels_for_test);
+	reference.windowSnapshot(snapshotOf(expected));
+	statistics.windowSnapshot(snapshotOf(snapshot));
+	for (std::size_t s = 0; s < snapshot.size(); ++s)
+	{
+		check_lt(std::abs(snapshot[s] - expected[s]), 1e-5f * (1.0f + expected[s]));
+	}
+}
+
+TEST("the pixel statistics reject invalid parameters")
+{
+	check_throws<std::invalid_argument>(
+	    [] { PixelStatistics statistics(0, depth_for_test, lateral_for_test); });
+	check_throws<std::invalid_argument>(
+	    [] { PixelStatistics statistics(window_for_test, 0, lateral_for_test); });
+
+	PixelStatistics statistics(window_for_test, depth_for_test, lateral_for_test);
+	const std::vector<float> transposed(pixels_for_test);
+	check_throws<std::invalid_argument>(
+	    [&statistics, &transposed]
+	    { statistics.add({transposed, lateral_for_test, depth_for_test}); });
+	std::vector<float> snapshot(4 * pixels_for_test);
+	check_throws<std::invalid_argument>(
+	    [&statistics, &snapshot]
+	    { statistics.windowSnapshot({snapshot, lateral_for_test, depth_for_test}); });
+}
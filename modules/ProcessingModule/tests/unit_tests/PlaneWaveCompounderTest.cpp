@@ -0,0 +1,93 @@
+#include <caf/test/test.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "ProcessingModule/PlaneWaveCompounder.hpp"
+
+using namespace processing;
+
+namespace
+{
+constexpr frame::FrameGeometry geometry_for_test{
+    .depth_samples = 100, .lateral_samples = 50, .channels = 0};
+
+// Image of a plane wave whose samples all equal `value`
+frame::AcquisitionFrame planeWave(uint64_t sequence, float value)
+{
+	return frame::AcquisitionFrame{
+	    .sequence = sequence,
+	    .timestamp = static_cast<int64_t>(1000 * sequence),
+	    .stream = frame::FrameStream::Doppler,
+	    .kind = frame::FrameKind::PlaneWaveIq,
+	    .geometry = geometry_for_test,
+	    .samples = std::make_shared<frame::SampleBuffer>(
+	        geometry_for_test.sampleCount(frame::FrameKind::PlaneWaveIq), value)};
+}
+}  // namespace
+
+TEST("the compounding kernel sums the images")
+{
+	// Several tiles, the last one partial
+	const std::vector<float> a(10000, 1.0f);
+	std::vector<float> b(10000, 2.0f);
+	b[9999] = 5.0f;
+	const std::vector<ConstIqImage> images{{a, 100, 50}, {b, 100, 50}};
+	std::vector<float> out(10000);
+	compoundImages(images, 0.5f, {out, 100, 50});
+	check_eq(out[0], 1.5f);
+	check_eq(out[5000], 1.5f);
+	check_eq(out[9999], 3.0f);
+
+	check_throws<std::invalid_argument>(
+	    [&] { compoundImages(images, 1.0f, {out, 50, 100}); });
+}
+
+TEST("the plane waves of an ensemble are compounded into one frame")
+{
+	PlaneWaveCompounder compounder(3);
+	std::vector<frame::AcquisitionFrame> compounded;
+	for (uint64_t i = 3; i < 9; ++i)
+	{
+		compounder.add(planeWave(i, static_cast<float>(i)), compounded);
+	}
+
+	require_eq(compounded.size(), 2u);
+	check_eq(compounded[0].sequence, 1u);
+	check_eq(compounded[0].timestamp, 5000);
+	check_eq(compounded[0].kind, frame::FrameKind::CompoundedIq);
+	check_eq(compounded[0].geometry, geometry_for_test);
+	check_eq(compounded[0].samples->front(), 12.0f);
+	check_eq(compounded[1].sequence, 2u);
+	check_eq(compounded[1].samples->back(), 21.0f);
+	check_eq(compounder.incompleteCount(), 0u);
+}
+
+TEST("an ensemble missing plane waves is compounded at the level of a complete one")
+{
+	PlaneWaveCompounder compounder(4);
+	std::vector<frame::AcquisitionFrame> compounded;
+
+	// The last angle of the first ensemble is missing, the first of the second one
+	compounder.add(planeWave(0, 1.0f), compounded);
+	compounder.add(planeWave(1, 1.0f), compounded);
+	compounder.add(planeWave(2, 1.0f), compounded);
+	check(compounded.empty());
+	compounder.add(planeWave(5, 1.0f), compounded);
+	require_eq(compounded.size(), 1u);
+	check_eq(compounded[0].sequence, 0u);
+	check_eq(compounded[0].samples->front(), 4.0f);
+
+	compounder.add(planeWave(6, 1.0f), compounded);
+	compounder.add(planeWave(7, 1.0f), compounded);
+	require_eq(compounded.size(), 2u);
+	check_eq(compounded[1].sequence, 1u);
+	check_eq(compounded[1].samples->front(), 4.0f);
+	check_eq(compounder.incompleteCount(), 2u);
+
+	frame::AcquisitionFrame rf = planeWave(8, 1.0f);
+	rf.kind = frame::FrameKind::RawRf;
+	check_throws<std::invalid_argument>([&] { compounder.add(rf, compounded); });
+}
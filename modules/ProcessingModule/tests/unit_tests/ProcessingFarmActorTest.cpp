@@ -0,0 +1,143 @@
+#include <caf/actor_from_state.hpp>
+#include <caf/test/caf_test_main.hpp>
+#include <caf/test/fixture/deterministic.hpp>
+#include <caf/test/test.hpp>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "Frame/FrameTypeIds.hpp"
+#include "ProcessingModule/ProcessingFarmActor.hpp"
+
+using namespace processing;
+
+namespace
+{
+// Marks the frames it processed, and fails on the frames numbered 3
+class MarkingProcessor : public FrameProcessor
+{
+public:
+	[[nodiscard]] frame::AcquisitionFrame process(
+	    const frame::AcquisitionFrame& frame) override
+	{
+		if (frame.sequence == 3)
+		{
+			throw std::runtime_error("unprocessable frame");
+		}
+		frame::AcquisitionFrame processed = frame;
+		processed.samples = std::make_shared<const frame::SampleBuffer>(1, 1.0f);
+		return processed;
+	}
+};
+
+// Counts the sequences it receives
+class SequenceCountingProcessor : public PassThroughProcessor
+{
+public:
+	explicit SequenceCountingProcessor(std::shared_ptr<int> count)
+	    : _count(std::move(count))
+	{
+	}
+
+	void setSequence(const acq_module::AcquisitionParameters& /*parameters*/) override
+	{
+		++*_count;
+	}
+
+private:
+	std::shared_ptr<int> _count;
+};
+
+frame::AcquisitionFrame frameOf(uint64_t sequence)
+{
+	frame::AcquisitionFrame frame;
+	frame.sequence = sequence;
+	return frame;
+}
+
+// Records the sequences of the frames it receives
+caf::behavior consumerImpl(std::shared_ptr<std::vector<uint64_t>> sequences)
+{
+	return {[sequences](caf::publish_atom, const frame::AcquisitionFrame& x)
+	        {
+		        if (x.samples && x.samples->size() == 1)
+		        {
+			        sequences->push_back(x.sequence);
+		        }
+	        },
+	        [](caf::publish_atom, const frame::StimulusEvent&) {},
+	        [](acq_module::AcquisitionState) {}};
+}
+}  // namespace
+
+WITH_FIXTURE(caf::test::fixture::deterministic)
+{
+
+TEST("the farm publishes the processed frames in order")
+{
+	auto session = sys.spawn(caf::actor_from_state<acq_module::acquisition_session_state>,
+	                         acq_module::SimulatorConfig{},
+	                         acq_module::AcquisitionConfig{});
+	const ProcessingConfig cfg{.workers = 3, .max_in_flight = 2, .ordering = "strict"};
+	const ProcessorFactory factory = [] { return std::make_unique<MarkingProcessor>(); };
+	auto farm =
+	    sys.spawn(caf::actor_from_state<processing_farm_state>, session, cfg, factory);
+	auto sequences = std::make_shared<std::vector<uint64_t>>();
+	auto consumer = sys.spawn(consumerImpl, sequences);
+
+	// The farm subscribes to the session on behalf of its first consumer
+	inject()
+	    .with(acq_subscribe_v, frame::FrameStream::Doppler, consumer)
+	    .from(consumer)
+	    .to(farm);
+	expect<acq_subscribe, frame::FrameStream, caf::actor>().from(farm).to(session);
+
+	for (uint64_t i = 0; i < 6; ++i)
+	{
+		inject().with(caf::publish_atom_v, frameOf(i)).from(session).to(farm);
+	}
+	dispatch_messages();
+
+	// Frame 3 failed in its worker, the others are published in order
+	check_eq(*sequences, (std::vector<uint64_t>{0, 1, 2, 4, 5}));
+}
+
+// --------------------------------------------------------------------
+
+TEST("the farm passes the sequence to its workers before starting the session")
+{
+	acq_module::SimulatorConfig simulator;
+	simulator.depth_samples = 16;
+	simulator.lateral_samples = 4;
+	simulator.frame_count = 1;
+	auto session = sys.spawn(caf::actor_from_state<acq_module::acquisition_session_state>,
+	                         simulator, acq_module::AcquisitionConfig{});
+	const ProcessingConfig cfg{.workers = 2, .max_in_flight = 2, .ordering = "strict"};
+	auto count = std::make_shared<int>(0);
+	const ProcessorFactory factory = [count]
+	{ return std::make_unique<SequenceCountingProcessor>(count); };
+	auto farm =
+	    sys.spawn(caf::actor_from_state<processing_farm_state>, session, cfg, factory);
+	auto sequences = std::make_shared<std::vector<uint64_t>>();
+	auto consumer = sys.spawn(consumerImpl, sequences);
+
+	inject()
+	    .with(acq_start_v, acq_module::AcquisitionParameters{})
+	    .from(consumer)
+	    .to(farm);
+	dispatch_messages();
+	check_eq(*count, 2);
+
+	inject().with(caf::get_atom_v).from(consumer).to(session);
+	expect<acq_module::AcquisitionState>()
+	    .with(acq_module::AcquisitionState::Running)
+	    .from(session)
+	    .to(consumer);
+}
+
+}  // WITH_FIXTURE(caf::test::fixture::deterministic)
+
+CAF_TEST_MAIN(caf::id_block::custom_types_general, caf::id_block::custom_types_acq_module)
@@ -0,0 +1,96 @@
+#include <caf/test/test.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "ProcessingModule/ReorderBuffer.hpp"
+
+using namespace processing;
+
+namespace
+{
+frame::AcquisitionFrame frameOf(uint64_t sequence,
+                                frame::FrameStream stream = frame::FrameStream::Doppler)
+{
+	frame::AcquisitionFrame frame;
+	frame.sequence = sequence;
+	frame.stream = stream;
+	return frame;
+}
+
+std::vector<uint64_t> sequencesOf(const std::vector<frame::AcquisitionFrame>& frames)
+{
+	std::vector<uint64_t> sequences;
+	for (const frame::AcquisitionFrame& frame : frames)
+	{
+		sequences.push_back(frame.sequence);
+	}
+	return sequences;
+}
+}  // namespace
+
+// --------------------------------------------------------------------
+// START TESTS
+// --------------------------------------------------------------------
+
+TEST("strict ordering releases the frames in the order of their tickets")
+{
+	ReorderBuffer buffer(OrderingPolicy::Strict);
+	std::vector<frame::AcquisitionFrame> released;
+
+	buffer.complete(2, frameOf(12), released);
+	buffer.complete(1, frameOf(11), released);
+	check(released.empty());
+	check_eq(buffer.heldCount(), 2u);
+
+	buffer.complete(0, frameOf(10), released);
+	check_eq(sequencesOf(released), (std::vector<uint64_t>{10, 11, 12}));
+	check_eq(buffer.heldCount(), 0u);
+}
+
+// --------------------------------------------------------------------
+
+TEST("a skipped ticket releases the frames held behind it")
+{
+	ReorderBuffer buffer(OrderingPolicy::Strict);
+	std::vector<frame::AcquisitionFrame> released;
+
+	buffer.complete(1, frameOf(11), released);
+	buffer.complete(3, frameOf(13), released);
+	buffer.skip(0, released);
+	check_eq(sequencesOf(released), (std::vector<uint64_t>{11}));
+
+	buffer.skip(2, released);
+	check_eq(sequencesOf(released), (std::vector<uint64_t>{11, 13}));
+	check_eq(buffer.droppedCount(), 0u);
+}
+
+// --------------------------------------------------------------------
+
+TEST("latest-wins drops the frames overtaken in their stream")
+{
+	ReorderBuffer buffer(OrderingPolicy::LatestWins);
+	std::vector<frame::AcquisitionFrame> released;
+
+	buffer.complete(1, frameOf(11), released);
+	// Overtaken by ticket 1
+	buffer.complete(0, frameOf(10), released);
+	// Other stream: not overtaken
+	buffer.complete(2, frameOf(0, frame::FrameStream::BMode), released);
+	buffer.complete(3, frameOf(12), released);
+
+	check_eq(sequencesOf(released), (std::vector<uint64_t>{11, 0, 12}));
+	check_eq(buffer.droppedCount(), 1u);
+	check_eq(buffer.heldCount(), 0u);
+}
+
+// --------------------------------------------------------------------
+
+TEST("ordering policy parsing")
+{
+	OrderingPolicy policy{OrderingPolicy::Strict};
+	check(from_string("latest-wins", policy));
+	check_eq(policy, OrderingPolicy::LatestWins);
+	check(!from_string("fifo", policy));
+	check_eq(to_string(OrderingPolicy::Strict), "strict");
+}
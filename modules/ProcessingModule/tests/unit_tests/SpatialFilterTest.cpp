@@ -0,0 +1,203 @@
+#include <caf/test/test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "ProcessingModule/SpatialFilter.hpp"
+#include "Simd/Dispatch.hpp"
+
+using namespace processing;
+
+namespace
+{
+// Not multiples of the chunks nor of the tiles of the filter
+constexpr uint32_t depth_for_test = 101;
+constexpr uint32_t lateral_for_test = 37;
+
+SpatialFilterConfig configForTest(std::string kind, uint32_t radius = 2)
+{
+	SpatialFilterConfig cfg;
+	cfg.kind = std::move(kind);
+	cfg.radius = radius;
+	cfg.sigma = 1.5f;
+	return cfg;
+}
+
+std::vector<float> randomImage()
+{
+	std::mt19937 generator(3);
+	std::uniform_real_distribution<float> uniform(0.0f, 10.0f);
+	std::vector<float> image(std::size_t{depth_for_test} * lateral_for_test);
+	for (float& pixel : image)
+	{
+		pixel = uniform(generator);
+	}
+	return image;
+}
+
+// Image of the dimensions for test
+frame::Frame<float, frame::Interleaved<1>> imageOf(std::vector<float>& pixels)
+{
+	return {pixels, depth_for_test, lateral_for_test};
+}
+
+// Pixel (z, x) of an image, the borders replicated
+float pixelOf(const std::vector<float>& image, int z, int x)
+{
+	z = std::clamp(z, 0, static_cast<int>(depth_for_test) - 1);
+	x = std::clamp(x, 0, static_cast<int>(lateral_for_test) - 1);
+	return image[static_cast<std::size_t>(x) * depth_for_test +
+	             static_cast<std::size_t>(z)];
+}
+}  // namespace
+
+TEST("the Gaussian filter is the 2D convolution with the Gaussian kernel")
+{
+	const std::vector<float> image = randomImage();
+	std::vector<float> filtered = image;
+	SpatialFilter filter(configForTest("gaussian"), depth_for_test, lateral_for_test);
+	filter.apply(imageOf(filtered));
+
+	std::vector<double> weights;
+	double total = 0.0;
+	for (int k = -2; k <= 2; ++k)
+	{
+		weights.push_back(std::exp(-0.5 * k * k / (1.5 * 1.5)));
+		total += weights.back();
+	}
+	for (int x = 0; x < static_cast<int>(lateral_for_test); ++x)
+	{
+		for (int z = 0; z < static_cast<int>(depth_for_test); ++z)
+		{
+			double expected = 0.0;
+			for (int dx = -2; dx <= 2; ++dx)
+			{
+				for (int dz = -2; dz <= 2; ++dz)
+				{
+					expected += weights[dx + 2] * weights[dz + 2] *
+					            pixelOf(image, z + dz, x + dx) / (total * total);
+				}
+			}
+			check_lt(std::abs(pixelOf(filtered, z, x) - expected), 1e-4);
+		}
+	}
+}
+
+TEST("the median filter gives the median of each window")
+{
+	const std::vector<float> image = randomImage();
+	for (uint32_t radius = 1; radius <= SpatialFilter::max_median_radius; ++radius)
+	{
+		std::vector<float> filtered = image;
+		SpatialFilter filter(configForTest("median", radius), depth_for_test,
+		                     lateral_for_test);
+		filter.apply(imageOf(filtered));
+
+		const int r = static_cast<int>(radius);
+		std::vector<float> window;
+		for (int x = 0; x < static_cast<int>(lateral_for_test); ++x)
+		{
+			for (int z = 0; z < static_cast<int>(depth_for_test); ++z)
+			{
+				window.clear();
+				for (int dx = -r; dx <= r; ++dx)
+				{
+					for (int dz = -r; dz <= r; ++dz)
+					{
+						window.push_back(pixelOf(image, z + dz, x + dx));
+					}
+				}
+				const auto median = window.begin() + window.size() / 2;
+				std::ranges::nth_element(window, median);
+				check_eq(pixelOf(filtered, z, x), *median);
+			}
+		}
+	}
+}
+
+TEST("the bilateral filter smooths the noise and keeps the edges")
+{
+	// A vessel 50 times brighter than the tissue around it, both noisy
+	std::mt19937 generator(5);
+	std::normal_distribution<float> noise(1.0f, 0.05f);
+	std::vector<float> image(std::size_t{depth_for_test} * lateral_for_test);
+	for (std::size_t x = 0; x < lateral_for_test; ++x)
+	{
+		for (std::size_t z = 0; z < depth_for_test; ++z)
+		{
+			const float level = x < lateral_for_test / 2 ? 1.0f : 50.0f;
+			image[x * depth_for_test + z] = level * noise(generator);
+		}
+	}
+
+	std::vector<float> bilateral = image;
+	SpatialFilter(configForTest("bilateral"), depth_for_test, lateral_for_test)
+	    .apply(imageOf(bilateral));
+	std::vector<float> gaussian = image;
+	SpatialFilter(configForTest("gaussian"), depth_for_test, lateral_for_test)
+	    .apply(imageOf(gaussian));
+
+	// Next to the edge the Gaussian blurs the vessel into the tissue, not the bilateral
+	const int edge = static_cast<int>(lateral_for_test / 2);
+	double tissueError = 0.0;
+	double tissueNoise = 0.0;
+	for (int z = 0; z < static_cast<int>(depth_for_test); ++z)
+	{
+		check_lt(10.0f, pixelOf(gaussian, z, edge - 1));
+		check_lt(std::abs(pixelOf(bilateral, z, edge - 1) - 1.0f), 0.1f);
+		tissueError += std::abs(pixelOf(bilateral, z, 5) - 1.0f);
+		tissueNoise += std::abs(pixelOf(image, z, 5) - 1.0f);
+	}
+	check_lt(tissueError, 0.5 * tissueNoise);
+}
+
+TEST("the variants of the instruction sets give the same images")
+{
+	for (const char* kind : {"gaussian", "median", "bilateral"})
+	{
+		simd::limitLevel(simd::SimdLevel::Scalar);
+		SpatialFilter reference(configForTest(kind), depth_for_test, lateral_for_test);
+		simd::limitLevel(simd::SimdLevel::Avx512);
+		SpatialFilter filter(configForTest(kind), depth_for_test, lateral_for_test);
+		check_eq(reference.simdLevel(), simd::SimdLevel::Scalar);
+
+		std::vector<float> expected = randomImage();
+		std::vector<float> image = expected;
+		reference.apply(imageOf(expected));
+		filter.apply(imageOf(image));
+		for (std::size_t p = 0; p < image.size(); ++p)
+		{
+			check_lt(std::abs(image[p] - expected[p]), 1e-5f * (1.0f + expected[p]));
+		}
+	}
+}
+
+TEST("the spatial filter rejects invalid parameters")
+{
+	std::vector<float> image = randomImage();
+	const std::vector<float> original = image;
+	SpatialFilter none(configForTest("none", 0), depth_for_test, lateral_for_test);
+	none.apply(imageOf(image));
+	check(image == original);
+
+	check_throws<std::invalid_argument>(
+	    [] { SpatialFilter filter(configForTest("box"), depth_for_test, 1); });
+	check_throws<std::invalid_argument>(
+	    []
+	    {
+		    const uint32_t radius = SpatialFilter::max_median_radius + 1;
+		    SpatialFilter filter(configForTest("median", radius), depth_for_test, 1);
+	    });
+	check_throws<std::invalid_argument>(
+	    [] { SpatialFilter filter(configForTest("gaussian", 0), depth_for_test, 1); });
+
+	SpatialFilter filter(configForTest("gaussian"), depth_for_test, lateral_for_test);
+	std::vector<float> transposed = randomImage();
+	check_throws<std::invalid_argument>(
+	    [&filter, &transposed]
+	    { filter.apply({transposed, lateral_for_test, depth_for_test}); });
+}
@@ -0,0 +1,296 @@
+#include <caf/test/test.hpp>
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "ProcessingModule/SvdClutterFilter.hpp"
+#include "Simd/Dispatch.hpp"
+
+using namespace processing;
+
+namespace
+{
+constexpr std::size_t pixels_for_test = 300;
+constexpr float blood_level = 1.0f;
+
+PowerDopplerConfig configForTest(uint32_t tissueComponents = 2, uint32_t step = 10)
+{
+	PowerDopplerConfig cfg;
+	cfg.ensemble = 40;
+	cfg.step = step;
+	cfg.tissue_components = tissueComponents;
+	return cfg;
+}
+
+/**
+ * \class EnsembleForTest
+ *
+ * @brief Frames of two tissue components, coherent over the pixels and 40 dB above the
+ * blood, and of a blood signal of independent samples.
+ */
+class EnsembleForTest
+{
+public:
+	EnsembleForTest() : _generator(42)
+	{
+		std::normal_distribution<float> normal;
+		for (std::size_t p = 0; p < pixels_for_test; ++p)
+		{
+			_slow.emplace_back(normal(_generator), normal(_generator));
+			_fast.emplace_back(normal(_generator), normal(_generator));
+		}
+	}
+
+	std::vector<float> next()
+	{
+		std::normal_distribution<float> blood(0.0f, blood_level);
+		const auto t = static_cast<float>(_frame++);
+		const std::complex<float> slow = 100.0f * std::polar(1.0f, 0.01f * t);
+		const std::complex<float> fast = 50.0f * std::polar(1.0f, 0.05f * t);
+
+		std::vector<float> iq;
+		for (std::size_t p = 0; p < pixels_for_test; ++p)
+		{
+			const std::complex<float> x = _slow[p] * slow + _fast[p] * fast;
+			iq.push_back(x.real() + blood(_generator));
+			iq.push_back(x.imag() + blood(_generator));
+		}
+		return iq;
+	}
+
+private:
+	std::mt19937 _generator;
+	std::vector<std::complex<float>> _slow;
+	std::vector<std::complex<float>> _fast;
+	std::size_t _frame{0};
+};
+
+// Frames of the pixels for test, in one column
+frame::Frame<const float, frame::Interleaved<2>> iqOf(const std::vector<float>& iq)
+{
+	return {iq, pixels_for_test, 1};
+}
+
+frame::Frame<float, frame::Interleaved<1>> powerOf(std::vector<float>& power)
+{
+	return {power, pixels_for_test, 1};
+}
+
+frame::Frame<float, frame::Interleaved<2>> colorOf(std::vector<float>& color)
+{
+	return {color, pixels_for_test, 1};
+}
+
+double mean(const std::vector<float>& values)
+{
+	double sum = 0.0;
+	for (const float value : values)
+	{
+		sum += value;
+	}
+	return sum / static_cast<double>(values.size());
+}
+}  // namespace
+
+TEST("the clutter filter removes the tissue and keeps the blood")
+{
+	SvdClutterFilter filter(configForTest(), pixels_for_test);
+	EnsembleForTest ensemble;
+	bool due = false;
+	for (int i = 0; i < 40; ++i)
+	{
+		check(!due);
+		due = filter.add(iqOf(ensemble.next()));
+	}
+	require(due);
+
+	std::vector<float> power(pixels_for_test);
+	filter.powerDoppler(powerOf(power));
+
+	// Two of the 40 dimensions of the blood are removed with the tissue
+	const double blood = 2.0 * blood_level * blood_level * 38.0 / 40.0;
+	check_lt(std::abs(mean(power) - blood), 0.1 * blood);
+	require_eq(filter.tissueSingularValues().size(), 2u);
+	check_lt(filter.tissueSingularValues()[1], filter.tissueSingularValues()[0]);
+}
+
+TEST("the sliding window gives the image of its last frames")
+{
+	// The window of the first filter slides three times
+	SvdClutterFilter sliding(configForTest(), pixels_for_test);
+	SvdClutterFilter fresh(configForTest(), pixels_for_test);
+	EnsembleForTest ensemble;
+	std::vector<float> power(pixels_for_test);
+	int images = 0;
+	for (int i = 0; i < 70; ++i)
+	{
+		const std::vector<float> iq = ensemble.next();
+		if (sliding.add(iqOf(iq)))
+		{
+			sliding.powerDoppler(powerOf(power));
+			++images;
+		}
+		if (i >= 30)
+		{
+			static_cast<void>(fresh.add(iqOf(iq)));
+		}
+	}
+	check_eq(images, 4);
+
+	std::vector<float> expected(pixels_for_test);
+	fresh.powerDoppler(powerOf(expected));
+	for (std::size_t p = 0; p < pixels_for_test; ++p)
+	{
+		check_lt(std::abs(power[p] - expected[p]), 1e-3f * expected[p] + 1e-4f);
+	}
+}
+
+TEST("without tissue components the power is the energy of the pixels")
+{
+	SvdClutterFilter filter(configForTest(0), pixels_for_test);
+	EnsembleForTest ensemble;
+	std::vector<double> energy(pixels_for_test);
+	for (int i = 0; i < 40; ++i)
+	{
+		const std::vector<float> iq = ensemble.next();
+		for (std::size_t p = 0; p < pixels_for_test; ++p)
+		{
+			energy[p] += (iq[2 * p] * iq[2 * p] + iq[2 * p + 1] * iq[2 * p + 1]) / 40.0;
+		}
+		static_cast<void>(filter.add(iqOf(iq)));
+	}
+
+	std::vector<float> power(pixels_for_test);
+	filter.powerDoppler(powerOf(power));
+	for (std::size_t p = 0; p < pixels_for_test; ++p)
+	{
+		check_lt(std::abs(power[p] - energy[p]), 1e-4 * energy[p]);
+	}
+}
+
+TEST("the variants of the instruction sets give the same image")
+{
+	std::vector<std::vector<float>> powers;
+	for (const simd::SimdLevel level :
+	     {simd::SimdLevel::Scalar, simd::SimdLevel::Avx2, simd::SimdLevel::Avx512})
+	{
+		simd::limitLevel(level);
+		SvdClutterFilter filter(configForTest(), pixels_for_test);
+		simd::limitLevel(simd::SimdLevel::Avx512);
+		EnsembleForTest ensemble;
+		for (int i = 0; i < 40; ++i)
+		{
+			static_cast<void>(filter.add(iqOf(ensemble.next())));
+		}
+		filter.powerDoppler(powerOf(powers.emplace_back(pixels_for_test)));
+	}
+
+	// The scalar products accumulate in double precision, the vector lanes in single
+	// precision before the blood is separated from the tissue 40 dB above it
+	for (std::size_t p = 0; p < pixels_for_test; ++p)
+	{
+		check_lt(std::abs(powers[1][p] - powers[0][p]), 0.01f * powers[0][p]);
+		check_lt(std::abs(powers[2][p] - powers[0][p]), 0.01f * powers[0][p]);
+	}
+}
+
+TEST("the clutter filter rejects the frames of another size")
+{
+	check_throws<std::invalid_argument>(
+	    [] { SvdClutterFilter filter(configForTest(40), pixels_for_test); });
+
+	SvdClutterFilter filter(configForTest(), pixels_for_test);
+	const std::vector<float> iq(10);
+	check_throws<std::invalid_argument>(
+	    [&filter, &iq] { static_cast<void>(filter.add({iq, 5, 1})); });
+	std::vector<float> power(10);
+	check_throws<std::invalid_argument>([&filter, &power]
+	                                    { filter.powerDoppler({power, 10, 1}); });
+}
+
+TEST("the color Doppler gives the axial velocity of the blood")
+{
+	// A flow of 0.8 rad per frame, 10 dB above the noise of the blood. The window slides
+	// so that its oldest frame is not in the first slot.
+	constexpr float phase_step = 0.8f;
+	constexpr float velocity_scale = kasaiVelocityScale(1540.0f, 15.625e6f, 1000.0);
+	SvdClutterFilter filter(configForTest(), pixels_for_test);
+	EnsembleForTest ensemble;
+	std::mt19937 generator(7);
+	std::uniform_real_distribution<float> phase(0.0f, 6.28f);
+	std::vector<float> offsets(pixels_for_test);
+	for (float& offset : offsets)
+	{
+		offset = phase(generator);
+	}
+
+	std::vector<float> power(pixels_for_test);
+	std::vector<float> color(2 * pixels_for_test);
+	int images = 0;
+	for (int i = 0; i < 75; ++i)
+	{
+		std::vector<float> iq = ensemble.next();
+		for (std::size_t p = 0; p < pixels_for_test; ++p)
+		{
+			const std::complex<float> flow =
+			    std::polar(3.0f, offsets[p] + phase_step * static_cast<float>(i));
+			iq[2 * p] += flow.real();
+			iq[2 * p + 1] += flow.imag();
+		}
+		if (filter.add(iqOf(iq)))
+		{
+			filter.dopplerMaps(powerOf(power), colorOf(color), velocity_scale);
+			++images;
+		}
+	}
+	require_eq(images, 4);
+
+	check_lt(std::abs(velocity_scale - 7.843e-3f), 1e-5f);
+
+	// Each pixel estimates the velocity from its own 40 noisy samples
+	const float velocity = velocity_scale * phase_step;
+	double meanVelocity = 0.0;
+	double meanVariance = 0.0;
+	for (std::size_t p = 0; p < pixels_for_test; ++p)
+	{
+		check_lt(std::abs(color[2 * p] - velocity), 0.2f * velocity);
+		check_lt(color[2 * p + 1], 0.5f);
+		meanVelocity += color[2 * p] / static_cast<double>(pixels_for_test);
+		meanVariance += color[2 * p + 1] / static_cast<double>(pixels_for_test);
+	}
+	check_lt(std::abs(meanVelocity - velocity), 0.02 * velocity);
+	check_lt(meanVariance, 0.25);
+}
+
+TEST("the color Doppler of noise has a high variance")
+{
+	SvdClutterFilter filter(configForTest(), pixels_for_test);
+	EnsembleForTest ensemble;
+	for (int i = 0; i < 40; ++i)
+	{
+		static_cast<void>(filter.add(iqOf(ensemble.next())));
+	}
+
+	std::vector<float> power(pixels_for_test);
+	std::vector<float> color(2 * pixels_for_test);
+	filter.dopplerMaps(powerOf(power), colorOf(color), 1.0f);
+	double variance = 0.0;
+	for (std::size_t p = 0; p < pixels_for_test; ++p)
+	{
+		check(std::abs(color[2 * p]) <= 3.1416f);
+		variance += color[2 * p + 1] / static_cast<double>(pixels_for_test);
+	}
+	check_lt(0.7, variance);
+
+	std::vector<float> wrongColor(pixels_for_test);
+	check_throws<std::invalid_argument>(
+	    [&filter, &power, &wrongColor]
+	    {
+		    filter.dopplerMaps(powerOf(power), {wrongColor, pixels_for_test / 2, 1},
+		                       1.0f);
+	    });
+}
@@ -0,0 +1,29 @@
+target("processing_module")
+    set_kind("shared")
+    add_files("src/*.cpp")
+    add_includedirs("include", {public = true})
+    -- Compiled for the baseline of x86-64: the scalar variants of the kernels run on any
+    -- machine, the AVX2 and AVX-512 variants are compiled with their target attributes
+    -- and selected at run time (common_simd).
+    add_deps("acquisition_module")
+    add_deps("common_caf")
+    add_deps("common_frame")
+    add_deps("common_logger")
+    add_deps("common_scheduler")
+    add_deps("common_simd")
+    add_rpathdirs("$ORIGIN") 
+
+    -- Unit test target
+target("processing_module_tests")
+    set_kind("binary")  
+    add_files("tests/unit_tests/*.cpp")
+    add_deps("processing_module")
+    add_packages("actor-framework", {components = {"caf_test"}})
+    add_links("caf_test")
+    add_tests("default")
+
+    -- Benchmark target, not run with the tests
+target("processing_module_benchmarks")
+    set_kind("binary")
+    add_files("tests/benchmarks/*.cpp")
+    add_deps("processing_module")
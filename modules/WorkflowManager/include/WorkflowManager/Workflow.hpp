@@ -11,8 +11,13 @@
 #ifndef WORKFLOWMANAGER_WORKFLOW_HPP
 #define WORKFLOWMANAGER_WORKFLOW_HPP
 
+#include <vector>
+
 #include "WorkflowType.hpp"
 
+#include "AcquisitionModule/AcquisitionParameters.hpp"
+#include "Frame/FrameStream.hpp"
+
 namespace workflow
 {
 
@@ -62,6 +67,24 @@ public:
 
 	// Get the type of the workflow
 	virtual WorkflowType getType() const = 0;
+
+	// Get the sequence of the acquisitions of the workflow
+	virtual acq_module::AcquisitionParameters acquisitionParameters() const
+	{
+		return acq_module::AcquisitionParameters{};
+	}
+
+	// Get the streams of the acquisition displayed by the echo viewer
+	virtual std::vector<frame::FrameStream> displayedStreams() const
+	{
+		return {frame::FrameStream::Doppler, frame::FrameStream::PowerDoppler};
+	}
+
+	// Get the streams of the acquisition stored by the domain model
+	virtual std::vector<frame::FrameStream> storedStreams() const
+	{
+		return {frame::FrameStream::Doppler, frame::FrameStream::PowerDoppler};
+	}
 };
 
 }  // namespace workflow
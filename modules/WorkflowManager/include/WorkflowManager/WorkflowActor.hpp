@@ -11,6 +11,11 @@
 #ifndef WORKFLOWMANAGER_WORKFLOWACTOR_HPP
 #define WORKFLOWMANAGER_WORKFLOWACTOR_HPP
 
+#include <string>
+#include <vector>
+
+#include <caf/actor.hpp>
+
 #include <caf/result.hpp>
 #include <caf/type_list.hpp>
 #include <caf/typed_actor.hpp>
@@ -20,7 +25,9 @@
 #include "WorkflowType.hpp"
 #include "WorkflowTypeIds.hpp"
 
+#include "AcquisitionModule/AcquisitionConfig.hpp"
 #include "AcquisitionModule/AcquisitionModuleActor.hpp"
+#include "ProcessingModule/ProcessingConfig.hpp"
 
 namespace workflow
 {
@@ -49,8 +56,17 @@ public:
 	/**
 	 * @brief: Ctor
 	 * @param: pointer to current actor
+	 * @param: initial type of workflow
+	 * @param: configuration of the simulated acquisition hardware
+	 * @param: configuration of the acquisition session (sequence cache, replay)
+	 * @param: configuration of the processing farm between the acquisition and the
+	 * consumers
 	 */
-	workflow_actor_state(workflow_actor::pointer_view self, WorkflowType initialType);
+	workflow_actor_state(workflow_actor::pointer_view self,
+	                     WorkflowType initialType,
+	                     acq_module::SimulatorConfig simulatorConfig,
+	                     acq_module::AcquisitionConfig acquisitionConfig,
+	                     processing::ProcessingConfig processingConfig);
 
 	/**
 	 * @brief: Defines the callbacks upon message reception
@@ -58,11 +74,45 @@ public:
 	workflow_actor::behavior_type make_behavior();
 
 private:
+	// Subscribes a consumer to the given streams of a source (the acquisition session
+	// or the processing farm), and unsubscribes it from the others. The power Doppler
+	// images come from the power Doppler stage, if any, through the spatial filter when
+	// they are denoised; the activation maps from the activation map stage, if any.
+	void subscribe(const caf::actor& source,
+	               const caf::actor& consumer,
+	               const std::vector<frame::FrameStream>& streams,
+	               bool denoised);
+
 	// Ptr to current actor
 	workflow_actor::pointer_view _self;
 
 	// Ptr to workflow implementation
 	std::unique_ptr<Workflow> _currentWorkflow;
+
+	// Passed to the acquisition session
+	acq_module::SimulatorConfig _simulatorConfig;
+	acq_module::AcquisitionConfig _acquisitionConfig;
+	processing::ProcessingConfig _processingConfig;
+
+	// Acquisition session, spawned by the first workflow
+	acq_module::acq_module_actor _acquisition;
+
+	// Actor the display subscribes to and the acquisition is started through: the
+	// compounding stage after the processing farm if any, else the acquisition session
+	caf::actor _frameSource;
+
+	// Power and color Doppler stage on the frames of the frame source, if enabled
+	caf::actor _powerDoppler;
+
+	// Denoising of the power Doppler images for the display, with the filter of the
+	// current workflow
+	caf::actor _spatialFilter;
+
+	// Statistics of the pixels of the power Doppler images, if enabled
+	caf::actor _pixelStatistics;
+
+	// Activation maps of the power Doppler images against the paradigm, if enabled
+	caf::actor _activationMap;
 };
 
 }  // namespace workflow
@@ -56,6 +56,12 @@ public:
 
 	// Get the type of the workflow
 	WorkflowType getType() const override;
+
+	// Get the sequence of the acquisitions of the workflow
+	acq_module::AcquisitionParameters acquisitionParameters() const override;
+
+	// Get the streams of the acquisition displayed by the echo viewer
+	std::vector<frame::FrameStream> displayedStreams() const override;
 };
 
 }  // namespace workflow
@@ -56,6 +56,12 @@ public:
 
 	// Get the type of the workflow
 	WorkflowType getType() const override;
+
+	// Get the streams of the acquisition displayed by the echo viewer
+	std::vector<frame::FrameStream> displayedStreams() const override;
+
+	// Get the streams of the acquisition stored by the domain model
+	std::vector<frame::FrameStream> storedStreams() const override;
 };
 
 }  // namespace workflow
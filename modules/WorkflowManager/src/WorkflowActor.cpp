@@ -8,7 +8,13 @@
  * Author: Alyson Roger <alyson.roger@iconeus.com>
  */
 
+#include <algorithm>
+#include <utility>
+
+#include <caf/actor_cast.hpp>
+#include <caf/actor_from_state.hpp>
 #include <caf/actor_registry.hpp>
+#include <caf/spawn_options.hpp>
 
 #include "WorkflowManager/Workflow.hpp"
 #include "WorkflowManager/WorkflowActor.hpp"
@@ -18,15 +24,34 @@
 
 #include "AcquisitionModule/AcquisitionModuleActor.hpp"
 #include "AcquisitionModule/AcquisitionModuleTypeIds.hpp"
+#include "ProcessingModule/ActivationMapActor.hpp"
+#include "ProcessingModule/BeamformingProcessor.hpp"
+#include "ProcessingModule/CompoundingActor.hpp"
+#include "ProcessingModule/PixelStatisticsActor.hpp"
+#include "ProcessingModule/PowerDopplerActor.hpp"
+#include "ProcessingModule/ProcessingFarmActor.hpp"
+#include "ProcessingModule/SpatialFilterActor.hpp"
 
 #include "CAF/CustomActorIdentifier.hpp"
+#include "Probe/Probe.hpp"
+#include "Recorder/MessageRecorder.hpp"
+
+MEDPROBE_SEMAPHORE(workflow_transition);
 
 namespace workflow
 {
 
-workflow_actor_state::workflow_actor_state(workflow_actor::pointer_view self,
-                                           WorkflowType initialType)
-    : _self(self), _currentWorkflow(WorkflowFactory::createWorkflow(initialType))
+workflow_actor_state::workflow_actor_state(
+    workflow_actor::pointer_view self,
+    WorkflowType initialType,
+    acq_module::SimulatorConfig simulatorConfig,
+    acq_module::AcquisitionConfig acquisitionConfig,
+    processing::ProcessingConfig processingConfig)
+    : _self(self),
+      _currentWorkflow(WorkflowFactory::createWorkflow(initialType)),
+      _simulatorConfig(std::move(simulatorConfig)),
+      _acquisitionConfig(std::move(acquisitionConfig)),
+      _processingConfig(std::move(processingConfig))
 {
 }
 
@@ -35,30 +60,161 @@ workflow_actor_state::workflow_actor_state(workflow_actor::pointer_view self,
 workflow_actor::behavior_type workflow_actor_state::make_behavior()
 {
 	return {
-	    [this](caf::get_atom) { return _currentWorkflow->getType(); },
+	    [this](caf::get_atom)
+	    {
+		    recorder::capture(common_caf::custom_workflow_manager_actor_id,
+		                      _self->current_sender(), caf::get_atom_v);
+		    return _currentWorkflow->getType();
+	    },
 	    [this](init_workflow)
 	    {
+		    recorder::capture(common_caf::custom_workflow_manager_actor_id,
+		                      _self->current_sender(), init_workflow_v);
+
 		    // Execute whatever the worklow manager needs to perform here (update the
 		    // state, initialise objects, log etc)
 		    _currentWorkflow->execute();
+		    MEDPROBE(workflow_transition, std::to_underlying(_currentWorkflow->getType()),
+		             medprobe::timestamp());
 
-		    // Spawn acquisition module actor.
-		    auto acquisitionModuleActorHandle =
-		        _self->spawn(acq_module::acquisition_actor_behavior);
-
-		    // Retrieve the actor that should receive the result of the acquisition. Here
-		    // the domain model for storage and the echo viewer for display.
 		    caf::actor_registry& registry = _self->system().registry();
 
-		    std::vector<caf::actor> destActors{
-		        registry.get<caf::actor>(common_caf::custom_echo_viewer_actor_id),
-		        registry.get<caf::actor>(common_caf::custom_domain_model_actor_id)};
+		    // The acquisition session is spawned once and reused by the next workflows.
+		    // Linked: it ends with the workflow manager.
+		    if (!_acquisition)
+		    {
+			    _acquisition = _self->spawn<caf::linked>(
+			        caf::actor_from_state<acq_module::acquisition_session_state>,
+			        _simulatorConfig, _acquisitionConfig);
+
+			    // Registered so that the acquisition can be recorded and replayed like
+			    // the other actors of the session
+			    registry.put(common_caf::custom_acquisition_actor_id, _acquisition);
+
+			    // The frames go through the processing farm when it has workers
+			    _frameSource = caf::actor_cast<caf::actor>(_acquisition);
+			    if (_processingConfig.workers > 0)
+			    {
+				    // The RF frames are beamformed, the tables of a sequence are shared
+				    // by the workers and read from the sequences compiled by the session
+				    const processing::ProcessorFactory factory =
+				        [cache = std::make_shared<processing::BeamformerCache>(
+				             _acquisitionConfig.sequence_cache)]
+				    { return std::make_unique<processing::BeamformingProcessor>(cache); };
+				    const auto farm = _self->spawn<caf::linked>(
+				        caf::actor_from_state<processing::processing_farm_state>,
+				        _acquisition, _processingConfig, factory);
+
+				    // The images of the plane waves are compounded per ensemble
+				    _frameSource = caf::actor_cast<caf::actor>(_self->spawn<caf::linked>(
+				        caf::actor_from_state<processing::compounding_state>, farm));
+			    }
+
+			    // Computed from the processed frames: the RF frames are beamformed first
+			    if (_processingConfig.power_doppler.enabled)
+			    {
+				    _powerDoppler = caf::actor_cast<caf::actor>(_self->spawn<caf::linked>(
+				        caf::actor_from_state<processing::power_doppler_state>,
+				        _frameSource, _processingConfig.power_doppler));
+
+				    // The display and the analysis stages take the denoised images,
+				    // filtered for the workflow
+				    _spatialFilter = caf::actor_cast<caf::actor>(
+				        _self->spawn<caf::linked>(
+				            caf::actor_from_state<processing::spatial_filter_state>,
+				            _powerDoppler, _processingConfig.spatial_filters));
 
-		    // Send start acquisition message with acquisition parameters and destinatory
-		    // actors
-		    _self->mail(acq_request_v, int32_t{42}, std::vector<caf::actor>{destActors})
-		        .send(acquisitionModuleActorHandle);
+				    // Baseline of the session
+				    if (_processingConfig.pixel_statistics.enabled)
+				    {
+					    _pixelStatistics = caf::actor_cast<caf::actor>(
+					        _self->spawn<caf::linked>(
+					            caf::actor_from_state<processing::pixel_statistics_state>,
+					            _spatialFilter, _processingConfig.pixel_statistics));
+				    }
+
+				    // Response to the paradigm, whose events the power Doppler stage
+				    // forwards without the Doppler frames
+				    if (_processingConfig.activation_map.enabled)
+				    {
+					    _activationMap = caf::actor_cast<caf::actor>(
+					        _self->spawn<caf::linked>(
+					            caf::actor_from_state<processing::activation_map_state>,
+					            _spatialFilter, _powerDoppler,
+					            _processingConfig.activation_map));
+				    }
+			    }
+		    }
+
+		    // Retrieve the actors that should receive the result of the acquisition. Here
+		    // the domain model for storage and the echo viewer for display, each of them
+		    // on the streams of the workflow only. Storage takes the raw frames from the
+		    // acquisition: it stays lossless when the processing sheds load, and its
+		    // power Doppler images are not denoised.
+		    if (_spatialFilter)
+		    {
+			    _self->mail(caf::update_atom_v, _currentWorkflow->getName())
+			        .send(_spatialFilter);
+		    }
+		    subscribe(_frameSource,
+		              registry.get<caf::actor>(common_caf::custom_echo_viewer_actor_id),
+		              _currentWorkflow->displayedStreams(), true);
+		    subscribe(caf::actor_cast<caf::actor>(_acquisition),
+		              registry.get<caf::actor>(common_caf::custom_domain_model_actor_id),
+		              _currentWorkflow->storedStreams(), false);
+
+		    // Send start acquisition message with acquisition parameters. Sent after the
+		    // subscriptions, which are processed first, through the processing stages if
+		    // any so that they know the sequence. The Doppler stage scales its velocities
+		    // with it.
+		    const acq_module::AcquisitionParameters parameters =
+		        _currentWorkflow->acquisitionParameters();
+		    if (_powerDoppler)
+		    {
+			    _self->mail(acq_start_v, parameters).send(_powerDoppler);
+		    }
+		    if (_pixelStatistics)
+		    {
+			    _self->mail(acq_start_v, parameters).send(_pixelStatistics);
+		    }
+		    if (_activationMap)
+		    {
+			    _self->mail(acq_start_v, parameters).send(_activationMap);
+		    }
+		    _self->mail(acq_start_v, parameters).send(_frameSource);
 	    }};
 };
 
+// --------------------------------------------------------------------
+
+void workflow_actor_state::subscribe(const caf::actor& source,
+                                     const caf::actor& consumer,
+                                     const std::vector<frame::FrameStream>& streams,
+                                     bool denoised)
+{
+	for (const frame::FrameStream stream : frame::frame_streams)
+	{
+		const bool doppler = stream == frame::FrameStream::PowerDoppler ||
+		                     stream == frame::FrameStream::ColorDoppler;
+		const bool filtered = denoised && stream == frame::FrameStream::PowerDoppler;
+		const caf::actor& streamSource =
+		    stream == frame::FrameStream::Activation
+		        ? _activationMap
+		        : (filtered ? _spatialFilter : (doppler ? _powerDoppler : source));
+		if (!streamSource)
+		{
+			continue;
+		}
+
+		if (std::ranges::find(streams, stream) != streams.end())
+		{
+			_self->mail(acq_subscribe_v, stream, consumer).send(streamSource);
+		}
+		else
+		{
+			_self->mail(acq_unsubscribe_v, stream, consumer).send(streamSource);
+		}
+	}
+}
+
 }  // namespace workflow
@@ -28,4 +28,24 @@ WorkflowType WorkflowNeonate::getType() const
 	return WorkflowType::Neonate;
 }
 
+// --------------------------------------------------------------------
+
+acq_module::AcquisitionParameters WorkflowNeonate::acquisitionParameters() const
+{
+	// Through the fontanel: fewer and wider angles, over the depth of the probe
+	acq_module::AcquisitionParameters parameters;
+	parameters.angle_count = 7;
+	parameters.max_angle = 12.0f;
+	return parameters;
+}
+
+// --------------------------------------------------------------------
+
+std::vector<frame::FrameStream> WorkflowNeonate::displayedStreams() const
+{
+	// Brain anatomy through the fontanel, under the Doppler image of the flow
+	return {frame::FrameStream::BMode, frame::FrameStream::Doppler,
+	        frame::FrameStream::PowerDoppler};
+}
+
 }  // namespace workflow
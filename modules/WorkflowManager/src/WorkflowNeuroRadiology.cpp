@@ -28,4 +28,22 @@ WorkflowType WorkflowNeuroRadiology::getType() const
 	return WorkflowType::NeuroRadiology;
 }
 
+// --------------------------------------------------------------------
+
+std::vector<frame::FrameStream> WorkflowNeuroRadiology::displayedStreams() const
+{
+	// The axial velocities tell the arteries from the veins, the activation maps the
+	// regions responding to the paradigm of a functional study
+	return {frame::FrameStream::Doppler, frame::FrameStream::PowerDoppler,
+	        frame::FrameStream::ColorDoppler, frame::FrameStream::Activation};
+}
+
+// --------------------------------------------------------------------
+
+std::vector<frame::FrameStream> WorkflowNeuroRadiology::storedStreams() const
+{
+	return {frame::FrameStream::Doppler, frame::FrameStream::PowerDoppler,
+	        frame::FrameStream::ColorDoppler};
+}
+
 }  // namespace workflow
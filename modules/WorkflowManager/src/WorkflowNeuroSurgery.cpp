@@ -28,4 +28,22 @@ WorkflowType WorkflowNeuroSurgery::getType() const
 	return WorkflowType::NeuroSurgery;
 }
 
+// --------------------------------------------------------------------
+
+std::vector<frame::FrameStream> WorkflowNeuroSurgery::displayedStreams() const
+{
+	// The surgeon locates the vessels on the B-mode anatomy, and their flow direction on
+	// the color Doppler
+	return {frame::FrameStream::BMode, frame::FrameStream::Doppler,
+	        frame::FrameStream::PowerDoppler, frame::FrameStream::ColorDoppler};
+}
+
+// --------------------------------------------------------------------
+
+std::vector<frame::FrameStream> WorkflowNeuroSurgery::storedStreams() const
+{
+	return {frame::FrameStream::Doppler, frame::FrameStream::PowerDoppler,
+	        frame::FrameStream::ColorDoppler};
+}
+
 }  // namespace workflow
@@ -3,8 +3,12 @@ target("workflow_manager")
     add_files("src/*.cpp")
     add_includedirs("include", {public = true})
     add_deps("acquisition_module")
+    add_deps("processing_module")
     add_deps("common_caf")
+    add_deps("common_frame")
     add_deps("common_logger")
+    add_deps("common_recorder")
+    add_deps("common_probe")
 
     -- To indicate at runtime that its shared library dependencies shall be searched at the same directory (this is temporary)
     add_rpathdirs("$ORIGIN") 
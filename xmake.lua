@@ -10,10 +10,16 @@ set_warnings("everything", "error") -- Treat all compilation warnings as errors
 includes("SessionManager")
 includes("modules/WorkflowManager")
 includes("modules/AcquisitionModule")
+includes("modules/ProcessingModule")
 includes("modules/EchoViewModel")
 includes("modules/DomainModel")
 includes("modules/Common/CAF")
 includes("modules/Common/Logger")
+includes("modules/Common/Scheduler")
+includes("modules/Common/Simd")
+includes("modules/Common/Recorder")
+includes("modules/Common/Probe")
+includes("modules/Common/Frame")
 
 -- Option to add the caf configuration file with "xmake run".
 -- Override default value with the command "xmake config --caf-config-file=path/to/file"